@@ -100,6 +100,7 @@ private:
   unsigned short nFFD_Iter;       /*!< \brief Iteration for the point inversion problem. */
   unsigned short FFD_Blending;    /*!< \brief Kind of FFD Blending function. */
   su2double FFD_Tol;              /*!< \brief Tolerance in the point inversion problem. */
+  string FFD_InversionCache;       /*!< \brief Prefix of the files that cache the result of the point inversion problem. */
   bool FFD_IntPrev;                       /*!< \brief Enables self-intersection prevention procedure within the FFD box. */
   unsigned short FFD_IntPrev_MaxIter;     /*!< \brief Amount of iterations for FFD box self-intersection prevention procedure. */
   unsigned short FFD_IntPrev_MaxDepth;    /*!< \brief Maximum recursion depth for FFD box self-intersection procedure. */
@@ -406,6 +407,11 @@ private:
   unsigned long TimeIter;           /*!< \brief Current time iterations for multizone problems. */
   long Unst_AdjointIter;            /*!< \brief Iteration number to begin the reverse time integration in the direct solver for the unsteady adjoint. */
   long Iter_Avg_Objective;          /*!< \brief Iteration the number of time steps to be averaged, counting from the back */
+  UNST_ADJ_PRIMAL Kind_Unst_Adj_Primal;  /*!< \brief Source of the primal trajectory for the unsteady adjoint. */
+  unsigned long Unst_Adj_nCheckpoints;   /*!< \brief Number of checkpoints for the unsteady adjoint primal trajectory. */
+  unsigned short Unst_Adj_StoreWindow;   /*!< \brief Number of recent primal states kept in memory for the unsteady adjoint. */
+  PRIMAL_STORE_COMPRESSION Kind_Primal_Store_Compression; /*!< \brief Compression of the in-memory primal states. */
+  unsigned long Unst_Adj_TapeReplay;     /*!< \brief Number of time steps for which the unsteady adjoint replays a recording. */
   su2double PhysicalTime;           /*!< \brief Physical time at the current iteration in the solver for unsteady problems. */
 
   unsigned short nLevels_TimeAccurateLTS;   /*!< \brief Number of time levels for time accurate local time stepping. */
@@ -419,6 +425,7 @@ private:
 
   unsigned short nQuasiNewtonSamples;  /*!< \brief Number of samples used in quasi-Newton solution methods. */
   bool UseVectorization;       /*!< \brief Whether to use vectorized numerics schemes. */
+  bool EdgeFluxExtFunc;        /*!< \brief Whether to record the vectorized fluxes as external functions (discrete adjoint). */
   bool NewtonKrylov;           /*!< \brief Use a coupled Newton method to solve the flow equations. */
   array<unsigned short,3> NK_IntParam{{20, 3, 2}}; /*!< \brief Integer parameters for NK method. */
   array<su2double,4> NK_DblParam{{-2.0, 0.1, -3.0, 1e-4}}; /*!< \brief Floating-point parameters for NK method. */
@@ -583,6 +590,8 @@ private:
 
   bool AD_Mode;             /*!< \brief Algorithmic Differentiation support. */
   bool AD_Preaccumulation;  /*!< \brief Enable or disable preaccumulation in the AD mode. */
+  TAPE_STORAGE Kind_AD_TapeStorage;  /*!< \brief Where the idle chunks of the AD tape are kept. */
+  string AD_TapeScratchDir;          /*!< \brief Directory of the scratch files of the AD tape. */
   STRUCT_COMPRESS Kind_Material_Compress;  /*!< \brief Determines if the material is compressible or incompressible (structural analysis). */
   STRUCT_MODEL Kind_Material;              /*!< \brief Determines the material model to be used (structural analysis). */
   STRUCT_DEFORMATION Kind_Struct_Solver;   /*!< \brief Determines the geometric condition (small or large deformations) for structural analysis. */
@@ -690,7 +699,9 @@ private:
   Wrt_Restart_Overwrite,              /*!< \brief Overwrite restart files or append iteration number.*/
   Wrt_Surface_Overwrite,              /*!< \brief Overwrite surface output files or append iteration number.*/
   Wrt_Volume_Overwrite,               /*!< \brief Overwrite volume output files or append iteration number.*/
+  Wrt_Async,                          /*!< \brief Write restart and Paraview files on a background thread.*/
   Restart_Flow;                       /*!< \brief Restart flow solution for adjoint and linearized problems. */
+  unsigned long Wrt_Async_MaxPending; /*!< \brief Maximum number of output snapshots waiting to be written.*/
   unsigned short nMarker_Monitoring,  /*!< \brief Number of markers to monitor. */
   nMarker_Designing,                  /*!< \brief Number of markers for the objective function. */
   nMarker_GeoEval,                    /*!< \brief Number of markers for the objective function. */
@@ -763,6 +774,8 @@ private:
   unsigned short Geo_Description;     /*!< \brief Description of the geometry. */
   unsigned short Mesh_FileFormat;     /*!< \brief Mesh input format. */
   TAB_OUTPUT Tab_FileFormat;          /*!< \brief Format of the output files. */
+  HISTORY_FORMAT History_FileFormat;  /*!< \brief Format of the history file. */
+  unsigned long History_Flush_Iter;   /*!< \brief Number of history lines between flushes of the history file. */
   unsigned short output_precision;    /*!< \brief <ofstream>.precision(value) for SU2_DOT and HISTORY output */
   unsigned short ActDisk_Jump;        /*!< \brief Format of the output files. */
   unsigned long StartWindowIteration; /*!< \brief Starting Iteration for long time Windowing apporach . */
@@ -1019,6 +1032,7 @@ private:
   su2double RadialBasisFunction_Parameter;   /*!< \brief Radial basis function parameter (radius). */
   su2double RadialBasisFunction_PruneTol;    /*!< \brief Tolerance to prune the RBF interpolation matrix. */
   bool Prestretch;                           /*!< \brief Read a reference geometry for optimization purposes. */
+  bool Cache_RefGradients;                   /*!< \brief Store the reference gradients of the structural elements. */
   string Prestretch_FEMFileName;             /*!< \brief File name for reference geometry. */
   string FEA_FileName;              /*!< \brief File name for element-based properties. */
   bool FEAAdvancedMode;             /*!< \brief Determine if advanced features are used from the element-based FEA analysis (experimental). */
@@ -1125,6 +1139,8 @@ private:
   unsigned short sizeMatMulPadding;          /*!< \brief The matrix size in the vectorization direction padded to a multiple of 8. Computed from byteAlignmentMatMul. */
   bool Compute_Entropy;                      /*!< \brief Whether or not to compute the entropy in the fluid model. */
   bool Use_Lumped_MassMatrix_DGFEM;          /*!< \brief Whether or not to use the lumped mass matrix for DGFEM. */
+  bool Sum_Factorization_DGFEM;              /*!< \brief Whether or not to use sum factorization for the volume integrals of tensor product DGFEM elements. */
+  unsigned short Implicit_Precond_Freq_DGFEM; /*!< \brief Number of implicit DGFEM iterations between updates of the block Jacobi preconditioner. */
   bool Jacobian_Spatial_Discretization_Only; /*!< \brief Flag to know if only the exact Jacobian of the spatial discretization must be computed. */
   bool Compute_Average;                      /*!< \brief Whether or not to compute averages for unsteady simulations in FV or DG solver. */
   unsigned short Comm_Level;                 /*!< \brief Level of MPI communications to be performed. */
@@ -1145,6 +1161,13 @@ private:
   unsigned short nVolumeOutputFiles=0;/*!< \brief Number of File formats to output */
   unsigned short nVolumeOutputFrequencies; /*!< \brief Number of frequencies for the volume outputs */
   unsigned long *VolumeOutputFrequencies; /*!< \brief list containing the writing frequencies */
+  OUTPUT_COMPRESSION Kind_Output_Compression; /*!< \brief Compression of the Paraview XML files. */
+  string *OutputQuantizedFields;      /*!< \brief Fields quantized (lossy) in the Paraview XML files. */
+  unsigned short nOutputQuantizedFields; /*!< \brief Number of quantized fields. */
+  unsigned short OutputQuantizationBits; /*!< \brief Mantissa bits kept for the quantized fields. */
+  unsigned short nVolumeOutputBox;       /*!< \brief Number of bounds of the volume output box. */
+  su2double *VolumeOutputBox;            /*!< \brief Bounds (min, max per direction) of the volume output box. */
+  unsigned long VolumeAvgStartIter;      /*!< \brief Time iteration at which the volume output fields start to be averaged. */
 
   bool Multizone_Mesh;            /*!< \brief Determines if the mesh contains multiple zones. */
   bool SinglezoneDriver;          /*!< \brief Determines if the single-zone driver is used. (TEMPORARY) */
@@ -1172,6 +1195,8 @@ private:
   string caseName;                 /*!< \brief Name of the current case */
 
   unsigned long edgeColorGroupSize; /*!< \brief Size of the edge groups colored for OpenMP parallelization of edge loops. */
+  PROFILING_MODE Kind_Profiling;    /*!< \brief Kind of run-time profiling of the solver phases. */
+  bool Profiling_Counters;          /*!< \brief Read the hardware counters in the profiled regions. */
 
   INLET_SPANWISE_INTERP Kind_InletInterpolationFunction; /*!brief type of spanwise interpolation function to use for the inlet face. */
   INLET_INTERP_TYPE Kind_Inlet_InterpolationType;    /*!brief type of spanwise interpolation data to use for the inlet face. */
@@ -2206,6 +2231,12 @@ public:
    */
   bool GetPrestretch(void) const { return Prestretch; }
 
+  /*!
+   * \brief Decide whether the reference gradients of the structural elements are stored.
+   * \return <code>TRUE</code> if they are computed once and stored, <code>FALSE</code> otherwise.
+   */
+  bool GetCache_RefGradients(void) const { return Cache_RefGradients; }
+
   /*!
    * \brief Get the name of the file with the element properties for structural problems.
    * \return Name of the file with the element properties of the structural problem.
@@ -3070,6 +3101,32 @@ public:
    */
   unsigned long GetIter_Avg_Objective(void) const { return Iter_Avg_Objective ; }
 
+  /*!
+   * \brief Get where the unsteady adjoint obtains the primal trajectory from.
+   */
+  UNST_ADJ_PRIMAL GetKind_Unst_Adj_Primal(void) const { return Kind_Unst_Adj_Primal; }
+
+  /*!
+   * \brief Get the number of binomial checkpoints of the unsteady adjoint primal trajectory.
+   */
+  unsigned long GetUnst_Adj_nCheckpoints(void) const { return Unst_Adj_nCheckpoints; }
+
+  /*!
+   * \brief Get the number of recently used primal states kept in memory by the unsteady adjoint.
+   */
+  unsigned short GetUnst_Adj_StoreWindow(void) const { return Unst_Adj_StoreWindow; }
+
+  /*!
+   * \brief Get the compression applied to the primal states kept in memory.
+   */
+  PRIMAL_STORE_COMPRESSION GetKind_Primal_Store_Compression(void) const { return Kind_Primal_Store_Compression; }
+
+  /*!
+   * \brief Get the number of time steps for which the unsteady adjoint uses a recording (replayed with the
+   *        primal inputs of each time step) before recording again, 0 means the tape is recorded every time step.
+   */
+  unsigned long GetUnst_Adj_TapeReplay(void) const { return Unst_Adj_TapeReplay; }
+
   /*!
    * \brief Retrieves the number of periodic time instances for Harmonic Balance.
    * \return Number of periodic time instances for Harmonic Balance.
@@ -4143,6 +4200,11 @@ public:
    */
   bool GetUseVectorization(void) const { return UseVectorization; }
 
+  /*!
+   * \brief Get whether to record the vectorized edge fluxes as hand-differentiated external functions.
+   */
+  bool GetEdgeFluxExtFunc(void) const { return EdgeFluxExtFunc; }
+
   /*!
    * \brief Get whether to use a Newton-Krylov method.
    */
@@ -5327,6 +5389,18 @@ public:
    */
   bool GetWrt_Volume_Overwrite(void) const { return Wrt_Volume_Overwrite; }
 
+  /*!
+   * \brief Flag for whether the restart and Paraview files are written asynchronously.
+   * \return <code>TRUE</code> if the files are written by a background thread while the solver continues.
+   */
+  bool GetWrt_Async(void) const { return Wrt_Async; }
+
+  /*!
+   * \brief Get the maximum number of output snapshots that may be waiting to be written.
+   * \return Number of snapshots, the solver waits for the background writer when it is reached.
+   */
+  unsigned long GetWrt_Async_MaxPending(void) const { return Wrt_Async_MaxPending; }
+
   /*!
    * \brief Provides the number of varaibles.
    * \return Number of variables.
@@ -5435,6 +5509,18 @@ public:
    */
   TAB_OUTPUT GetTabular_FileFormat(void) const { return Tab_FileFormat; }
 
+  /*!
+   * \brief Get the format of the history file.
+   * \return TABULAR to use the tabular format, or BINARY.
+   */
+  HISTORY_FORMAT GetHistory_FileFormat(void) const { return History_FileFormat; }
+
+  /*!
+   * \brief Get the number of history lines that are buffered before the history file is flushed.
+   * \return Number of lines.
+   */
+  unsigned long GetHistory_Flush_Iter(void) const { return History_Flush_Iter; }
+
   /*!
    * \brief Get the output precision to be used in <ofstream>.precision(value) for history and SU2_DOT output.
    * \return Output precision.
@@ -5598,6 +5684,13 @@ public:
    */
   string GetObjFunc_Extension(string val_filename) const;
 
+  /*!
+   * \brief Get the filename suffix of one objective function (e.g. "_cd").
+   * \param[in] val_obj - Index of the objective function.
+   * \return Suffix that identifies the objective function.
+   */
+  string GetObjFunc_Suffix(unsigned short val_obj) const;
+
   /*!
    * \brief Get functional that is going to be used to evaluate the residual flow convergence.
    * \return Functional that is going to be used to evaluate the residual flow convergence.
@@ -8422,6 +8515,12 @@ public:
    */
   su2double GetFFD_Tol(void) const { return FFD_Tol; }
 
+  /*!
+   * \brief Get the prefix of the files that cache the parametric coordinates of the FFD point inversion.
+   * \return File prefix, empty if the cache is not used.
+   */
+  const string& GetFFD_InversionCache(void) const { return FFD_InversionCache; }
+
   /*!
    * \brief Get information about whether to do a check on self-intersections within
       the FFD box based on value on the Jacobian determinant.
@@ -9013,6 +9112,20 @@ public:
    */
   bool GetUse_Lumped_MassMatrix_DGFEM(void) const { return Use_Lumped_MassMatrix_DGFEM; }
 
+  /*!
+   * \brief Function to make available whether or not sum factorization must be
+            used for the volume integrals of quadrilaterals and hexahedra.
+   * \return The boolean whether or not to use sum factorization.
+   */
+  bool GetSum_Factorization_DGFEM(void) const { return Sum_Factorization_DGFEM; }
+
+  /*!
+   * \brief Function to make available the number of implicit DGFEM iterations
+            after which the element block Jacobi preconditioner is recomputed.
+   * \return The update frequency of the preconditioner.
+   */
+  unsigned short GetImplicit_Precond_Freq_DGFEM(void) const { return Implicit_Precond_Freq_DGFEM; }
+
   /*!
    * \brief Function to make available whether or not only the exact Jacobian
    *        of the spatial discretization must be computed.
@@ -9152,6 +9265,16 @@ public:
    */
   bool GetAD_Preaccumulation(void) const { return AD_Preaccumulation;}
 
+  /*!
+   * \brief Get where the idle chunks of the AD tape are kept.
+   */
+  TAPE_STORAGE GetKind_AD_TapeStorage(void) const { return Kind_AD_TapeStorage; }
+
+  /*!
+   * \brief Get the directory of the scratch files of the AD tape.
+   */
+  const string& GetAD_TapeScratchDir(void) const { return AD_TapeScratchDir; }
+
   /*!
    * \brief Get the heat equation.
    * \return YES if weakly coupled heat equation for inc. flow is enabled.
@@ -9541,6 +9664,38 @@ public:
    */
   unsigned long GetVolumeOutputFrequency(unsigned short iFile) const { return VolumeOutputFrequencies[iFile]; }
 
+  /*!
+   * \brief Get the compression of the binary data of the Paraview XML files.
+   */
+  OUTPUT_COMPRESSION GetKind_Output_Compression() const { return Kind_Output_Compression; }
+
+  /*!
+   * \brief Get the names of the fields that are quantized in the Paraview XML files.
+   */
+  vector<string> GetOutput_QuantizedFields() const {
+    return vector<string>(OutputQuantizedFields, OutputQuantizedFields + nOutputQuantizedFields);
+  }
+
+  /*!
+   * \brief Get the number of mantissa bits kept for the quantized fields.
+   */
+  unsigned short GetOutput_QuantizationBits() const { return OutputQuantizationBits; }
+
+  /*!
+   * \brief Check if the visualization volume output is restricted to a box.
+   */
+  bool GetVolumeOutput_Box() const { return nVolumeOutputBox != 0; }
+
+  /*!
+   * \brief Get the bounds of the volume output box (xmin, xmax, ymin, ymax[, zmin, zmax]).
+   */
+  const su2double* GetVolumeOutput_BoxBounds() const { return VolumeOutputBox; }
+
+  /*!
+   * \brief Get the time iteration at which the time averaging of volume output fields starts.
+   */
+  unsigned long GetVolumeAvg_StartIter() const { return VolumeAvgStartIter; }
+
   /*!
    * \brief Get the desired factorization frequency for PaStiX
    * \return Number of calls to 'Build' that trigger re-factorization.
@@ -9583,6 +9738,16 @@ public:
    */
   unsigned long GetEdgeColoringGroupSize(void) const { return edgeColorGroupSize; }
 
+  /*!
+   * \brief Get the kind of run-time profiling of the solver phases.
+   */
+  PROFILING_MODE GetKind_Profiling(void) const { return Kind_Profiling; }
+
+  /*!
+   * \brief Get whether the hardware counters are read in the profiled regions.
+   */
+  bool GetProfiling_Counters(void) const { return Profiling_Counters; }
+
   /*!
    * \brief Get the ParMETIS load balancing tolerance.
    */
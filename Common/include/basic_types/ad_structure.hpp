@@ -27,6 +27,8 @@
 
 #pragma once
 
+#include <memory>
+#include <vector>
 #include "../code_config.hpp"
 #include "../parallelization/omp_structure.hpp"
 
@@ -289,6 +291,63 @@ namespace AD{
    */
   inline void EndNoSharedReading() {}
 
+  /*!
+   * \brief Number of adjoint directions propagated by one evaluation of the tape (CoDiPack vector mode).
+   */
+  constexpr unsigned short nDirections = 1;
+
+  /*!
+   * \brief Select the adjoint direction accessed by the Get/SetDerivative functions.
+   * \param[in] iDir - Index of the direction, smaller than nDirections.
+   */
+  inline void SetDirection(unsigned short iDir) {}
+
+  /*!
+   * \brief Get the adjoint direction accessed by the Get/SetDerivative functions.
+   */
+  inline unsigned short GetDirection() {return 0;}
+
+  /*!
+   * \brief True if the tape stores primal values and can therefore be replayed with new inputs.
+   */
+  constexpr bool PrimalTape = false;
+
+  /*!
+   * \brief Keep track of the identifiers of the inputs and outputs of the following recordings,
+   *        which is needed to replay them later (see BeginReplay).
+   */
+  inline void SetTapeTracking(bool track) {}
+
+  /*!
+   * \brief Make one of the tape slots the active (global) tape, the previously active tape is kept in its slot.
+   * \note This allows keeping several recordings (e.g. main and secondary) to be replayed.
+   * \param[in] slot - Index of the slot, smaller than nTapeSlots.
+   */
+  inline void SetTapeSlot(unsigned short slot) {}
+
+  /*!
+   * \brief Start replaying the active tape. The inputs registered next get the identifiers of the recording and pass
+   *        their current values to the tape, they must be registered by the same code and in the same order as in
+   *        the recording, the addresses of the variables are not stored.
+   * \return False if the tape cannot be replayed (no primal value tape, or external functions without a primal
+   *         function were recorded), then it must be recorded again.
+   */
+  inline bool BeginReplay() { return false; }
+
+  /*!
+   * \brief Re-evaluate the primal values of the active tape with the values of its inputs (see BeginReplay).
+   *        The outputs registered next get their new values and the identifiers of the recording, after which
+   *        the tape can be used as if it had just been recorded.
+   * \note Only valid if the control flow of the recording does not depend on the new inputs.
+   */
+  inline void ReplayTape() {}
+
+  /*!
+   * \brief Finish a replay of the active tape.
+   * \return False if the inputs or outputs that were registered do not match those of the recording.
+   */
+  inline bool EndReplay() { return true; }
+
 #else
   using CheckpointHandler = codi::DataStore;
 
@@ -305,6 +364,49 @@ namespace AD{
 
   extern bool PreaccEnabled;
 
+#ifdef CODI_VECTOR_DIM
+  constexpr unsigned short nDirections = CODI_VECTOR_DIM;
+#else
+  constexpr unsigned short nDirections = 1;
+#endif
+
+  extern unsigned short ActiveDirection;
+
+#ifdef CODI_PRIMAL_TAPE
+  constexpr bool PrimalTape = true;
+#else
+  constexpr bool PrimalTape = false;
+#endif
+
+  constexpr unsigned short nTapeSlots = 2;
+
+  /*!
+   * \brief A tape slot, the tape (when it is not the active one) and what is needed to replay it.
+   * \note Only the identifiers of the inputs and outputs are kept, in the order of their registration.
+   */
+  struct TapeRecord {
+    std::unique_ptr<su2double::TapeType> tape;
+    std::vector<su2double::Identifier> inputs, outputs;
+    bool replayable = true;   /*!< \brief False if an external function without primal function was recorded. */
+  };
+
+  /*!
+   * \brief Stage of the replay of the active tape, the registered inputs or outputs are matched with those of the recording.
+   */
+  enum class ReplayStage {NONE, INPUTS, OUTPUTS};
+
+  extern bool TrackRecording;
+
+  extern ReplayStage Replaying;
+
+  extern size_t ReplayCursor;
+
+  extern bool ReplayMismatch;
+
+  extern unsigned short ActiveSlot;
+
+  extern TapeRecord TapeSlots[nTapeSlots];
+
 #ifdef HAVE_OPDI
   using CoDiTapePosition = su2double::TapeType::Position;
   using OpDiState = void*;
@@ -326,9 +428,45 @@ namespace AD{
 
   FORCEINLINE su2double::TapeType& getGlobalTape() {return su2double::getGlobalTape();}
 
-  FORCEINLINE void RegisterInput(su2double &data) {AD::getGlobalTape().registerInput(data);}
+  /*--- Registration during a replay, the next identifier of the recording is given to the variable. ---*/
 
-  FORCEINLINE void RegisterOutput(su2double& data) {AD::getGlobalTape().registerOutput(data);}
+  inline void ReplayInput(su2double& data) {
+#ifdef CODI_PRIMAL_TAPE
+    const auto& inputs = TapeSlots[ActiveSlot].inputs;
+    if (Replaying != ReplayStage::INPUTS || ReplayCursor >= inputs.size()) {
+      ReplayMismatch = true;
+      return;
+    }
+    const auto id = inputs[ReplayCursor++];
+    AD::getGlobalTape().primal(id) = data.getValue();
+    data.getIdentifier() = id;
+#endif
+  }
+
+  inline void ReplayOutput(su2double& data) {
+#ifdef CODI_PRIMAL_TAPE
+    const auto& outputs = TapeSlots[ActiveSlot].outputs;
+    if (Replaying != ReplayStage::OUTPUTS || ReplayCursor >= outputs.size()) {
+      ReplayMismatch = true;
+      return;
+    }
+    const auto id = outputs[ReplayCursor++];
+    data.value() = AD::getGlobalTape().primal(id);
+    data.getIdentifier() = id;
+#endif
+  }
+
+  FORCEINLINE void RegisterInput(su2double &data) {
+    if (PrimalTape && Replaying != ReplayStage::NONE) return ReplayInput(data);
+    AD::getGlobalTape().registerInput(data);
+    if (PrimalTape && TrackRecording) TapeSlots[ActiveSlot].inputs.push_back(data.getIdentifier());
+  }
+
+  FORCEINLINE void RegisterOutput(su2double& data) {
+    if (PrimalTape && Replaying != ReplayStage::NONE) return ReplayOutput(data);
+    AD::getGlobalTape().registerOutput(data);
+    if (PrimalTape && TrackRecording) TapeSlots[ActiveSlot].outputs.push_back(data.getIdentifier());
+  }
 
   FORCEINLINE void ResetInput(su2double &data) {data = data.getValue();}
 
@@ -363,6 +501,9 @@ namespace AD{
 
   FORCEINLINE void Reset() {
     AD::getGlobalTape().reset();
+    TapeSlots[ActiveSlot].inputs.clear();
+    TapeSlots[ActiveSlot].outputs.clear();
+    TapeSlots[ActiveSlot].replayable = true;
   #if defined(HAVE_OPDI)
     opdi::logic->reset();
   #endif
@@ -380,12 +521,84 @@ namespace AD{
     index = data.getGradientData();
   }
 
+  FORCEINLINE void SetTapeTracking(bool track) {TrackRecording = track;}
+
+  inline void SetTapeSlot(unsigned short slot) {
+    if (slot == ActiveSlot) return;
+
+    /*--- Park the active tape in its slot and bring in the one of the new slot. ---*/
+    auto& parked = TapeSlots[ActiveSlot].tape;
+    auto& next = TapeSlots[slot].tape;
+    if (!parked) parked.reset(new su2double::TapeType);
+    if (!next) next.reset(new su2double::TapeType);
+
+    AD::getGlobalTape().swap(*parked);
+    AD::getGlobalTape().swap(*next);
+    ActiveSlot = slot;
+  }
+
+  inline bool BeginReplay() {
+    if (!PrimalTape || !TapeSlots[ActiveSlot].replayable) return false;
+    Replaying = ReplayStage::INPUTS;
+    ReplayCursor = 0;
+    ReplayMismatch = false;
+    return true;
+  }
+
+  inline void ReplayTape() {
+    if (ReplayCursor != TapeSlots[ActiveSlot].inputs.size()) ReplayMismatch = true;
+#ifdef CODI_PRIMAL_TAPE
+    AD::getGlobalTape().evaluatePrimal();
+#endif
+    Replaying = ReplayStage::OUTPUTS;
+    ReplayCursor = 0;
+  }
+
+  inline bool EndReplay() {
+    if (ReplayCursor != TapeSlots[ActiveSlot].outputs.size()) ReplayMismatch = true;
+    Replaying = ReplayStage::NONE;
+    return !ReplayMismatch;
+  }
+
+  /*!
+   * \brief Add an external function to the tape with its helper, the tape can only be replayed (BeginReplay)
+   *        if the external function has a primal function.
+   */
+  template<class ReverseFunc, class PrimalFunc>
+  FORCEINLINE void AddExtFuncToTape(ExtFuncHelper& helper, ReverseFunc reverse, PrimalFunc primal) {
+    helper.addToTape(reverse, nullptr, primal);
+    if (PrimalTape && primal == nullptr) TapeSlots[ActiveSlot].replayable = false;
+  }
+
+  FORCEINLINE void SetDirection(unsigned short iDir) {ActiveDirection = iDir;}
+
+  FORCEINLINE unsigned short GetDirection() {return ActiveDirection;}
+
+  /*--- Access to the active direction of a gradient, the gradient is a scalar unless
+   *    su2double is a vector type, in which case each direction is one objective. ---*/
+
+#ifdef CODI_VECTOR_DIM
+  FORCEINLINE double& GradientComponent(su2double::Gradient& grad) {return grad[ActiveDirection];}
+
+  FORCEINLINE double GradientComponent(const su2double::Gradient& grad) {return grad[ActiveDirection];}
+#else
+  FORCEINLINE double& GradientComponent(su2double::Gradient& grad) {return grad;}
+
+  FORCEINLINE double GradientComponent(const su2double::Gradient& grad) {return grad;}
+#endif
+
   FORCEINLINE void SetDerivative(int index, const double val) {
+#ifdef CODI_VECTOR_DIM
+    auto grad = AD::getGlobalTape().getGradient(index);
+    GradientComponent(grad) = val;
+    AD::getGlobalTape().setGradient(index, grad);
+#else
     AD::getGlobalTape().setGradient(index, val);
+#endif
   }
 
   FORCEINLINE double GetDerivative(int index) {
-    return AD::getGlobalTape().getGradient(index);
+    return GradientComponent(AD::getGlobalTape().getGradient(index));
   }
 
   /*--- Base case for parameter pack expansion. ---*/
@@ -85,7 +85,27 @@ namespace SU2_TYPE {
 
   /*--- Implementation of the above for the different types. ---*/
 
-#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+#if defined(CODI_REVERSE_TYPE) && defined(CODI_VECTOR_DIM)
+
+  /*--- Vector mode, the derivative functions act on the active direction (see AD::SetDirection). ---*/
+
+  FORCEINLINE void SetValue(su2double& data, const passivedouble &val) {data.setValue(val);}
+
+  FORCEINLINE passivedouble GetValue(const su2double& data) {return data.getValue();}
+
+  FORCEINLINE void SetDerivative(su2double& data, const passivedouble &val) {
+    auto grad = data.getGradient();
+    AD::GradientComponent(grad) = val;
+    data.setGradient(grad);
+  }
+
+  FORCEINLINE void SetSecondary(su2double& data, const passivedouble &val) {SetDerivative(data, val);}
+
+  FORCEINLINE passivedouble GetDerivative(const su2double& data) {return AD::GradientComponent(data.getGradient());}
+
+  FORCEINLINE passivedouble GetSecondary(const su2double& data) {return GetDerivative(data);}
+
+#elif defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
 
   FORCEINLINE void SetValue(su2double& data, const passivedouble &val) {data.setValue(val);}
 
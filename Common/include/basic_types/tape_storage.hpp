@@ -0,0 +1,297 @@
+/*!
+ * \file tape_storage.hpp
+ * \brief Data vector of the CoDiPack Jacobian tapes that stores its idle chunks (AD_TAPE_STORAGE).
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <memory>
+#include <type_traits>
+#include <vector>
+#include "../toolboxes/CTapeChunkStore.hpp"
+
+namespace AD {
+
+/*!
+ * \brief Arrays of a kind of CoDiPack chunk, only chunks of arithmetic data (statements, Jacobians,
+ * indices) are stored, the other chunks (external functions) always stay in memory.
+ */
+template <class Chunk>
+struct ChunkArrays {
+  static constexpr bool storable = false;
+  static constexpr size_t size = 0;
+};
+
+template <class Data>
+struct ChunkArrays<codi::Chunk1<Data> > {
+  static constexpr bool storable = std::is_arithmetic<Data>::value;
+  static constexpr size_t size = 1;
+
+  template <class Vector, class Function>
+  static void apply(Vector& vector, size_t chunk, Function& function) {
+    Data* data;
+    vector.getDataPointer(chunk, 0, data);
+    function(0, data);
+  }
+};
+
+template <class Data1, class Data2>
+struct ChunkArrays<codi::Chunk2<Data1, Data2> > {
+  static constexpr bool storable = std::is_arithmetic<Data1>::value && std::is_arithmetic<Data2>::value;
+  static constexpr size_t size = 2;
+
+  template <class Vector, class Function>
+  static void apply(Vector& vector, size_t chunk, Function& function) {
+    Data1* data1;
+    Data2* data2;
+    vector.getDataPointer(chunk, 0, data1, data2);
+    function(0, data1);
+    function(1, data2);
+  }
+};
+
+/*!
+ * \brief Chunk vector (data vector policy of the CoDiPack tapes) that encodes each chunk when the recording
+ * moves past it, and frees its memory until it is evaluated.
+ * \note The chunks are evaluated one at a time (on each level of the nesting of the tape), so the memory of
+ * the tape is roughly that of the encoded data plus one chunk per level. The encoded data is kept from one
+ * evaluation to the next, it is only written again when the tape is reset and recorded again.
+ * If storage is not enabled (CTapeChunkStore::Defaults) this behaves as codi::ChunkVector.
+ */
+template <class ChunkData, class NestedVector = codi::EmptyChunkVector>
+class StoredChunkVector : public codi::ChunkVector<ChunkData, NestedVector> {
+ public:
+  using Base = codi::ChunkVector<ChunkData, NestedVector>;
+  using Position = typename Base::Position;
+  using Arrays = ChunkArrays<ChunkData>;
+
+ private:
+  /*!
+   * \brief State of a chunk, RESIDENT ones only have their data in memory, ENCODED ones in memory and in the
+   * store, STORED ones only in the store, and FREED chunks have no (valid) data anywhere.
+   */
+  enum class State { RESIDENT, ENCODED, STORED, FREED };
+
+  struct ChunkRecord {
+    State state = State::RESIDENT;
+    size_t capacity = 0;
+    CTapeChunkStore::Block blocks[Arrays::size == 0 ? 1 : Arrays::size];
+  };
+
+  std::unique_ptr<CTapeChunkStore> store;
+  std::vector<ChunkRecord> records;
+
+  /*--- Functions applied to each array of a chunk. ---*/
+
+  struct Encoder {
+    CTapeChunkStore& store;
+    ChunkRecord& record;
+    size_t count;
+    template <class T>
+    void operator()(size_t i, T* data) { store.Store(data, count, record.blocks[i]); }
+  };
+
+  struct Decoder {
+    const CTapeChunkStore& store;
+    ChunkRecord& record;
+    template <class T>
+    void operator()(size_t i, T* data) { store.Load(record.blocks[i], data); }
+  };
+
+  static bool Enabled() { return Arrays::storable && CTapeChunkStore::Defaults().enabled; }
+
+  ChunkRecord& Record(size_t chunk) {
+    if (records.size() < this->getNumChunks()) records.resize(this->getNumChunks());
+    return records[chunk];
+  }
+
+  void ReleaseBlocks(ChunkRecord& record) {
+    for (auto& block : record.blocks) store->Release(block);
+  }
+
+  /*!
+   * \brief Encode a chunk the recording has moved past and free its memory.
+   */
+  void Evict(size_t chunk) {
+    if (!store) {
+      const auto& settings = CTapeChunkStore::Defaults();
+      store.reset(new CTapeChunkStore(settings.toFile, settings.scratchDir));
+    }
+    auto& record = Record(chunk);
+    auto& data = this->getChunk(chunk);
+    if (record.state == State::RESIDENT) {
+      Encoder encoder{*store, record, data.getUsedSize()};
+      Arrays::apply(*this, chunk, encoder);
+      record.state = State::ENCODED;
+    }
+    if (record.state == State::ENCODED) {
+      record.capacity = data.getUsedSize() + data.getUnusedSize();
+      data.resize(0);
+      record.state = State::STORED;
+    }
+  }
+
+  /*!
+   * \brief Bring the data of a chunk back into memory.
+   */
+  void Restore(size_t chunk) {
+    auto& record = Record(chunk);
+    if (record.state == State::STORED || record.state == State::FREED) {
+      this->getChunk(chunk).resize(record.capacity);
+    }
+    if (record.state == State::STORED) {
+      Decoder decoder{*store, record};
+      Arrays::apply(*this, chunk, decoder);
+      record.state = State::ENCODED;
+    } else if (record.state == State::FREED) {
+      record.state = State::RESIDENT;
+    }
+  }
+
+  /*!
+   * \brief Free the memory of an encoded chunk after it was evaluated, unless it is being recorded.
+   */
+  void Release(size_t chunk) {
+    if (Record(chunk).state == State::ENCODED && chunk != this->getPosition().chunk) Evict(chunk);
+  }
+
+  /*!
+   * \brief Mark the chunks from "first" onwards as overwritten, their encoded data is no longer valid.
+   */
+  void Invalidate(size_t first) {
+    for (auto chunk = first; chunk < records.size(); ++chunk) {
+      auto& record = records[chunk];
+      if (record.state == State::ENCODED) record.state = State::RESIDENT;
+      if (record.state == State::STORED) record.state = State::FREED;
+      ReleaseBlocks(record);
+    }
+  }
+
+ public:
+  using Base::Base;
+
+  void swap(StoredChunkVector& other) {
+    Base::swap(other);
+    store.swap(other.store);
+    records.swap(other.records);
+  }
+
+  void reserveItems(const size_t items) {
+    if (!Enabled()) {
+      Base::reserveItems(items);
+      return;
+    }
+    const auto previous = this->getPosition().chunk;
+    Base::reserveItems(items);
+    const auto current = this->getPosition().chunk;
+    if (current != previous) {
+      Restore(current);
+      Evict(previous);
+    }
+  }
+
+  void reset(const Position& pos) {
+    if (Enabled() && !records.empty()) {
+      Restore(pos.chunk);
+      Invalidate(pos.chunk);
+    }
+    Base::reset(pos);
+  }
+
+  void reset() {
+    if (Enabled() && !records.empty()) {
+      Invalidate(0);
+      Restore(0);
+      store->Clear();
+    }
+    Base::reset();
+  }
+
+  void resetHard() {
+    if (!records.empty()) {
+      /*--- Only the memory is restored, the data is discarded. ---*/
+      Invalidate(0);
+      for (size_t chunk = 0; chunk < records.size(); ++chunk) Restore(chunk);
+      store->Clear();
+      records.clear();
+    }
+    Base::resetHard();
+  }
+
+  /*--- The evaluations are split at the chunk boundaries, each chunk is restored before it is evaluated. ---*/
+
+  template <class Function, class... Args>
+  void evaluateReverse(const Position& start, const Position& end, const Function& function, Args&&... args) {
+    if (records.empty()) {
+      Base::evaluateReverse(start, end, function, std::forward<Args>(args)...);
+      return;
+    }
+    auto from = start;
+    for (auto chunk = start.chunk; chunk > end.chunk; --chunk) {
+      const auto chunkStart = this->getInnerPosition(chunk);
+      Restore(chunk);
+      Base::evaluateReverse(from, Position(chunk, 0, chunkStart), function, args...);
+      Release(chunk);
+      from = Position(chunk - 1, this->getChunk(chunk - 1).getUsedSize(), chunkStart);
+    }
+    Restore(end.chunk);
+    Base::evaluateReverse(from, end, function, args...);
+    Release(end.chunk);
+  }
+
+  template <class Function, class... Args>
+  void evaluateForward(const Position& start, const Position& end, const Function& function, Args&&... args) {
+    if (records.empty()) {
+      Base::evaluateForward(start, end, function, std::forward<Args>(args)...);
+      return;
+    }
+    auto from = start;
+    for (auto chunk = start.chunk; chunk < end.chunk; ++chunk) {
+      const auto nextStart = this->getInnerPosition(chunk + 1);
+      Restore(chunk);
+      Base::evaluateForward(from, Position(chunk, this->getChunk(chunk).getUsedSize(), nextStart), function, args...);
+      Release(chunk);
+      from = Position(chunk + 1, 0, nextStart);
+    }
+    Restore(end.chunk);
+    Base::evaluateForward(from, end, function, args...);
+    Release(end.chunk);
+  }
+
+  /*--- Iterations over the data (e.g. to delete external functions on reset) see all chunks in memory. ---*/
+
+  template <class Function, class... Args>
+  void forEachReverse(const Position& start, const Position& end, Function& function, Args&&... args) {
+    for (size_t chunk = end.chunk; chunk <= start.chunk && !records.empty(); ++chunk) Restore(chunk);
+    Base::forEachReverse(start, end, function, std::forward<Args>(args)...);
+  }
+
+  template <class Function, class... Args>
+  void forEachForward(const Position& start, const Position& end, Function& function, Args&&... args) {
+    for (size_t chunk = start.chunk; chunk <= end.chunk && !records.empty(); ++chunk) Restore(chunk);
+    Base::forEachForward(start, end, function, std::forward<Args>(args)...);
+  }
+};
+
+}  // namespace AD
@@ -89,13 +89,39 @@ FORCEINLINE Out su2staticcast_p(In ptr) {
 #include "codi.hpp"
 #include "codi/tools/dataStore.hpp"
 
+#if defined(CODI_PRIMAL_TAPE) && (defined(HAVE_OMP) || defined(CODI_VECTOR_DIM))
+#error "The primal value tape (CODI_PRIMAL_TAPE) is not available with OpenMP or the vector mode."
+#endif
+
+#if defined(CODI_TAPE_STORAGE) && (defined(HAVE_OMP) || defined(CODI_VECTOR_DIM) || defined(CODI_PRIMAL_TAPE))
+#error "The tape storage (CODI_TAPE_STORAGE) is only available for the Jacobian tapes without OpenMP or the vector mode."
+#endif
+
 #if defined(HAVE_OMP)
+#if defined(CODI_VECTOR_DIM)
+#error "The vector mode of the discrete adjoint (CODI_VECTOR_DIM) is not available with OpenMP."
+#endif
 using su2double = codi::RealReverseIndexParallel;
+#elif defined(CODI_TAPE_STORAGE) // idle tape chunks are compressed or moved to a scratch file (AD_TAPE_STORAGE)
+#include "basic_types/tape_storage.hpp"
+#if defined(CODI_INDEX_TAPE)
+using su2double = codi::ActiveReal<codi::JacobiIndexTape<codi::JacobiIndexTapeTypes<
+    codi::ReverseTapeTypes<double, double, codi::ReuseIndexHandlerUseCount<int> >, AD::StoredChunkVector> > >;
+#else
+using su2double = codi::ActiveReal<codi::JacobiTape<codi::JacobiTapeTypes<
+    codi::ReverseTapeTypes<double, double, codi::LinearIndexHandler<int> >, AD::StoredChunkVector> > >;
+#endif
 #else
+#if defined(CODI_VECTOR_DIM) // several adjoint directions per tape evaluation
 #if defined(CODI_INDEX_TAPE)
+using su2double = codi::RealReverseIndexVec<CODI_VECTOR_DIM>;
+#else
+using su2double = codi::RealReverseVec<CODI_VECTOR_DIM>;
+#endif
+#elif defined(CODI_INDEX_TAPE)
 using su2double = codi::RealReverseIndex;
-//#elif defined(CODI_PRIMAL_TAPE)
-//using su2double = codi::RealReversePrimal;
+#elif defined(CODI_PRIMAL_TAPE) // primal value tape, can be re-evaluated with new inputs
+using su2double = codi::RealReversePrimal;
 //#elif defined(CODI_PRIMAL_INDEX_TAPE)
 //using su2double = codi::RealReversePrimalIndex;
 #else
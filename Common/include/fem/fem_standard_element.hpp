@@ -814,6 +814,12 @@ private:
                                                       and dtLagBasisIntegration combined for efficiency when using BLAS routines. */
   vector<su2double> matDerBasisIntTrans;  /*!< \brief Matrix of the transpose of the derivative part of matBasisIntegration. It is
                                                       stored such that the volume residual can be computed in one matrix multiplication. */
+  unsigned short nIntegration1D;          /*!< \brief Number of integration points in one direction of a tensor product element. */
+  vector<su2double> lagBasisLineInt;      /*!< \brief 1D Lagrangian basis functions in the 1D integration points. Only stored for
+                                                      quadrilaterals and hexahedra, for which the basis functions and the
+                                                      integration rule are tensor products, such that sum factorization can
+                                                      be used in the volume integrals. */
+  vector<su2double> drLagBasisLineInt;    /*!< \brief Derivatives of the 1D Lagrangian basis functions in the 1D integration points. */
   vector<su2double> matDerBasisSolDOFs;   /*!< \brief Matrix of the derivatives of the Lagrangian basis functions in the solution
                                                       DOFs. Needed to compute the metric terms in the solution DOFs. */
   vector<su2double> matDerBasisOwnDOFs;   /*!< \brief Matrix of the derivatives of the Lagrangian basis functions in the owned
@@ -955,6 +961,54 @@ public:
   */
   inline const su2double* GetDerMatBasisFunctionsIntTrans(void) const {return matDerBasisIntTrans.data();}
 
+  /*!
+  * \brief Function, which indicates whether the sum factorization kernels can be used for this element.
+  * \return True for quadrilaterals and hexahedra, whose basis functions are tensor products.
+  */
+  inline bool TensorProductBasis(void) const {return !lagBasisLineInt.empty();}
+
+  /*!
+  * \brief Function, which determines the size of the work array needed by the sum factorization kernels.
+  * \param[in] NPad - Padded number of columns (element variables) treated simultaneously.
+  * \return The number of entries of the work array.
+  */
+  inline unsigned long SizeWorkTensorProduct(const unsigned short NPad) const {
+    return 3ul*NPad*max(nIntegration, nDOFs);
+  }
+
+  /*!
+  * \brief Function, which computes the solution and, if desired, its parametric gradients in the
+           integration points with sum factorization. The result is identical to the product of
+           matBasisIntegration (only its first nIntegration rows when no gradients are desired)
+           and solDOFs, but the cost scales with (nPoly+1)^(nDim+1) instead of (nPoly+1)^(2*nDim).
+  * \param[in]  NPad          - Padded number of columns of solDOFs and solInt.
+  * \param[in]  computeGrad   - Whether or not the gradients must be computed as well.
+  * \param[in]  solDOFs       - Solution in the DOFs, stored as nDOFs rows of NPad entries.
+  * \param[out] solAndGradInt - Solution and gradients in the integration points.
+  * \param[out] work          - Work array of at least SizeWorkTensorProduct(NPad) entries.
+  */
+  void SolAndGradIntTensorProduct(const unsigned short NPad,
+                                  const bool           computeGrad,
+                                  const su2double      *solDOFs,
+                                  su2double            *solAndGradInt,
+                                  su2double            *work) const;
+
+  /*!
+  * \brief Function, which computes the volume residual with sum factorization. The result is identical
+           to the product of matDerBasisIntTrans and fluxes plus, if present, the product of
+           lagBasisIntegrationTrans and sources.
+  * \param[in]  NPad    - Padded number of columns of fluxes, sources and res.
+  * \param[in]  fluxes  - Fluxes in the integration points, stored as nIntegration*nDim rows of NPad entries.
+  * \param[in]  sources - Source terms in the integration points, nIntegration rows. Not used if nullptr.
+  * \param[out] res     - Residual of the DOFs, stored as nDOFs rows of NPad entries.
+  * \param[out] work    - Work array of at least SizeWorkTensorProduct(NPad) entries.
+  */
+  void ResidualTensorProduct(const unsigned short NPad,
+                             const su2double      *fluxes,
+                             const su2double      *sources,
+                             su2double            *res,
+                             su2double            *work) const;
+
   /*!
   * \brief Function, which makes available the matrix storage of the derivative of the basis functions in the own DOFs.
   * \return  The pointer to matDerBasisOwnDOFs.
@@ -1157,6 +1211,40 @@ private:
                                                       vector<su2double> &lagBasis,
                                                       vector<su2double> &matDerBasis);
   /*!
+  * \brief Function, which creates the 1D data needed for the sum factorization kernels
+           of quadrilaterals and hexahedra.
+  */
+  void DataTensorProduct(void);
+
+  /*!
+  * \brief Function, which applies a 1D matrix in one direction of a tensor of NPad vectors.
+           The rows of the input tensor are numbered q + nBefore*(l + nIn*p) and the rows
+           of the output tensor q + nBefore*(k + nOut*p).
+  * \param[in]  A        - 1D matrix, stored row major as nOut x nIn, or nIn x nOut if trans.
+  * \param[in]  trans    - Whether or not the transpose of A must be applied.
+  * \param[in]  nOut     - Number of entries of the output tensor in the contracted direction.
+  * \param[in]  nIn      - Number of entries of the input tensor in the contracted direction.
+  * \param[in]  nBefore  - Product of the number of entries of the directions before the contracted one.
+  * \param[in]  nAfter   - Product of the number of entries of the directions after the contracted one.
+  * \param[in]  NPad     - Number of entries of a row.
+  * \param[in]  strideIn - Distance between two consecutive rows of the input tensor.
+  * \param[in]  in       - Input tensor.
+  * \param[in]  addToOut - Whether the result is added to out or overwrites it.
+  * \param[out] out      - Output tensor, whose rows are contiguous.
+  */
+  static void TensorContraction(const su2double      *A,
+                                const bool           trans,
+                                const unsigned short nOut,
+                                const unsigned short nIn,
+                                const unsigned long  nBefore,
+                                const unsigned long  nAfter,
+                                const unsigned short NPad,
+                                const unsigned long  strideIn,
+                                const su2double      *in,
+                                const bool           addToOut,
+                                su2double            *out);
+
+  /*!
   * \brief Function, which creates all the data for a line element.
   */
   void DataStandardLine(void);
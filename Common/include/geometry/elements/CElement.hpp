@@ -87,6 +87,14 @@ protected:
   su2activematrix HiHj = 0.0;                        /*!< \brief Scalar product of 2 ansatz functions. */
   std::vector<std::vector<su2activematrix>> DHiDHj;  /*!< \brief Scalar product of the gradients of 2 ansatz functions. */
 
+  const su2double* RefGradients = nullptr;  /*!< \brief Stored reference gradients used by ComputeGrad_Linear (if set). */
+
+  /*!
+   * \brief Set the Jacobians and the gradients of the shape functions wrt the reference configuration
+   *        from the stored values (see SetRefGradients).
+   */
+  void LoadRefGradients();
+
 public:
   enum FrameType {REFERENCE=1, CURRENT=2}; /*!< \brief Type of nodal coordinates. */
 
@@ -132,6 +140,26 @@ public:
    */
   void ClearElement(void);
 
+  /*!
+   * \brief Number of values needed to store the reference gradients of the element,
+   *        i.e. the Jacobian and the gradients of the shape functions at each Gauss point.
+   */
+  inline unsigned short GetnRefGradients(void) const { return nGaussPoints*(1+nNodes*nDim); }
+
+  /*!
+   * \brief Copy the reference gradients (last computed by ComputeGrad_Linear) to an external array.
+   * \param[out] data - Array of size GetnRefGradients().
+   */
+  void GetRefGradients(su2double* data) const;
+
+  /*!
+   * \brief Provide stored reference gradients, while they are set ComputeGrad_Linear copies them
+   *        instead of computing them from the reference coordinates.
+   * \note This is only valid when the reference configuration does not change, use nullptr to unset.
+   * \param[in] data - Array of size GetnRefGradients() filled by GetRefGradients(), or nullptr.
+   */
+  inline void SetRefGradients(const su2double* data) { RefGradients = data; }
+
   /*!
    * \brief Retrieve the number of nodes of the element.
    * \return Number of nodes of the element.
@@ -779,7 +807,10 @@ public:
   /*!
    * \brief Set the value of the gradient of the shape functions wrt the reference configuration.
    */
-  void ComputeGrad_Linear(void) final { ComputeGrad_impl<REFERENCE>(); }
+  void ComputeGrad_Linear(void) final {
+    if (RefGradients) LoadRefGradients();
+    else ComputeGrad_impl<REFERENCE>();
+  }
 
   /*!
    * \brief Set the value of the gradient of the shape functions wrt the current configuration.
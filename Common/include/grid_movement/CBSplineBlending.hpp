@@ -42,7 +42,7 @@ class CBSplineBlending : public CFreeFormBlending{
 
 private:
   vector<su2double>          U;  /*!< \brief The knot vector for uniform BSplines on the interval [0,1]. */
-  vector<vector<su2double> > N;  /*!< \brief The temporary matrix holding the j+p basis functions up to order p. */
+  vector<vector<vector<su2double> > > N;  /*!< \brief The temporary matrix holding the j+p basis functions up to order p (one per thread). */
   unsigned short KnotSize;       /*!< \brief The size of the knot vector. */
 
 public:
@@ -59,6 +59,7 @@ public:
 
   /*!
    * \brief Returns the value of the i-th basis function and stores the values of the i+p basis functions in the matrix N.
+   * \note Each thread uses its own matrix N, the evaluation is thread-safe.
    * \param[in] val_i - index of the basis function.
    * \param[in] val_t - Point at which we want to evaluate the i-th basis.
    */
@@ -42,7 +42,7 @@ class CBezierBlending : public CFreeFormBlending{
 
 private:
 
-  vector<su2double> binomial; /*!< \brief Temporary vector for the Bernstein evaluation. */
+  vector<vector<su2double> > binomial; /*!< \brief Binomial coefficients (Pascal's triangle) up to the order of the basis. */
 
   /*!
    * \brief Returns the value of the i-th Bernstein polynomial of order n.
@@ -63,12 +63,13 @@ private:
 
   /*!
    * \brief Get the binomial coefficient n over i, defined as n!/(m!(n-m)!)
-   * \note If the denominator is 0, the value is 1.
+   * \note If the denominator is 0, the value is 1. The coefficients are tabulated by SetOrder,
+   *       which makes the evaluation of the basis thread-safe.
    * \param[in] n - Upper coefficient.
    * \param[in] m - Lower coefficient.
    * \return Value of the binomial coefficient n over m.
    */
-  su2double Binomial(unsigned short n, unsigned short m);
+  inline su2double Binomial(unsigned short n, unsigned short m) const { return binomial[n][m]; }
 
 public:
 
@@ -54,8 +54,6 @@ public:
   su2double *ParamCoord, *ParamCoord_,  /*!< \brief Parametric coordinates of a point. */
   *cart_coord, *cart_coord_;      /*!< \brief Cartesian coordinates of a point. */
   su2double ObjFunc;      /*!< \brief Objective function of the point inversion process. */
-  su2double *Gradient;      /*!< \brief Gradient of the point inversion process. */
-  su2double **Hessian;          /*!< \brief Hessian of the point inversion process. */
   su2double MaxCoord[3];    /*!< \brief Maximum coordinates of the FFDBox. */
   su2double MinCoord[3];    /*!< \brief Minimum coordinates of the FFDBox. */
   string Tag;         /*!< \brief Tag to identify the FFDBox. */
@@ -73,6 +71,10 @@ public:
   vector<unsigned short> Fix_JPlane;  /*!< \brief Fix FFD J plane. */
   vector<unsigned short> Fix_KPlane;  /*!< \brief Fix FFD K plane. */
 
+  vector<su2double> SurfaceBasis[3];  /*!< \brief Basis of each direction at the surface points (nSurfacePoint x order). */
+  unsigned short SurfaceBasisOrder[3] = {0, 0, 0}; /*!< \brief Orders for which SurfaceBasis was computed. */
+  bool SurfaceBasisValid = false;     /*!< \brief SurfaceBasis matches the current parametric coordinates. */
+
   CFreeFormBlending** BlendingFunction;
 
 
@@ -193,7 +195,8 @@ public:
    */
   inline void Set_ParametricCoord(su2double *val_coord) { ParametricCoord[0].push_back(val_coord[0]);
                                                                        ParametricCoord[1].push_back(val_coord[1]);
-                                                                       ParametricCoord[2].push_back(val_coord[2]); }
+                                                                       ParametricCoord[2].push_back(val_coord[2]);
+                                                                       SurfaceBasisValid = false; }
 
 
   /*!
@@ -215,7 +218,8 @@ public:
    */
   inline void Set_ParametricCoord(const su2double *val_coord, unsigned long val_iSurfacePoints) { ParametricCoord[0][val_iSurfacePoints] = val_coord[0];
                                                                                                          ParametricCoord[1][val_iSurfacePoints] = val_coord[1];
-                                                                                                         ParametricCoord[2][val_iSurfacePoints] = val_coord[2]; }
+                                                                                                         ParametricCoord[2][val_iSurfacePoints] = val_coord[2];
+                                                                                                         SurfaceBasisValid = false; }
 
 
   /*!
@@ -547,6 +551,30 @@ public:
    */
   su2double *GetParametricCoord_Iterative(unsigned long iPoint, su2double *xyz, const su2double *guess, CConfig *config);
 
+  /*!
+   * \brief Iterative strategy for computing the parametric coordinates (thread-safe version, without messages).
+   * \param[in] xyz - Cartesians coordinates of the target point.
+   * \param[in] guess - Initial guess for doing the parametric coordinates search.
+   * \param[in] config - Definition of the particular problem.
+   * \param[out] uvw - Parametric coordinates of the point.
+   * \return False if the iterations did not converge.
+   */
+  bool GetParametricCoord_Iterative(const su2double *xyz, const su2double *guess,
+                                    const CConfig *config, su2double *uvw) const;
+
+  /*!
+   * \brief Compute the parametric coordinates of a set of points in parallel.
+   * \note The initial guess of each point is the nearest sample of a regular sampling
+   *       (in parametric space) of the box, found with an ADT of the samples.
+   * \param[in] nPoint - Number of points.
+   * \param[in] xyz - Cartesian coordinates of the points (nPoint x 3).
+   * \param[in] pointID - Indices of the points (only used in the messages about the points that are not found).
+   * \param[in] config - Definition of the particular problem.
+   * \param[out] uvw - Parametric coordinates of the points (nPoint x 3).
+   */
+  void GetParametricCoord_Parallel(unsigned long nPoint, const su2double *xyz, const unsigned long *pointID,
+                                   const CConfig *config, su2double *uvw) const;
+
   /*!
    * \brief Compute the cross product.
    * \param[in] v1 - First input vector.
@@ -575,6 +603,26 @@ public:
    */
   su2double *EvalCartesianCoord(su2double *ParamCoord) const;
 
+  /*!
+   * \brief Thread-safe version of EvalCartesianCoord, the result is written to xyz.
+   * \param[in] uvw - Parametric coordinates of a point.
+   * \param[out] xyz - Cartesian coordinates of the point.
+   */
+  void EvalCartesianCoord(const su2double *uvw, su2double *xyz) const;
+
+  /*!
+   * \brief Tabulate the basis of each direction at the parametric coordinates of the surface points.
+   * \note Called by EvalCartesianCoord_SurfacePoints when the coordinates or the orders change.
+   */
+  void SetSurfaceBasis();
+
+  /*!
+   * \brief Evaluate the cartesian coordinates of all the surface points of the box (in parallel)
+   *        as a tensor-product contraction of the control points with the tabulated basis.
+   * \param[out] xyz - Cartesian coordinates of the surface points (nSurfacePoint x 3).
+   */
+  void EvalCartesianCoord_SurfacePoints(su2double *xyz);
+
   /*!
    * \brief Get the order in the l direction of the FFD FFDBox.
    * \return Order in the l direction of the FFD FFDBox.
@@ -632,10 +680,9 @@ public:
    * \brief The routine computes the gradient of F(u, v, w) = ||X(u, v, w)-(x, y, z)||^2  evaluated at (u, v, w).
    * \param[in] val_coord - Parametric coordiates of the target point.
    * \param[in] xyz - Cartesians coordinates of the point.
-   * \param[in] analytical - Compute the analytical gradient.
-   * \return Value of the analytical gradient.
+   * \param[out] val_Gradient - Value of the analytical gradient.
    */
-  su2double *GetFFDGradient(su2double *val_coord, su2double *xyz);
+  void GetFFDGradient(su2double *val_coord, const su2double *xyz, su2double *val_Gradient) const;
 
   /*!
    * \brief The routine that computes the Hessian of F(u, v, w) = ||X(u, v, w)-(x, y, z)||^2 evaluated at (u, v, w)
@@ -645,7 +692,7 @@ public:
    * \param[in] xyz - Cartesians coordinates of the target point to compose the functional.
    * \param[in] val_Hessian - Value of the hessian.
    */
-  void GetFFDHessian(su2double *uvw, su2double *xyz, su2double **val_Hessian);
+  void GetFFDHessian(su2double *uvw, const su2double *xyz, su2double val_Hessian[3][3]) const;
 
   /*!
    * \brief An auxiliary routine to help us compute the gradient of F(u, v, w) = ||X(u, v, w)-(x, y, z)||^2 =
@@ -688,7 +735,7 @@ public:
    *        points, and derivate de v-Bersntein polynomial (use m-1 when summing!!).
    */
   su2double GetDerivative3(su2double *uvw, unsigned short dim, unsigned short diff_this,
-                           unsigned short *lmn);
+                           unsigned short *lmn) const;
 
   /*!
    * \brief An auxiliary routine to help us compute the Hessian of F(u, v, w) = ||X(u, v, w)-(x, y, z)||^2 =
@@ -724,7 +771,7 @@ public:
    * \return __________.
    */
   su2double GetDerivative5(su2double *uvw, unsigned short dim, unsigned short diff_this, unsigned short diff_this_also,
-                           unsigned short *lmn);
+                           unsigned short *lmn) const;
 
   /*!
    * \brief Euclidean norm of a vector.
@@ -30,6 +30,8 @@
 #include "CGridMovement.hpp"
 #include "CFreeFormDefBox.hpp"
 
+#include <cstdint>
+
 /*!
  * \class CSurfaceMovement
  * \brief Class for moving the surface numerical grid.
@@ -214,6 +216,21 @@ public:
    */
   void SetParametricCoord(CGeometry *geometry, CConfig *config, CFreeFormDefBox *FFDBox, unsigned short iFFDBox);
 
+  /*!
+   * \brief Key of the parametric coordinates of a set of points in the inversion cache (FFD_INVERSION_CACHE),
+   *        a hash of the box, of the options used by the inversion, and of the points.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] FFDBox - The FFD box.
+   * \param[in] markerIdx - Marker of each point.
+   * \param[in] vertexIdx - Vertex of each point.
+   * \param[in] pointIdx - Index of each point.
+   * \param[in] cartCoord - Cartesian coordinates of the points (nPoint x 3).
+   * \return 64-bit FNV-1a hash.
+   */
+  static uint64_t FFDInversionKey(const CConfig* config, CFreeFormDefBox* FFDBox,
+                                  const vector<unsigned short>& markerIdx, const vector<unsigned long>& vertexIdx,
+                                  const vector<unsigned long>& pointIdx, const vector<su2double>& cartCoord);
+
   /*!
    * \brief Update the parametric coordinates of a grid point using a point inversion strategy
    *        in the free form FFDBox.
@@ -31,6 +31,7 @@
 #include "../linear_algebra/CSysMatrix.hpp"
 #include "../linear_algebra/CSysVector.hpp"
 #include "../linear_algebra/CSysSolve.hpp"
+#include "../toolboxes/graph_toolbox.hpp"
 
 /*!
  * \class CVolumetricMovement
@@ -39,6 +40,7 @@
  */
 class CVolumetricMovement : public CGridMovement {
 protected:
+  enum : size_t {OMP_MIN_SIZE = 32, OMP_MAX_SIZE = 512}; /*!< \brief Chunk sizes for element loops. */
 
   unsigned short nDim;    /*!< \brief Number of dimensions. */
   unsigned short nVar;    /*!< \brief Number of variables. */
@@ -58,6 +60,23 @@ protected:
   CSysVector<su2double> LinSysSol;
   CSysVector<su2double> LinSysRes;
 
+#ifdef HAVE_OMP
+  vector<GridColor<> > ElemColoring;   /*!< \brief Element colors. */
+  bool LockStrategy = false;           /*!< \brief Whether to use an OpenMP lock to guard updates of the stiffness matrix. */
+  vector<omp_lock_t> UpdateLocks;      /*!< \brief Locks that may be used to protect accesses to CSysMatrix in element loops. */
+#else
+  array<DummyGridColor<>,1> ElemColoring;      /*--- Behaves like a normal integer type. ---*/
+  static constexpr bool LockStrategy = false;  /*--- Lock strategy is never needed for MPI-only. ---*/
+  DummyVectorOfLocks UpdateLocks;
+#endif
+  unsigned long omp_chunk_size = OMP_MAX_SIZE;  /*!< \brief Chunk size used in light element loops. */
+
+  /*!
+   * \brief Set the element coloring (or the locks) used to parallelize the assembly of the stiffness matrix.
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  void HybridParallelInitialization(CGeometry* geometry);
+
 public:
 
   /*!
@@ -114,7 +133,7 @@ public:
    * \param[in] nNodes - Number of nodes defining the element.
    * \param[in] scale
    */
-  void SetFEA_StiffMatrix3D(CGeometry *geometry, CConfig *config, su2double **StiffMatrix_Elem, unsigned long PointCorners[8], su2double CoordCorners[8][3],
+  void SetFEA_StiffMatrix3D(CGeometry *geometry, CConfig *config, su2double StiffMatrix_Elem[24][24], unsigned long PointCorners[8], su2double CoordCorners[8][3],
   unsigned short nNodes, su2double ElemVolume, su2double ElemDistance);
 
   /*!
@@ -127,7 +146,7 @@ public:
    * \param[in] nNodes - Number of nodes defining the element.
    * \param[in] scale
    */
-  void SetFEA_StiffMatrix2D(CGeometry *geometry, CConfig *config, su2double **StiffMatrix_Elem, unsigned long PointCorners[8], su2double CoordCorners[8][3],
+  void SetFEA_StiffMatrix2D(CGeometry *geometry, CConfig *config, su2double StiffMatrix_Elem[24][24], unsigned long PointCorners[8], su2double CoordCorners[8][3],
   unsigned short nNodes, su2double ElemVolume, su2double ElemDistance);
 
   /*!
@@ -230,8 +249,9 @@ public:
    * \param[in] StiffMatrix_Elem - Element stiffness matrix to be filled.
    * \param[in] PointCorners - Index values for element corners
    * \param[in] nNodes - Number of nodes defining the element.
+   * \note Thread-safe when called from a colored element loop (or with LockStrategy).
    */
-  void AddFEA_StiffMatrix(CGeometry *geometry, su2double **StiffMatrix_Elem, unsigned long PointCorners[8], unsigned short nNodes);
+  void AddFEA_StiffMatrix(CGeometry *geometry, su2double StiffMatrix_Elem[24][24], unsigned long PointCorners[8], unsigned short nNodes);
 
   /*!
    * \brief Check for negative volumes (all elements) after performing grid deformation.
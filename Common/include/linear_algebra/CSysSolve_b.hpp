@@ -35,5 +35,15 @@ struct CSysSolve_b {
   static void Solve_b(const su2double::Real* x, su2double::Real* x_b, size_t m,
                       const su2double::Real* y, const su2double::Real* y_b, size_t n,
                       codi::DataStore* d);
+
+  /*!
+   * \brief Primal function used when a primal value tape is replayed with new inputs.
+   * \note The update of the fixed-point iteration is zero at the converged state where the adjoint is
+   *       evaluated, and the (passive) Jacobian of the recording only acts as a preconditioner of the adjoint
+   *       iteration, therefore the solution of the linear system is not recomputed.
+   */
+  static void Solve_p(const su2double::Real* x, size_t m, su2double::Real* y, size_t n, codi::DataStore* d) {
+    for (size_t i = 0; i < n; ++i) y[i] = 0.0;
+  }
 };
 #endif
@@ -2024,6 +2024,32 @@ inline bool isTecplot(OUTPUT_TYPE format) {
   }
 }
 
+/*!
+ * \brief Compression of the binary data of the Paraview XML files.
+ */
+enum class OUTPUT_COMPRESSION {
+  NONE,   /*!< \brief Raw appended data. */
+  ZLIB,   /*!< \brief Blocks compressed with zlib (vtkZLibDataCompressor). */
+};
+static const MapType<std::string, OUTPUT_COMPRESSION> Output_Compression_Map = {
+  MakePair("NONE", OUTPUT_COMPRESSION::NONE)
+  MakePair("ZLIB", OUTPUT_COMPRESSION::ZLIB)
+};
+
+/*!
+ * \brief Kind of run-time profiling of the solver phases.
+ */
+enum class PROFILING_MODE {
+  NONE,     /*!< \brief No profiling. */
+  SUMMARY,  /*!< \brief Summary of the timers of each region. */
+  TRACE,    /*!< \brief Summary and timeline of the regions (Chrome trace format). */
+};
+static const MapType<std::string, PROFILING_MODE> Profiling_Mode_Map = {
+  MakePair("NONE", PROFILING_MODE::NONE)
+  MakePair("SUMMARY", PROFILING_MODE::SUMMARY)
+  MakePair("TRACE", PROFILING_MODE::TRACE)
+};
+
 /*!
  * \brief Type of solution output file formats
  */
@@ -2036,6 +2062,18 @@ static const MapType<std::string, TAB_OUTPUT> TabOutput_Map = {
   MakePair("TECPLOT", TAB_OUTPUT::TAB_TECPLOT)
 };
 
+/*!
+ * \brief Type of history file formats
+ */
+enum class HISTORY_FORMAT {
+  TABULAR,            /*!< \brief Text file in the format of TABULAR_FORMAT. */
+  BINARY              /*!< \brief Binary file of double precision columns (.bin). */
+};
+static const MapType<std::string, HISTORY_FORMAT> HistoryFormat_Map = {
+  MakePair("TABULAR", HISTORY_FORMAT::TABULAR)
+  MakePair("BINARY", HISTORY_FORMAT::BINARY)
+};
+
 /*!
  * \brief Type of volume sensitivity file formats (inout to SU2_DOT)
  */
@@ -2369,6 +2407,46 @@ enum class RECORDING {
   SOLUTION_AND_MESH,
 };
 
+/*!
+ * \brief Source of the primal trajectory for unsteady discrete adjoints.
+ */
+enum class UNST_ADJ_PRIMAL {
+  RESTART_FILES,    /*!< \brief Read every primal time step from the restart files of the direct run. */
+  CHECKPOINTING,    /*!< \brief Keep the trajectory in memory, recompute it from binomial checkpoints. */
+};
+static const MapType<std::string, UNST_ADJ_PRIMAL> Unst_Adj_Primal_Map = {
+  MakePair("RESTART_FILES", UNST_ADJ_PRIMAL::RESTART_FILES)
+  MakePair("CHECKPOINTING", UNST_ADJ_PRIMAL::CHECKPOINTING)
+};
+
+/*!
+ * \brief Compression of the primal states kept in memory for unsteady discrete adjoints.
+ */
+enum class PRIMAL_STORE_COMPRESSION {
+  NONE,       /*!< \brief States are stored as they are. */
+  LOSSLESS,   /*!< \brief Delta (xor) encoding, byte shuffling, and run-length encoding of zeros. */
+  FLOAT32,    /*!< \brief As LOSSLESS after rounding the states to single precision. */
+};
+static const MapType<std::string, PRIMAL_STORE_COMPRESSION> Primal_Store_Compression_Map = {
+  MakePair("NONE", PRIMAL_STORE_COMPRESSION::NONE)
+  MakePair("LOSSLESS", PRIMAL_STORE_COMPRESSION::LOSSLESS)
+  MakePair("FLOAT32", PRIMAL_STORE_COMPRESSION::FLOAT32)
+};
+
+/*!
+ * \brief Where the idle chunks of the AD tape are kept.
+ */
+enum class TAPE_STORAGE {
+  MEMORY,        /*!< \brief In memory, as recorded. */
+  COMPRESSED,    /*!< \brief In memory, losslessly compressed. */
+  SCRATCH_FILE,  /*!< \brief Compressed in a scratch file (AD_TAPE_SCRATCH_DIR). */
+};
+static const MapType<std::string, TAPE_STORAGE> Tape_Storage_Map = {
+  MakePair("MEMORY", TAPE_STORAGE::MEMORY)
+  MakePair("COMPRESSED", TAPE_STORAGE::COMPRESSED)
+  MakePair("SCRATCH_FILE", TAPE_STORAGE::SCRATCH_FILE)
+};
+
 /*!
  * \brief Types of schemes for dynamic structural computations
  */
@@ -207,6 +207,10 @@ class CBaseMPIWrapper {
     MPI_Allreduce(sendbuf, recvbuf, count, datatype, op, comm);
   }
 
+  static inline void Exscan(const void* sendbuf, void* recvbuf, int count, Datatype datatype, Op op, Comm comm) {
+    MPI_Exscan(sendbuf, recvbuf, count, datatype, op, comm);
+  }
+
   static inline void Gather(const void* sendbuf, int sendcnt, Datatype sendtype, void* recvbuf, int recvcnt,
                             Datatype recvtype, int root, Comm comm) {
     MPI_Gather(sendbuf, sendcnt, sendtype, recvbuf, recvcnt, recvtype, root, comm);
@@ -560,6 +564,9 @@ class CBaseMPIWrapper {
     CopyData(sendbuf, recvbuf, count, datatype);
   }
 
+  /*--- As with MPI, the result on the first (here the only) rank is left undefined. ---*/
+  static inline void Exscan(const void* sendbuf, void* recvbuf, int count, Datatype datatype, Op op, Comm comm) {}
+
   static inline void Gather(const void* sendbuf, int sendcnt, Datatype sendtype, void* recvbuf, int recvcnt,
                             Datatype recvtype, int root, Comm comm) {
     CopyData(sendbuf, recvbuf, sendcnt, sendtype);
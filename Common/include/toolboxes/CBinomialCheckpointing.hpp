@@ -0,0 +1,90 @@
+/*!
+ * \file CBinomialCheckpointing.hpp
+ * \brief Optimal (binomial) checkpointing schedule to reverse a chain of time steps
+ *        with a limited number of stored states.
+ * \note Based on the revolve algorithm, see DOI 10.1145/347837.347846.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+/*!
+ * \brief Binomial checkpointing schedule.
+ * \note The problem is to deliver the states x_l, x_{l-1}, ..., x_1 (in this order) of the chain
+ * x_j = F(x_{j-1}), starting from a stored x_0 and using at most "s" additional stored states
+ * (checkpoints). Each evaluation of F is one step. The schedule is applied recursively, after
+ * advancing "Advance(l,s)" steps from x_0 a checkpoint is placed, the states above it are then
+ * reversed with s-1 checkpoints, and those below it with s checkpoints (the checkpoints form a stack).
+ * \ingroup Toolboxes
+ */
+class CBinomialCheckpointing {
+ public:
+  using Index = unsigned long;
+
+  /*!
+   * \brief Binomial coefficient (s+r)! / (s! r!), i.e. the number of steps that can be reversed
+   * with s checkpoints and at most r evaluations of each step (without counting the initial state).
+   */
+  static Index Beta(Index s, Index r) {
+    Index beta = 1;
+    for (Index i = 1; i <= r; ++i) beta = (beta * (s + i)) / i;
+    return beta;
+  }
+
+  /*!
+   * \brief Minimum number of steps required to reverse a chain of length l with s checkpoints.
+   */
+  static Index Cost(Index l, Index s) {
+    if (l == 0) return 0;
+
+    /*--- Equivalent to the classic revolve problem with one more step and one more
+     *    snapshot, find the repetition number r such that beta(S,r-1) < L <= beta(S,r). ---*/
+    const Index L = l + 1, S = s + 1;
+    Index r = 0, beta = 1;
+    while (beta < L) {
+      ++r;
+      beta = (beta * (S + r)) / r;
+    }
+    /*--- beta(S+1,r-1) = beta(S,r-1) * (S+r) / (S+1), where beta(S,r-1) = beta(S,r) * r / (S+r). ---*/
+    const Index betaPrev = (beta * r) / (S + r);
+    return r * L - (betaPrev * (S + r)) / (S + 1);
+  }
+
+  /*!
+   * \brief Optimal number of steps to advance from the stored state before placing the next checkpoint.
+   * \note A return value of l means no checkpoint should be placed (when s is 0 or l is 1).
+   */
+  static Index Advance(Index l, Index s) {
+    if (s == 0 || l < 2) return l;
+
+    Index best = l, minCost = l + Cost(l - 1, s);
+    for (Index m = 1; m < l; ++m) {
+      const Index cost = m + Cost(l - m, s - 1) + Cost(m - 1, s);
+      if (cost <= minCost) {
+        minCost = cost;
+        best = m;
+      }
+    }
+    return best;
+  }
+};
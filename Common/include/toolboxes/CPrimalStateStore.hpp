@@ -0,0 +1,136 @@
+/*!
+ * \file CPrimalStateStore.hpp
+ * \brief In-memory store of (optionally compressed) primal states, used to provide
+ *        the primal trajectory to the unsteady discrete adjoint.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <map>
+#include <vector>
+#include <cstdint>
+#include "../containers/C2DContainer.hpp"
+#include "../option_structure.hpp"
+
+/*!
+ * \brief Store of primal states (each a list of matrices, e.g. the solution of each solver) indexed by time step.
+ * \note States are either checkpoints, which are only removed explicitly, or part of a sliding
+ * window of limited size. The window is tailored for reverse time sweeps, states above the working
+ * range are removed first, states within it are never removed, and then the oldest (lowest) states go.
+ * \ingroup Toolboxes
+ */
+class CPrimalStateStore {
+ public:
+  using Key = long;
+
+ private:
+  /*!
+   * \brief One matrix of a state, in compressed form.
+   */
+  struct Block {
+    unsigned long rows = 0, cols = 0;
+    std::vector<uint8_t> bytes;
+  };
+
+  /*!
+   * \brief One state, with its checkpoint flag.
+   */
+  struct State {
+    std::vector<Block> blocks;
+    bool checkpoint = false;
+  };
+
+  std::map<Key, State> states;             /*!< \brief Stored states, ordered by time step. */
+  unsigned long windowSize;                /*!< \brief Maximum number of states that are not checkpoints. */
+  PRIMAL_STORE_COMPRESSION compression;    /*!< \brief Kind of compression applied to the states. */
+  Key rangeLo, rangeHi;                    /*!< \brief Working range of the reverse sweep. */
+
+  /*!
+   * \brief Remove states from the window until it fits its maximum size.
+   */
+  void Evict();
+
+  /*!
+   * \brief Encode a matrix into a block.
+   */
+  void Encode(const su2activematrix& mat, Block& block) const;
+
+  /*!
+   * \brief Decode a block into a matrix.
+   */
+  void Decode(const Block& block, su2activematrix& mat) const;
+
+ public:
+  /*!
+   * \brief Constructor.
+   * \param[in] window - Number of states (other than checkpoints) that may be stored.
+   * \param[in] kind - Kind of compression.
+   */
+  CPrimalStateStore(unsigned long window, PRIMAL_STORE_COMPRESSION kind);
+
+  /*!
+   * \brief Store a state, replacing any state with the same key.
+   * \param[in] key - Time step of the state.
+   * \param[in] vars - Matrices that define the state.
+   * \param[in] checkpoint - Whether the state is a checkpoint.
+   */
+  void Store(Key key, const std::vector<const su2activematrix*>& vars, bool checkpoint = false);
+
+  /*!
+   * \brief Retrieve a state into pre-allocated matrices (of the same sizes used to store it).
+   * \return False if the state is not stored.
+   */
+  bool Retrieve(Key key, const std::vector<su2activematrix*>& vars) const;
+
+  /*!
+   * \brief Check if a state is stored.
+   */
+  inline bool Contains(Key key) const { return states.count(key) != 0; }
+
+  /*!
+   * \brief Turn a stored state into a checkpoint or back into a window state.
+   */
+  void SetCheckpoint(Key key, bool checkpoint);
+
+  /*!
+   * \brief Set the range of time steps that is needed at the current stage of the reverse sweep.
+   * \note States above the range are removed, states in it are not removed to make space in the window.
+   */
+  void SetWorkingRange(Key lo, Key hi);
+
+  /*!
+   * \brief Remove all states.
+   */
+  inline void Clear() { states.clear(); }
+
+  /*!
+   * \brief Number of stored states (including checkpoints).
+   */
+  inline unsigned long GetnStates() const { return states.size(); }
+
+  /*!
+   * \brief Memory used by the stored states in bytes.
+   */
+  unsigned long GetMemoryUsage() const;
+};
@@ -0,0 +1,134 @@
+/*!
+ * \file CRegionProfiler.hpp
+ * \brief Hierarchical timers (and optional hardware counters) for the phases of the solvers.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "../option_structure.hpp"
+
+/*!
+ * \class CRegionProfiler
+ * \brief Process-wide profiler of named code regions.
+ * \note Regions are measured with scopes (see SU2_PROFILE_SCOPE), each thread builds a tree of the regions it
+ * enters, the tree of the master thread is the hierarchical report, the trees of the other threads are used to
+ * compute the thread imbalance. The results of all ranks are combined by Finalize. When the profiler is not
+ * active a scope costs one branch. The optional hardware counters (cycles, instructions, cache misses) use the
+ * Linux perf_event interface and are disabled with a warning if it is not available.
+ * \ingroup Toolboxes
+ */
+class CRegionProfiler {
+ public:
+  enum : int { N_COUNTERS = 3 }; /*!< \brief Cycles, instructions, cache misses. */
+
+  /*!
+   * \brief Accumulated data of one node of the region tree.
+   */
+  struct Entry {
+    std::string path;                  /*!< \brief Names of the enclosing regions and of the region, separated by "/". */
+    unsigned short depth = 0;          /*!< \brief Nesting level, 0 for top level regions. */
+    unsigned long calls = 0;           /*!< \brief Number of times the region was entered. */
+    double time = 0.0;                 /*!< \brief Inclusive wall time [s]. */
+    uint64_t counters[N_COUNTERS] = {}; /*!< \brief Inclusive hardware counts. */
+  };
+
+ private:
+  static bool active;  /*!< \brief Whether scopes are measured. */
+
+ public:
+  /*!
+   * \brief Start (or stop, for PROFILING_MODE::NONE) profiling, the previous data is discarded.
+   * \note Collective, must be called outside of parallel regions.
+   * \param[in] mode - Kind of profiling.
+   * \param[in] counters - Read the hardware counters.
+   */
+  static void Initialize(PROFILING_MODE mode, bool counters);
+
+  /*!
+   * \brief Whether the profiler is active.
+   */
+  static inline bool IsActive() { return active; }
+
+  /*!
+   * \brief Get the identifier of a region, repeated names give the same identifier (thread-safe).
+   */
+  static int RegisterRegion(const char* name);
+
+  /*!
+   * \brief Enter a region on the calling thread.
+   */
+  static void Start(int region);
+
+  /*!
+   * \brief Leave the innermost region of the calling thread.
+   */
+  static void Stop();
+
+  /*!
+   * \brief Get the region tree of the master thread of this rank, in depth-first order.
+   * \note Regions that are still open are not included.
+   */
+  static std::vector<Entry> GetLocalTree();
+
+  /*!
+   * \brief Combine the data of all threads and ranks, print the summary and write the files, then stop profiling.
+   * \note Collective, must be called outside of parallel regions.
+   * \param[in] summaryFile - CSV file with the summary of each region.
+   * \param[in] traceFile - File with the events in Chrome trace format (only written in PROFILING_MODE::TRACE).
+   */
+  static void Finalize(const std::string& summaryFile, const std::string& traceFile);
+};
+
+/*!
+ * \class CProfilerScope
+ * \brief Measures a region from construction to destruction.
+ * \ingroup Toolboxes
+ */
+class CProfilerScope {
+ private:
+  bool started;
+
+ public:
+  explicit CProfilerScope(int region) : started(CRegionProfiler::IsActive()) {
+    if (started) CRegionProfiler::Start(region);
+  }
+  ~CProfilerScope() {
+    if (started) CRegionProfiler::Stop();
+  }
+  CProfilerScope(const CProfilerScope&) = delete;
+  CProfilerScope& operator=(const CProfilerScope&) = delete;
+};
+
+#define SU2_PROFILE_CONCAT_(A, B) A##B
+#define SU2_PROFILE_CONCAT(A, B) SU2_PROFILE_CONCAT_(A, B)
+
+/*!
+ * \brief Measure the rest of the enclosing block as region NAME (a string literal).
+ */
+#define SU2_PROFILE_SCOPE(NAME)                                                                         \
+  static const int SU2_PROFILE_CONCAT(su2ProfileRegion_, __LINE__) = CRegionProfiler::RegisterRegion(NAME); \
+  const CProfilerScope SU2_PROFILE_CONCAT(su2ProfileScope_, __LINE__)(SU2_PROFILE_CONCAT(su2ProfileRegion_, __LINE__))
@@ -0,0 +1,142 @@
+/*!
+ * \file CTapeChunkStore.hpp
+ * \brief Store of the data of idle AD tape chunks, compressed in memory or in a scratch file.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/*!
+ * \brief Store of the data of the tape chunks that are not being recorded or evaluated (AD_TAPE_STORAGE).
+ * \note The arrays are encoded like the lossless primal states (see CompressionToolbox::EncodeWords),
+ * each value is xor'ed with the previous one, which makes the index streams of the tape small, the bytes
+ * are shuffled into planes and runs of zeros are run-length encoded. The encoded data is then kept in
+ * memory, or written to a scratch file whose space is reused after Clear.
+ * \ingroup Toolboxes
+ */
+class CTapeChunkStore {
+ public:
+  /*!
+   * \brief Settings of the stores created by the tape (set from the config, see AD_TAPE_STORAGE).
+   */
+  struct Settings {
+    bool enabled = false;             /*!< \brief Whether idle chunks are stored, otherwise the tape is not changed. */
+    bool toFile = false;              /*!< \brief Whether the encoded chunks are written to a scratch file. */
+    std::string scratchDir = ".";     /*!< \brief Directory of the scratch files. */
+  };
+
+  /*!
+   * \brief An encoded array.
+   */
+  struct Block {
+    std::vector<uint8_t> bytes;       /*!< \brief Encoded data, if kept in memory. */
+    unsigned long count = 0;          /*!< \brief Number of values. */
+    unsigned long size = 0;           /*!< \brief Number of encoded bytes. */
+    long offset = -1;                 /*!< \brief Position of the encoded data in the scratch file, -1 if in memory. */
+  };
+
+ private:
+  const bool toFile;                  /*!< \brief Whether the encoded data goes to a scratch file. */
+  const std::string scratchDir;       /*!< \brief Directory of the scratch file. */
+  std::string fileName;               /*!< \brief Name of the scratch file, created on first use. */
+  FILE* file = nullptr;               /*!< \brief Handle of the scratch file. */
+  long fileEnd = 0;                   /*!< \brief End of the data written since the last Clear. */
+  unsigned long memory = 0;           /*!< \brief Encoded bytes kept in memory. */
+
+  /*!
+   * \brief Encode an array of values of size "wordSize" bytes.
+   */
+  void Encode(const void* data, size_t wordSize, unsigned long count, Block& block);
+
+  /*!
+   * \brief Decode a block into an array of values of size "wordSize" bytes.
+   */
+  void Decode(const Block& block, size_t wordSize, void* data) const;
+
+ public:
+  /*!
+   * \brief Settings used by the tape when it creates its stores.
+   */
+  static Settings& Defaults();
+
+  /*!
+   * \brief Constructor.
+   * \param[in] toFile - Write the encoded data to a scratch file instead of keeping it in memory.
+   * \param[in] scratchDir - Directory of the scratch file.
+   */
+  explicit CTapeChunkStore(bool toFile, std::string scratchDir = ".");
+
+  /*!
+   * \brief Destructor, removes the scratch file.
+   */
+  ~CTapeChunkStore();
+
+  CTapeChunkStore(const CTapeChunkStore&) = delete;
+  CTapeChunkStore& operator=(const CTapeChunkStore&) = delete;
+
+  /*!
+   * \brief Encode and store an array, replacing the previous content of the block.
+   * \param[in] data - Values, their bytes are encoded as they are.
+   * \param[in] count - Number of values.
+   * \param[out] block - Where the data is stored.
+   */
+  template <class T>
+  void Store(const T* data, unsigned long count, Block& block) {
+    Encode(data, sizeof(T), count, block);
+  }
+
+  /*!
+   * \brief Decode a stored array.
+   * \param[in] block - Where the data is stored.
+   * \param[out] data - Values, the array must hold block.count values.
+   */
+  template <class T>
+  void Load(const Block& block, T* data) const {
+    Decode(block, sizeof(T), data);
+  }
+
+  /*!
+   * \brief Free the memory of a block, the space of the scratch file is only reused after Clear.
+   */
+  void Release(Block& block);
+
+  /*!
+   * \brief Reuse the scratch file from its start, the blocks written to it are no longer valid.
+   */
+  void Clear();
+
+  /*!
+   * \brief Encoded bytes kept in memory.
+   */
+  inline unsigned long GetMemoryUsage() const { return memory; }
+
+  /*!
+   * \brief Encoded bytes written to the scratch file since the last Clear.
+   */
+  inline unsigned long GetFileUsage() const { return fileEnd; }
+};
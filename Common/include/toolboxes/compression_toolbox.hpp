@@ -0,0 +1,109 @@
+/*!
+ * \file compression_toolbox.hpp
+ * \brief Lossless encoding of arrays of words, used by the stores of primal states and tape chunks.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace CompressionToolbox {
+
+/*!
+ * \brief Encode words stored as a row-major matrix with "cols" columns.
+ * \note The values of each variable (column) are xor'ed with those of the previous point (row),
+ * for smooth fields this zeroes the sign, exponent, and high mantissa bits. The bytes are then
+ * shuffled into planes of equal significance, and runs of zeros are encoded as the pair (0, length).
+ * \param[in] words - Values to encode.
+ * \param[in] cols - Number of columns, i.e. distance between a value and the one it is xor'ed with.
+ * \param[out] bytes - Encoded data.
+ */
+template <class Word>
+inline void EncodeWords(const std::vector<Word>& words, unsigned long cols, std::vector<uint8_t>& bytes) {
+  const auto n = words.size();
+  bytes.clear();
+  bytes.reserve(n * sizeof(Word) / 2);
+
+  for (size_t iByte = 0; iByte < sizeof(Word); ++iByte) {
+    const auto shift = 8 * iByte;
+    unsigned long zeros = 0;
+
+    for (size_t i = 0; i < n; ++i) {
+      const Word delta = (i < cols) ? words[i] : (words[i] ^ words[i - cols]);
+      const auto byte = static_cast<uint8_t>((delta >> shift) & 0xFF);
+
+      if (byte == 0) {
+        if (++zeros == 255) {
+          bytes.push_back(0);
+          bytes.push_back(255);
+          zeros = 0;
+        }
+      } else {
+        if (zeros) {
+          bytes.push_back(0);
+          bytes.push_back(static_cast<uint8_t>(zeros));
+          zeros = 0;
+        }
+        bytes.push_back(byte);
+      }
+    }
+    if (zeros) {
+      bytes.push_back(0);
+      bytes.push_back(static_cast<uint8_t>(zeros));
+    }
+  }
+  bytes.shrink_to_fit();
+}
+
+/*!
+ * \brief Decode the output of EncodeWords.
+ * \param[in] bytes - Encoded data.
+ * \param[in] cols - Number of columns used to encode the data.
+ * \param[in,out] words - Decoded values, the vector must have the size of the encoded one.
+ */
+template <class Word>
+inline void DecodeWords(const std::vector<uint8_t>& bytes, unsigned long cols, std::vector<Word>& words) {
+  const auto n = words.size();
+  for (auto& w : words) w = 0;
+
+  size_t pos = 0;
+  for (size_t iByte = 0; iByte < sizeof(Word); ++iByte) {
+    const auto shift = 8 * iByte;
+
+    for (size_t i = 0; i < n;) {
+      const auto byte = bytes[pos++];
+      if (byte == 0) {
+        i += bytes[pos++];
+      } else {
+        words[i++] |= static_cast<Word>(byte) << shift;
+      }
+    }
+  }
+
+  for (size_t i = cols; i < n; ++i) words[i] ^= words[i - cols];
+}
+
+}  // namespace CompressionToolbox
@@ -1158,6 +1158,10 @@ void CConfig::SetConfig_Options() {
   addBoolOption("WRT_SURFACE_OVERWRITE", Wrt_Surface_Overwrite, true);
   /*!\brief WRT_VOLUME_OVERWRITE \n DESCRIPTION: overwrite visualisation files or append iteration number. \n Options: YES, NO \ingroup Config */
   addBoolOption("WRT_VOLUME_OVERWRITE", Wrt_Volume_Overwrite, true);
+  /*!\brief WRT_ASYNC \n DESCRIPTION: write the restart and Paraview files on a background thread. \n Options: YES, NO \ingroup Config */
+  addBoolOption("WRT_ASYNC", Wrt_Async, false);
+  /*!\brief WRT_ASYNC_MAX_PENDING \n DESCRIPTION: maximum number of output snapshots waiting to be written (WRT_ASYNC). \ingroup Config */
+  addUnsignedLongOption("WRT_ASYNC_MAX_PENDING", Wrt_Async_MaxPending, 2);
   /*!\brief SYSTEM_MEASUREMENTS \n DESCRIPTION: System of measurements \n OPTIONS: see \link Measurements_Map \endlink \n DEFAULT: SI \ingroup Config*/
   addEnumOption("SYSTEM_MEASUREMENTS", SystemMeasurements, Measurements_Map, SI);
 
@@ -1697,6 +1701,8 @@ void CConfig::SetConfig_Options() {
   addUnsignedShortOption("QUASI_NEWTON_NUM_SAMPLES", nQuasiNewtonSamples, 0);
   /* DESCRIPTION: Whether to use vectorized numerical schemes, less robust against transients. */
   addBoolOption("USE_VECTORIZATION", UseVectorization, false);
+  /* DESCRIPTION: Record the vectorized centered fluxes as hand-differentiated external functions in discrete adjoint runs. */
+  addBoolOption("EDGE_FLUX_EXT_FUNC", EdgeFluxExtFunc, false);
 
   /*!\par CONFIG_CATEGORY: Time-marching \ingroup Config*/
   /*--- Options related to time-marching ---*/
@@ -1745,6 +1751,16 @@ void CConfig::SetConfig_Options() {
   addLongOption("UNST_ADJOINT_ITER", Unst_AdjointIter, 0);
   /* DESCRIPTION: Number of iterations to average the objective */
   addLongOption("ITER_AVERAGE_OBJ", Iter_Avg_Objective , 0);
+  /* DESCRIPTION: Source of the primal trajectory for the unsteady adjoint (RESTART_FILES, CHECKPOINTING) */
+  addEnumOption("UNST_ADJOINT_PRIMAL", Kind_Unst_Adj_Primal, Unst_Adj_Primal_Map, UNST_ADJ_PRIMAL::RESTART_FILES);
+  /* DESCRIPTION: Number of binomial checkpoints of the primal trajectory for the unsteady adjoint */
+  addUnsignedLongOption("UNST_ADJOINT_CHECKPOINTS", Unst_Adj_nCheckpoints, 20);
+  /* DESCRIPTION: Number of recent primal states kept in memory in addition to the checkpoints */
+  addUnsignedShortOption("UNST_ADJOINT_STORE_WINDOW", Unst_Adj_StoreWindow, 8);
+  /* DESCRIPTION: Compression of the in-memory primal states (NONE, LOSSLESS, FLOAT32) */
+  addEnumOption("UNST_ADJOINT_STORE_COMPRESSION", Kind_Primal_Store_Compression, Primal_Store_Compression_Map, PRIMAL_STORE_COMPRESSION::LOSSLESS);
+  /* DESCRIPTION: Number of time steps for which a recording of the unsteady adjoint is replayed with new primal inputs (requires a primal value tape) */
+  addUnsignedLongOption("UNST_ADJOINT_TAPE_REPLAY", Unst_Adj_TapeReplay, 0);
   /* DESCRIPTION: Time discretization */
   addEnumOption("TIME_DISCRE_FLOW", Kind_TimeIntScheme_Flow, Time_Int_Map, EULER_IMPLICIT);
   /* DESCRIPTION: Time discretization */
@@ -2054,6 +2070,10 @@ void CConfig::SetConfig_Options() {
 
   /*!\brief OUTPUT_FORMAT \n DESCRIPTION: I/O format for output plots. \n OPTIONS: see \link TabOutput_Map \endlink \n DEFAULT: TECPLOT \ingroup Config */
   addEnumOption("TABULAR_FORMAT", Tab_FileFormat, TabOutput_Map, TAB_OUTPUT::TAB_CSV);
+  /*!\brief HISTORY_FORMAT \n DESCRIPTION: Format of the history file, TABULAR uses TABULAR_FORMAT. \n OPTIONS: see \link HistoryFormat_Map \endlink \n DEFAULT: TABULAR \ingroup Config */
+  addEnumOption("HISTORY_FORMAT", History_FileFormat, HistoryFormat_Map, HISTORY_FORMAT::TABULAR);
+  /*!\brief HISTORY_FLUSH_ITER \n DESCRIPTION: Number of history lines buffered before the history file is flushed. \n DEFAULT: 1 \ingroup Config */
+  addUnsignedLongOption("HISTORY_FLUSH_ITER", History_Flush_Iter, 1);
   /*!\brief OUTPUT_PRECISION \n DESCRIPTION: Set <ofstream>.precision(value) to specified value for SU2_DOT and HISTORY output. Useful for exact gradient validation. \n DEFAULT: 6 \ingroup Config */
   addUnsignedShortOption("OUTPUT_PRECISION", output_precision, 10);
   /*!\brief ACTDISK_JUMP \n DESCRIPTION: The jump is given by the difference in values or a ratio */
@@ -2347,6 +2367,10 @@ void CConfig::SetConfig_Options() {
   addBoolOption("COMPUTE_ENTROPY_FLUID_MODEL", Compute_Entropy, true);
   /* DESCRIPTION: Use the lumped mass matrix for steady DGFEM computations */
   addBoolOption("USE_LUMPED_MASSMATRIX_DGFEM", Use_Lumped_MassMatrix_DGFEM, false);
+  /* DESCRIPTION: Use sum factorization for the volume integrals of quadrilaterals and hexahedra (YES, NO) */
+  addBoolOption("SUM_FACTORIZATION_DGFEM", Sum_Factorization_DGFEM, true);
+  /* DESCRIPTION: Number of implicit iterations between updates of the element block Jacobi preconditioner (10 by default) */
+  addUnsignedShortOption("IMPLICIT_PRECOND_FREQ_DGFEM", Implicit_Precond_Freq_DGFEM, 10);
   /* DESCRIPTION: Only compute the exact Jacobian of the spatial discretization (NO, YES) */
   addBoolOption("JACOBIAN_SPATIAL_DISCRETIZATION_ONLY", Jacobian_Spatial_Discretization_Only, false);
 
@@ -2428,6 +2452,10 @@ void CConfig::SetConfig_Options() {
   addEnumOption("NONLINEAR_FEM_SOLUTION_METHOD", Kind_SpaceIteScheme_FEA, Space_Ite_Map_FEA, STRUCT_SPACE_ITE::NEWTON);
   /* DESCRIPTION: Formulation for bidimensional elasticity solver */
   addEnumOption("FORMULATION_ELASTICITY_2D", Kind_2DElasForm, ElasForm_2D, STRUCT_2DFORM::PLANE_STRAIN);
+  /*  DESCRIPTION: Store the gradients of the shape functions wrt the reference configuration of each element,
+  *  instead of recomputing them for every assembly (the reference configuration must be fixed).
+  *  Options: NO, YES \ingroup Config */
+  addBoolOption("STRUCT_CACHE_REF_GRADIENTS", Cache_RefGradients, true);
   /*  DESCRIPTION: Apply dead loads
   *  Options: NO, YES \ingroup Config */
   addBoolOption("DEAD_LOAD", DeadLoad, false);
@@ -2673,6 +2701,9 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Free surface damping coefficient */
   addDoubleOption("FFD_TOLERANCE", FFD_Tol, 1E-10);
 
+  /* DESCRIPTION: Prefix of the files that cache the parametric coordinates of the FFD point inversion (empty to disable) */
+  addStringOption("FFD_INVERSION_CACHE", FFD_InversionCache, string(""));
+
   /* DESCRIPTION: Procedure to prevent self-intersections within the FFD box based on Jacobian determinant */
   addBoolOption("FFD_INTPREV", FFD_IntPrev, NO);
 
@@ -2719,6 +2750,12 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Preaccumulation in the AD mode. */
   addBoolOption("PREACC", AD_Preaccumulation, YES);
 
+  /* DESCRIPTION: Where the idle chunks of the AD tape are kept (MEMORY, COMPRESSED, SCRATCH_FILE). */
+  addEnumOption("AD_TAPE_STORAGE", Kind_AD_TapeStorage, Tape_Storage_Map, TAPE_STORAGE::MEMORY);
+
+  /* DESCRIPTION: Directory of the scratch files of the AD tape (AD_TAPE_STORAGE= SCRATCH_FILE). */
+  addStringOption("AD_TAPE_SCRATCH_DIR", AD_TapeScratchDir, string("."));
+
   /*--- options that are used in the python optimization scripts. These have no effect on the c++ toolsuite ---*/
   /*!\par CONFIG_CATEGORY:Python Options\ingroup Config*/
 
@@ -2866,6 +2903,17 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Volume solution files */
   addEnumListOption("OUTPUT_FILES", nVolumeOutputFiles, VolumeOutputFiles, Output_Map);
 
+  /* DESCRIPTION: Compression of the binary data of the Paraview XML (and multiblock) files */
+  addEnumOption("OUTPUT_COMPRESSION", Kind_Output_Compression, Output_Compression_Map, OUTPUT_COMPRESSION::NONE);
+  /* DESCRIPTION: Volume output fields rounded to fewer mantissa bits (lossy) in the Paraview XML files */
+  addStringListOption("OUTPUT_QUANTIZED_FIELDS", nOutputQuantizedFields, OutputQuantizedFields);
+  /* DESCRIPTION: Number of mantissa bits kept for OUTPUT_QUANTIZED_FIELDS (1 to 23) */
+  addUnsignedShortOption("OUTPUT_QUANTIZATION_BITS", OutputQuantizationBits, 12);
+  /* DESCRIPTION: Bounds (xmin, xmax, ymin, ymax, zmin, zmax) of the box to which the volume visualization files are restricted */
+  addDoubleListOption("VOLUME_OUTPUT_BOX", nVolumeOutputBox, VolumeOutputBox);
+  /* DESCRIPTION: Time iteration at which the time averaging of volume output fields (MEAN_*, RMS_*) starts */
+  addUnsignedLongOption("VOLUME_AVERAGE_START_ITER", VolumeAvgStartIter, 0);
+
   /* DESCRIPTION: Parameter to perturb eigenvalues */
   addDoubleOption("UQ_DELTA_B", uq_delta_b, 1.0);
 
@@ -2890,6 +2938,11 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Size of the edge groups colored for thread parallel edge loops (0 forces the reducer strategy). */
   addUnsignedLongOption("EDGE_COLORING_GROUP_SIZE", edgeColorGroupSize, 512);
 
+  /* DESCRIPTION: Run-time profiling of the solver phases (NONE, SUMMARY, TRACE). */
+  addEnumOption("PROFILING", Kind_Profiling, Profiling_Mode_Map, PROFILING_MODE::NONE);
+  /* DESCRIPTION: Read the hardware counters (Linux perf_event) in the profiled regions. */
+  addBoolOption("PROFILING_COUNTERS", Profiling_Counters, false);
+
   /*--- options that are used for libROM ---*/
   /*!\par CONFIG_CATEGORY:libROM options \ingroup Config*/
 
@@ -3364,6 +3417,28 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
     VolumeOutputFiles[2] = OUTPUT_TYPE::SURFACE_PARAVIEW_XML;
   }
 
+#ifndef HAVE_ZLIB
+  if (Kind_Output_Compression != OUTPUT_COMPRESSION::NONE) {
+    SU2_MPI::Error("OUTPUT_COMPRESSION requires SU2 to be compiled with zlib support.", CURRENT_FUNCTION);
+  }
+#endif
+
+  if (OutputQuantizationBits < 1 || OutputQuantizationBits > 23) {
+    SU2_MPI::Error("OUTPUT_QUANTIZATION_BITS must be between 1 and 23.", CURRENT_FUNCTION);
+  }
+
+  if (nVolumeOutputBox != 0) {
+    /*--- The dimension is only known (val_nDim > 1) when the config of a zone is read. ---*/
+    if ((nVolumeOutputBox != 4 && nVolumeOutputBox != 6) || (val_nDim > 1 && nVolumeOutputBox != 2*val_nDim)) {
+      SU2_MPI::Error("VOLUME_OUTPUT_BOX must contain a minimum and a maximum for each direction.", CURRENT_FUNCTION);
+    }
+    for (unsigned short iDim = 0; iDim < nVolumeOutputBox/2; iDim++) {
+      if (VolumeOutputBox[2*iDim] > VolumeOutputBox[2*iDim+1]) {
+        SU2_MPI::Error("The minimum of VOLUME_OUTPUT_BOX is larger than the maximum.", CURRENT_FUNCTION);
+      }
+    }
+  }
+
   /*--- Set the default output frequencies ---*/
   if (!OptionIsSet("OUTPUT_WRT_FREQ")){
     nVolumeOutputFrequencies = nVolumeOutputFiles;
@@ -4607,6 +4682,13 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
     nLevels_TimeAccurateLTS = 1;
   }
 
+  /* The Jacobian-free Newton-Krylov method of the DG solver is not differentiated. */
+  if (Kind_TimeIntScheme_FEM_Flow == EULER_IMPLICIT &&
+      (Kind_Solver == MAIN_SOLVER::DISC_ADJ_FEM_EULER || Kind_Solver == MAIN_SOLVER::DISC_ADJ_FEM_NS ||
+       Kind_Solver == MAIN_SOLVER::DISC_ADJ_FEM_RANS)) {
+    SU2_MPI::Error("TIME_DISCRE_FEM_FLOW= EULER_IMPLICIT is not available for the discrete adjoint.", CURRENT_FUNCTION);
+  }
+
   if (Kind_TimeIntScheme_FEM_Flow == ADER_DG) {
 
     TimeMarching = TIME_MARCHING::TIME_STEPPING;  // Only time stepping for ADER.
@@ -4816,6 +4898,18 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
 
   AD::PreaccEnabled = AD_Preaccumulation;
 
+#if defined(CODI_TAPE_STORAGE)
+  auto& tapeStorage = CTapeChunkStore::Defaults();
+  tapeStorage.enabled = (Kind_AD_TapeStorage != TAPE_STORAGE::MEMORY);
+  tapeStorage.toFile = (Kind_AD_TapeStorage == TAPE_STORAGE::SCRATCH_FILE);
+  tapeStorage.scratchDir = AD_TapeScratchDir;
+#else
+  if (Kind_AD_TapeStorage != TAPE_STORAGE::MEMORY) {
+    SU2_MPI::Error("AD_TAPE_STORAGE requires a build with the tape storage (meson option codi-tape-storage=true).",
+                   CURRENT_FUNCTION);
+  }
+#endif
+
 #else
   if (AD_Mode == YES) {
     SU2_MPI::Error("Config option AUTO_DIFF= YES requires AD support.\n"
@@ -5135,6 +5229,10 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
                    CURRENT_FUNCTION);
   }
 
+  if (History_Flush_Iter == 0) {
+    SU2_MPI::Error("HISTORY_FLUSH_ITER must be at least 1.", CURRENT_FUNCTION);
+  }
+
   /* Force the lowest memory preconditioner when direct solvers are used. */
 
   auto isPastix = [](unsigned short kindSolver) {
@@ -5175,6 +5273,35 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
         Iter_Avg_Objective = nTimeIter;
       }
 
+      if (Kind_Unst_Adj_Primal == UNST_ADJ_PRIMAL::CHECKPOINTING) {
+        if (GetGrid_Movement() || Deform_Mesh) {
+          SU2_MPI::Error("UNST_ADJOINT_PRIMAL= CHECKPOINTING is not available for moving or deforming meshes.",
+                         CURRENT_FUNCTION);
+        }
+        if (TimeMarching != TIME_MARCHING::DT_STEPPING_1ST && TimeMarching != TIME_MARCHING::DT_STEPPING_2ND) {
+          SU2_MPI::Error("UNST_ADJOINT_PRIMAL= CHECKPOINTING requires dual time stepping.", CURRENT_FUNCTION);
+        }
+        if (Unst_Adj_nCheckpoints == 0) {
+          SU2_MPI::Error("UNST_ADJOINT_CHECKPOINTS must be at least 1.", CURRENT_FUNCTION);
+        }
+      }
+
+      if (Unst_Adj_TapeReplay > 0) {
+        if (!AD::PrimalTape) {
+          SU2_MPI::Error("UNST_ADJOINT_TAPE_REPLAY requires a primal value tape (meson option codi-tape=PrimalLinear).",
+                         CURRENT_FUNCTION);
+        }
+        if (GetGrid_Movement() || Deform_Mesh || Multizone_Problem) {
+          SU2_MPI::Error("UNST_ADJOINT_TAPE_REPLAY is only available for single-zone problems on static meshes.",
+                         CURRENT_FUNCTION);
+        }
+        /*--- Preaccumulated statements store their Jacobians and cannot be re-evaluated. ---*/
+        AD_Preaccumulation = false;
+#ifdef CODI_REVERSE_TYPE
+        AD::PreaccEnabled = false;
+#endif
+      }
+
     }
 
     /*--- Note that this is deliberately done at the end of this routine! ---*/
@@ -6942,6 +7069,12 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
           cout << "Function coefficients: {1/6, 1/3, 1/3, 1/6}" << endl;
           break;
 
+        case EULER_IMPLICIT:
+          cout << "Euler implicit method for the flow equations, Jacobian-free Newton-Krylov." << endl;
+          cout << "Element block Jacobi preconditioner updated every " << Implicit_Precond_Freq_DGFEM
+               << " iterations." << endl;
+          break;
+
         case ADER_DG:
           if(nLevels_TimeAccurateLTS == 1)
             cout << "ADER-DG for the flow equations with global time stepping." << endl;
@@ -8220,51 +8353,7 @@ string CConfig::GetObjFunc_Extension(string val_filename) const {
     Filename = Filename.substr(0, lastindex);
 
     if (nObj==1) {
-      switch (Kind_ObjFunc[0]) {
-        case DRAG_COEFFICIENT:            AdjExt = "_cd";       break;
-        case LIFT_COEFFICIENT:            AdjExt = "_cl";       break;
-        case SIDEFORCE_COEFFICIENT:       AdjExt = "_csf";      break;
-        case INVERSE_DESIGN_PRESSURE:     AdjExt = "_invpress"; break;
-        case INVERSE_DESIGN_HEATFLUX:     AdjExt = "_invheat";  break;
-        case MOMENT_X_COEFFICIENT:        AdjExt = "_cmx";      break;
-        case MOMENT_Y_COEFFICIENT:        AdjExt = "_cmy";      break;
-        case MOMENT_Z_COEFFICIENT:        AdjExt = "_cmz";      break;
-        case EFFICIENCY:                  AdjExt = "_eff";      break;
-        case EQUIVALENT_AREA:             AdjExt = "_ea";       break;
-        case NEARFIELD_PRESSURE:          AdjExt = "_nfp";      break;
-        case FORCE_X_COEFFICIENT:         AdjExt = "_cfx";      break;
-        case FORCE_Y_COEFFICIENT:         AdjExt = "_cfy";      break;
-        case FORCE_Z_COEFFICIENT:         AdjExt = "_cfz";      break;
-        case THRUST_COEFFICIENT:          AdjExt = "_ct";       break;
-        case TORQUE_COEFFICIENT:          AdjExt = "_cq";       break;
-        case TOTAL_HEATFLUX:              AdjExt = "_totheat";  break;
-        case MAXIMUM_HEATFLUX:            AdjExt = "_maxheat";  break;
-        case AVG_TEMPERATURE:             AdjExt = "_avtp";     break;
-        case FIGURE_OF_MERIT:             AdjExt = "_merit";    break;
-        case BUFFET_SENSOR:               AdjExt = "_buffet";   break;
-        case SURFACE_TOTAL_PRESSURE:      AdjExt = "_pt";       break;
-        case SURFACE_STATIC_PRESSURE:     AdjExt = "_pe";       break;
-        case SURFACE_STATIC_TEMPERATURE:  AdjExt = "_T";        break;
-        case SURFACE_MASSFLOW:            AdjExt = "_mfr";      break;
-        case SURFACE_UNIFORMITY:          AdjExt = "_uniform";  break;
-        case SURFACE_SECONDARY:           AdjExt = "_second";   break;
-        case SURFACE_MOM_DISTORTION:      AdjExt = "_distort";  break;
-        case SURFACE_SECOND_OVER_UNIFORM: AdjExt = "_sou";      break;
-        case SURFACE_PRESSURE_DROP:       AdjExt = "_dp";       break;
-        case SURFACE_SPECIES_0:           AdjExt = "_avgspec0"; break;
-        case SURFACE_SPECIES_VARIANCE:    AdjExt = "_specvar";  break;
-        case SURFACE_MACH:                AdjExt = "_mach";     break;
-        case CUSTOM_OBJFUNC:              AdjExt = "_custom";   break;
-        case FLOW_ANGLE_OUT:              AdjExt = "_fao";      break;
-        case MASS_FLOW_IN:                AdjExt = "_mfi";      break;
-        case ENTROPY_GENERATION:          AdjExt = "_entg";     break;
-        case REFERENCE_GEOMETRY:          AdjExt = "_refgeom";  break;
-        case REFERENCE_NODE:              AdjExt = "_refnode";  break;
-        case VOLUME_FRACTION:             AdjExt = "_volfrac";  break;
-        case TOPOL_DISCRETENESS:          AdjExt = "_topdisc";  break;
-        case TOPOL_COMPLIANCE:            AdjExt = "_topcomp";  break;
-        case STRESS_PENALTY:              AdjExt = "_stress";   break;
-      }
+      AdjExt = GetObjFunc_Suffix(0);
     }
     else{
       AdjExt = "_combo";
@@ -8279,6 +8368,58 @@ string CConfig::GetObjFunc_Extension(string val_filename) const {
   return Filename;
 }
 
+string CConfig::GetObjFunc_Suffix(unsigned short val_obj) const {
+
+  string AdjExt;
+
+  switch (Kind_ObjFunc[val_obj]) {
+    case DRAG_COEFFICIENT:            AdjExt = "_cd";       break;
+    case LIFT_COEFFICIENT:            AdjExt = "_cl";       break;
+    case SIDEFORCE_COEFFICIENT:       AdjExt = "_csf";      break;
+    case INVERSE_DESIGN_PRESSURE:     AdjExt = "_invpress"; break;
+    case INVERSE_DESIGN_HEATFLUX:     AdjExt = "_invheat";  break;
+    case MOMENT_X_COEFFICIENT:        AdjExt = "_cmx";      break;
+    case MOMENT_Y_COEFFICIENT:        AdjExt = "_cmy";      break;
+    case MOMENT_Z_COEFFICIENT:        AdjExt = "_cmz";      break;
+    case EFFICIENCY:                  AdjExt = "_eff";      break;
+    case EQUIVALENT_AREA:             AdjExt = "_ea";       break;
+    case NEARFIELD_PRESSURE:          AdjExt = "_nfp";      break;
+    case FORCE_X_COEFFICIENT:         AdjExt = "_cfx";      break;
+    case FORCE_Y_COEFFICIENT:         AdjExt = "_cfy";      break;
+    case FORCE_Z_COEFFICIENT:         AdjExt = "_cfz";      break;
+    case THRUST_COEFFICIENT:          AdjExt = "_ct";       break;
+    case TORQUE_COEFFICIENT:          AdjExt = "_cq";       break;
+    case TOTAL_HEATFLUX:              AdjExt = "_totheat";  break;
+    case MAXIMUM_HEATFLUX:            AdjExt = "_maxheat";  break;
+    case AVG_TEMPERATURE:             AdjExt = "_avtp";     break;
+    case FIGURE_OF_MERIT:             AdjExt = "_merit";    break;
+    case BUFFET_SENSOR:               AdjExt = "_buffet";   break;
+    case SURFACE_TOTAL_PRESSURE:      AdjExt = "_pt";       break;
+    case SURFACE_STATIC_PRESSURE:     AdjExt = "_pe";       break;
+    case SURFACE_STATIC_TEMPERATURE:  AdjExt = "_T";        break;
+    case SURFACE_MASSFLOW:            AdjExt = "_mfr";      break;
+    case SURFACE_UNIFORMITY:          AdjExt = "_uniform";  break;
+    case SURFACE_SECONDARY:           AdjExt = "_second";   break;
+    case SURFACE_MOM_DISTORTION:      AdjExt = "_distort";  break;
+    case SURFACE_SECOND_OVER_UNIFORM: AdjExt = "_sou";      break;
+    case SURFACE_PRESSURE_DROP:       AdjExt = "_dp";       break;
+    case SURFACE_SPECIES_0:           AdjExt = "_avgspec0"; break;
+    case SURFACE_SPECIES_VARIANCE:    AdjExt = "_specvar";  break;
+    case SURFACE_MACH:                AdjExt = "_mach";     break;
+    case CUSTOM_OBJFUNC:              AdjExt = "_custom";   break;
+    case FLOW_ANGLE_OUT:              AdjExt = "_fao";      break;
+    case MASS_FLOW_IN:                AdjExt = "_mfi";      break;
+    case ENTROPY_GENERATION:          AdjExt = "_entg";     break;
+    case REFERENCE_GEOMETRY:          AdjExt = "_refgeom";  break;
+    case REFERENCE_NODE:              AdjExt = "_refnode";  break;
+    case VOLUME_FRACTION:             AdjExt = "_volfrac";  break;
+    case TOPOL_DISCRETENESS:          AdjExt = "_topdisc";  break;
+    case TOPOL_COMPLIANCE:            AdjExt = "_topcomp";  break;
+    case STRESS_PENALTY:              AdjExt = "_stress";   break;
+  }
+  return AdjExt;
+}
+
 unsigned short CConfig::GetContainerPosition(unsigned short val_eqsystem) {
 
   switch (val_eqsystem) {
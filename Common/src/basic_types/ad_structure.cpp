@@ -41,6 +41,20 @@ namespace AD {
 
   bool PreaccEnabled = true;
 
+  unsigned short ActiveDirection = 0;
+
+  bool TrackRecording = false;
+
+  ReplayStage Replaying = ReplayStage::NONE;
+
+  size_t ReplayCursor = 0;
+
+  bool ReplayMismatch = false;
+
+  unsigned short ActiveSlot = 0;
+
+  TapeRecord TapeSlots[nTapeSlots];
+
   codi::PreaccumulationHelper<su2double> PreaccHelper;
 #ifdef HAVE_OPDI
   SU2_OMP(threadprivate(PreaccHelper))
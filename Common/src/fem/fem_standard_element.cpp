@@ -1940,6 +1940,11 @@ CFEMStandardElement::CFEMStandardElement(unsigned short          val_VTK_Type,
     case HEXAHEDRON:    DataStandardHexahedron();    break;
   }
 
+  /*--- Quadrilaterals and hexahedra have a tensor product basis and integration
+        rule, for which the 1D data of the sum factorization kernels is created. ---*/
+  nIntegration1D = 0;
+  if((VTK_Type == QUADRILATERAL) || (VTK_Type == HEXAHEDRON)) DataTensorProduct();
+
   /*--------------------------------------------------------------------------*/
   /*--- Create the data of the basis functions and its derivatives in the  ---*/
   /*--- integration points of the element.                                 ---*/
@@ -2223,6 +2228,125 @@ void CFEMStandardElement::BasisFunctionsAndDerivativesInPoint(
     MatMulRowMajor(nDOFs, 1, VDr[i], matVandermondeInv, dLagBasis[i]);
 }
 
+void CFEMStandardElement::SolAndGradIntTensorProduct(const unsigned short NPad,
+                                                     const bool           computeGrad,
+                                                     const su2double      *solDOFs,
+                                                     su2double            *solAndGradInt,
+                                                     su2double            *work) const {
+
+  /*--- Easier storage of the 1D sizes and matrices, as well as the
+        three work tensors. ---*/
+  const unsigned short nD = nPoly + 1;
+  const unsigned short nI = nIntegration1D;
+  const su2double *A = lagBasisLineInt.data();
+  const su2double *D = drLagBasisLineInt.data();
+
+  const unsigned long sizeWork = (unsigned long) NPad*max(nIntegration, nDOFs);
+  su2double *w0 = work;
+  su2double *w1 = w0 + sizeWork;
+  su2double *w2 = w1 + sizeWork;
+
+  /*--- Offset between the solution and its derivatives in solAndGradInt,
+        which is the layout of the product with matBasisIntegration. ---*/
+  const unsigned long offDeriv = (unsigned long) NPad*nIntegration;
+  su2double *solInt = solAndGradInt;
+  su2double *drInt  = solInt + offDeriv;
+  su2double *dsInt  = drInt  + offDeriv;
+  su2double *dtInt  = dsInt  + offDeriv;
+
+  if(VTK_Type == QUADRILATERAL) {
+
+    /*--- 2D. Contract the r-direction first, followed by the s-direction. ---*/
+    TensorContraction(A, false, nI, nD, 1, nD, NPad, NPad, solDOFs, false, w0);
+    TensorContraction(A, false, nI, nD, nI, 1, NPad, NPad, w0, false, solInt);
+
+    if( computeGrad ) {
+      TensorContraction(D, false, nI, nD, nI, 1, NPad, NPad, w0, false, dsInt);
+      TensorContraction(D, false, nI, nD, 1, nD, NPad, NPad, solDOFs, false, w1);
+      TensorContraction(A, false, nI, nD, nI, 1, NPad, NPad, w1, false, drInt);
+    }
+  }
+  else {
+
+    /*--- 3D. The intermediate tensors are shared between the solution and
+          the derivatives, such that 9 contractions are needed for all of them. ---*/
+    const unsigned long nII = nI*nI, nDD = nD*nD;
+
+    TensorContraction(A, false, nI, nD, 1, nDD, NPad, NPad, solDOFs, false, w0);
+
+    if( computeGrad ) {
+      TensorContraction(D, false, nI, nD, 1,  nDD, NPad, NPad, solDOFs, false, w1);
+      TensorContraction(A, false, nI, nD, nI, nD,  NPad, NPad, w1, false, w2);
+      TensorContraction(A, false, nI, nD, nII, 1,  NPad, NPad, w2, false, drInt);
+
+      TensorContraction(D, false, nI, nD, nI, nD,  NPad, NPad, w0, false, w2);
+      TensorContraction(A, false, nI, nD, nII, 1,  NPad, NPad, w2, false, dsInt);
+    }
+
+    TensorContraction(A, false, nI, nD, nI, nD, NPad, NPad, w0, false, w1);
+    TensorContraction(A, false, nI, nD, nII, 1, NPad, NPad, w1, false, solInt);
+
+    if( computeGrad )
+      TensorContraction(D, false, nI, nD, nII, 1, NPad, NPad, w1, false, dtInt);
+  }
+}
+
+void CFEMStandardElement::ResidualTensorProduct(const unsigned short NPad,
+                                                const su2double      *fluxes,
+                                                const su2double      *sources,
+                                                su2double            *res,
+                                                su2double            *work) const {
+
+  /*--- Easier storage of the 1D sizes and matrices, as well as the
+        three work tensors. ---*/
+  const unsigned short nD = nPoly + 1;
+  const unsigned short nI = nIntegration1D;
+  const su2double *A = lagBasisLineInt.data();
+  const su2double *D = drLagBasisLineInt.data();
+
+  const unsigned long sizeWork = (unsigned long) NPad*max(nIntegration, nDOFs);
+  su2double *w0 = work;
+  su2double *w1 = w0 + sizeWork;
+  su2double *w2 = w1 + sizeWork;
+
+  /*--- The fluxes of the directions are interleaved per integration point. ---*/
+  const unsigned short nDim   = (VTK_Type == QUADRILATERAL) ? 2 : 3;
+  const unsigned long strideF = (unsigned long) nDim*NPad;
+
+  if(VTK_Type == QUADRILATERAL) {
+
+    /*--- 2D. Transposed contraction of the r-direction, where the source terms
+          share the path of the r-fluxes, followed by the s-direction. ---*/
+    TensorContraction(D, true, nD, nI, 1, nI, NPad, strideF, fluxes, false, w0);
+    if( sources )
+      TensorContraction(A, true, nD, nI, 1, nI, NPad, NPad, sources, true, w0);
+    TensorContraction(A, true, nD, nI, 1, nI, NPad, strideF, fluxes+NPad, false, w1);
+
+    TensorContraction(A, true, nD, nI, nD, 1, NPad, NPad, w0, false, res);
+    TensorContraction(D, true, nD, nI, nD, 1, NPad, NPad, w1, true,  res);
+  }
+  else {
+
+    /*--- 3D. The r- and s-fluxes and the source terms share the final
+          contraction in t-direction. ---*/
+    const unsigned long nII = nI*nI, nDD = nD*nD;
+
+    TensorContraction(D, true, nD, nI, 1, nII, NPad, strideF, fluxes, false, w0);
+    if( sources )
+      TensorContraction(A, true, nD, nI, 1, nII, NPad, NPad, sources, true, w0);
+    TensorContraction(A, true, nD, nI, 1, nII, NPad, strideF, fluxes+NPad, false, w1);
+
+    TensorContraction(A, true, nD, nI, nD, nI, NPad, NPad, w0, false, w2);
+    TensorContraction(D, true, nD, nI, nD, nI, NPad, NPad, w1, true,  w2);
+
+    TensorContraction(A, true, nD, nI, 1,  nII, NPad, strideF, fluxes+2*NPad, false, w0);
+    TensorContraction(A, true, nD, nI, nD, nI,  NPad, NPad, w0, false, w1);
+
+    TensorContraction(A, true, nD, nI, nDD, 1, NPad, NPad, w2, false, res);
+    TensorContraction(D, true, nD, nI, nDD, 1, NPad, NPad, w1, true,  res);
+  }
+}
+
 bool CFEMStandardElement::SameStandardElement(unsigned short val_VTK_Type,
                                               unsigned short val_nPoly,
                                               bool           val_constJac) {
@@ -2272,6 +2396,9 @@ void CFEMStandardElement::Copy(const CFEMStandardElement &other) {
   matVandermondeInv   = other.matVandermondeInv;
   matBasisIntegration = other.matBasisIntegration;
   matDerBasisIntTrans = other.matDerBasisIntTrans;
+  nIntegration1D      = other.nIntegration1D;
+  lagBasisLineInt     = other.lagBasisLineInt;
+  drLagBasisLineInt   = other.drLagBasisLineInt;
   matDerBasisSolDOFs  = other.matDerBasisSolDOFs;
   matDerBasisOwnDOFs  = other.matDerBasisOwnDOFs;
   mat2ndDerBasisInt   = other.mat2ndDerBasisInt;
@@ -2399,6 +2526,57 @@ void CFEMStandardElement::CreateBasisFunctionsAndMatrixDerivatives(
     matDerBasis[ii] = dtLagBasisLoc[i];
 }
 
+void CFEMStandardElement::DataTensorProduct(void) {
+
+  /*--- The integration points of quadrilaterals and hexahedra are a tensor
+        product of the 1D Gauss-Legendre points, where the r-direction runs
+        fastest. Hence the first nIntegration1D points are the 1D points. ---*/
+  nIntegration1D = orderExact/2 + 1;
+  vector<su2double> rLine(rIntegration.begin(), rIntegration.begin()+nIntegration1D);
+
+  /*--- Determine the 1D Lagrangian basis functions and its derivatives
+        in the 1D integration points. ---*/
+  unsigned short nDOFsLine;
+  vector<su2double> rDOFsLine, matVandermondeInvDummy;
+  LagrangianBasisFunctionAndDerivativesLine(nPoly, rLine, nDOFsLine, rDOFsLine,
+                                            matVandermondeInvDummy,
+                                            lagBasisLineInt, drLagBasisLineInt);
+}
+
+void CFEMStandardElement::TensorContraction(const su2double      *A,
+                                            const bool           trans,
+                                            const unsigned short nOut,
+                                            const unsigned short nIn,
+                                            const unsigned long  nBefore,
+                                            const unsigned long  nAfter,
+                                            const unsigned short NPad,
+                                            const unsigned long  strideIn,
+                                            const su2double      *in,
+                                            const bool           addToOut,
+                                            su2double            *out) {
+
+  for(unsigned long p=0; p<nAfter; ++p) {
+    for(unsigned short k=0; k<nOut; ++k) {
+      for(unsigned long q=0; q<nBefore; ++q) {
+
+        su2double *rowOut = out + NPad*(q + nBefore*(k + nOut*p));
+        if( !addToOut ) {
+          for(unsigned short c=0; c<NPad; ++c) rowOut[c] = 0.0;
+        }
+
+        /*--- Loop over the contracted direction. The innermost loop over
+              the padded vectors is contiguous in memory. ---*/
+        for(unsigned short l=0; l<nIn; ++l) {
+          const su2double a = trans ? A[l*nOut+k] : A[k*nIn+l];
+          const su2double *rowIn = in + strideIn*(q + nBefore*(l + nIn*p));
+          SU2_OMP_SIMD
+          for(unsigned short c=0; c<NPad; ++c) rowOut[c] += a*rowIn[c];
+        }
+      }
+    }
+  }
+}
+
 void CFEMStandardElement::DataStandardLine(void) {
 
   /*--- Determine the Lagrangian basis functions and its derivatives
@@ -32,6 +32,7 @@
 #include "../../include/parallelization/omp_structure.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
 #include "../../include/toolboxes/ndflattener.hpp"
+#include "../../include/toolboxes/CRegionProfiler.hpp"
 
 CGeometry::CGeometry(void) :
   size(SU2_MPI::GetSize()),
@@ -627,6 +628,8 @@ void CGeometry::InitiateComms(CGeometry *geometry,
 
   if (nP2PSend == 0) return;
 
+  SU2_PROFILE_SCOPE("Halo_Comms");
+
   /*--- Local variables ---*/
 
   unsigned short iDim;
@@ -734,6 +737,8 @@ void CGeometry::CompleteComms(CGeometry *geometry,
 
   if (nP2PRecv == 0) return;
 
+  SU2_PROFILE_SCOPE("Halo_Comms");
+
   /*--- Local variables ---*/
 
   unsigned short iDim, COUNT_PER_POINT = 0, MPI_TYPE = 0;
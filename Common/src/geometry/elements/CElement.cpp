@@ -83,3 +83,25 @@ void CElement::ClearElement(void) {
     kab_i.setConstant(0.0);
 }
 
+
+void CElement::GetRefGradients(su2double* data) const {
+
+  for (const auto& gauss : GaussPoint) {
+    *(data++) = gauss.GetJ_X();
+    for (unsigned short iNode = 0; iNode < nNodes; ++iNode)
+      for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+        *(data++) = gauss.GetGradNi_Xj(iNode, iDim);
+  }
+}
+
+void CElement::LoadRefGradients() {
+
+  const su2double* data = RefGradients;
+
+  for (auto& gauss : GaussPoint) {
+    gauss.SetJ_X(*(data++));
+    for (unsigned short iNode = 0; iNode < nNodes; ++iNode)
+      for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+        gauss.SetGradNi_Xj(*(data++), iDim, iNode);
+  }
+}
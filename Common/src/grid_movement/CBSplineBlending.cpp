@@ -27,6 +27,7 @@
 
 #include "../../include/grid_movement/CBSplineBlending.hpp"
 #include "../../include/parallelization/mpi_structure.hpp"
+#include "../../include/parallelization/omp_structure.hpp"
 
 CBSplineBlending::CBSplineBlending(short val_order, short n_controlpoints): CFreeFormBlending(){
   SetOrder(val_order, n_controlpoints);
@@ -61,7 +62,7 @@ void CBSplineBlending::SetOrder(short val_order, short n_controlpoints){
 
   /*--- Allocate the temporary vectors for the basis evaluation ---*/
 
-  N.resize(Order, vector<su2double>(Order, 0.0));
+  N.assign(omp_get_max_threads(), vector<vector<su2double> >(Order, vector<su2double>(Order, 0.0)));
 }
 
 su2double CBSplineBlending::GetBasis(short val_i, su2double val_t){
@@ -79,6 +80,8 @@ su2double CBSplineBlending::GetBasis(short val_i, su2double val_t){
   unsigned short j,k;
   su2double saved, temp;
 
+  auto& N = this->N[omp_get_thread_num()];
+
   for (j = 0; j < Order; j++){
     if ((val_t >= U[val_i+j]) && (val_t < U[val_i+j+1])) N[j][0] = 1.0;
     else N[j][0] = 0;
@@ -108,6 +111,8 @@ su2double CBSplineBlending::GetDerivative(short val_i, su2double val_t, short va
 
   GetBasis(val_i, val_t);
 
+  const auto& N = this->N[omp_get_thread_num()];
+
   /*--- Use the recursive definition for the derivative (hardcoded for 1st and 2nd derivative). ---*/
 
   if (val_order_der == 0){ return N[0][Order-1];}
@@ -38,7 +38,17 @@ CBezierBlending::~CBezierBlending(){}
 void CBezierBlending::SetOrder(short val_order, short n_controlpoints){
   Order  = val_order;
   Degree = Order - 1;
-  binomial.resize(Order+1, 0.0);
+
+  /*--- Tabulate the binomial coefficients, row n holds n over m for m = 0,...,n. ---*/
+
+  binomial.assign(Order+1, vector<su2double>(Order+1, 0.0));
+
+  for (unsigned short n = 0; n <= Order; ++n) {
+    binomial[n][0] = 1.0;
+    for (unsigned short m = 1; m <= n; ++m) {
+      binomial[n][m] = binomial[n-1][m-1] + binomial[n-1][m];
+    }
+  }
 }
 
 su2double CBezierBlending::GetBasis(short val_i, su2double val_t){
@@ -99,23 +109,3 @@ su2double CBezierBlending::GetBernsteinDerivative(short val_n, short val_i, su2d
 
   return value;
 }
-
-su2double CBezierBlending::Binomial(unsigned short n, unsigned short m){
-
-  unsigned short i, j;
-  su2double result;
-
-  binomial[0] = 1.0;
-  for (i = 1; i <= n; ++i) {
-    binomial[i] = 1.0;
-    for (j = i-1U; j > 0; --j) {
-      binomial[j] += binomial[j-1U];
-    }
-  }
-
-  result = binomial[m];
-  if (fabs(result) < EPS*EPS) { result = 0.0; }
-
-  return result;
-
-}
@@ -28,6 +28,8 @@
 #include "../../include/grid_movement/CFreeFormDefBox.hpp"
 #include "../../include/grid_movement/CBezierBlending.hpp"
 #include "../../include/grid_movement/CBSplineBlending.hpp"
+#include "../../include/adt/CADTPointsOnlyClass.hpp"
+#include "../../include/parallelization/omp_structure.hpp"
 
 CFreeFormDefBox::CFreeFormDefBox(void) : CGridMovement() { }
 
@@ -48,7 +50,6 @@ CFreeFormDefBox::CFreeFormDefBox(const unsigned short Degree[], unsigned short B
 
   ParamCoord = new su2double[nDim]; ParamCoord_ = new su2double[nDim];
   cart_coord = new su2double[nDim]; cart_coord_ = new su2double[nDim];
-  Gradient = new su2double[nDim];
 
   lDegree = Degree[0]; lOrder = lDegree+1;
   mDegree = Degree[1]; mOrder = mDegree+1;
@@ -130,7 +131,6 @@ CFreeFormDefBox::~CFreeFormDefBox(void) {
   delete [] ParamCoord_;
   delete [] cart_coord;
   delete [] cart_coord_;
-  delete [] Gradient;
 
   for (iCornerPoints = 0; iCornerPoints < nCornerPoints; iCornerPoints++)
     delete [] Coord_Corner_Points[iCornerPoints];
@@ -770,26 +770,103 @@ su2double *CFreeFormDefBox::GetParametricCoord_Analytical(const su2double *cart_
 }
 
 su2double *CFreeFormDefBox::EvalCartesianCoord(su2double *ParamCoord) const {
+
+  EvalCartesianCoord(ParamCoord, cart_coord);
+
+  return cart_coord;
+}
+
+void CFreeFormDefBox::EvalCartesianCoord(const su2double *uvw, su2double *xyz) const {
   unsigned short iDim, iDegree, jDegree, kDegree;
 
   for (iDim = 0; iDim < nDim; iDim++)
-    cart_coord[iDim] = 0.0;
+    xyz[iDim] = 0.0;
 
   for (iDegree = 0; iDegree <= lDegree; iDegree++)
     for (jDegree = 0; jDegree <= mDegree; jDegree++)
       for (kDegree = 0; kDegree <= nDegree; kDegree++)
         for (iDim = 0; iDim < nDim; iDim++) {
-          cart_coord[iDim] += Coord_Control_Points[iDegree][jDegree][kDegree][iDim]
-          * BlendingFunction[0]->GetBasis(iDegree, ParamCoord[0])
-          * BlendingFunction[1]->GetBasis(jDegree, ParamCoord[1])
-          * BlendingFunction[2]->GetBasis(kDegree, ParamCoord[2]);
+          xyz[iDim] += Coord_Control_Points[iDegree][jDegree][kDegree][iDim]
+          * BlendingFunction[0]->GetBasis(iDegree, uvw[0])
+          * BlendingFunction[1]->GetBasis(jDegree, uvw[1])
+          * BlendingFunction[2]->GetBasis(kDegree, uvw[2]);
         }
+}
 
-  return cart_coord;
+void CFreeFormDefBox::SetSurfaceBasis() {
+
+  const unsigned long nPoint = GetnSurfacePoint();
+  const unsigned short order[3] = {lOrder, mOrder, nOrder};
+
+  for (unsigned short iDir = 0; iDir < 3; iDir++) {
+    SurfaceBasis[iDir].resize(nPoint*order[iDir]);
+    SurfaceBasisOrder[iDir] = order[iDir];
+  }
+
+  SU2_OMP_PARALLEL
+  {
+    SU2_OMP_FOR_STAT(256)
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+      for (unsigned short iDir = 0; iDir < 3; iDir++) {
+        for (unsigned short iOrder = 0; iOrder < order[iDir]; iOrder++) {
+          SurfaceBasis[iDir][iPoint*order[iDir]+iOrder] =
+            BlendingFunction[iDir]->GetBasis(iOrder, ParametricCoord[iDir][iPoint]);
+        }
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+  END_SU2_OMP_PARALLEL
+
+  SurfaceBasisValid = true;
 }
 
+void CFreeFormDefBox::EvalCartesianCoord_SurfacePoints(su2double *xyz) {
+
+  const unsigned long nPoint = GetnSurfacePoint();
 
-su2double *CFreeFormDefBox::GetFFDGradient(su2double *val_coord, su2double *xyz) {
+  if (!SurfaceBasisValid || (SurfaceBasis[0].size() != nPoint*lOrder) ||
+      (SurfaceBasisOrder[0] != lOrder) || (SurfaceBasisOrder[1] != mOrder) || (SurfaceBasisOrder[2] != nOrder)) {
+    SetSurfaceBasis();
+  }
+
+  /*--- For each point, contract the n direction, then m, then l (instead of
+   *    evaluating the product of the three basis for each control point). ---*/
+
+  SU2_OMP_PARALLEL
+  {
+    SU2_OMP_FOR_STAT(256)
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+      const su2double* Bl = &SurfaceBasis[0][iPoint*lOrder];
+      const su2double* Bm = &SurfaceBasis[1][iPoint*mOrder];
+      const su2double* Bn = &SurfaceBasis[2][iPoint*nOrder];
+
+      su2double coord[3] = {0.0, 0.0, 0.0};
+
+      for (unsigned short iOrder = 0; iOrder < lOrder; iOrder++) {
+        su2double coord_l[3] = {0.0, 0.0, 0.0};
+
+        for (unsigned short jOrder = 0; jOrder < mOrder; jOrder++) {
+          su2double coord_m[3] = {0.0, 0.0, 0.0};
+
+          for (unsigned short kOrder = 0; kOrder < nOrder; kOrder++)
+            for (unsigned short iDim = 0; iDim < 3; iDim++)
+              coord_m[iDim] += Bn[kOrder] * Coord_Control_Points[iOrder][jOrder][kOrder][iDim];
+
+          for (unsigned short iDim = 0; iDim < 3; iDim++) coord_l[iDim] += Bm[jOrder] * coord_m[iDim];
+        }
+        for (unsigned short iDim = 0; iDim < 3; iDim++) coord[iDim] += Bl[iOrder] * coord_l[iDim];
+      }
+
+      for (unsigned short iDim = 0; iDim < 3; iDim++) xyz[3*iPoint+iDim] = coord[iDim];
+    }
+    END_SU2_OMP_FOR
+  }
+  END_SU2_OMP_PARALLEL
+
+}
+
+void CFreeFormDefBox::GetFFDGradient(su2double *val_coord, const su2double *xyz, su2double *val_Gradient) const {
 
   unsigned short iDim, jDim, lmn[3];
 
@@ -797,18 +874,16 @@ su2double *CFreeFormDefBox::GetFFDGradient(su2double *val_coord, su2double *xyz)
 
   lmn[0] = lDegree; lmn[1] = mDegree; lmn[2] = nDegree;
 
-  for (iDim = 0; iDim < nDim; iDim++) Gradient[iDim] = 0.0;
+  for (iDim = 0; iDim < nDim; iDim++) val_Gradient[iDim] = 0.0;
 
   for (iDim = 0; iDim < nDim; iDim++)
     for (jDim = 0; jDim < nDim; jDim++)
-      Gradient[jDim] += GetDerivative2(val_coord, iDim, xyz,  lmn) *
+      val_Gradient[jDim] += GetDerivative2(val_coord, iDim, xyz,  lmn) *
       GetDerivative3(val_coord, iDim, jDim, lmn);
 
-  return Gradient;
-
 }
 
-void CFreeFormDefBox::GetFFDHessian(su2double *uvw, su2double *xyz, su2double **val_Hessian) {
+void CFreeFormDefBox::GetFFDHessian(su2double *uvw, const su2double *xyz, su2double val_Hessian[3][3]) const {
 
   unsigned short iDim, jDim, lmn[3];
 
@@ -851,7 +926,19 @@ void CFreeFormDefBox::GetFFDHessian(su2double *uvw, su2double *xyz, su2double **
 
 su2double *CFreeFormDefBox::GetParametricCoord_Iterative(unsigned long iPoint, su2double *xyz, const su2double *ParamCoordGuess, CConfig *config) {
 
-  su2double *IndepTerm, SOR_Factor = 1.0, MinNormError, NormError, Determinant, AdjHessian[3][3], Temp[3] = {0.0,0.0,0.0};
+  if (!GetParametricCoord_Iterative(xyz, ParamCoordGuess, config, ParamCoord)) {
+    cout << "Unknown point: "<< iPoint <<" (" << xyz[0] <<", "<< xyz[1] <<", "<< xyz[2] <<"). Increase the value of FFD_ITERATIONS." << endl;
+  }
+
+  return ParamCoord;
+
+}
+
+bool CFreeFormDefBox::GetParametricCoord_Iterative(const su2double *xyz, const su2double *ParamCoordGuess,
+                                                   const CConfig *config, su2double *ParamCoord) const {
+
+  su2double IndepTerm[3], Gradient[3], Hessian[3][3];
+  su2double SOR_Factor = 1.0, Determinant, AdjHessian[3][3], Temp[3] = {0.0,0.0,0.0};
   unsigned short iDim, jDim, RandonCounter;
   unsigned long iter;
 
@@ -859,17 +946,14 @@ su2double *CFreeFormDefBox::GetParametricCoord_Iterative(unsigned long iPoint, s
   unsigned short it_max = config->GetnFFD_Iter();
   unsigned short Random_Trials = 500;
 
-  /*--- Allocate the Hessian ---*/
+  /*--- Initialize with the guess (all the work variables are local, for thread-safety) ---*/
 
-  Hessian = new su2double* [nDim];
-  IndepTerm = new su2double [nDim];
   for (iDim = 0; iDim < nDim; iDim++) {
-    Hessian[iDim] = new su2double[nDim];
     ParamCoord[iDim] = ParamCoordGuess[iDim];
     IndepTerm [iDim] = 0.0;
   }
 
-  RandonCounter = 0; MinNormError = 1E6;
+  RandonCounter = 0;
 
   /*--- External iteration ---*/
 
@@ -877,7 +961,7 @@ su2double *CFreeFormDefBox::GetParametricCoord_Iterative(unsigned long iPoint, s
 
     /*--- The independent term of the solution of our system is -Gradient(sol_old) ---*/
 
-    Gradient = GetFFDGradient(ParamCoord, xyz);
+    GetFFDGradient(ParamCoord, xyz, Gradient);
 
     for (iDim = 0; iDim < nDim; iDim++) IndepTerm[iDim] = - Gradient[iDim];
 
@@ -923,29 +1007,22 @@ su2double *CFreeFormDefBox::GetParametricCoord_Iterative(unsigned long iPoint, s
 
     /*--- If the gradient is small, we have converged ---*/
 
-    if ((fabs(IndepTerm[0]) < tol) && (fabs(IndepTerm[1]) < tol) && (fabs(IndepTerm[2]) < tol))  break;
-
-    /*--- Compute the norm of the error ---*/
-
-    NormError = 0.0;
-    for (iDim = 0; iDim < nDim; iDim++)
-      NormError += IndepTerm[iDim]*IndepTerm[iDim];
-    NormError = sqrt(NormError);
-
-    MinNormError = min(NormError, MinNormError);
+    if ((fabs(IndepTerm[0]) < tol) && (fabs(IndepTerm[1]) < tol) && (fabs(IndepTerm[2]) < tol))  return true;
 
     /*--- If we have no convergence with Random_Trials iterations probably we are in a local minima. ---*/
 
     if (((iter % it_max) == 0) && (iter != 0)) {
 
       RandonCounter++;
-      if (RandonCounter == Random_Trials) {
-        cout << endl << "Unknown point: "<< iPoint <<" (" << xyz[0] <<", "<< xyz[1] <<", "<< xyz[2] <<"). Min Error: "<< MinNormError <<". Iter: "<< iter <<"."<< endl;
-      }
-      else {
+      if (RandonCounter < Random_Trials) {
+        /*--- Restart from a deterministic (additive recurrence) sequence of points around the guess,
+         *    rand() is neither reproducible nor thread-safe. ---*/
+        const su2double alpha[3] = {0.8191725134, 0.6710436067, 0.5497004779};
         SOR_Factor = 0.1;
-        for (iDim = 0; iDim < nDim; iDim++)
-          ParamCoord[iDim] = su2double(rand())/su2double(RAND_MAX);
+        for (iDim = 0; iDim < nDim; iDim++) {
+          const su2double t = ParamCoordGuess[iDim] + RandonCounter*alpha[iDim];
+          ParamCoord[iDim] = t - floor(t);
+        }
       }
 
     }
@@ -966,20 +1043,102 @@ su2double *CFreeFormDefBox::GetParametricCoord_Iterative(unsigned long iPoint, s
 
   }
 
-  for (iDim = 0; iDim < nDim; iDim++)
-    delete [] Hessian[iDim];
-  delete [] Hessian;
-  delete [] IndepTerm;
-
   /*--- The code has hit the max number of iterations ---*/
 
-  if (iter == (unsigned long)it_max*Random_Trials) {
-    cout << "Unknown point: (" << xyz[0] <<", "<< xyz[1] <<", "<< xyz[2] <<"). Increase the value of FFD_ITERATIONS." << endl;
+  return false;
+
+}
+
+void CFreeFormDefBox::GetParametricCoord_Parallel(unsigned long nPoint, const su2double *xyz, const unsigned long *pointID,
+                                                  const CConfig *config, su2double *uvw) const {
+
+  if (nPoint == 0) return;
+
+  /*--- Sample the box on a regular grid of parametric coordinates, the nearest sample to each
+   *    point is used as initial guess for the Newton iterations. The Cartesian coordinates of
+   *    the samples are computed by tensor-product (one direction at a time) with tabulated basis. ---*/
+
+  const unsigned short order[3] = {lOrder, mOrder, nOrder};
+  unsigned long nSample[3];
+  vector<su2double> param[3], basis[3];
+
+  /*--- The last sample is placed just below 1, B-spline basis are defined on [0,1) and all vanish at 1. ---*/
+  const su2double tMax = 1.0 - 1e-8;
+
+  for (unsigned short iDir = 0; iDir < 3; iDir++) {
+    nSample[iDir] = min(2ul*order[iDir]+1, 65ul);
+    param[iDir].resize(nSample[iDir]);
+    basis[iDir].resize(nSample[iDir]*order[iDir]);
+    for (auto iSample = 0ul; iSample < nSample[iDir]; iSample++) {
+      const su2double t = min(su2double(iSample) / (nSample[iDir]-1), tMax);
+      param[iDir][iSample] = t;
+      for (unsigned short iOrder = 0; iOrder < order[iDir]; iOrder++)
+        basis[iDir][iSample*order[iDir]+iOrder] = BlendingFunction[iDir]->GetBasis(iOrder, t);
+    }
   }
+  const auto nS0 = nSample[0], nS1 = nSample[1], nS2 = nSample[2];
 
-  /*--- Real Solution is now ParamCoord; Return it ---*/
+  /*--- Contract the n direction, then m, then l. ---*/
 
-  return ParamCoord;
+  vector<su2double> T1(lOrder*mOrder*nS2*3, 0.0), T2(lOrder*nS1*nS2*3, 0.0), coord(nS0*nS1*nS2*3, 0.0);
+
+  for (unsigned short i = 0; i < lOrder; i++)
+    for (unsigned short j = 0; j < mOrder; j++)
+      for (auto s2 = 0ul; s2 < nS2; s2++)
+        for (unsigned short k = 0; k < nOrder; k++)
+          for (unsigned short iDim = 0; iDim < 3; iDim++)
+            T1[((i*mOrder+j)*nS2+s2)*3+iDim] += basis[2][s2*nOrder+k] * Coord_Control_Points[i][j][k][iDim];
+
+  for (unsigned short i = 0; i < lOrder; i++)
+    for (auto s1 = 0ul; s1 < nS1; s1++)
+      for (unsigned short j = 0; j < mOrder; j++)
+        for (auto s2 = 0ul; s2 < nS2; s2++)
+          for (unsigned short iDim = 0; iDim < 3; iDim++)
+            T2[((i*nS1+s1)*nS2+s2)*3+iDim] += basis[1][s1*mOrder+j] * T1[((i*mOrder+j)*nS2+s2)*3+iDim];
+
+  for (auto s0 = 0ul; s0 < nS0; s0++)
+    for (unsigned short i = 0; i < lOrder; i++)
+      for (auto s1 = 0ul; s1 < nS1; s1++)
+        for (auto s2 = 0ul; s2 < nS2; s2++)
+          for (unsigned short iDim = 0; iDim < 3; iDim++)
+            coord[((s0*nS1+s1)*nS2+s2)*3+iDim] += basis[0][s0*lOrder+i] * T2[((i*nS1+s1)*nS2+s2)*3+iDim];
+
+  const auto nSampleTotal = nS0*nS1*nS2;
+  vector<unsigned long> sampleID(nSampleTotal);
+  for (auto iSample = 0ul; iSample < nSampleTotal; iSample++) sampleID[iSample] = iSample;
+
+  CADTPointsOnlyClass sampleTree(3, nSampleTotal, coord.data(), sampleID.data(), false);
+
+  /*--- The inversion of each point is independent, the points that are not found are reported afterwards,
+   *    the worker threads do not write messages. ---*/
+
+  vector<char> found(nPoint);
+
+  SU2_OMP_PARALLEL
+  {
+    SU2_OMP_FOR_DYN(8)
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+      su2double dist;
+      unsigned long iSample;
+      int rankID;
+      sampleTree.DetermineNearestNode(&xyz[3*iPoint], dist, iSample, rankID);
+
+      const unsigned long s[3] = {iSample / (nS1*nS2), (iSample / nS2) % nS1, iSample % nS2};
+      su2double guess[3];
+      for (unsigned short iDir = 0; iDir < 3; iDir++) guess[iDir] = param[iDir][s[iDir]];
+
+      found[iPoint] = GetParametricCoord_Iterative(&xyz[3*iPoint], guess, config, &uvw[3*iPoint]);
+    }
+    END_SU2_OMP_FOR
+  }
+  END_SU2_OMP_PARALLEL
+
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+    if (found[iPoint]) continue;
+    const su2double* point = &xyz[3*iPoint];
+    cout << "Unknown point: "<< pointID[iPoint] <<" (" << point[0] <<", "<< point[1] <<", "<< point[2]
+         <<"). Increase the value of FFD_ITERATIONS." << endl;
+  }
 
 }
 
@@ -1103,14 +1262,12 @@ su2double CFreeFormDefBox::GetDerivative2 (su2double *uvw, unsigned short dim, c
   return 2.0*(value - xyz[dim]);
 }
 
-su2double CFreeFormDefBox::GetDerivative3(su2double *uvw, unsigned short dim, unsigned short diff_this, unsigned short *lmn) {
+su2double CFreeFormDefBox::GetDerivative3(su2double *uvw, unsigned short dim, unsigned short diff_this, unsigned short *lmn) const {
 
-  unsigned short iDegree, jDegree, kDegree, iDim;
+  unsigned short iDegree, jDegree, kDegree;
   su2double value = 0;
 
-  unsigned short *ijk = new unsigned short[nDim];
-
-  for (iDim = 0; iDim < nDim; iDim++) ijk[iDim] = 0;
+  unsigned short ijk[3] = {0, 0, 0};
 
   for (iDegree = 0; iDegree <= lmn[0]; iDegree++)
     for (jDegree = 0; jDegree <= lmn[1]; jDegree++)
@@ -1120,8 +1277,6 @@ su2double CFreeFormDefBox::GetDerivative3(su2double *uvw, unsigned short dim, un
         GetDerivative1(uvw, diff_this, ijk, lmn);
       }
 
-  delete [] ijk;
-
   return value;
 }
 
@@ -1148,14 +1303,12 @@ su2double CFreeFormDefBox::GetDerivative4(su2double *uvw, unsigned short val_dif
 }
 
 su2double CFreeFormDefBox::GetDerivative5(su2double *uvw, unsigned short dim, unsigned short diff_this, unsigned short diff_this_also,
-                                      unsigned short *lmn) {
+                                      unsigned short *lmn) const {
 
-  unsigned short iDegree, jDegree, kDegree, iDim;
+  unsigned short iDegree, jDegree, kDegree;
   su2double value = 0.0;
 
-  unsigned short *ijk = new unsigned short[nDim];
-
-  for (iDim = 0; iDim < nDim; iDim++) ijk[iDim] = 0;
+  unsigned short ijk[3] = {0, 0, 0};
 
   for (iDegree = 0; iDegree <= lmn[0]; iDegree++)
     for (jDegree = 0; jDegree <= lmn[1]; jDegree++)
@@ -1165,7 +1318,5 @@ su2double CFreeFormDefBox::GetDerivative5(su2double *uvw, unsigned short dim, un
         GetDerivative4(uvw, diff_this, diff_this_also, ijk, lmn);
       }
 
-  delete [] ijk;
-
   return value;
 }
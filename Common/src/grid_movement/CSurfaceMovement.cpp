@@ -27,6 +27,106 @@
 
 #include "../../include/grid_movement/CSurfaceMovement.hpp"
 #include "../../include/toolboxes/C1DInterpolation.hpp"
+#include "../../include/parallelization/omp_structure.hpp"
+
+#include <fstream>
+#include <cstring>
+
+namespace {
+
+/*--- The parametric coordinates of the surface points are cached in binary files, one per box and
+ *    rank, with a key (hash) of everything the point inversion depends on. A cache file that does
+ *    not match the current surface or box is ignored and rewritten. ---*/
+
+const char FFDCacheMagic[8] = {'S','U','2','F','F','D','P','C'};
+
+void HashBytes(const void* data, size_t size, uint64_t& hash) {
+  const auto* bytes = static_cast<const unsigned char*>(data);
+  for (size_t i = 0; i < size; ++i) {
+    hash ^= bytes[i];
+    hash *= 1099511628211ull;
+  }
+}
+
+template <class T>
+void HashValue(const T& val, uint64_t& hash) { HashBytes(&val, sizeof(T), hash); }
+
+void HashValue(const su2double& val, uint64_t& hash) {
+  const passivedouble passive = SU2_TYPE::GetValue(val);
+  HashBytes(&passive, sizeof(passivedouble), hash);
+}
+
+bool ReadFFDInversionCache(const string& fileName, uint64_t key, vector<su2double>& paramCoord) {
+  ifstream file(fileName, ios::binary);
+  if (!file.is_open()) return false;
+
+  char magic[8];
+  uint64_t fileKey = 0, size = 0;
+  file.read(magic, sizeof(magic));
+  file.read(reinterpret_cast<char*>(&fileKey), sizeof(uint64_t));
+  file.read(reinterpret_cast<char*>(&size), sizeof(uint64_t));
+  if (!file || memcmp(magic, FFDCacheMagic, sizeof(magic)) != 0 || fileKey != key || size != paramCoord.size())
+    return false;
+
+  vector<passivedouble> buffer(size);
+  file.read(reinterpret_cast<char*>(buffer.data()), size*sizeof(passivedouble));
+  if (!file) return false;
+
+  for (size_t i = 0; i < size; ++i) paramCoord[i] = buffer[i];
+  return true;
+}
+
+void WriteFFDInversionCache(const string& fileName, uint64_t key, const vector<su2double>& paramCoord) {
+  ofstream file(fileName, ios::binary);
+  if (!file.is_open()) {
+    cout << "WARNING: Could not write the FFD inversion cache " << fileName << "." << endl;
+    return;
+  }
+  const uint64_t size = paramCoord.size();
+  vector<passivedouble> buffer(size);
+  for (size_t i = 0; i < size; ++i) buffer[i] = SU2_TYPE::GetValue(paramCoord[i]);
+
+  file.write(FFDCacheMagic, sizeof(FFDCacheMagic));
+  file.write(reinterpret_cast<const char*>(&key), sizeof(uint64_t));
+  file.write(reinterpret_cast<const char*>(&size), sizeof(uint64_t));
+  file.write(reinterpret_cast<const char*>(buffer.data()), size*sizeof(passivedouble));
+}
+
+}  // namespace
+
+uint64_t CSurfaceMovement::FFDInversionKey(const CConfig* config, CFreeFormDefBox* FFDBox,
+                                           const vector<unsigned short>& markerIdx, const vector<unsigned long>& vertexIdx,
+                                           const vector<unsigned long>& pointIdx, const vector<su2double>& cartCoord) {
+  uint64_t hash = 14695981039346656037ull;
+
+  const auto tag = FFDBox->GetTag();
+  HashBytes(tag.data(), tag.size(), hash);
+
+  const unsigned short order[] = {FFDBox->GetlOrder(), FFDBox->GetmOrder(), FFDBox->GetnOrder()};
+  for (auto val : order) HashValue(val, hash);
+  HashValue(config->GetFFD_Blending(), hash);
+  for (unsigned short iDim = 0; iDim < 3; ++iDim) HashValue(config->GetFFD_BSplineOrder()[iDim], hash);
+  HashValue(config->GetFFD_CoordSystem(), hash);
+  HashValue(config->GetFFD_Tol(), hash);
+  HashValue(config->GetnFFD_Iter(), hash);
+
+  for (unsigned short i = 0; i < order[0]; ++i)
+    for (unsigned short j = 0; j < order[1]; ++j)
+      for (unsigned short k = 0; k < order[2]; ++k) {
+        const su2double* coord = FFDBox->GetCoordControlPoints(i, j, k);
+        for (unsigned short iDim = 0; iDim < 3; ++iDim) HashValue(coord[iDim], hash);
+      }
+
+  const uint64_t nPoint = pointIdx.size();
+  HashValue(nPoint, hash);
+  for (size_t i = 0; i < nPoint; ++i) {
+    HashValue(markerIdx[i], hash);
+    HashValue(vertexIdx[i], hash);
+    HashValue(pointIdx[i], hash);
+    for (unsigned short iDim = 0; iDim < 3; ++iDim) HashValue(cartCoord[3*i+iDim], hash);
+  }
+  return hash;
+}
 
 CSurfaceMovement::CSurfaceMovement(void) : CGridMovement() {
 
@@ -732,8 +832,8 @@ void CSurfaceMovement::CopyBoundary(CGeometry *geometry, CConfig *config) {
 void CSurfaceMovement::SetParametricCoord(CGeometry *geometry, CConfig *config, CFreeFormDefBox *FFDBox, unsigned short iFFDBox) {
 
   unsigned short iMarker, iDim, iOrder, jOrder, kOrder, lOrder, mOrder, nOrder;
-  unsigned long iVertex, iPoint, TotalVertex = 0;
-  su2double *CartCoordNew, *ParamCoord, CartCoord[3], ParamCoordGuess[3], MaxDiff, my_MaxDiff = 0.0, Diff, *Coord;
+  unsigned long iVertex, iPoint;
+  su2double *ParamCoord, CartCoord[3], MaxDiff, my_MaxDiff = 0.0, Diff, *Coord;
   unsigned short nDim = geometry->GetnDim();
   su2double X_0, Y_0, Z_0, Xbar, Ybar, Zbar;
 
@@ -771,17 +871,12 @@ void CSurfaceMovement::SetParametricCoord(CGeometry *geometry, CConfig *config,
     FFDBox->BlendingFunction[1]->SetOrder(2, 2);
     FFDBox->BlendingFunction[2]->SetOrder(2, 2);
   }
-  /*--- Point inversion algorithm with a basic box ---*/
-
-  ParamCoordGuess[0]  = 0.5; ParamCoordGuess[1] = 0.5; ParamCoordGuess[2] = 0.5;
-  CartCoord[0]        = 0.0; CartCoord[1]       = 0.0; CartCoord[2]       = 0.0;
+  /*--- Gather the surface points that are inside the box, with their coordinates
+   in the coordinate system of the box, for the point inversion. ---*/
 
-  /*--- Count the number of vertices ---*/
-
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
-    if (config->GetMarker_All_DV(iMarker) == YES)
-      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++)
-        TotalVertex++;
+  vector<unsigned short> markerIdx;
+  vector<unsigned long> vertexIdx, pointIdx;
+  vector<su2double> cartCoord, paramCoord;
 
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
     if (config->GetMarker_All_DV(iMarker) == YES) {
@@ -789,6 +884,7 @@ void CSurfaceMovement::SetParametricCoord(CGeometry *geometry, CConfig *config,
 
         /*--- Get the cartesian coordinates ---*/
 
+        CartCoord[0] = 0.0; CartCoord[1] = 0.0; CartCoord[2] = 0.0;
         for (iDim = 0; iDim < nDim; iDim++)
           CartCoord[iDim] = geometry->vertex[iMarker][iVertex]->GetCoord(iDim);
 
@@ -815,82 +911,116 @@ void CSurfaceMovement::SetParametricCoord(CGeometry *geometry, CConfig *config,
 
         iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
 
-        /*--- If the point is inside the FFD, compute the value of the parametric coordinate ---*/
+        /*--- Only the points inside the FFD have a parametric coordinate ---*/
 
         if (FFDBox->GetPointFFD(geometry, config, iPoint)) {
+          markerIdx.push_back(iMarker);
+          vertexIdx.push_back(iVertex);
+          pointIdx.push_back(iPoint);
+          for (iDim = 0; iDim < 3; iDim++) cartCoord.push_back(CartCoord[iDim]);
+        }
+      }
+    }
+  }
 
-          /*--- Find the parametric coordinate ---*/
+  const unsigned long nPointFFD = pointIdx.size();
+  paramCoord.resize(3*nPointFFD);
 
-          ParamCoord = FFDBox->GetParametricCoord_Iterative(iPoint, CartCoord, ParamCoordGuess, config);
+  /*--- Find the parametric coordinates, either from a previous run or by point inversion. ---*/
 
-          /*--- Compute the cartesian coordinates using the parametric coordinates
-           to check that everything is correct ---*/
+  const string& cachePrefix = config->GetFFD_InversionCache();
+  const bool useCache = !cachePrefix.empty();
+  string cacheFile;
+  uint64_t cacheKey = 0;
+  bool cacheHit = false;
 
-          CartCoordNew = FFDBox->EvalCartesianCoord(ParamCoord);
+  if (useCache) {
+    cacheFile = cachePrefix + "_" + FFDBox->GetTag() + "_" + to_string(rank) + ".dat";
+    cacheKey = FFDInversionKey(config, FFDBox, markerIdx, vertexIdx, pointIdx, cartCoord);
+    cacheHit = ReadFFDInversionCache(cacheFile, cacheKey, paramCoord);
+  }
 
-          /*--- Compute max difference between original value and the recomputed value ---*/
+  if (!cacheHit) {
+    FFDBox->GetParametricCoord_Parallel(nPointFFD, cartCoord.data(), pointIdx.data(), config, paramCoord.data());
+    if (useCache) WriteFFDInversionCache(cacheFile, cacheKey, paramCoord);
+  }
 
-          Diff = 0.0;
-          for (iDim = 0; iDim < nDim; iDim++)
-            Diff += (CartCoordNew[iDim]-CartCoord[iDim])*(CartCoordNew[iDim]-CartCoord[iDim]);
-          Diff = sqrt(Diff);
-          my_MaxDiff = max(my_MaxDiff, Diff);
+  if (useCache) {
+    int myHit = cacheHit, allHit = 0;
+    SU2_MPI::Allreduce(&myHit, &allHit, 1, MPI_INT, MPI_MIN, SU2_MPI::GetComm());
+    if (rank == MASTER_NODE && allHit)
+      cout << "Parametric coordinates of FFD box " << FFDBox->GetTag() << " read from the inversion cache." << endl;
+  }
 
-          /*--- If the parametric coordinates are in (0,1) the point belongs to the FFDBox, using the input tolerance  ---*/
+  /*--- Compute the cartesian coordinates using the parametric coordinates
+   to check that everything is correct. ---*/
 
-          if (((ParamCoord[0] >= - config->GetFFD_Tol()) && (ParamCoord[0] <= 1.0 + config->GetFFD_Tol())) &&
-              ((ParamCoord[1] >= - config->GetFFD_Tol()) && (ParamCoord[1] <= 1.0 + config->GetFFD_Tol())) &&
-              ((ParamCoord[2] >= - config->GetFFD_Tol()) && (ParamCoord[2] <= 1.0 + config->GetFFD_Tol()))) {
+  vector<su2double> diffs(nPointFFD);
 
+  SU2_OMP_PARALLEL
+  {
+    SU2_OMP_FOR_STAT(256)
+    for (auto iPointFFD = 0ul; iPointFFD < nPointFFD; iPointFFD++) {
+      su2double CartCoordNew[3];
+      FFDBox->EvalCartesianCoord(&paramCoord[3*iPointFFD], CartCoordNew);
 
-            /*--- Rectification of the initial tolerance (we have detected situations
-             where 0.0 and 1.0 doesn't work properly ---*/
+      su2double dist = 0.0;
+      for (unsigned short jDim = 0; jDim < nDim; jDim++)
+        dist += pow(CartCoordNew[jDim]-cartCoord[3*iPointFFD+jDim], 2);
+      diffs[iPointFFD] = sqrt(dist);
+    }
+    END_SU2_OMP_FOR
+  }
+  END_SU2_OMP_PARALLEL
 
-            su2double lower_limit = config->GetFFD_Tol();
-            su2double upper_limit = 1.0-config->GetFFD_Tol();
+  /*--- Store the results in the original order of the points. ---*/
 
-            if (ParamCoord[0] < lower_limit) ParamCoord[0] = lower_limit;
-            if (ParamCoord[1] < lower_limit) ParamCoord[1] = lower_limit;
-            if (ParamCoord[2] < lower_limit) ParamCoord[2] = lower_limit;
-            if (ParamCoord[0] > upper_limit) ParamCoord[0] = upper_limit;
-            if (ParamCoord[1] > upper_limit) ParamCoord[1] = upper_limit;
-            if (ParamCoord[2] > upper_limit) ParamCoord[2] = upper_limit;
+  for (auto iPointFFD = 0ul; iPointFFD < nPointFFD; iPointFFD++) {
 
-            /*--- Set the value of the parametric coordinate ---*/
+    ParamCoord = &paramCoord[3*iPointFFD];
+    for (iDim = 0; iDim < 3; iDim++) CartCoord[iDim] = cartCoord[3*iPointFFD+iDim];
 
-            FFDBox->Set_MarkerIndex(iMarker);
-            FFDBox->Set_VertexIndex(iVertex);
-            FFDBox->Set_PointIndex(iPoint);
-            FFDBox->Set_ParametricCoord(ParamCoord);
-            FFDBox->Set_CartesianCoord(CartCoord);
+    /*--- Compute max difference between original value and the recomputed value ---*/
 
-            ParamCoordGuess[0] = ParamCoord[0]; ParamCoordGuess[1] = ParamCoord[1]; ParamCoordGuess[2] = ParamCoord[2];
+    Diff = diffs[iPointFFD];
+    my_MaxDiff = max(my_MaxDiff, Diff);
 
-            if (Diff >= config->GetFFD_Tol()) {
-              cout << "Please check this point: Local (" << ParamCoord[0] <<" "<< ParamCoord[1] <<" "<< ParamCoord[2] <<") <-> Global ("
-              << CartCoord[0] <<" "<< CartCoord[1] <<" "<< CartCoord[2] <<") <-> Error "<< Diff <<" vs "<< config->GetFFD_Tol() <<"." << endl;
-            }
+    /*--- If the parametric coordinates are in (0,1) the point belongs to the FFDBox, using the input tolerance  ---*/
 
-          }
-          else {
+    if (((ParamCoord[0] >= - config->GetFFD_Tol()) && (ParamCoord[0] <= 1.0 + config->GetFFD_Tol())) &&
+        ((ParamCoord[1] >= - config->GetFFD_Tol()) && (ParamCoord[1] <= 1.0 + config->GetFFD_Tol())) &&
+        ((ParamCoord[2] >= - config->GetFFD_Tol()) && (ParamCoord[2] <= 1.0 + config->GetFFD_Tol()))) {
 
-            if (Diff >= config->GetFFD_Tol()) {
-              cout << "Please check this point: Local (" << ParamCoord[0] <<" "<< ParamCoord[1] <<" "<< ParamCoord[2] <<") <-> Global ("
-              << CartCoord[0] <<" "<< CartCoord[1] <<" "<< CartCoord[2] <<") <-> Error "<< Diff <<" vs "<< config->GetFFD_Tol() <<"." << endl;
-            }
 
-          }
+      /*--- Rectification of the initial tolerance (we have detected situations
+       where 0.0 and 1.0 doesn't work properly ---*/
 
-        }
-      }
+      su2double lower_limit = config->GetFFD_Tol();
+      su2double upper_limit = 1.0-config->GetFFD_Tol();
+
+      if (ParamCoord[0] < lower_limit) ParamCoord[0] = lower_limit;
+      if (ParamCoord[1] < lower_limit) ParamCoord[1] = lower_limit;
+      if (ParamCoord[2] < lower_limit) ParamCoord[2] = lower_limit;
+      if (ParamCoord[0] > upper_limit) ParamCoord[0] = upper_limit;
+      if (ParamCoord[1] > upper_limit) ParamCoord[1] = upper_limit;
+      if (ParamCoord[2] > upper_limit) ParamCoord[2] = upper_limit;
+
+      /*--- Set the value of the parametric coordinate ---*/
+
+      FFDBox->Set_MarkerIndex(markerIdx[iPointFFD]);
+      FFDBox->Set_VertexIndex(vertexIdx[iPointFFD]);
+      FFDBox->Set_PointIndex(pointIdx[iPointFFD]);
+      FFDBox->Set_ParametricCoord(ParamCoord);
+      FFDBox->Set_CartesianCoord(CartCoord);
+    }
+
+    if (Diff >= config->GetFFD_Tol()) {
+      cout << "Please check this point: Local (" << ParamCoord[0] <<" "<< ParamCoord[1] <<" "<< ParamCoord[2] <<") <-> Global ("
+      << CartCoord[0] <<" "<< CartCoord[1] <<" "<< CartCoord[2] <<") <-> Error "<< Diff <<" vs "<< config->GetFFD_Tol() <<"." << endl;
     }
   }
 
-#ifdef HAVE_MPI
   SU2_MPI::Allreduce(&my_MaxDiff, &MaxDiff, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
-#else
-  MaxDiff = my_MaxDiff;
-#endif
 
   if (rank == MASTER_NODE)
     cout << "Compute parametric coord      | FFD box: " << FFDBox->GetTag() << ". Max Diff: " << MaxDiff <<"."<< endl;
@@ -1472,7 +1602,7 @@ void CSurfaceMovement::ApplyDesignVariables(CGeometry *geometry, CConfig *config
 su2double CSurfaceMovement::SetCartesianCoord(CGeometry *geometry, CConfig *config, CFreeFormDefBox *FFDBox, unsigned short iFFDBox, bool ResetDef) {
 
   su2double *CartCoordNew, Diff, my_MaxDiff = 0.0, MaxDiff,
-  *ParamCoord, VarCoord[3] = {0.0, 0.0, 0.0}, CartCoordOld[3] = {0.0, 0.0, 0.0};
+  VarCoord[3] = {0.0, 0.0, 0.0}, CartCoordOld[3] = {0.0, 0.0, 0.0};
   unsigned short iMarker, iDim;
   unsigned long iVertex, iPoint, iSurfacePoints;
 
@@ -1492,7 +1622,10 @@ su2double CSurfaceMovement::SetCartesianCoord(CGeometry *geometry, CConfig *conf
     }
   }
 
-  /*--- Recompute the cartesians coordinates ---*/
+  /*--- Recompute the cartesians coordinates, all at once with the tabulated basis of the box ---*/
+
+  vector<su2double> CartCoordAll(3*FFDBox->GetnSurfacePoint());
+  FFDBox->EvalCartesianCoord_SurfacePoints(CartCoordAll.data());
 
   for (iSurfacePoints = 0; iSurfacePoints < FFDBox->GetnSurfacePoint(); iSurfacePoints++) {
 
@@ -1511,14 +1644,10 @@ su2double CSurfaceMovement::SetCartesianCoord(CGeometry *geometry, CConfig *conf
 
       geometry->vertex[iMarker][iVertex]->SetVarCoord(VarCoord);
 
-      /*--- Get the parametric coordinate of the surface point ---*/
+      /*--- New cartesian coordinate of the surface point, the value is set in
+       the FFDBox structure after the coordinate transformation ---*/
 
-      ParamCoord = FFDBox->Get_ParametricCoord(iSurfacePoints);
-
-      /*--- Compute the new cartesian coordinate, and set the value in
-       the FFDBox structure ---*/
-
-      CartCoordNew = FFDBox->EvalCartesianCoord(ParamCoord);
+      CartCoordNew = &CartCoordAll[3*iSurfacePoints];
 
       /*--- If polar coordinates, compute the cartesians from the polar value ---*/
 
@@ -54,10 +54,64 @@ CVolumetricMovement::CVolumetricMovement(CGeometry *geometry, CConfig *config) :
     LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
     LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
     StiffMatrix.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
+
+    /*--- The sparse pattern is reused by all deformations, as is the element coloring. ---*/
+    HybridParallelInitialization(geometry);
   }
 }
 
-CVolumetricMovement::~CVolumetricMovement(void) { }
+CVolumetricMovement::~CVolumetricMovement(void) {
+
+  if (LockStrategy) {
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+      omp_destroy_lock(&UpdateLocks[iPoint]);
+  }
+}
+
+void CVolumetricMovement::HybridParallelInitialization(CGeometry* geometry) {
+#ifdef HAVE_OMP
+  /*--- Get the element coloring. ---*/
+
+  su2double parallelEff = 1.0;
+  const auto& coloring = geometry->GetElementColoring(&parallelEff);
+
+  /*--- If the coloring is too bad use lock-guarded accesses
+   *    to CSysMatrix in element loops instead. ---*/
+  LockStrategy = parallelEff < COLORING_EFF_THRESH;
+
+  /*--- When using locks force a single color to reduce the color loop overhead. ---*/
+  if (LockStrategy && (coloring.getOuterSize()>1))
+    geometry->SetNaturalElementColoring();
+
+  if (!coloring.empty()) {
+    /*--- We are not constrained by the color group size when using locks. ---*/
+    auto groupSize = LockStrategy? 1ul : geometry->GetElementColorGroupSize();
+    auto nColor = coloring.getOuterSize();
+    ElemColoring.reserve(nColor);
+
+    for(auto iColor = 0ul; iColor < nColor; ++iColor)
+      ElemColoring.emplace_back(coloring.innerIdx(iColor), coloring.getNumNonZeros(iColor), groupSize);
+  }
+
+  su2double minEff = 1.0;
+  SU2_MPI::Reduce(&parallelEff, &minEff, 1, MPI_DOUBLE, MPI_MIN, MASTER_NODE, SU2_MPI::GetComm());
+
+  if (minEff < COLORING_EFF_THRESH && rank == MASTER_NODE) {
+    cout << "WARNING: The element coloring efficiency was " << minEff << ", a fallback strategy is in use for the mesh deformation.\n"
+         << "         Better performance may be possible by reducing the number of threads per rank." << endl;
+  }
+
+  if (LockStrategy) {
+    UpdateLocks.resize(nPoint);
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+      omp_init_lock(&UpdateLocks[iPoint]);
+  }
+
+  omp_chunk_size = computeStaticChunkSize(geometry->GetnElem(), omp_get_max_threads(), OMP_MAX_SIZE);
+#else
+  ElemColoring[0] = DummyGridColor<>(geometry->GetnElem());
+#endif
+}
 
 void CVolumetricMovement::UpdateGridCoord(CGeometry *geometry, CConfig *config) {
 
@@ -226,76 +280,94 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
 
 void CVolumetricMovement::ComputeDeforming_Element_Volume(CGeometry *geometry, su2double &MinVolume, su2double &MaxVolume, bool Screen_Output) {
 
-  unsigned long iElem, ElemCounter = 0, PointCorners[8];
-  su2double Volume = 0.0, CoordCorners[8][3];
-  unsigned short nNodes = 0, iNodes, iDim;
-  bool RightVol = true;
+  const unsigned long nElem = geometry->GetnElem();
+  unsigned long ElemCounter = 0;
 
   if (rank == MASTER_NODE && Screen_Output)
     cout << "Computing volumes of the grid elements." << endl;
 
   MaxVolume = -1E22; MinVolume = 1E22;
 
-  /*--- Load up each triangle and tetrahedron to check for negative volumes. ---*/
+  SU2_OMP_PARALLEL
+  {
+    /*--- Local min/max, final reduction outside loop. ---*/
+    su2double maxVol = -1E22, minVol = 1E22;
+    unsigned long elCount = 0;
 
-  for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+    /*--- Load up each triangle and tetrahedron to check for negative volumes. ---*/
 
-    if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE)     nNodes = 3;
-    if (geometry->elem[iElem]->GetVTK_Type() == QUADRILATERAL)    nNodes = 4;
-    if (geometry->elem[iElem]->GetVTK_Type() == TETRAHEDRON)  nNodes = 4;
-    if (geometry->elem[iElem]->GetVTK_Type() == PYRAMID)      nNodes = 5;
-    if (geometry->elem[iElem]->GetVTK_Type() == PRISM)        nNodes = 6;
-    if (geometry->elem[iElem]->GetVTK_Type() == HEXAHEDRON)   nNodes = 8;
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (unsigned long iElem = 0; iElem < nElem; iElem++) {
 
-    for (iNodes = 0; iNodes < nNodes; iNodes++) {
-      PointCorners[iNodes] = geometry->elem[iElem]->GetNode(iNodes);
-      for (iDim = 0; iDim < nDim; iDim++) {
-        CoordCorners[iNodes][iDim] = geometry->nodes->GetCoord(PointCorners[iNodes], iDim);
-      }
-    }
+      unsigned long PointCorners[8];
+      su2double Volume = 0.0, CoordCorners[8][3];
+      unsigned short nNodes = 0, iNodes, iDim;
 
-    /*--- 2D elements ---*/
+      if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE)     nNodes = 3;
+      if (geometry->elem[iElem]->GetVTK_Type() == QUADRILATERAL)    nNodes = 4;
+      if (geometry->elem[iElem]->GetVTK_Type() == TETRAHEDRON)  nNodes = 4;
+      if (geometry->elem[iElem]->GetVTK_Type() == PYRAMID)      nNodes = 5;
+      if (geometry->elem[iElem]->GetVTK_Type() == PRISM)        nNodes = 6;
+      if (geometry->elem[iElem]->GetVTK_Type() == HEXAHEDRON)   nNodes = 8;
 
-    if (nDim == 2) {
-      if (nNodes == 3) Volume = GetTriangle_Area(CoordCorners);
-      if (nNodes == 4) Volume = GetQuadrilateral_Area(CoordCorners);
-    }
+      for (iNodes = 0; iNodes < nNodes; iNodes++) {
+        PointCorners[iNodes] = geometry->elem[iElem]->GetNode(iNodes);
+        for (iDim = 0; iDim < nDim; iDim++) {
+          CoordCorners[iNodes][iDim] = geometry->nodes->GetCoord(PointCorners[iNodes], iDim);
+        }
+      }
 
-    /*--- 3D Elementes ---*/
+      /*--- 2D elements ---*/
 
-    if (nDim == 3) {
-      if (nNodes == 4) Volume = GetTetra_Volume(CoordCorners);
-      if (nNodes == 5) Volume = GetPyram_Volume(CoordCorners);
-      if (nNodes == 6) Volume = GetPrism_Volume(CoordCorners);
-      if (nNodes == 8) Volume = GetHexa_Volume(CoordCorners);
-    }
+      if (nDim == 2) {
+        if (nNodes == 3) Volume = GetTriangle_Area(CoordCorners);
+        if (nNodes == 4) Volume = GetQuadrilateral_Area(CoordCorners);
+      }
 
-    RightVol = true;
-    if (Volume < 0.0) RightVol = false;
+      /*--- 3D Elementes ---*/
 
-    MaxVolume = max(MaxVolume, Volume);
-    MinVolume = min(MinVolume, Volume);
-    geometry->elem[iElem]->SetVolume(Volume);
+      if (nDim == 3) {
+        if (nNodes == 4) Volume = GetTetra_Volume(CoordCorners);
+        if (nNodes == 5) Volume = GetPyram_Volume(CoordCorners);
+        if (nNodes == 6) Volume = GetPrism_Volume(CoordCorners);
+        if (nNodes == 8) Volume = GetHexa_Volume(CoordCorners);
+      }
 
-    if (!RightVol) ElemCounter++;
+      maxVol = max(maxVol, Volume);
+      minVol = min(minVol, Volume);
+      geometry->elem[iElem]->SetVolume(Volume);
 
-  }
+      if (Volume < 0.0) elCount++;
 
-#ifdef HAVE_MPI
-  unsigned long ElemCounter_Local = ElemCounter; ElemCounter = 0;
-  su2double MaxVolume_Local = MaxVolume; MaxVolume = 0.0;
-  su2double MinVolume_Local = MinVolume; MinVolume = 0.0;
-  SU2_MPI::Allreduce(&ElemCounter_Local, &ElemCounter, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
-  SU2_MPI::Allreduce(&MaxVolume_Local, &MaxVolume, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
-  SU2_MPI::Allreduce(&MinVolume_Local, &MinVolume, 1, MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
-#endif
+    }
+    END_SU2_OMP_FOR
+    SU2_OMP_CRITICAL
+    {
+      MaxVolume = max(MaxVolume, maxVol);
+      MinVolume = min(MinVolume, minVol);
+      ElemCounter += elCount;
+    }
+    END_SU2_OMP_CRITICAL
+
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+    {
+      elCount = ElemCounter; maxVol = MaxVolume; minVol = MinVolume;
+      SU2_MPI::Allreduce(&elCount, &ElemCounter, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+      SU2_MPI::Allreduce(&maxVol, &MaxVolume, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+      SU2_MPI::Allreduce(&minVol, &MinVolume, 1, MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
 
-  /*--- Volume from  0 to 1 ---*/
+    /*--- Volume from  0 to 1 ---*/
 
-  for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
-    Volume = geometry->elem[iElem]->GetVolume()/MaxVolume;
-    geometry->elem[iElem]->SetVolume(Volume);
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (unsigned long iElem = 0; iElem < nElem; iElem++) {
+      const su2double Volume = geometry->elem[iElem]->GetVolume()/MaxVolume;
+      geometry->elem[iElem]->SetVolume(Volume);
+    }
+    END_SU2_OMP_FOR
   }
+  END_SU2_OMP_PARALLEL
 
   if ((ElemCounter != 0) && (rank == MASTER_NODE) && (Screen_Output))
     cout <<"There are " << ElemCounter << " elements with negative volume.\n" << endl;
@@ -463,21 +535,11 @@ void CVolumetricMovement::ComputeSolid_Wall_Distance(CGeometry *geometry, CConfi
 
 su2double CVolumetricMovement::SetFEAMethodContributions_Elem(CGeometry *geometry, CConfig *config) {
 
-  unsigned short iVar, iDim, nNodes = 0, iNodes, StiffMatrix_nElem = 0;
-  unsigned long iElem, PointCorners[8];
-  su2double **StiffMatrix_Elem = nullptr, CoordCorners[8][3];
-  su2double MinVolume = 0.0, MaxVolume = 0.0, MinDistance = 0.0, MaxDistance = 0.0, ElemVolume = 0.0, ElemDistance = 0.0;
+  su2double MinVolume = 0.0, MaxVolume = 0.0, MinDistance = 0.0, MaxDistance = 0.0;
 
   bool Screen_Output  = config->GetDeform_Output();
 
-  /*--- Allocate maximum size (quadrilateral and hexahedron) ---*/
-
-  if (nDim == 2) StiffMatrix_nElem = 8;
-  else StiffMatrix_nElem = 24;
-
-  StiffMatrix_Elem = new su2double* [StiffMatrix_nElem];
-  for (iVar = 0; iVar < StiffMatrix_nElem; iVar++)
-    StiffMatrix_Elem[iVar] = new su2double [StiffMatrix_nElem];
+  const bool wallDistance = (config->GetDeform_Stiffness_Type() == SOLID_WALL_DISTANCE);
 
   /*--- Compute min volume in the entire mesh. ---*/
 
@@ -487,53 +549,67 @@ su2double CVolumetricMovement::SetFEAMethodContributions_Elem(CGeometry *geometr
   /*--- Compute the distance to the nearest surface if needed
    as part of the stiffness calculation.. ---*/
 
-  if ((config->GetDeform_Stiffness_Type() == SOLID_WALL_DISTANCE) ||
-      (config->GetDeform_Limit() < 1E6)) {
+  if (wallDistance || (config->GetDeform_Limit() < 1E6)) {
     ComputeSolid_Wall_Distance(geometry, config, MinDistance, MaxDistance);
     if (rank == MASTER_NODE && Screen_Output) cout <<"Min. distance: "<< MinDistance <<", max. distance: "<< MaxDistance <<"." << endl;
   }
 
-  /*--- Compute contributions from each element by forming the stiffness matrix (FEA) ---*/
+  /*--- Compute contributions from each element by forming the stiffness matrix (FEA).
+   * Elements of the same color do not share nodes, and so they can be assembled
+   * concurrently, otherwise the updates of the matrix rows are guarded by locks. ---*/
 
-  for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+  SU2_OMP_PARALLEL
+  {
+    /*--- Maximum size (quadrilateral and hexahedron), private to each thread. ---*/
 
-    if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE)      nNodes = 3;
-    if (geometry->elem[iElem]->GetVTK_Type() == QUADRILATERAL) nNodes = 4;
-    if (geometry->elem[iElem]->GetVTK_Type() == TETRAHEDRON)   nNodes = 4;
-    if (geometry->elem[iElem]->GetVTK_Type() == PYRAMID)       nNodes = 5;
-    if (geometry->elem[iElem]->GetVTK_Type() == PRISM)         nNodes = 6;
-    if (geometry->elem[iElem]->GetVTK_Type() == HEXAHEDRON)    nNodes = 8;
+    su2double StiffMatrix_Elem[24][24], CoordCorners[8][3];
+    unsigned long PointCorners[8];
 
-    for (iNodes = 0; iNodes < nNodes; iNodes++) {
-      PointCorners[iNodes] = geometry->elem[iElem]->GetNode(iNodes);
-      for (iDim = 0; iDim < nDim; iDim++) {
-        CoordCorners[iNodes][iDim] = geometry->nodes->GetCoord(PointCorners[iNodes], iDim);
-      }
-    }
+    for (auto color : ElemColoring) {
 
-    /*--- Extract Element volume and distance to compute the stiffness ---*/
+      /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+      SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+      for (auto k = 0ul; k < color.size; ++k) {
 
-    ElemVolume = geometry->elem[iElem]->GetVolume();
+        const auto iElem = color.indices[k];
 
-    if ((config->GetDeform_Stiffness_Type() == SOLID_WALL_DISTANCE)) {
-      ElemDistance = 0.0;
-      for (iNodes = 0; iNodes < nNodes; iNodes++)
-        ElemDistance += geometry->nodes->GetWall_Distance(PointCorners[iNodes]);
-      ElemDistance = ElemDistance/(su2double)nNodes;
-    }
+        unsigned short nNodes = 0, iNodes, iDim;
 
-    if (nDim == 2) SetFEA_StiffMatrix2D(geometry, config, StiffMatrix_Elem, PointCorners, CoordCorners, nNodes, ElemVolume, ElemDistance);
-    if (nDim == 3) SetFEA_StiffMatrix3D(geometry, config, StiffMatrix_Elem, PointCorners, CoordCorners, nNodes, ElemVolume, ElemDistance);
+        if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE)      nNodes = 3;
+        if (geometry->elem[iElem]->GetVTK_Type() == QUADRILATERAL) nNodes = 4;
+        if (geometry->elem[iElem]->GetVTK_Type() == TETRAHEDRON)   nNodes = 4;
+        if (geometry->elem[iElem]->GetVTK_Type() == PYRAMID)       nNodes = 5;
+        if (geometry->elem[iElem]->GetVTK_Type() == PRISM)         nNodes = 6;
+        if (geometry->elem[iElem]->GetVTK_Type() == HEXAHEDRON)    nNodes = 8;
 
-    AddFEA_StiffMatrix(geometry, StiffMatrix_Elem, PointCorners, nNodes);
+        for (iNodes = 0; iNodes < nNodes; iNodes++) {
+          PointCorners[iNodes] = geometry->elem[iElem]->GetNode(iNodes);
+          for (iDim = 0; iDim < nDim; iDim++) {
+            CoordCorners[iNodes][iDim] = geometry->nodes->GetCoord(PointCorners[iNodes], iDim);
+          }
+        }
 
-  }
+        /*--- Extract Element volume and distance to compute the stiffness ---*/
+
+        const su2double ElemVolume = geometry->elem[iElem]->GetVolume();
+
+        su2double ElemDistance = 0.0;
+        if (wallDistance) {
+          for (iNodes = 0; iNodes < nNodes; iNodes++)
+            ElemDistance += geometry->nodes->GetWall_Distance(PointCorners[iNodes]);
+          ElemDistance = ElemDistance/(su2double)nNodes;
+        }
+
+        if (nDim == 2) SetFEA_StiffMatrix2D(geometry, config, StiffMatrix_Elem, PointCorners, CoordCorners, nNodes, ElemVolume, ElemDistance);
+        if (nDim == 3) SetFEA_StiffMatrix3D(geometry, config, StiffMatrix_Elem, PointCorners, CoordCorners, nNodes, ElemVolume, ElemDistance);
 
-  /*--- Deallocate memory and exit ---*/
+        AddFEA_StiffMatrix(geometry, StiffMatrix_Elem, PointCorners, nNodes);
 
-  for (iVar = 0; iVar < StiffMatrix_nElem; iVar++)
-    delete [] StiffMatrix_Elem[iVar];
-  delete [] StiffMatrix_Elem;
+      }
+      END_SU2_OMP_FOR
+    }
+  }
+  END_SU2_OMP_PARALLEL
 
   return MinVolume;
 
@@ -1275,7 +1351,7 @@ su2double CVolumetricMovement::GetHexa_Volume(su2double CoordCorners[8][3]) cons
 
 }
 
-void CVolumetricMovement::SetFEA_StiffMatrix2D(CGeometry *geometry, CConfig *config, su2double **StiffMatrix_Elem, unsigned long PointCorners[8], su2double CoordCorners[8][3],
+void CVolumetricMovement::SetFEA_StiffMatrix2D(CGeometry *geometry, CConfig *config, su2double StiffMatrix_Elem[24][24], unsigned long PointCorners[8], su2double CoordCorners[8][3],
                                                unsigned short nNodes, su2double ElemVolume, su2double ElemDistance) {
 
   su2double B_Matrix[3][8], D_Matrix[3][3], Aux_Matrix[8][3];
@@ -1312,6 +1388,28 @@ void CVolumetricMovement::SetFEA_StiffMatrix2D(CGeometry *geometry, CConfig *con
     Location[3][0] = -0.577350269189626;  Location[3][1] = 0.577350269189626;   Weight[3] = 1.0;
   }
 
+  /*--- Impose a type of stiffness for each element (constant over the element) ---*/
+
+  switch (config->GetDeform_Stiffness_Type()) {
+    case INVERSE_VOLUME: E = 1.0 / ElemVolume; break;
+    case SOLID_WALL_DISTANCE: E = 1.0 / ElemDistance; break;
+    case CONSTANT_STIFFNESS: E = 1.0 / EPS; break;
+  }
+
+  Nu = config->GetDeform_Coeff();
+  Mu = E / (2.0*(1.0 + Nu));
+  Lambda = Nu*E/((1.0+Nu)*(1.0-2.0*Nu));
+
+  /*--- Compute the D Matrix (for plane strain and 3-D)---*/
+
+  D_Matrix[0][0] = Lambda + 2.0*Mu;    D_Matrix[0][1] = Lambda;            D_Matrix[0][2] = 0.0;
+  D_Matrix[1][0] = Lambda;            D_Matrix[1][1] = Lambda + 2.0*Mu;   D_Matrix[1][2] = 0.0;
+  D_Matrix[2][0] = 0.0;               D_Matrix[2][1] = 0.0;               D_Matrix[2][2] = Mu;
+
+  /*--- Rows of B that are not zero in the columns associated with the x and y displacements. ---*/
+
+  const unsigned short NonZeroRows[2][2] = {{0, 2}, {1, 2}};
+
   for (iGauss = 0; iGauss < nGauss; iGauss++) {
 
     Xi = Location[iGauss][0]; Eta = Location[iGauss][1];
@@ -1333,32 +1431,14 @@ void CVolumetricMovement::SetFEA_StiffMatrix2D(CGeometry *geometry, CConfig *con
       B_Matrix[2][1+iNode*nVar] = DShapeFunction[iNode][0];
     }
 
-    /*--- Impose a type of stiffness for each element ---*/
-
-    switch (config->GetDeform_Stiffness_Type()) {
-      case INVERSE_VOLUME: E = 1.0 / ElemVolume; break;
-      case SOLID_WALL_DISTANCE: E = 1.0 / ElemDistance; break;
-      case CONSTANT_STIFFNESS: E = 1.0 / EPS; break;
-    }
-
-    Nu = config->GetDeform_Coeff();
-    Mu = E / (2.0*(1.0 + Nu));
-    Lambda = Nu*E/((1.0+Nu)*(1.0-2.0*Nu));
-
-    /*--- Compute the D Matrix (for plane strain and 3-D)---*/
-
-    D_Matrix[0][0] = Lambda + 2.0*Mu;    D_Matrix[0][1] = Lambda;            D_Matrix[0][2] = 0.0;
-    D_Matrix[1][0] = Lambda;            D_Matrix[1][1] = Lambda + 2.0*Mu;   D_Matrix[1][2] = 0.0;
-    D_Matrix[2][0] = 0.0;               D_Matrix[2][1] = 0.0;               D_Matrix[2][2] = Mu;
-
-
-    /*--- Compute the BT.D Matrix ---*/
+    /*--- Compute the BT.D Matrix, each column of B has only 2 non-zero rows. ---*/
 
     for (iVar = 0; iVar < nNodes*nVar; iVar++) {
+      const unsigned short* iRows = NonZeroRows[iVar%nVar];
       for (jVar = 0; jVar < 3; jVar++) {
         Aux_Matrix[iVar][jVar] = 0.0;
-        for (kVar = 0; kVar < 3; kVar++)
-          Aux_Matrix[iVar][jVar] += B_Matrix[kVar][iVar]*D_Matrix[kVar][jVar];
+        for (kVar = 0; kVar < 2; kVar++)
+          Aux_Matrix[iVar][jVar] += B_Matrix[iRows[kVar]][iVar]*D_Matrix[iRows[kVar]][jVar];
       }
     }
 
@@ -1367,8 +1447,9 @@ void CVolumetricMovement::SetFEA_StiffMatrix2D(CGeometry *geometry, CConfig *con
 
     for (iVar = 0; iVar < nNodes*nVar; iVar++) {
       for (jVar = 0; jVar < nNodes*nVar; jVar++) {
-        for (kVar = 0; kVar < 3; kVar++) {
-          StiffMatrix_Elem[iVar][jVar] += Weight[iGauss] * Aux_Matrix[iVar][kVar]*B_Matrix[kVar][jVar] * fabs(Det);
+        const unsigned short* jRows = NonZeroRows[jVar%nVar];
+        for (kVar = 0; kVar < 2; kVar++) {
+          StiffMatrix_Elem[iVar][jVar] += Weight[iGauss] * Aux_Matrix[iVar][jRows[kVar]]*B_Matrix[jRows[kVar]][jVar] * fabs(Det);
         }
       }
     }
@@ -1377,7 +1458,7 @@ void CVolumetricMovement::SetFEA_StiffMatrix2D(CGeometry *geometry, CConfig *con
 
 }
 
-void CVolumetricMovement::SetFEA_StiffMatrix3D(CGeometry *geometry, CConfig *config, su2double **StiffMatrix_Elem, unsigned long PointCorners[8], su2double CoordCorners[8][3],
+void CVolumetricMovement::SetFEA_StiffMatrix3D(CGeometry *geometry, CConfig *config, su2double StiffMatrix_Elem[24][24], unsigned long PointCorners[8], su2double CoordCorners[8][3],
                                                unsigned short nNodes, su2double ElemVolume, su2double ElemDistance) {
 
   su2double B_Matrix[6][24], D_Matrix[6][6] = {{0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
@@ -1442,6 +1523,31 @@ void CVolumetricMovement::SetFEA_StiffMatrix3D(CGeometry *geometry, CConfig *con
     Location[7][0] = 0.577350269189626;   Location[7][1] = 0.577350269189626;   Location[7][2] = 0.577350269189626;   Weight[7] = 1.0;
   }
 
+  /*--- Impose a type of stiffness for each element (constant over the element) ---*/
+
+  switch (config->GetDeform_Stiffness_Type()) {
+    case INVERSE_VOLUME: E = 1.0 / ElemVolume; break;
+    case SOLID_WALL_DISTANCE: E = 1.0 / ElemDistance; break;
+    case CONSTANT_STIFFNESS: E = 1.0 / EPS; break;
+  }
+
+  Nu = config->GetDeform_Coeff();
+  Mu = E / (2.0*(1.0 + Nu));
+  Lambda = Nu*E/((1.0+Nu)*(1.0-2.0*Nu));
+
+  /*--- Compute the D Matrix (for plane strain and 3-D)---*/
+
+  D_Matrix[0][0] = Lambda + 2.0*Mu;  D_Matrix[0][1] = Lambda;          D_Matrix[0][2] = Lambda;
+  D_Matrix[1][0] = Lambda;          D_Matrix[1][1] = Lambda + 2.0*Mu;  D_Matrix[1][2] = Lambda;
+  D_Matrix[2][0] = Lambda;          D_Matrix[2][1] = Lambda;          D_Matrix[2][2] = Lambda + 2.0*Mu;
+  D_Matrix[3][3] = Mu;
+  D_Matrix[4][4] = Mu;
+  D_Matrix[5][5] = Mu;
+
+  /*--- Rows of B that are not zero in the columns associated with the x, y, and z displacements. ---*/
+
+  const unsigned short NonZeroRows[3][3] = {{0, 3, 5}, {1, 3, 4}, {2, 4, 5}};
+
   for (iGauss = 0; iGauss < nGauss; iGauss++) {
 
     Xi = Location[iGauss][0]; Eta = Location[iGauss][1];  Zeta = Location[iGauss][2];
@@ -1472,35 +1578,14 @@ void CVolumetricMovement::SetFEA_StiffMatrix3D(CGeometry *geometry, CConfig *con
       B_Matrix[5][2+iNode*nVar] = DShapeFunction[iNode][0];
     }
 
-    /*--- Impose a type of stiffness for each element ---*/
-
-    switch (config->GetDeform_Stiffness_Type()) {
-      case INVERSE_VOLUME: E = 1.0 / ElemVolume; break;
-      case SOLID_WALL_DISTANCE: E = 1.0 / ElemDistance; break;
-      case CONSTANT_STIFFNESS: E = 1.0 / EPS; break;
-    }
-
-    Nu = config->GetDeform_Coeff();
-    Mu = E / (2.0*(1.0 + Nu));
-    Lambda = Nu*E/((1.0+Nu)*(1.0-2.0*Nu));
-
-    /*--- Compute the D Matrix (for plane strain and 3-D)---*/
-
-    D_Matrix[0][0] = Lambda + 2.0*Mu;  D_Matrix[0][1] = Lambda;          D_Matrix[0][2] = Lambda;
-    D_Matrix[1][0] = Lambda;          D_Matrix[1][1] = Lambda + 2.0*Mu;  D_Matrix[1][2] = Lambda;
-    D_Matrix[2][0] = Lambda;          D_Matrix[2][1] = Lambda;          D_Matrix[2][2] = Lambda + 2.0*Mu;
-    D_Matrix[3][3] = Mu;
-    D_Matrix[4][4] = Mu;
-    D_Matrix[5][5] = Mu;
-
-
-    /*--- Compute the BT.D Matrix ---*/
+    /*--- Compute the BT.D Matrix, each column of B has only 3 non-zero rows. ---*/
 
     for (iVar = 0; iVar < nNodes*nVar; iVar++) {
+      const unsigned short* iRows = NonZeroRows[iVar%nVar];
       for (jVar = 0; jVar < 6; jVar++) {
         Aux_Matrix[iVar][jVar] = 0.0;
-        for (kVar = 0; kVar < 6; kVar++)
-          Aux_Matrix[iVar][jVar] += B_Matrix[kVar][iVar]*D_Matrix[kVar][jVar];
+        for (kVar = 0; kVar < 3; kVar++)
+          Aux_Matrix[iVar][jVar] += B_Matrix[iRows[kVar]][iVar]*D_Matrix[iRows[kVar]][jVar];
       }
     }
 
@@ -1509,8 +1594,9 @@ void CVolumetricMovement::SetFEA_StiffMatrix3D(CGeometry *geometry, CConfig *con
 
     for (iVar = 0; iVar < nNodes*nVar; iVar++) {
       for (jVar = 0; jVar < nNodes*nVar; jVar++) {
-        for (kVar = 0; kVar < 6; kVar++) {
-          StiffMatrix_Elem[iVar][jVar] += Weight[iGauss] * Aux_Matrix[iVar][kVar]*B_Matrix[kVar][jVar] * fabs(Det);
+        const unsigned short* jRows = NonZeroRows[jVar%nVar];
+        for (kVar = 0; kVar < 3; kVar++) {
+          StiffMatrix_Elem[iVar][jVar] += Weight[iGauss] * Aux_Matrix[iVar][jRows[kVar]]*B_Matrix[jRows[kVar]][jVar] * fabs(Det);
         }
       }
     }
@@ -1519,43 +1605,35 @@ void CVolumetricMovement::SetFEA_StiffMatrix3D(CGeometry *geometry, CConfig *con
 
 }
 
-void CVolumetricMovement::AddFEA_StiffMatrix(CGeometry *geometry, su2double **StiffMatrix_Elem, unsigned long PointCorners[8], unsigned short nNodes) {
+void CVolumetricMovement::AddFEA_StiffMatrix(CGeometry *geometry, su2double StiffMatrix_Elem[24][24], unsigned long PointCorners[8], unsigned short nNodes) {
 
   unsigned short iVar, jVar, iDim, jDim;
 
   unsigned short nVar = geometry->GetnDim();
 
-  su2double **StiffMatrix_Node;
-  StiffMatrix_Node = new su2double* [nVar];
-  for (iVar = 0; iVar < nVar; iVar++)
-    StiffMatrix_Node[iVar] = new su2double [nVar];
-
-  for (iVar = 0; iVar < nVar; iVar++)
-    for (jVar = 0; jVar < nVar; jVar++)
-      StiffMatrix_Node[iVar][jVar] = 0.0;
+  su2double StiffMatrix_Node[3*3] = {0.0};
 
   /*--- Transform the stiffness matrix for the hexahedral element into the
    contributions for the individual nodes relative to each other. ---*/
 
   for (iVar = 0; iVar < nNodes; iVar++) {
+
+    if (LockStrategy) omp_set_lock(&UpdateLocks[PointCorners[iVar]]);
+
     for (jVar = 0; jVar < nNodes; jVar++) {
 
       for (iDim = 0; iDim < nVar; iDim++) {
         for (jDim = 0; jDim < nVar; jDim++) {
-          StiffMatrix_Node[iDim][jDim] = StiffMatrix_Elem[(iVar*nVar)+iDim][(jVar*nVar)+jDim];
+          StiffMatrix_Node[iDim*nVar+jDim] = StiffMatrix_Elem[(iVar*nVar)+iDim][(jVar*nVar)+jDim];
         }
       }
 
       StiffMatrix.AddBlock(PointCorners[iVar], PointCorners[jVar], StiffMatrix_Node);
 
     }
-  }
-
-  /*--- Deallocate memory and exit ---*/
 
-  for (iVar = 0; iVar < nVar; iVar++)
-    delete [] StiffMatrix_Node[iVar];
-  delete [] StiffMatrix_Node;
+    if (LockStrategy) omp_unset_lock(&UpdateLocks[PointCorners[iVar]]);
+  }
 
 }
 
@@ -29,6 +29,7 @@
 
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/toolboxes/allocation_toolbox.hpp"
+#include "../../include/toolboxes/CRegionProfiler.hpp"
 
 #include <cmath>
 
@@ -241,6 +242,8 @@ void CSysMatrixComms::Initiate(const CSysVector<T>& x, CGeometry *geometry,
 
   if (geometry->nP2PSend == 0) return;
 
+  SU2_PROFILE_SCOPE("Halo_Comms");
+
   /*--- Local variables ---*/
 
   const unsigned short COUNT_PER_POINT = x.GetNVar();
@@ -370,6 +373,8 @@ void CSysMatrixComms::Complete(CSysVector<T>& x, CGeometry *geometry,
 
   if (geometry->nP2PRecv == 0) return;
 
+  SU2_PROFILE_SCOPE("Halo_Comms");
+
   /*--- Local variables ---*/
 
   const unsigned short COUNT_PER_POINT = x.GetNVar();
@@ -33,6 +33,7 @@
 #include "../../include/linear_algebra/CSysMatrix.hpp"
 #include "../../include/linear_algebra/CMatrixVectorProduct.hpp"
 #include "../../include/linear_algebra/CPreconditioner.hpp"
+#include "../../include/toolboxes/CRegionProfiler.hpp"
 
 #include <limits>
 
@@ -45,6 +46,23 @@ namespace {
   constexpr T linSolEpsilon() { return numeric_limits<passivedouble>::epsilon(); }
   template<>
   constexpr float linSolEpsilon<float>() { return 1e-12; }
+
+  /*!
+   * \brief Forwards to another preconditioner, measuring its application with the profiler.
+   */
+  template<class ScalarType>
+  class CProfiledPreconditioner final : public CPreconditioner<ScalarType> {
+    const CPreconditioner<ScalarType>& precond;
+  public:
+    explicit CProfiledPreconditioner(const CPreconditioner<ScalarType>& p) : precond(p) {}
+
+    void operator()(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & v) const override {
+      SU2_PROFILE_SCOPE("Preconditioner_Apply");
+      precond(u, v);
+    }
+
+    bool IsIdentity() const override { return precond.IsIdentity(); }
+  };
 }
 
 template<class ScalarType>
@@ -810,6 +828,8 @@ unsigned long CSysSolve<ScalarType>::Smoother_LinSolver(const CSysVector<ScalarT
 template<class ScalarType>
 unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, const CSysVector<su2double> & LinSysRes,
                                            CSysVector<su2double> & LinSysSol, CGeometry *geometry, const CConfig *config) {
+  SU2_PROFILE_SCOPE("Linear_Solver");
+
   /*---
    A word about the templated types. It is assumed that the residual and solution vectors are always of su2doubles,
    meaning that they are active in the discrete adjoint. The same assumption is made in SetExternalSolve.
@@ -888,7 +908,11 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
 
   /*--- Build preconditioner. ---*/
 
-  precond->Build();
+  {
+    SU2_PROFILE_SCOPE("Preconditioner_Build");
+    precond->Build();
+  }
+  const CProfiledPreconditioner<ScalarType> profiledPrecond(*precond);
 
   /*--- Solve system. ---*/
 
@@ -897,19 +921,19 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
 
   switch (KindSolver) {
     case BCGSTAB:
-      IterLinSol = BCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+      IterLinSol = BCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, profiledPrecond, SolverTol, MaxIter, residual, ScreenOutput, config);
       break;
     case FGMRES:
-      IterLinSol = FGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+      IterLinSol = FGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, profiledPrecond, SolverTol, MaxIter, residual, ScreenOutput, config);
       break;
     case RESTARTED_FGMRES:
-      IterLinSol = RFGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+      IterLinSol = RFGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, profiledPrecond, SolverTol, MaxIter, residual, ScreenOutput, config);
       break;
     case CONJUGATE_GRADIENT:
-      IterLinSol = CG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+      IterLinSol = CG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, profiledPrecond, SolverTol, MaxIter, residual, ScreenOutput, config);
       break;
     case SMOOTHER:
-      IterLinSol = Smoother_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+      IterLinSol = Smoother_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, profiledPrecond, SolverTol, MaxIter, residual, ScreenOutput, config);
       break;
     case PASTIX_LDLT : case PASTIX_LU:
       Jacobian.BuildPastixPreconditioner(geometry, config, KindSolver);
@@ -980,7 +1004,7 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
     }
     END_SU2_OMP_SAFE_GLOBAL_ACCESS
 
-    AD::FuncHelper->addToTape(CSysSolve_b<ScalarType>::Solve_b);
+    AD::AddExtFuncToTape(*AD::FuncHelper, CSysSolve_b<ScalarType>::Solve_b, CSysSolve_b<ScalarType>::Solve_p);
 
     SU2_OMP_SAFE_GLOBAL_ACCESS(AD::EndExtFunc();)
 #endif
@@ -994,6 +1018,8 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType> & Jacobian,
                                              CSysVector<su2double> & LinSysSol, CGeometry *geometry, const CConfig *config,
                                              const bool directCall) {
 
+  SU2_PROFILE_SCOPE("Linear_Solver");
+
   unsigned short KindSolver, KindPrecond;
   unsigned long MaxIter, IterLinSol = 0;
   ScalarType SolverTol;
@@ -1040,9 +1066,11 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType> & Jacobian,
 
   /*--- If there was no call to solve first the preconditioner needs to be built here. ---*/
   if (directCall) {
+    SU2_PROFILE_SCOPE("Preconditioner_Build");
     Jacobian.TransposeInPlace();
     precond->Build();
   }
+  const CProfiledPreconditioner<ScalarType> profiledPrecond(*precond);
 
   auto mat_vec = CSysMatrixVectorProduct<ScalarType>(Jacobian, geometry, config);
 
@@ -1055,19 +1083,19 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType> & Jacobian,
 
   switch(KindSolver) {
     case FGMRES:
-      IterLinSol = FGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol , MaxIter, residual, ScreenOutput, config);
+      IterLinSol = FGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, profiledPrecond, SolverTol , MaxIter, residual, ScreenOutput, config);
       break;
     case RESTARTED_FGMRES:
-      IterLinSol = RFGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol , MaxIter, residual, ScreenOutput, config);
+      IterLinSol = RFGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, profiledPrecond, SolverTol , MaxIter, residual, ScreenOutput, config);
       break;
     case BCGSTAB:
-      IterLinSol = BCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol , MaxIter, residual, ScreenOutput, config);
+      IterLinSol = BCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, profiledPrecond, SolverTol , MaxIter, residual, ScreenOutput, config);
       break;
     case CONJUGATE_GRADIENT:
-      IterLinSol = CG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+      IterLinSol = CG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, profiledPrecond, SolverTol, MaxIter, residual, ScreenOutput, config);
       break;
     case SMOOTHER:
-      IterLinSol = Smoother_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+      IterLinSol = Smoother_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, profiledPrecond, SolverTol, MaxIter, residual, ScreenOutput, config);
       break;
     case PASTIX_LDLT : case PASTIX_LU:
       if (directCall) Jacobian.BuildPastixPreconditioner(geometry, config, KindSolver);
@@ -0,0 +1,188 @@
+/*!
+ * \file CPrimalStateStore.cpp
+ * \brief Implementation of the in-memory store of primal states (see hpp).
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/CPrimalStateStore.hpp"
+#include "../../include/parallelization/mpi_structure.hpp"
+#include "../../include/toolboxes/compression_toolbox.hpp"
+
+#include <cstring>
+#include <limits>
+
+using CompressionToolbox::EncodeWords;
+using CompressionToolbox::DecodeWords;
+
+CPrimalStateStore::CPrimalStateStore(unsigned long window, PRIMAL_STORE_COMPRESSION kind)
+    : windowSize(window),
+      compression(kind),
+      rangeLo(std::numeric_limits<Key>::max()),
+      rangeHi(std::numeric_limits<Key>::max()) {}
+
+void CPrimalStateStore::Encode(const su2activematrix& mat, Block& block) const {
+  block.rows = mat.rows();
+  block.cols = mat.cols();
+  const auto n = mat.size();
+
+  switch (compression) {
+    case PRIMAL_STORE_COMPRESSION::NONE: {
+      block.bytes.resize(n * sizeof(passivedouble));
+      auto* ptr = block.bytes.data();
+      for (size_t i = 0; i < n; ++i) {
+        const passivedouble val = SU2_TYPE::GetValue(mat.data()[i]);
+        memcpy(ptr + i * sizeof(passivedouble), &val, sizeof(passivedouble));
+      }
+      break;
+    }
+    case PRIMAL_STORE_COMPRESSION::LOSSLESS: {
+      static_assert(sizeof(passivedouble) == sizeof(uint64_t), "");
+      std::vector<uint64_t> words(n);
+      for (size_t i = 0; i < n; ++i) {
+        const passivedouble val = SU2_TYPE::GetValue(mat.data()[i]);
+        memcpy(&words[i], &val, sizeof(uint64_t));
+      }
+      EncodeWords(words, block.cols, block.bytes);
+      break;
+    }
+    case PRIMAL_STORE_COMPRESSION::FLOAT32: {
+      static_assert(sizeof(float) == sizeof(uint32_t), "");
+      std::vector<uint32_t> words(n);
+      for (size_t i = 0; i < n; ++i) {
+        const auto val = static_cast<float>(SU2_TYPE::GetValue(mat.data()[i]));
+        memcpy(&words[i], &val, sizeof(uint32_t));
+      }
+      EncodeWords(words, block.cols, block.bytes);
+      break;
+    }
+  }
+}
+
+void CPrimalStateStore::Decode(const Block& block, su2activematrix& mat) const {
+  if (block.rows != mat.rows() || block.cols != mat.cols()) {
+    SU2_MPI::Error("The sizes of a stored primal state do not match those of the destination.", CURRENT_FUNCTION);
+  }
+  const auto n = mat.size();
+
+  switch (compression) {
+    case PRIMAL_STORE_COMPRESSION::NONE: {
+      const auto* ptr = block.bytes.data();
+      for (size_t i = 0; i < n; ++i) {
+        passivedouble val;
+        memcpy(&val, ptr + i * sizeof(passivedouble), sizeof(passivedouble));
+        mat.data()[i] = val;
+      }
+      break;
+    }
+    case PRIMAL_STORE_COMPRESSION::LOSSLESS: {
+      std::vector<uint64_t> words(n);
+      DecodeWords(block.bytes, block.cols, words);
+      for (size_t i = 0; i < n; ++i) {
+        passivedouble val;
+        memcpy(&val, &words[i], sizeof(uint64_t));
+        mat.data()[i] = val;
+      }
+      break;
+    }
+    case PRIMAL_STORE_COMPRESSION::FLOAT32: {
+      std::vector<uint32_t> words(n);
+      DecodeWords(block.bytes, block.cols, words);
+      for (size_t i = 0; i < n; ++i) {
+        float val;
+        memcpy(&val, &words[i], sizeof(uint32_t));
+        mat.data()[i] = passivedouble(val);
+      }
+      break;
+    }
+  }
+}
+
+void CPrimalStateStore::Store(Key key, const std::vector<const su2activematrix*>& vars, bool checkpoint) {
+  auto& state = states[key];
+  state.checkpoint = checkpoint;
+  state.blocks.resize(vars.size());
+  for (auto iVar = 0ul; iVar < vars.size(); ++iVar) Encode(*vars[iVar], state.blocks[iVar]);
+
+  Evict();
+}
+
+bool CPrimalStateStore::Retrieve(Key key, const std::vector<su2activematrix*>& vars) const {
+  const auto it = states.find(key);
+  if (it == states.end()) return false;
+
+  const auto& blocks = it->second.blocks;
+  if (blocks.size() != vars.size()) {
+    SU2_MPI::Error("The number of variables of a stored primal state does not match the request.", CURRENT_FUNCTION);
+  }
+  for (auto iVar = 0ul; iVar < vars.size(); ++iVar) Decode(blocks[iVar], *vars[iVar]);
+  return true;
+}
+
+void CPrimalStateStore::SetCheckpoint(Key key, bool checkpoint) {
+  const auto it = states.find(key);
+  if (it == states.end()) return;
+  it->second.checkpoint = checkpoint;
+  if (!checkpoint) Evict();
+}
+
+void CPrimalStateStore::SetWorkingRange(Key lo, Key hi) {
+  rangeLo = lo;
+  rangeHi = hi;
+
+  for (auto it = states.upper_bound(hi); it != states.end();) {
+    if (it->second.checkpoint) ++it;
+    else it = states.erase(it);
+  }
+  Evict();
+}
+
+void CPrimalStateStore::Evict() {
+  unsigned long nWindow = 0;
+  for (const auto& state : states) nWindow += !state.second.checkpoint;
+
+  while (nWindow > windowSize) {
+    /*--- Prefer states above the working range (no longer needed by a reverse sweep),
+     *    then the lowest state that is not in the working range. ---*/
+    auto victim = states.end();
+    for (auto it = states.upper_bound(rangeHi); it != states.end(); ++it) {
+      if (!it->second.checkpoint) { victim = it; break; }
+    }
+    if (victim == states.end()) {
+      for (auto it = states.begin(); it != states.end(); ++it) {
+        const bool inRange = (it->first >= rangeLo) && (it->first <= rangeHi);
+        if (!it->second.checkpoint && !inRange) { victim = it; break; }
+      }
+    }
+    if (victim == states.end()) break;
+
+    states.erase(victim);
+    --nWindow;
+  }
+}
+
+unsigned long CPrimalStateStore::GetMemoryUsage() const {
+  unsigned long bytes = 0;
+  for (const auto& state : states)
+    for (const auto& block : state.second.blocks) bytes += block.bytes.size();
+  return bytes;
+}
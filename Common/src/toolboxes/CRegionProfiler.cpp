@@ -0,0 +1,546 @@
+/*!
+ * \file CRegionProfiler.cpp
+ * \brief Implementation of the hierarchical timers of the solver phases.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/CRegionProfiler.hpp"
+#include "../../include/parallelization/mpi_structure.hpp"
+#include "../../include/parallelization/omp_structure.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+bool CRegionProfiler::active = false;
+
+namespace {
+
+constexpr int N_COUNTERS = CRegionProfiler::N_COUNTERS;
+
+/*--- Bounds the memory used by the trace (~100 bytes of JSON per event). ---*/
+constexpr size_t MAX_EVENTS_PER_THREAD = 200000;
+
+using Clock = std::chrono::steady_clock;
+
+/*!
+ * \brief Node of the region tree of a thread, the children are regions entered from within it.
+ */
+struct Node {
+  int region, parent;
+  std::vector<int> children;
+  unsigned long calls = 0;
+  double time = 0.0;
+  uint64_t counters[N_COUNTERS] = {};
+  Node(int region_, int parent_) : region(region_), parent(parent_) {}
+};
+
+/*!
+ * \brief Open region.
+ */
+struct Frame {
+  int node;
+  double start;
+  uint64_t counters[N_COUNTERS];
+};
+
+/*!
+ * \brief Closed region, for the trace.
+ */
+struct Event {
+  int region;
+  double start, duration;
+};
+
+/*!
+ * \brief Data of one thread, node 0 is the root of the tree.
+ */
+struct ThreadData {
+  std::vector<Node> nodes;
+  std::vector<Frame> stack;
+  std::vector<Event> events;
+  unsigned long droppedEvents = 0;
+  int perfFd[N_COUNTERS] = {-1, -1, -1};
+  bool perfTried = false, perfOpen = false;
+
+  ThreadData() { nodes.emplace_back(-1, -1); }
+
+  void CloseCounters() {
+#ifdef __linux__
+    for (auto& fd : perfFd) {
+      if (fd >= 0) close(fd);
+      fd = -1;
+    }
+#endif
+    perfOpen = false;
+  }
+
+  ~ThreadData() { CloseCounters(); }
+
+  /*--- Count the user-space cycles, instructions and cache misses of the calling thread, as one group. ---*/
+  void OpenCounters() {
+    perfTried = true;
+#ifdef __linux__
+    const uint64_t config[N_COUNTERS] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                         PERF_COUNT_HW_CACHE_MISSES};
+    for (int i = 0; i < N_COUNTERS; ++i) {
+      perf_event_attr attr;
+      memset(&attr, 0, sizeof(attr));
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.size = sizeof(attr);
+      attr.config = config[i];
+      attr.disabled = (i == 0);
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      attr.read_format = PERF_FORMAT_GROUP;
+      perfFd[i] = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, (i == 0) ? -1 : perfFd[0], 0));
+      if (perfFd[i] < 0) {
+        CloseCounters();
+        return;
+      }
+    }
+    ioctl(perfFd[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(perfFd[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    perfOpen = true;
+#endif
+  }
+
+  void ReadCounters(uint64_t* values) const {
+    for (int i = 0; i < N_COUNTERS; ++i) values[i] = 0;
+#ifdef __linux__
+    uint64_t buf[1 + N_COUNTERS];
+    if (read(perfFd[0], buf, sizeof(buf)) == static_cast<ssize_t>(sizeof(buf))) {
+      for (int i = 0; i < N_COUNTERS; ++i) values[i] = buf[1 + i];
+    }
+#endif
+  }
+};
+
+std::mutex registryMutex;
+std::vector<std::string> regionNames;
+std::vector<std::unique_ptr<ThreadData>> threadData;
+Clock::time_point epoch;
+bool traceEvents = false, readCounters = false;
+std::atomic<bool> countersFailed(false);
+
+inline double Now() { return std::chrono::duration<double>(Clock::now() - epoch).count(); }
+
+inline ThreadData* GetThreadData() {
+  const auto iThread = static_cast<size_t>(omp_get_thread_num());
+  return (iThread < threadData.size()) ? threadData[iThread].get() : nullptr;
+}
+
+/*!
+ * \brief Append a node (except the root) and its subtree to a list of entries, depth-first.
+ */
+void AppendTree(const ThreadData& td, int iNode, const std::string& prefix, unsigned short depth,
+                std::vector<CRegionProfiler::Entry>& entries, std::vector<int>& regions) {
+  const auto& node = td.nodes[iNode];
+  std::string path = prefix;
+
+  if (iNode != 0) {
+    path += (prefix.empty() ? "" : "/") + regionNames[node.region];
+    entries.emplace_back();
+    auto& entry = entries.back();
+    entry.path = path;
+    entry.depth = depth;
+    entry.calls = node.calls;
+    entry.time = node.time;
+    for (int i = 0; i < N_COUNTERS; ++i) entry.counters[i] = node.counters[i];
+    regions.push_back(node.region);
+    ++depth;
+  }
+  for (auto child : node.children) AppendTree(td, child, path, depth, entries, regions);
+}
+
+/*!
+ * \brief Inclusive time of each region on one thread (nested calls of a region are counted once).
+ */
+std::vector<double> RegionTimes(const ThreadData& td) {
+  std::vector<double> times(regionNames.size(), 0.0);
+  for (size_t iNode = 1; iNode < td.nodes.size(); ++iNode) {
+    const auto& node = td.nodes[iNode];
+    bool nested = false;
+    for (int p = node.parent; p > 0 && !nested; p = td.nodes[p].parent) nested = (td.nodes[p].region == node.region);
+    if (!nested) times[node.region] += node.time;
+  }
+  return times;
+}
+
+/*!
+ * \brief Gather one string per rank on the master rank.
+ */
+std::vector<std::string> GatherOnMaster(const std::string& local) {
+  const int rank = SU2_MPI::GetRank(), size = SU2_MPI::GetSize();
+  int length = static_cast<int>(local.size());
+  std::vector<int> lengths(size);
+  SU2_MPI::Gather(&length, 1, MPI_INT, lengths.data(), 1, MPI_INT, MASTER_NODE, SU2_MPI::GetComm());
+
+  std::vector<std::string> all;
+  if (rank == MASTER_NODE) {
+    all.resize(size);
+    all[MASTER_NODE] = local;
+    for (int iRank = 0; iRank < size; ++iRank) {
+      if (iRank == MASTER_NODE) continue;
+      all[iRank].resize(lengths[iRank]);
+      SU2_MPI::Recv(&all[iRank][0], lengths[iRank], MPI_CHAR, iRank, 0, SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
+    }
+  } else {
+    SU2_MPI::Send(local.data(), length, MPI_CHAR, MASTER_NODE, 0, SU2_MPI::GetComm());
+  }
+  return all;
+}
+
+std::string JsonEscape(const std::string& str) {
+  std::string out;
+  for (auto c : str) {
+    if (c == '"' || c == '\\') out += '\\';
+    out += c;
+  }
+  return out;
+}
+
+/*!
+ * \brief Data of one region path combined over ranks.
+ */
+struct Aggregate {
+  unsigned short depth = 0;
+  int nRanks = 0;
+  unsigned long calls = 0;
+  double sum = 0.0, min = std::numeric_limits<double>::max(), max = 0.0, threadImbalance = 1.0;
+  uint64_t counters[N_COUNTERS] = {};
+};
+
+}  // namespace
+
+void CRegionProfiler::Initialize(PROFILING_MODE mode, bool counters) {
+  active = false;
+  threadData.clear();
+  countersFailed = false;
+
+  if (mode == PROFILING_MODE::NONE) return;
+
+  traceEvents = (mode == PROFILING_MODE::TRACE);
+  readCounters = counters;
+
+  for (int iThread = 0; iThread < omp_get_max_threads(); ++iThread) threadData.emplace_back(new ThreadData);
+
+  /*--- Common time origin for the trace. ---*/
+  SU2_MPI::Barrier(SU2_MPI::GetComm());
+  epoch = Clock::now();
+  active = true;
+}
+
+int CRegionProfiler::RegisterRegion(const char* name) {
+  std::lock_guard<std::mutex> lock(registryMutex);
+  const auto it = std::find(regionNames.begin(), regionNames.end(), name);
+  if (it != regionNames.end()) return static_cast<int>(it - regionNames.begin());
+  regionNames.emplace_back(name);
+  return static_cast<int>(regionNames.size()) - 1;
+}
+
+void CRegionProfiler::Start(int region) {
+  auto* td = GetThreadData();
+  if (!td) return;
+
+  const int parent = td->stack.empty() ? 0 : td->stack.back().node;
+  int iNode = -1;
+  for (auto child : td->nodes[parent].children) {
+    if (td->nodes[child].region == region) {
+      iNode = child;
+      break;
+    }
+  }
+  if (iNode < 0) {
+    iNode = static_cast<int>(td->nodes.size());
+    td->nodes.emplace_back(region, parent);
+    td->nodes[parent].children.push_back(iNode);
+  }
+
+  Frame frame;
+  frame.node = iNode;
+  if (readCounters && !td->perfTried) {
+    td->OpenCounters();
+    if (!td->perfOpen) countersFailed = true;
+  }
+  if (td->perfOpen) {
+    td->ReadCounters(frame.counters);
+  } else {
+    for (auto& c : frame.counters) c = 0;
+  }
+  /*--- Last, to leave the bookkeeping out of the measurement. ---*/
+  frame.start = Now();
+  td->stack.push_back(frame);
+}
+
+void CRegionProfiler::Stop() {
+  const double end = Now();
+  auto* td = GetThreadData();
+  if (!td || td->stack.empty()) return;
+
+  const auto frame = td->stack.back();
+  td->stack.pop_back();
+
+  auto& node = td->nodes[frame.node];
+  ++node.calls;
+  node.time += end - frame.start;
+
+  if (td->perfOpen) {
+    uint64_t counters[N_COUNTERS];
+    td->ReadCounters(counters);
+    for (int i = 0; i < N_COUNTERS; ++i) node.counters[i] += counters[i] - frame.counters[i];
+  }
+
+  if (traceEvents) {
+    if (td->events.size() < MAX_EVENTS_PER_THREAD) {
+      td->events.push_back({node.region, frame.start, end - frame.start});
+    } else {
+      ++td->droppedEvents;
+    }
+  }
+}
+
+std::vector<CRegionProfiler::Entry> CRegionProfiler::GetLocalTree() {
+  std::vector<Entry> entries;
+  std::vector<int> regions;
+  if (!threadData.empty()) AppendTree(*threadData[0], 0, "", 0, entries, regions);
+  return entries;
+}
+
+void CRegionProfiler::Finalize(const std::string& summaryFile, const std::string& traceFile) {
+  if (!active) return;
+  const double localTime = Now();
+  active = false;
+
+  const int rank = SU2_MPI::GetRank(), size = SU2_MPI::GetSize();
+
+  double totalTime = 0.0;
+  SelectMPIWrapper<passivedouble>::W::Allreduce(&localTime, &totalTime, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+
+  /*--- Thread imbalance of each region, max over the threads that entered it divided by their average. ---*/
+
+  std::vector<double> maxTime(regionNames.size(), 0.0), sumTime(regionNames.size(), 0.0);
+  std::vector<int> nThreads(regionNames.size(), 0);
+  unsigned long droppedEvents = 0;
+
+  for (const auto& td : threadData) {
+    const auto times = RegionTimes(*td);
+    for (size_t iRegion = 0; iRegion < times.size(); ++iRegion) {
+      if (times[iRegion] <= 0.0) continue;
+      maxTime[iRegion] = std::max(maxTime[iRegion], times[iRegion]);
+      sumTime[iRegion] += times[iRegion];
+      ++nThreads[iRegion];
+    }
+    droppedEvents += td->droppedEvents;
+  }
+
+  /*--- Serialize the tree of the master thread. ---*/
+
+  std::vector<Entry> entries;
+  std::vector<int> regions;
+  AppendTree(*threadData[0], 0, "", 0, entries, regions);
+
+  std::ostringstream local;
+  local << std::setprecision(17);
+  for (size_t iEntry = 0; iEntry < entries.size(); ++iEntry) {
+    const auto& entry = entries[iEntry];
+    const int iRegion = regions[iEntry];
+    const double imbalance = (sumTime[iRegion] > 0.0) ? maxTime[iRegion] * nThreads[iRegion] / sumTime[iRegion] : 1.0;
+    local << entry.path << '\t' << entry.depth << '\t' << entry.calls << '\t' << entry.time;
+    for (auto c : entry.counters) local << '\t' << c;
+    local << '\t' << imbalance << '\n';
+  }
+
+  const auto allTrees = GatherOnMaster(local.str());
+
+  int failed = countersFailed, anyFailed = 0;
+  SU2_MPI::Allreduce(&failed, &anyFailed, 1, MPI_INT, MPI_MAX, SU2_MPI::GetComm());
+  unsigned long totalDropped = 0;
+  SU2_MPI::Allreduce(&droppedEvents, &totalDropped, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+
+  if (rank == MASTER_NODE) {
+
+    /*--- Combine the ranks, each path is a node of the tree. ---*/
+
+    std::map<std::string, Aggregate> aggregates;
+    std::map<std::string, std::vector<std::string> > children;
+
+    for (const auto& tree : allTrees) {
+      std::istringstream lines(tree);
+      std::string line;
+      while (std::getline(lines, line)) {
+        std::istringstream fields(line);
+        std::string path, field;
+        std::getline(fields, path, '\t');
+
+        auto it = aggregates.find(path);
+        if (it == aggregates.end()) {
+          it = aggregates.emplace(path, Aggregate()).first;
+          const auto pos = path.rfind('/');
+          children[(pos == std::string::npos) ? "" : path.substr(0, pos)].push_back(path);
+        }
+        auto& agg = it->second;
+
+        unsigned long calls = 0;
+        double time = 0.0, imbalance = 1.0;
+        uint64_t counters[N_COUNTERS] = {};
+        std::getline(fields, field, '\t');
+        agg.depth = static_cast<unsigned short>(std::stoul(field));
+        std::getline(fields, field, '\t');
+        calls = std::stoul(field);
+        std::getline(fields, field, '\t');
+        time = std::stod(field);
+        for (auto& c : counters) {
+          std::getline(fields, field, '\t');
+          c = std::stoull(field);
+        }
+        std::getline(fields, field, '\t');
+        imbalance = std::stod(field);
+
+        ++agg.nRanks;
+        agg.calls += calls;
+        agg.sum += time;
+        agg.min = std::min(agg.min, time);
+        agg.max = std::max(agg.max, time);
+        agg.threadImbalance = std::max(agg.threadImbalance, imbalance);
+        for (int i = 0; i < N_COUNTERS; ++i) agg.counters[i] += counters[i];
+      }
+    }
+
+    /*--- Depth-first order, the children in order of first appearance. ---*/
+
+    std::vector<std::string> order;
+    std::vector<std::string> pending(1, "");
+    while (!pending.empty()) {
+      const auto parent = pending.back();
+      pending.pop_back();
+      if (!parent.empty()) order.push_back(parent);
+      const auto& kids = children[parent];
+      for (auto it = kids.rbegin(); it != kids.rend(); ++it) pending.push_back(*it);
+    }
+
+    const bool showCounters = readCounters && !anyFailed;
+
+    std::cout << "\n------------------------------ Profiling summary -----------------------------\n";
+    std::cout << "Wall time of the profiled run: " << totalTime << " s, " << size << " rank(s), "
+              << threadData.size() << " thread(s) per rank.\n";
+    std::cout << "Times are inclusive and per rank, Imbal. is max/avg over ranks, Thr.imb. is max/avg over the\n"
+                 "threads that entered a region with the same name.\n\n";
+
+    std::cout << std::left << std::setw(40) << "Region" << std::right << std::setw(10) << "Calls" << std::setw(11)
+              << "Avg [s]" << std::setw(11) << "Min [s]" << std::setw(11) << "Max [s]" << std::setw(8) << "%" << std::setw(8)
+              << "Imbal." << std::setw(9) << "Thr.imb.";
+    if (showCounters) std::cout << std::setw(7) << "IPC" << std::setw(12) << "Miss/call";
+    std::cout << '\n';
+
+    std::ofstream csv;
+    if (!summaryFile.empty()) {
+      csv.open(summaryFile);
+      csv << "\"Region\",\"Depth\",\"Calls\",\"Avg_Time\",\"Min_Time\",\"Max_Time\",\"Rank_Imbalance\",\"Thread_Imbalance\","
+             "\"Cycles\",\"Instructions\",\"Cache_Misses\"\n";
+      csv << std::setprecision(10);
+    }
+
+    for (const auto& path : order) {
+      const auto& agg = aggregates[path];
+      const double minTime = (agg.nRanks < size) ? 0.0 : agg.min;
+      const double avgTime = agg.sum / size;
+      const double imbalance = (avgTime > 0.0) ? agg.max / avgTime : 1.0;
+      const auto pos = path.rfind('/');
+      const auto name = std::string(2 * agg.depth, ' ') + ((pos == std::string::npos) ? path : path.substr(pos + 1));
+
+      std::cout << std::left << std::setw(40) << name.substr(0, 39) << std::right << std::setw(10) << agg.calls / size
+                << std::fixed << std::setprecision(4) << std::setw(11) << avgTime << std::setw(11) << minTime
+                << std::setw(11) << agg.max << std::setprecision(1) << std::setw(8)
+                << ((totalTime > 0.0) ? 100 * avgTime / totalTime : 0.0) << std::setprecision(2) << std::setw(8)
+                << imbalance << std::setw(9) << agg.threadImbalance;
+      if (showCounters) {
+        const double ipc = agg.counters[0] ? double(agg.counters[1]) / agg.counters[0] : 0.0;
+        std::cout << std::setw(7) << ipc << std::setprecision(0) << std::setw(12)
+                  << (agg.calls ? double(agg.counters[2]) / agg.calls : 0.0);
+      }
+      std::cout << std::defaultfloat << '\n';
+
+      if (csv.is_open()) {
+        csv << '"' << path << "\"," << agg.depth << ',' << agg.calls << ',' << avgTime << ',' << minTime << ','
+            << agg.max << ',' << imbalance << ',' << agg.threadImbalance;
+        for (auto c : agg.counters) csv << ',' << (showCounters ? c : 0);
+        csv << '\n';
+      }
+    }
+
+    if (readCounters && anyFailed) {
+      std::cout << "\nWARNING: Hardware counters are not available (perf_event_open failed, "
+                   "see /proc/sys/kernel/perf_event_paranoid).\n";
+    }
+    if (totalDropped > 0) {
+      std::cout << "\nWARNING: " << totalDropped << " events were not included in the trace (limit of "
+                << MAX_EVENTS_PER_THREAD << " per thread).\n";
+    }
+    if (csv.is_open()) std::cout << "\nProfiling summary written to " << summaryFile << ".\n";
+    std::cout << std::endl;
+  }
+
+  /*--- Timeline, complete events ("X") in microseconds, processes are ranks and threads are threads. ---*/
+
+  if (traceEvents && !traceFile.empty()) {
+    std::ostringstream events;
+    events << std::fixed << std::setprecision(3);
+    events << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << rank << ",\"args\":{\"name\":\"Rank " << rank
+           << "\"}}";
+    for (size_t iThread = 0; iThread < threadData.size(); ++iThread) {
+      for (const auto& event : threadData[iThread]->events) {
+        events << ",\n{\"name\":\"" << JsonEscape(regionNames[event.region]) << "\",\"ph\":\"X\",\"ts\":"
+               << 1e6 * event.start << ",\"dur\":" << 1e6 * event.duration << ",\"pid\":" << rank
+               << ",\"tid\":" << iThread << "}";
+      }
+    }
+    const auto allEvents = GatherOnMaster(events.str());
+
+    if (rank == MASTER_NODE) {
+      std::ofstream trace(traceFile);
+      trace << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+      for (int iRank = 0; iRank < size; ++iRank) trace << (iRank ? ",\n" : "") << allEvents[iRank];
+      trace << "\n]}\n";
+      std::cout << "Profiling trace written to " << traceFile << "." << std::endl;
+    }
+  }
+
+  threadData.clear();
+}
@@ -0,0 +1,132 @@
+/*!
+ * \file CTapeChunkStore.cpp
+ * \brief Implementation of the store of idle AD tape chunks (see hpp).
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/CTapeChunkStore.hpp"
+#include "../../include/toolboxes/compression_toolbox.hpp"
+#include "../../include/parallelization/mpi_structure.hpp"
+
+#include <cstring>
+
+namespace {
+
+/*--- Values of 1, 2, 4, or 8 bytes are encoded as words, those of other sizes (structures)
+ *    byte by byte, each byte being xor'ed with the same byte of the previous value. ---*/
+
+template <class Word>
+void EncodeArray(const void* data, unsigned long count, unsigned long cols, std::vector<uint8_t>& bytes) {
+  std::vector<Word> words(count);
+  if (count) memcpy(words.data(), data, count * sizeof(Word));
+  CompressionToolbox::EncodeWords(words, cols, bytes);
+}
+
+template <class Word>
+void DecodeArray(const std::vector<uint8_t>& bytes, unsigned long count, unsigned long cols, void* data) {
+  std::vector<Word> words(count);
+  CompressionToolbox::DecodeWords(bytes, cols, words);
+  if (count) memcpy(data, words.data(), count * sizeof(Word));
+}
+
+}  // namespace
+
+CTapeChunkStore::Settings& CTapeChunkStore::Defaults() {
+  static Settings settings;
+  return settings;
+}
+
+CTapeChunkStore::CTapeChunkStore(bool toFile_, std::string scratchDir_)
+    : toFile(toFile_), scratchDir(std::move(scratchDir_)) {}
+
+CTapeChunkStore::~CTapeChunkStore() {
+  if (file) {
+    fclose(file);
+    remove(fileName.c_str());
+  }
+}
+
+void CTapeChunkStore::Encode(const void* data, size_t wordSize, unsigned long count, Block& block) {
+  Release(block);
+
+  switch (wordSize) {
+    case 1: EncodeArray<uint8_t>(data, count, 1, block.bytes); break;
+    case 2: EncodeArray<uint16_t>(data, count, 1, block.bytes); break;
+    case 4: EncodeArray<uint32_t>(data, count, 1, block.bytes); break;
+    case 8: EncodeArray<uint64_t>(data, count, 1, block.bytes); break;
+    default: EncodeArray<uint8_t>(data, count * wordSize, wordSize, block.bytes); break;
+  }
+  block.count = count;
+  block.size = block.bytes.size();
+
+  if (!toFile) {
+    memory += block.size;
+    return;
+  }
+
+  if (!file) {
+    /*--- Each store has its own file, the tape has a few (one per kind of chunk). ---*/
+    static unsigned long counter = 0;
+    fileName = scratchDir + "/su2_tape_" + std::to_string(SU2_MPI::GetRank()) + "_" + std::to_string(counter++) + ".dat";
+    file = fopen(fileName.c_str(), "w+b");
+    if (!file) SU2_MPI::Error("Could not create the tape scratch file " + fileName, CURRENT_FUNCTION);
+  }
+  if (fseek(file, fileEnd, SEEK_SET) != 0 || fwrite(block.bytes.data(), 1, block.size, file) != block.size) {
+    SU2_MPI::Error("Could not write to the tape scratch file " + fileName, CURRENT_FUNCTION);
+  }
+  block.offset = fileEnd;
+  fileEnd += block.size;
+  std::vector<uint8_t>().swap(block.bytes);
+}
+
+void CTapeChunkStore::Decode(const Block& block, size_t wordSize, void* data) const {
+  std::vector<uint8_t> fileBytes;
+  if (block.offset >= 0) {
+    fileBytes.resize(block.size);
+    if (fseek(file, block.offset, SEEK_SET) != 0 || fread(fileBytes.data(), 1, block.size, file) != block.size) {
+      SU2_MPI::Error("Could not read from the tape scratch file " + fileName, CURRENT_FUNCTION);
+    }
+  }
+  const auto& bytes = (block.offset >= 0) ? fileBytes : block.bytes;
+  const auto count = block.count;
+
+  switch (wordSize) {
+    case 1: DecodeArray<uint8_t>(bytes, count, 1, data); break;
+    case 2: DecodeArray<uint16_t>(bytes, count, 1, data); break;
+    case 4: DecodeArray<uint32_t>(bytes, count, 1, data); break;
+    case 8: DecodeArray<uint64_t>(bytes, count, 1, data); break;
+    default: DecodeArray<uint8_t>(bytes, count * wordSize, wordSize, data); break;
+  }
+}
+
+void CTapeChunkStore::Release(Block& block) {
+  if (block.offset < 0) memory -= block.bytes.size();
+  std::vector<uint8_t>().swap(block.bytes);
+  block.count = 0;
+  block.size = 0;
+  block.offset = -1;
+}
+
+void CTapeChunkStore::Clear() {
+  fileEnd = 0;
+}
@@ -45,6 +45,21 @@ protected:
   RECORDING SecondaryVariables;                 /*!< \brief The kind of recording linked to the secondary variables of the problem.*/
   int MainSolver;                               /*!< \brief Index of the main adjoint solver. */
   su2double ObjFunc;                            /*!< \brief The value of the objective function.*/
+  unsigned short nObjDirections = 1;            /*!< \brief Number of objectives solved for at once (vector mode if > 1).*/
+  vector<su2double> ObjFuncs;                   /*!< \brief The objective functions of the vector mode, one per adjoint direction.*/
+  vector<su2passivematrix> AdjointStates;       /*!< \brief Adjoint solutions of each direction (vector mode).*/
+  vector<su2passivematrix> Sensitivities;       /*!< \brief Volume sensitivities of each direction (vector mode).*/
+
+  /*!
+   * \brief Residuals of a solver, combined over the adjoint directions (vector mode).
+   */
+  struct DirectionResiduals {
+    vector<su2double> rms, max;
+    vector<unsigned long> point;
+    vector<array<su2double,3> > coord;
+  };
+  vector<DirectionResiduals> CombinedResiduals; /*!< \brief Combined residuals of each solver (vector mode).*/
+  unsigned long TapeRecordIter[2];              /*!< \brief Time step at which the main and secondary tapes were recorded (tape replay).*/
   CIteration* direct_iteration;                 /*!< \brief A pointer to the direct iteration.*/
 
   CConfig *config;                              /*!< \brief Definition of the particular problem. */
@@ -57,6 +72,45 @@ protected:
 
   COutputLegacy* output_legacy;
 
+  /*!
+   * \brief Make one adjoint direction (objective) the current one, by selecting it in the AD tool
+   *        and loading its adjoint solution into the adjoint solvers (vector mode).
+   * \param[in] iDir - Index of the direction.
+   */
+  void LoadDirection(unsigned short iDir);
+
+  /*!
+   * \brief Store the adjoint solution of the current direction (vector mode).
+   */
+  void StoreDirection();
+
+  /*!
+   * \brief Combine the residuals of the current direction with those of the previous directions, keeping the
+   *        largest of each variable, so that the solvers hold the combined residuals after the last direction.
+   * \param[in] iDir - Index of the direction.
+   */
+  void CombineResiduals(unsigned short iDir);
+
+  /*!
+   * \brief Make the tape of a kind of recording the active one and, if it was recorded recently enough
+   *        (UNST_ADJOINT_TAPE_REPLAY), re-evaluate it with the current primal inputs instead of recording again.
+   * \param[in] kind_recording - MainVariables or SecondaryVariables.
+   * \return True if the tape was replayed, false if it needs to be recorded.
+   */
+  bool ReplayRecording(RECORDING kind_recording);
+
+  /*!
+   * \brief Register the objective function(s) as outputs of the tape.
+   */
+  void RegisterObjFunction();
+
+  /*!
+   * \brief Register the values that can change between time steps, without being computed by the iteration
+   *        (time step size, boundary data of the Python wrapper), as inputs of the tapes that are replayed.
+   * \param[in] reset - Remove the identifiers of a previous recording instead.
+   */
+  void RegisterTimeDependentInputs(bool reset);
+
 public:
 
   /*!
@@ -91,6 +145,12 @@ public:
    */
   void Postprocess(void) override;
 
+  /*!
+   * \brief Output the solution in solution file, one set of files per objective in vector mode.
+   * \param[in] TimeIter - index of the current time-step.
+   */
+  void Output(unsigned long TimeIter) override;
+
   /*!
    * \brief Record one iteration of a flow iteration in within multiple zones.
    * \param[in] kind_recording - Type of recording (full list in ENUM_RECORDING, option_structure.hpp)
@@ -109,7 +169,7 @@ public:
   void SetObjFunction(void);
 
   /*!
-   * \brief Initialize the adjoint value of the objective function.
+   * \brief Initialize the adjoint value of the objective function (of each objective in vector mode).
    */
   void SetAdj_ObjFunction(void);
 
@@ -788,6 +788,145 @@ public:
     }
   }
 
+  /*--- Bulk access to marker and volume data, the arrays are mapped to NumPy arrays by the Python
+   *    wrapper. Marker arrays have one row per vertex (halos included) and one column per dimension.
+   *    The getters fill arrays allocated by the caller, the setters read them. ---*/
+
+  /*!
+   * \brief Get the global indices of the vertices of a marker.
+   * \param[in] iMarker - Marker identifier.
+   * \param[out] indices - Global index of each vertex (nVertex).
+   * \param[in] nRows - Size of the array.
+   */
+  void GetMarkerGlobalIndices(unsigned short iMarker, unsigned long* indices, int nRows) const;
+
+  /*!
+   * \brief Get the undeformed coordinates (from the mesh solver) of the vertices of a marker.
+   * \param[in] iMarker - Marker identifier.
+   * \param[out] values - Coordinates (nVertex x nDim).
+   * \param[in] nRows - Number of rows of the array.
+   * \param[in] nCols - Number of columns of the array.
+   */
+  void GetMarkerInitialCoordinates(unsigned short iMarker, passivedouble* values, int nRows, int nCols) const;
+
+  /*!
+   * \brief Get the normals of the vertices of a marker.
+   * \param[in] iMarker - Marker identifier.
+   * \param[out] values - Normals (nVertex x nDim).
+   * \param[in] nRows - Number of rows of the array.
+   * \param[in] nCols - Number of columns of the array.
+   * \param[in] unitNormals - Normalize the vectors.
+   */
+  void GetMarkerNormals(unsigned short iMarker, passivedouble* values, int nRows, int nCols,
+                        bool unitNormals = false) const;
+
+  /*!
+   * \brief Get the temperatures of the vertices of a marker (see GetVertexTemperature).
+   * \param[in] iMarker - Marker identifier.
+   * \param[out] values - Temperatures (nVertex).
+   * \param[in] nRows - Size of the array.
+   */
+  void GetMarkerTemperatures(unsigned short iMarker, passivedouble* values, int nRows) const;
+
+  /*!
+   * \brief Set the temperatures of the vertices of a customized marker.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] newValues - Temperatures (nVertex).
+   * \param[in] nRows - Size of the array.
+   */
+  void SetMarkerTemperatures(unsigned short iMarker, passivedouble* newValues, int nRows);
+
+  /*!
+   * \brief Get the heat fluxes of the vertices of a marker (see GetVertexHeatFluxes).
+   * \param[in] iMarker - Marker identifier.
+   * \param[out] values - Heat fluxes (nVertex x nDim).
+   * \param[in] nRows - Number of rows of the array.
+   * \param[in] nCols - Number of columns of the array.
+   */
+  void GetMarkerHeatFluxes(unsigned short iMarker, passivedouble* values, int nRows, int nCols) const;
+
+  /*!
+   * \brief Set the displacements of the vertices of a marker for the mesh solver.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] newValues - Displacements (nVertex x nDim).
+   * \param[in] nRows - Number of rows of the array.
+   * \param[in] nCols - Number of columns of the array.
+   */
+  void SetMarkerDisplacements(unsigned short iMarker, passivedouble* newValues, int nRows, int nCols);
+
+  /*!
+   * \brief Get the flow loads (tractions) of the vertices of a marker, zero if the marker is not a wall.
+   * \param[in] iMarker - Marker identifier.
+   * \param[out] values - Loads (nVertex x nDim).
+   * \param[in] nRows - Number of rows of the array.
+   * \param[in] nCols - Number of columns of the array.
+   */
+  void GetMarkerFlowLoads(unsigned short iMarker, passivedouble* values, int nRows, int nCols) const;
+
+  /*!
+   * \brief Set the loads of the vertices of a marker for the structural solver.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] newValues - Loads (nVertex x nDim).
+   * \param[in] nRows - Number of rows of the array.
+   * \param[in] nCols - Number of columns of the array.
+   */
+  void SetMarkerFEALoads(unsigned short iMarker, passivedouble* newValues, int nRows, int nCols);
+
+  /*!
+   * \brief Get the displacements of the vertices of a marker from the structural solver.
+   * \param[in] iMarker - Marker identifier.
+   * \param[out] values - Displacements (nVertex x nDim).
+   * \param[in] nRows - Number of rows of the array.
+   * \param[in] nCols - Number of columns of the array.
+   */
+  void GetMarkerFEADisplacements(unsigned short iMarker, passivedouble* values, int nRows, int nCols) const;
+
+  /*!
+   * \brief Get the coordinates of all points (halos included).
+   * \param[out] values - Coordinates (nPoint x nDim).
+   * \param[in] nRows - Number of rows of the array.
+   * \param[in] nCols - Number of columns of the array.
+   */
+  void GetCoordinates(passivedouble* values, int nRows, int nCols) const;
+
+  /*!
+   * \brief Get the solution of a solver at all points (halos included).
+   * \param[in] iSolver - Position of the solver (FLOW_SOL, TURB_SOL, etc.).
+   * \param[out] values - Solution (nPoint x nVar).
+   * \param[in] nRows - Number of rows of the array.
+   * \param[in] nCols - Number of columns of the array.
+   */
+  void GetSolution(unsigned short iSolver, passivedouble* values, int nRows, int nCols) const;
+
+  /*!
+   * \brief Set the solution of a solver at all points (halos included).
+   * \param[in] iSolver - Position of the solver (FLOW_SOL, TURB_SOL, etc.).
+   * \param[in] newValues - Solution (nPoint x nVar).
+   * \param[in] nRows - Number of rows of the array.
+   * \param[in] nCols - Number of columns of the array.
+   */
+  void SetSolution(unsigned short iSolver, passivedouble* newValues, int nRows, int nCols);
+
+  /*!
+   * \brief Get a view (no copy) of the coordinates of all points (halos included).
+   * \note Not available in AD builds. The view is valid while the geometry exists, it must not be modified.
+   * \param[out] view - Pointer to the coordinates (nPoint x nDim, row-major).
+   * \param[out] nRows - Number of points.
+   * \param[out] nCols - Number of dimensions.
+   */
+  void GetCoordinatesView(passivedouble** view, int* nRows, int* nCols);
+
+  /*!
+   * \brief Get a view (no copy) of the solution of a solver at all points (halos included).
+   * \note Not available in AD builds. The view is valid while the solver exists, modifications
+   * are seen by the solver (halos are not communicated).
+   * \param[in] iSolver - Position of the solver (FLOW_SOL, TURB_SOL, etc.).
+   * \param[out] view - Pointer to the solution (nPoint x nVar, row-major).
+   * \param[out] nRows - Number of points.
+   * \param[out] nCols - Number of variables.
+   */
+  void GetSolutionView(unsigned short iSolver, passivedouble** view, int* nRows, int* nCols);
+
 };
 
 /*!
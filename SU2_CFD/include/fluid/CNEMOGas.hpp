@@ -132,6 +132,24 @@ public:
                                                        const su2double* cvve, const su2double* dTdU, const su2double* dTvedU,
                                                        su2double **val_jacobian) = 0;
 
+  /*!
+   * \brief Compute species net production rates for a block of points.
+   * \note The inputs and outputs are stored by species (structure of arrays), e.g. the density of
+   * species s at point i is val_rhos[s*nPoints+i]. Implementations must not modify the object.
+   * \param[in] nPoints - Number of points in the block.
+   * \param[in] val_rhos - Species partial densities.
+   * \param[in] val_T - Translational/Rotational temperatures.
+   * \param[in] val_Tve - Vibrational/Electronic temperatures.
+   * \param[out] val_ws - Species net production rates.
+   */
+  virtual void ComputeNetProductionRates(unsigned long nPoints, const su2double* val_rhos, const su2double* val_T,
+                                         const su2double* val_Tve, su2double* val_ws) const;
+
+  /*!
+   * \brief Whether the gas model implements the batched net production rates.
+   */
+  virtual bool HasBatchedNetProductionRates() const { return false; }
+
   /*!
    * \brief Populate chemical source term jacobian.
    */
@@ -61,8 +61,7 @@ private:
   Wall_Catalycity,                /*!< \brief Specified wall species mass-fractions for catalytic boundaries. */
   Particle_Mass,                  /*!< \brief Mass of all particles present in the plasma */
   MolarFracWBE,                   /*!< \brief Molar fractions to be used in Wilke/Blottner/Eucken model */
-  phis, mus,                      /*!< \brief Auxiliary vectors to be used in Wilke/Blottner/Eucken model */
-  A;                              /*!< \brief Auxiliary vector to be used in net production rate computation */
+  phis, mus;                      /*!< \brief Auxiliary vectors to be used in Wilke/Blottner/Eucken model */
 
   std::array<su2double,1> mu_ref; /*!< \brief Vector containing reference viscosity for Sutherland's law */
   std::array<su2double,1> k_ref;  /*!< \brief Vector containing reference thermal conducivities for Sutherland's law */
@@ -84,20 +83,25 @@ private:
   su2double                     /*!< \brief Derivatives w.r.t. conservative variables */
   *dPdU, *dTdU, *dTvedU;
 
-  su2double fwdRxn, bkwRxn,
-  kf,kfb,kb,
-  coeff, eta, epsilon, T_min,
-  Trxnf, Trxnb,
-  Thf, Thb, dThf, dThb,
-  theta, af, bf, ab, bb;
-
   vector<su2double>
-  dkf, dkb,
-  dRfok, dRbok,
   eve, eve_eq, cvve, cvve_eq;
 
-  vector<int>
-  alphak, betak;
+  C3DDoubleMatrix KeqConstants;  /*!< \brief Table of equilibrium reaction constants of each reaction. */
+
+  su2matrix<int> ReactantStoich, /*!< \brief Number of times each species is a reactant of each reaction. */
+  ProductStoich;                 /*!< \brief Number of times each species is a product of each reaction. */
+
+  static constexpr unsigned short MAXNSPECIES = 20; /*!< \brief Max number of species, for static arrays. */
+  static constexpr unsigned short MAXNVAR = MAXNSPECIES+5; /*!< \brief Max number of variables, for static arrays. */
+  static constexpr unsigned long BLOCK_SIZE = 64; /*!< \brief Chunk size of the batched routines. */
+
+  /*!
+   * \brief Rate-controlling temperatures, rate coefficients, and rates of progress of one reaction at one point.
+   */
+  struct ReactionRates {
+    su2double Trxnf, Trxnb, Thf, Thb, kf, kb, fwdRxn, bkwRxn;
+    su2double A[5];
+  };
 
 public:
 
@@ -195,6 +199,18 @@ public:
    */
   vector<su2double>& ComputeTemperatures(vector<su2double>& val_rhos, su2double rhoEmix, su2double rhoEve, su2double rhoEvel, su2double Tve_old) final;
 
+  /*!
+   * \brief Compute species net production rates for a block of points.
+   * \note Does not modify the object, and can therefore be called concurrently by multiple threads.
+   */
+  void ComputeNetProductionRates(unsigned long nPoints, const su2double* val_rhos, const su2double* val_T,
+                                 const su2double* val_Tve, su2double* val_ws) const final;
+
+  /*!
+   * \brief The batched net production rates are implemented.
+   */
+  bool HasBatchedNetProductionRates() const final { return true; }
+
   private:
 
   /*!
@@ -204,10 +220,65 @@ public:
 
   /*!
    * \brief Calculates constants used for Keq correlation.
-   * \param[out] A - Reference to coefficient array.
-   * \param[in] val_reaction - Reaction number indicator.
+   * \param[in] val_Reaction - Reaction number indicator.
+   * \param[in] N - Mixture number density [1/cm^3].
+   * \param[out] A - Coefficient array.
+   */
+  void ComputeKeqConstants(unsigned short val_Reaction, su2double N, su2double* A) const;
+
+  /*!
+   * \brief Compute the mixture number density [1/cm^3] used for the Keq correlation.
+   * \param[in] val_rhos - Species partial densities.
+   * \param[in] stride - Distance between the densities of consecutive species.
+   */
+  inline su2double ComputeNumberDensity(const su2double* val_rhos, unsigned long stride = 1) const {
+    su2double N = 0.0;
+    for (unsigned short iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+      N += val_rhos[iSpecies*stride]/MolarMass[iSpecies]*AVOGAD_CONSTANT;
+    return N*(1E-6);
+  }
+
+  /*!
+   * \brief Compute the rate-controlling temperatures and the rate coefficients of a reaction.
+   * \param[in] iReaction - Reaction number.
+   * \param[in] val_T - Translational/Rotational temperature.
+   * \param[in] val_Tve - Vibrational/Electronic temperature.
+   * \param[in] N - Mixture number density [1/cm^3].
+   * \param[out] rxn - Rates of the reaction, the rates of progress are not set.
+   */
+  void ComputeRateCoefficients(unsigned short iReaction, su2double val_T, su2double val_Tve,
+                               su2double N, ReactionRates& rxn) const;
+
+  /*!
+   * \brief Compute the forward and backward rates of progress of a reaction.
+   * \param[in] iReaction - Reaction number.
+   * \param[in] conc - Species molar concentrations [kmol/cm^3 * 1E3].
+   * \param[in] stride - Distance between the concentrations of consecutive species.
+   * \param[in,out] rxn - Rates of the reaction (the coefficients must be set).
+   */
+  inline void ComputeRatesOfProgress(unsigned short iReaction, const su2double* conc,
+                                     unsigned long stride, ReactionRates& rxn) const {
+    rxn.fwdRxn = 1.0;
+    rxn.bkwRxn = 1.0;
+    for (unsigned short ii = 0; ii < 3; ii++) {
+      const auto iSpecies = Reactions(iReaction,0,ii);
+      if (iSpecies != nSpecies) rxn.fwdRxn *= conc[iSpecies*stride];
+      const auto jSpecies = Reactions(iReaction,1,ii);
+      if (jSpecies != nSpecies) rxn.bkwRxn *= conc[jSpecies*stride];
+    }
+    rxn.fwdRxn = 1000.0 * rxn.kf * rxn.fwdRxn;
+    rxn.bkwRxn = 1000.0 * rxn.kb * rxn.bkwRxn;
+  }
+
+  /*!
+   * \brief Add the contribution of one reaction to the chemical source term jacobian.
+   * \param[in] iReaction - Reaction number.
+   * \param[in] rxn - Rates of the reaction.
+   * \param[in] conc - Species molar concentrations.
    */
-  void ComputeKeqConstants(unsigned short val_Reaction);
+  void ChemistryJacobian(unsigned short iReaction, const ReactionRates& rxn, const su2double* conc,
+                         const su2double* eve, const su2double* cvve, const su2double* dTdU,
+                         const su2double* dTvedU, su2double **val_jacobian) const;
 
   /*!
    * \brief Calculate species diffusion coefficients with Wilke/Blottner/Eucken transport model.
@@ -28,6 +28,7 @@
  */
 
 #include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/CRegionProfiler.hpp"
 
 namespace detail {
 
@@ -202,6 +203,7 @@ void computeGradientsGreenGauss(CSolver* solver,
                                 size_t varBegin,
                                 size_t varEnd,
                                 GradientType& gradient) {
+  SU2_PROFILE_SCOPE("Gradients");
   switch (geometry.GetnDim()) {
   case 2:
     detail::computeGradientsGreenGauss<2>(solver, kindMpiComm, kindPeriodicComm, geometry,
@@ -28,6 +28,7 @@
 
 #include "../../../Common/include/parallelization/omp_structure.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
+#include "../../../Common/include/toolboxes/CRegionProfiler.hpp"
 
 namespace detail {
 
@@ -341,6 +342,7 @@ void computeGradientsLeastSquares(CSolver* solver,
                                   size_t varEnd,
                                   GradientType& gradient,
                                   RMatrixType& Rmatrix) {
+  SU2_PROFILE_SCOPE("Gradients");
   switch (geometry.GetnDim()) {
   case 2:
     detail::computeGradientsLeastSquares<2>(solver, kindMpiComm, kindPeriodicComm, geometry, config,
@@ -28,7 +28,9 @@
 
 #pragma once
 
+#include <memory>
 #include "CIteration.hpp"
+#include "../../../Common/include/toolboxes/CPrimalStateStore.hpp"
 
 class CFluidIteration;
 
@@ -42,6 +44,12 @@ class CDiscAdjFluidIteration final : public CIteration {
  private:
   const bool turbulent;                      /*!< \brief Stores the turbulent flag. */
 
+  std::unique_ptr<CPrimalStateStore> PrimalStore;    /*!< \brief In-memory primal trajectory (checkpointing mode). */
+  std::unique_ptr<CFluidIteration> PrimalIteration;  /*!< \brief Direct iteration used to recompute primal states. */
+  std::unique_ptr<COutput> PrimalOutput;             /*!< \brief Direct output monitoring the recomputed time steps. */
+  std::vector<long> Checkpoints;                     /*!< \brief Stack of checkpoints, the base states at the bottom. */
+  unsigned long nRecomputedSteps = 0;                /*!< \brief Number of primal time steps recomputed so far. */
+
   /*!
    * \brief load unsteady solution for unsteady problems
    * \param[in] geometry - Geometrical definition of the problem.
@@ -54,13 +62,73 @@ class CDiscAdjFluidIteration final : public CIteration {
   void LoadUnsteady_Solution(CGeometry**** geometry, CSolver***** solver, CConfig** config, unsigned short val_iZone,
                              unsigned short val_iInst, int val_DirectIter);
 
+  /*!
+   * \brief Get the solution matrices (on all grid levels) that define a primal state.
+   * \param[in] solver - Solvers of the zone and instance.
+   * \param[in] config - Definition of the particular problem.
+   * \return Pointers to the solution matrices of the primal solvers.
+   */
+  vector<su2activematrix*> GetPrimalState(CSolver*** solver, const CConfig* config) const;
+
+  /*!
+   * \brief Set the solution of the primal solvers to a stored state, or to freestream for negative iterations.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iZone - Index of the zone.
+   * \param[in] iInst - Index of the instance.
+   * \param[in] DirectIter - Direct iteration to restore.
+   */
+  void RestorePrimalState(CGeometry**** geometry, CSolver***** solver, CConfig** config, unsigned short iZone,
+                          unsigned short iInst, long DirectIter);
+
+  /*!
+   * \brief Set the time levels n and n-1 (and optionally the solution) from the stored states that precede DirectIter.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iZone - Index of the zone.
+   * \param[in] iInst - Index of the instance.
+   * \param[in] DirectIter - Direct iteration whose previous time levels are set.
+   * \param[in] setSolution - Also set the solution to the state at DirectIter.
+   */
+  void SetPrimalTimeLevels(CGeometry**** geometry, CSolver***** solver, CConfig** config, unsigned short iZone,
+                           unsigned short iInst, long DirectIter, bool setSolution);
+
+  /*!
+   * \brief Make sure the states DirectIter-order+1 to DirectIter are stored, recomputing them from the
+   * closest checkpoint if necessary, and placing new checkpoints according to the binomial schedule.
+   */
+  void ComputePrimalStates(COutput* output, CIntegration**** integration, CGeometry**** geometry, CSolver***** solver,
+                           CNumerics****** numerics, CConfig** config, CSurfaceMovement** surface_movement,
+                           CVolumetricMovement*** grid_movement, CFreeFormDefBox*** FFDBox, unsigned short iZone,
+                           unsigned short iInst, long DirectIter);
+
+  /*!
+   * \brief Converge one primal time step (from the current time levels) and store the result.
+   */
+  void AdvancePrimal(COutput* output, CIntegration**** integration, CGeometry**** geometry, CSolver***** solver,
+                     CNumerics****** numerics, CConfig** config, CSurfaceMovement** surface_movement,
+                     CVolumetricMovement*** grid_movement, CFreeFormDefBox*** FFDBox, unsigned short iZone,
+                     unsigned short iInst, long DirectIter);
+
+  /*!
+   * \brief Push a checkpoint (the states needed to restart at DirectIter) or pop the last one.
+   */
+  void PushCheckpoint(long DirectIter, const CConfig* config);
+  void PopCheckpoint(const CConfig* config);
+
  public:
   /*!
    * \brief Constructor of the class.
    * \param[in] config - Definition of the particular problem.
    */
-  explicit CDiscAdjFluidIteration(const CConfig *config) : CIteration(config),
-    turbulent(config->GetKind_Solver() == MAIN_SOLVER::DISC_ADJ_RANS || config->GetKind_Solver() == MAIN_SOLVER::DISC_ADJ_INC_RANS) {}
+  explicit CDiscAdjFluidIteration(const CConfig *config);
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CDiscAdjFluidIteration() override;
 
   /*!
    * \brief Preprocessing to prepare for an iteration of the physics.
@@ -27,6 +27,7 @@
 
 #include "CLimiterDetails.hpp"
 #include "computeLimiters_impl.hpp"
+#include "../../../Common/include/toolboxes/CRegionProfiler.hpp"
 
 /*!
  * \brief A wrapper funtion that calls specialized implementations depending
@@ -54,6 +55,8 @@ void computeLimiters(LIMITER LimiterKind,
   if (geometry.GetnDim() != 2 && geometry.GetnDim() != 3)
     SU2_MPI::Error("Too many dimensions to compute limiters.", CURRENT_FUNCTION);
 
+  SU2_PROFILE_SCOPE("Limiters");
+
 #define INSTANTIATE(KIND)\
 if (geometry.GetnDim() == 2) {\
   computeLimiters_impl<2,KIND>(solver, kindMpiComm, kindPeriodicComm1, kindPeriodicComm2, geometry,\
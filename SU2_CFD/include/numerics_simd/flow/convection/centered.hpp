@@ -31,6 +31,7 @@
 #include "../../util.hpp"
 #include "../variables.hpp"
 #include "common.hpp"
+#include "centered_b.hpp"
 #include "../../../variables/CEulerVariable.hpp"
 #include "../../../../../Common/include/geometry/CGeometry.hpp"
 
@@ -51,16 +52,30 @@ protected:
   const su2double gamma;
   const su2double fixFactor;
   const bool dynamicGrid;
+  const bool extFuncAD;
   const su2double stretchParam = 0.3;
 
+  /*!
+   * \brief Whether the scheme implements "dissipationParams", i.e. supports the hand-differentiated flux.
+   */
+  static constexpr bool handDifferentiated = false;
+
+  /*!
+   * \brief Parameters of the dissipation term for the hand-differentiated flux.
+   */
+  CCenteredDissipationParams dissipationParams(passivedouble ni, passivedouble nj) const { return {}; }
+
   /*!
    * \brief Constructor, store some constants and forward args to base.
+   * \note The hand-differentiated flux covers the inviscid scalar dissipation schemes on static grids.
    */
   template<class... Ts>
   CCenteredBase(const CConfig& config, Ts&... args) : Base(config, args...),
     gamma(config.GetGamma()),
     fixFactor(config.GetCent_Jac_Fix_Factor()),
-    dynamicGrid(config.GetDynamic_Grid()) {
+    dynamicGrid(config.GetDynamic_Grid()),
+    extFuncAD(Derived::handDifferentiated && Base::nPrimVar == 0 && !dynamicGrid &&
+              config.GetDiscrete_Adjoint() && config.GetEdgeFluxExtFunc()) {
   }
 
   /*!
@@ -76,29 +91,22 @@ protected:
     return geometry.nodes->GetnNeighbor(idx);
   }
 
-public:
   /*!
-   * \brief Implementation of the base centered flux.
+   * \brief Compute the flux and Jacobians of the edges.
    */
-  void ComputeFlux(Int iEdge,
-                   const CConfig& config,
-                   const CGeometry& geometry,
-                   const CVariable& solution_,
-                   UpdateType updateType,
-                   Double updateMask,
-                   CSysVector<su2double>& vector,
-                   SparseMatrixType& matrix) const final {
+  FORCEINLINE void computeFlux(Int iEdge,
+                               Int iPoint,
+                               Int jPoint,
+                               bool implicit,
+                               const CConfig& config,
+                               const CGeometry& geometry,
+                               const CVariable& solution_,
+                               VectorDbl<nVar>& flux,
+                               MatrixDbl<nVar>& jac_i,
+                               MatrixDbl<nVar>& jac_j) const {
 
-    /*--- Start preaccumulation, inputs are registered
-     *    automatically in "gatherVariables". ---*/
-    AD::StartPreacc();
-
-    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
     const auto& solution = static_cast<const CEulerVariable&>(solution_);
 
-    const auto iPoint = geometry.edges->GetNode(iEdge,0);
-    const auto jPoint = geometry.edges->GetNode(iEdge,1);
-
     /*--- Geometric properties. ---*/
 
     const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
@@ -135,9 +143,8 @@ public:
 
     /*--- Inviscid fluxes and Jacobians. ---*/
 
-    auto flux = inviscidProjFlux(avgV, avgU, normal);
+    flux = inviscidProjFlux(avgV, avgU, normal);
 
-    MatrixDbl<nVar> jac_i, jac_j;
     if (implicit) {
       jac_i = inviscidProjJac(gamma, V.i.velocity(), U.i.energy(), normal, 0.5);
       jac_j = inviscidProjJac(gamma, V.j.velocity(), U.j.energy(), normal, 0.5);
@@ -173,10 +180,101 @@ public:
 
     Base::viscousTerms(iEdge, iPoint, jPoint, avgV, V, solution_, geometry,
                        config, area, unitNormal, implicit, flux, jac_i, jac_j);
+  }
+
+#ifdef CODI_REVERSE_TYPE
+  /*!
+   * \brief Record the flux as an external function, whose derivatives are provided by CCenteredFlux_b.
+   * \note The flux is computed with the tape paused, only the inputs are stored on the tape, and
+   *       CCenteredFlux_b::Primal recomputes it when the tape is replayed with new inputs.
+   */
+  FORCEINLINE void computeFluxExtFunc(Int iEdge,
+                                      Int iPoint,
+                                      Int jPoint,
+                                      bool implicit,
+                                      const CConfig& config,
+                                      const CGeometry& geometry,
+                                      const CVariable& solution_,
+                                      VectorDbl<nVar>& flux,
+                                      MatrixDbl<nVar>& jac_i,
+                                      MatrixDbl<nVar>& jac_j) const {
+    static_assert(Double::Size == 1, "The SIMD size must be 1 for reverse AD.");
+
+    const auto& solution = static_cast<const CEulerVariable&>(solution_);
+    const auto& normal = geometry.edges->GetNormal();
+    const auto& primitives = solution.GetPrimitive();
+    const unsigned long points[] = {iPoint[0], jPoint[0]};
+
+    const auto params = static_cast<const Derived*>(this)->dissipationParams(
+                          geometry.nodes->GetnNeighbor(points[0]), geometry.nodes->GetnNeighbor(points[1]));
 
-    /*--- Stop preaccumulation. ---*/
+    AD::ExtFuncHelper helper(true);
+    helper.disableOutputPrimalStore();
 
-    stopPreacc(flux);
+    /*--- Inputs, in the order expected by CCenteredFlux_b. ---*/
+
+    for (size_t iDim = 0; iDim < nDim; ++iDim) helper.addInput(normal(iEdge[0],iDim));
+    for (auto point : points)
+      for (size_t iVar = 1; iVar <= CCenteredFlux_b<nDim>::nPrimVar; ++iVar)
+        helper.addInput(primitives(point,iVar));
+    for (auto point : points) helper.addInput(solution.GetLambda()(point));
+    if (params.sensor) {
+      for (auto point : points) helper.addInput(solution.GetSensor()(point));
+    }
+    if (params.laplacian) {
+      for (auto point : points)
+        for (size_t iVar = 0; iVar < nVar; ++iVar)
+          helper.addInput(solution.GetUndivided_Laplacian()(point,iVar));
+    }
+
+    AD::StopRecording();
+    computeFlux(iEdge, iPoint, jPoint, implicit, config, geometry, solution_, flux, jac_i, jac_j);
+    AD::StartRecording();
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) helper.addOutput(flux(iVar)[0]);
+    helper.addUserData(params);
+    AD::AddExtFuncToTape(helper, CCenteredFlux_b<nDim>::Reverse, CCenteredFlux_b<nDim>::Primal);
+  }
+#endif
+
+public:
+  /*!
+   * \brief Implementation of the base centered flux.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    VectorDbl<nVar> flux;
+    MatrixDbl<nVar> jac_i, jac_j;
+
+#ifdef CODI_REVERSE_TYPE
+    /*--- Hand-differentiated flux, not used if preaccumulation is paused due to shared reading. ---*/
+    if (extFuncAD && AD::TapeActive() && AD::PreaccEnabled) {
+      computeFluxExtFunc(iEdge, iPoint, jPoint, implicit, config, geometry, solution, flux, jac_i, jac_j);
+    } else
+#endif
+    {
+      /*--- Start preaccumulation, inputs are registered
+       *    automatically in "gatherVariables". ---*/
+      AD::StartPreacc();
+
+      computeFlux(iEdge, iPoint, jPoint, implicit, config, geometry, solution, flux, jac_i, jac_j);
+
+      /*--- Stop preaccumulation. ---*/
+
+      stopPreacc(flux);
+    }
 
     /*--- Update the vector and system matrix. ---*/
 
@@ -212,6 +310,23 @@ public:
     kappa4(config.GetKappa_4th_Flow()) {
   }
 
+  static constexpr bool handDifferentiated = true;
+
+  /*!
+   * \brief Parameters of the dissipation term for the hand-differentiated flux.
+   */
+  CCenteredDissipationParams dissipationParams(passivedouble ni, passivedouble nj) const {
+    CCenteredDissipationParams params;
+    const passivedouble sc2 = 3 * (ni+nj) / (ni*nj);
+    params.sensorCoeff = 0.5 * SU2_TYPE::GetValue(kappa2) * sc2;
+    params.kappa4 = SU2_TYPE::GetValue(kappa4);
+    params.sc4 = 0.25 * pow(sc2, 2);
+    params.stretch = SU2_TYPE::GetValue(stretchParam);
+    params.sensor = true;
+    params.laplacian = true;
+    return params;
+  }
+
   /*!
    * \brief Updates flux and Jacobians with JST dissipation.
    * \note "Ts" is here just in case other schemes in the family need extra args.
@@ -417,6 +532,19 @@ public:
     kappa2(config.GetKappa_2nd_Flow()) {
   }
 
+  static constexpr bool handDifferentiated = true;
+
+  /*!
+   * \brief Parameters of the dissipation term for the hand-differentiated flux.
+   */
+  CCenteredDissipationParams dissipationParams(passivedouble ni, passivedouble nj) const {
+    CCenteredDissipationParams params;
+    params.sensorCoeff = 0.5 * SU2_TYPE::GetValue(kappa2) * 3 * (ni+nj) / (ni*nj);
+    params.stretch = SU2_TYPE::GetValue(stretchParam);
+    params.sensor = true;
+    return params;
+  }
+
   /*!
    * \brief Updates flux and Jacobians with 2nd order dissipation.
    * \note "Ts" is here just in case other schemes in the family need extra args.
@@ -488,6 +616,18 @@ public:
     kappa0(config.GetKappa_1st_Flow()) {
   }
 
+  static constexpr bool handDifferentiated = true;
+
+  /*!
+   * \brief Parameters of the dissipation term for the hand-differentiated flux.
+   */
+  CCenteredDissipationParams dissipationParams(passivedouble ni, passivedouble nj) const {
+    CCenteredDissipationParams params;
+    params.eps2Const = SU2_TYPE::GetValue(kappa0) * nDim * (ni+nj) / (ni*nj);
+    params.stretch = SU2_TYPE::GetValue(stretchParam);
+    return params;
+  }
+
   /*!
    * \brief Updates flux and Jacobians with 1st order scalar dissipation.
    * \note "Ts" is here just in case other schemes in the family need extra args.
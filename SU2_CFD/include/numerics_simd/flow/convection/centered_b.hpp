@@ -0,0 +1,286 @@
+/*!
+ * \file centered_b.hpp
+ * \brief Hand-differentiated (reverse mode) centered convective fluxes, recorded
+ *        as external functions to avoid taping every operation of the edge loop.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include "../../../../../Common/include/basic_types/datatype_structure.hpp"
+
+/*!
+ * \brief Parameters of the scalar dissipation of the centered schemes (JST, JST_KE, LAX).
+ * \note The 2nd order coefficient is eps2 = eps2Const + sensorCoeff * (s_i + s_j), and
+ * the 4th order one is eps4 = max(0, kappa4 - eps2) * sc4. They are passive (geometry-based).
+ */
+struct CCenteredDissipationParams {
+  passivedouble eps2Const = 0.0;   /*!< \brief Constant part of the 2nd order coefficient. */
+  passivedouble sensorCoeff = 0.0; /*!< \brief Factor of the pressure sensor in the 2nd order coefficient. */
+  passivedouble kappa4 = 0.0;      /*!< \brief 4th order dissipation constant. */
+  passivedouble sc4 = 0.0;         /*!< \brief Stretching factor of the 4th order coefficient. */
+  passivedouble stretch = 0.0;     /*!< \brief Exponent of the spectral radius correction. */
+  bool sensor = false;             /*!< \brief The pressure sensors are inputs. */
+  bool laplacian = false;          /*!< \brief The undivided Laplacians are inputs. */
+};
+
+/*!
+ * \class CCenteredFlux_b
+ * \ingroup ConvDiscr
+ * \brief Reverse mode derivative of the inviscid centered flux on a static grid.
+ * \note The inputs (x) are, in order: the edge normal (nDim), the primitives of i and j
+ * (nPrimVar each, velocity, pressure, density, enthalpy, speed of sound, i.e. primitives 1
+ * to nDim+4), the spectral radii of i and j, the pressure sensors of i and j (if params.sensor),
+ * and the undivided Laplacians of i and j (nVar each, if params.laplacian). The outputs are the
+ * nVar components of the flux. Only the inputs need to be stored on the tape.
+ */
+template<size_t nDim>
+struct CCenteredFlux_b {
+  static constexpr size_t nVar = nDim+2;
+  static constexpr size_t nPrimVar = nDim+4;
+
+  /*!
+   * \brief Number of inputs for a given set of parameters.
+   */
+  static size_t nInput(const CCenteredDissipationParams& params) {
+    return nDim + 2*nPrimVar + 2 + 2*params.sensor + 2*nVar*params.laplacian;
+  }
+
+  /*!
+   * \brief Intermediate values of the primal flux, shared by ::Flux and ::Adjoint.
+   */
+  struct Primals {
+    passivedouble avgV[nPrimVar], diffU[nVar], dissip[nVar], phi[2];
+    passivedouble area, projVel, mdot, lambda0, corr, lambdaCorr, eps2, eps4;
+    bool eps4Active;
+  };
+
+  /*--- Offsets of the primitives. ---*/
+
+  static constexpr size_t PRES = nDim, RHO = nDim+1, ENTH = nDim+2, SOUND = nDim+3;
+
+  /*!
+   * \brief Compute the intermediate values of the primal flux.
+   * \param[in] x - Inputs (see class notes).
+   * \param[in] params - Dissipation parameters.
+   */
+  static Primals Forward(const passivedouble* x, const CCenteredDissipationParams& params) {
+    using std::abs; using std::pow; using std::sqrt;
+
+    const passivedouble* normal = x;
+    const passivedouble* V[2] = {x + nDim, x + nDim + nPrimVar};
+    const passivedouble* lambda = x + nDim + 2*nPrimVar;
+    const passivedouble* sensor = lambda + 2;
+    const passivedouble* lapl[2] = {sensor + 2*params.sensor, sensor + 2*params.sensor + nVar};
+
+    Primals p;
+    for (size_t iVar = 0; iVar < nPrimVar; ++iVar) p.avgV[iVar] = 0.5 * (V[0][iVar] + V[1][iVar]);
+
+    p.area = 0.0; p.projVel = 0.0;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      p.area += pow(normal[iDim], 2);
+      p.projVel += p.avgV[iDim] * normal[iDim];
+    }
+    p.area = sqrt(p.area);
+    p.mdot = p.avgV[RHO] * p.projVel;
+
+    p.diffU[0] = V[0][RHO] - V[1][RHO];
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      p.diffU[iDim+1] = V[0][RHO]*V[0][iDim] - V[1][RHO]*V[1][iDim];
+    }
+    p.diffU[nVar-1] = V[0][RHO]*V[0][ENTH] - V[1][RHO]*V[1][ENTH];
+
+    p.lambda0 = abs(p.projVel) + p.avgV[SOUND]*p.area;
+    for (int k = 0; k < 2; ++k) p.phi[k] = pow(0.25*lambda[k]/p.lambda0, params.stretch);
+    p.corr = 4*p.phi[0]*p.phi[1] / (p.phi[0]+p.phi[1]);
+    p.lambdaCorr = p.corr * p.lambda0;
+
+    p.eps2 = params.eps2Const;
+    if (params.sensor) p.eps2 += params.sensorCoeff * (sensor[0] + sensor[1]);
+    p.eps4Active = params.laplacian && (params.kappa4 - p.eps2 > 0.0);
+    p.eps4 = p.eps4Active ? (params.kappa4 - p.eps2) * params.sc4 : 0.0;
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      p.dissip[iVar] = p.eps2 * p.diffU[iVar];
+      if (params.laplacian) p.dissip[iVar] -= p.eps4 * (lapl[0][iVar] - lapl[1][iVar]);
+    }
+    return p;
+  }
+
+  /*!
+   * \brief Compute the flux, the same as the primal kernel for the inputs of the class.
+   * \param[in] x - Inputs (see class notes).
+   * \param[in] params - Dissipation parameters.
+   * \param[out] y - The nVar components of the flux.
+   */
+  static void Flux(const passivedouble* x, const CCenteredDissipationParams& params, passivedouble* y) {
+    const auto p = Forward(x, params);
+    const passivedouble* normal = x;
+
+    y[0] = p.mdot;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) y[iDim+1] = p.mdot*p.avgV[iDim] + normal[iDim]*p.avgV[PRES];
+    y[nVar-1] = p.mdot*p.avgV[ENTH];
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) y[iVar] += p.dissip[iVar] * p.lambdaCorr;
+  }
+
+  /*!
+   * \brief Accumulate the Jacobian-transpose product J^T * y_b into x_b.
+   * \param[in] x - Inputs (see class notes).
+   * \param[in] y_b - Adjoints of the flux.
+   * \param[in] params - Dissipation parameters.
+   * \param[in,out] x_b - Adjoints of the inputs.
+   */
+  static void Adjoint(const passivedouble* x, const passivedouble* y_b,
+                      const CCenteredDissipationParams& params, passivedouble* x_b) {
+    using std::pow;
+
+    /*--- Unpack the inputs. ---*/
+
+    const passivedouble* normal = x;
+    const passivedouble* V[2] = {x + nDim, x + nDim + nPrimVar};
+    const passivedouble* lambda = x + nDim + 2*nPrimVar;
+    const passivedouble* sensor = lambda + 2;
+    const passivedouble* lapl[2] = {sensor + 2*params.sensor, sensor + 2*params.sensor + nVar};
+
+    passivedouble* normal_b = x_b;
+    passivedouble* V_b[2] = {x_b + nDim, x_b + nDim + nPrimVar};
+    passivedouble* lambda_b = x_b + nDim + 2*nPrimVar;
+    passivedouble* sensor_b = lambda_b + 2;
+    passivedouble* lapl_b[2] = {sensor_b + 2*params.sensor, sensor_b + 2*params.sensor + nVar};
+
+    /*--- Recompute the intermediate values of the primal. ---*/
+
+    const auto p = Forward(x, params);
+    const auto& avgV = p.avgV;
+    const auto& diffU = p.diffU;
+    const auto& dissip = p.dissip;
+    const auto& phi = p.phi;
+    const auto area = p.area, projVel = p.projVel, mdot = p.mdot, lambda0 = p.lambda0, corr = p.corr;
+    const auto lambdaCorr = p.lambdaCorr, eps2 = p.eps2, eps4 = p.eps4;
+    const bool eps4Active = p.eps4Active;
+
+    /*--- Reverse sweep, dissipation term. ---*/
+
+    passivedouble lambdaCorr_b = 0.0, eps2_b = 0.0, eps4_b = 0.0;
+    passivedouble diffU_b[nVar];
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      lambdaCorr_b += y_b[iVar] * dissip[iVar];
+      const passivedouble dissip_b = y_b[iVar] * lambdaCorr;
+      diffU_b[iVar] = dissip_b * eps2;
+      eps2_b += dissip_b * diffU[iVar];
+      if (params.laplacian) {
+        eps4_b -= dissip_b * (lapl[0][iVar] - lapl[1][iVar]);
+        lapl_b[0][iVar] -= dissip_b * eps4;
+        lapl_b[1][iVar] += dissip_b * eps4;
+      }
+    }
+
+    if (eps4Active) eps2_b -= eps4_b * params.sc4;
+
+    if (params.sensor) {
+      sensor_b[0] += eps2_b * params.sensorCoeff;
+      sensor_b[1] += eps2_b * params.sensorCoeff;
+    }
+
+    /*--- Corrected spectral radius. ---*/
+
+    passivedouble lambda0_b = lambdaCorr_b * corr;
+    const passivedouble corr_b = lambdaCorr_b * lambda0;
+    const passivedouble sumPhi2 = pow(phi[0]+phi[1], 2);
+
+    for (int k = 0; k < 2; ++k) {
+      const passivedouble phi_b = corr_b * 4 * pow(phi[1-k], 2) / sumPhi2;
+      lambda_b[k] += phi_b * params.stretch * phi[k] / lambda[k];
+      lambda0_b -= phi_b * params.stretch * phi[k] / lambda0;
+    }
+
+    passivedouble avgV_b[nPrimVar] = {0.0};
+    const passivedouble projVel_b = lambda0_b * ((projVel > 0.0) - (projVel < 0.0));
+    avgV_b[SOUND] += lambda0_b * area;
+    const passivedouble area_b = lambda0_b * avgV[SOUND];
+
+    /*--- Convective flux. ---*/
+
+    passivedouble mdot_b = y_b[0] + y_b[nVar-1] * avgV[ENTH];
+    avgV_b[ENTH] += y_b[nVar-1] * mdot;
+
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      mdot_b += y_b[iDim+1] * avgV[iDim];
+      avgV_b[iDim] += y_b[iDim+1] * mdot;
+      normal_b[iDim] += y_b[iDim+1] * avgV[PRES];
+      avgV_b[PRES] += y_b[iDim+1] * normal[iDim];
+    }
+
+    avgV_b[RHO] += mdot_b * projVel;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      const passivedouble proj_b = mdot_b * avgV[RHO] + projVel_b;
+      avgV_b[iDim] += proj_b * normal[iDim];
+      normal_b[iDim] += proj_b * avgV[iDim] + area_b * normal[iDim] / area;
+    }
+
+    /*--- Difference of conservative variables. ---*/
+
+    for (int k = 0; k < 2; ++k) {
+      const passivedouble sign = (k == 0) ? 1.0 : -1.0;
+      V_b[k][RHO] += sign * (diffU_b[0] + diffU_b[nVar-1] * V[k][ENTH]);
+      V_b[k][ENTH] += sign * diffU_b[nVar-1] * V[k][RHO];
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        V_b[k][RHO] += sign * diffU_b[iDim+1] * V[k][iDim];
+        V_b[k][iDim] += sign * diffU_b[iDim+1] * V[k][RHO];
+      }
+      /*--- Averages. ---*/
+      for (size_t iVar = 0; iVar < nPrimVar; ++iVar) V_b[k][iVar] += 0.5 * avgV_b[iVar];
+    }
+  }
+
+#ifdef CODI_REVERSE_TYPE
+  /*!
+   * \brief Reverse function registered with the external function helper.
+   * \note The parameters are the first user data of the helper.
+   */
+  static void Reverse(const su2double::Real* x, su2double::Real* x_b, size_t m,
+                      const su2double::Real* y, const su2double::Real* y_b, size_t n,
+                      codi::DataStore* d) {
+    CCenteredDissipationParams params;
+    d->getDataByIndex(params, 0);
+
+    for (size_t i = 0; i < m; ++i) x_b[i] = 0.0;
+    Adjoint(x, y_b, params, x_b);
+  }
+
+  /*!
+   * \brief Primal function registered with the external function helper, used when the tape is replayed.
+   * \note The parameters are the first user data of the helper.
+   */
+  static void Primal(const su2double::Real* x, size_t m, su2double::Real* y, size_t n, codi::DataStore* d) {
+    CCenteredDissipationParams params;
+    d->getDataByIndex(params, 0);
+
+    Flux(x, params, y);
+  }
+#endif
+};
@@ -77,6 +77,11 @@ public:
    */
   void LoadVolumeData(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned long iPoint) override;
 
+  /*!
+   * \brief LoadVolumeData only reads solver and geometry data, the points can be loaded in parallel.
+   */
+  inline bool GetHasThreadedVolumeLoad() const override { return true; }
+
   /*!
    * \brief Check whether the base values for relative residuals should be initialized
    * \param[in] config - Definition of the particular problem.
@@ -72,6 +72,11 @@ public:
    */
   void LoadVolumeData(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned long iPoint) override;
 
+  /*!
+   * \brief LoadVolumeData only reads solver and geometry data, the points can be loaded in parallel.
+   */
+  inline bool GetHasThreadedVolumeLoad() const override { return true; }
+
   /*!
    * \brief Set the available history output fields
    * \param[in] config - Definition of the particular problem.
@@ -64,4 +64,9 @@ public:
    */
   void LoadVolumeData(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned long iPoint) override;
 
+  /*!
+   * \brief LoadVolumeData only reads solver and geometry data, the points can be loaded in parallel.
+   */
+  inline bool GetHasThreadedVolumeLoad() const override { return true; }
+
 };
@@ -37,6 +37,7 @@
 
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
 #include "tools/CWindowingTools.hpp"
+#include "tools/CBinaryHistoryWriter.hpp"
 #include "../../../Common/include/option_structure.hpp"
 
 /*--- AD workaround for a cmath function not defined in CoDi. ---*/
@@ -86,10 +87,13 @@ protected:
   unsigned long curTimeIter,      /*!< \brief Current value of the time iteration index */
   curAbsTimeIter,                 /*!< \brief Current value of the time iteration index */
   curOuterIter,                   /*!< \brief Current value of the outer iteration index */
-  curInnerIter;                   /*!< \brief Current value of the inner iteration index */
+  curInnerIter,                   /*!< \brief Current value of the inner iteration index */
+  volumeAvgStartIter;             /*!< \brief Time iteration at which the averaging of volume fields starts */
 
   string historyFilename;   /*!< \brief The history filename*/
   ofstream histFile;        /*!< \brief Output file stream for the history */
+  CBinaryHistoryWriter binaryHistoryFile; /*!< \brief Writer of the history with HISTORY_FORMAT= BINARY */
+  unsigned long historyLinesSinceFlush = 0; /*!< \brief Lines written to the history file since the last flush */
 
   bool cauchyTimeConverged; /*! \brief: Flag indicating that solver is already converged. Needed for writing restart files. */
 
@@ -274,14 +278,23 @@ protected:
 
   /*! \brief Vector to cache the positions of the field in the data array */
   std::vector<short>                            fieldIndexCache;
-  /*! \brief Current value of the cache index */
-  unsigned short                                cachePosition;
   /*! \brief Boolean to store whether the field index cache should be build. */
   bool                                          buildFieldIndexCache;
   /*! \brief Vector to cache the positions of the field in the data array */
   std::vector<short>                            fieldGetIndexCache;
-  /*! \brief Current value of the cache index */
-  unsigned short                                curGetFieldIndex;
+
+  /*!
+   * \brief Current positions in the set and get caches, each thread loads entire points and so it
+   *        needs its own positions. The padding keeps the positions of different threads in separate cache lines.
+   */
+  struct CacheCursor {
+    unsigned short set = 0, get = 0;
+    char padding[60];
+  };
+  std::vector<CacheCursor>                      cacheCursors;
+
+  /*! \brief Chunk size of the thread-parallel volume data loading loop. */
+  static constexpr unsigned long OMP_VOLUME_LOAD_CHUNK = 1024;
 
   /*! \brief Requested volume field names in the config file. */
   std::vector<string> requestedVolumeFields;
@@ -590,6 +603,12 @@ protected:
    */
   void SetHistoryFile_Header(const CConfig *config);
 
+  /*!
+   * \brief Get the fields of the history file, in the order of the columns.
+   * \return Pointers to the fields.
+   */
+  std::vector<const HistoryOutputField*> GetHistoryFileFields() const;
+
   /*!
    * \brief Write the history file output
    * \param[in] config - Definition of the particular problem.
@@ -719,20 +738,50 @@ protected:
   }
 
 
+  /*!
+   * \brief Clear the offset caches of the volume output fields and the positions of all threads.
+   */
+  void ResetFieldIndexCache();
+
+  /*!
+   * \brief Get the offset of a volume output field in the data array, from the offset cache or
+   *        (while the cache is being built) from the field map.
+   * \param[in] name - Name of the field.
+   * \param[in,out] indexCache - Offset cache.
+   * \param[in,out] position - Current position in the offset cache.
+   * \return Offset of the field, -1 if the field is not written.
+   */
+  short GetFieldIndex(const char* name, std::vector<short>& indexCache, unsigned short& position) const;
+
+  /*!
+   * \brief Whether LoadVolumeData can be called concurrently for different points.
+   * \note Child classes that return true must only read shared data in LoadVolumeData, the field
+   *        offsets are cached per thread. Lazy initializations happen for the first point, which is loaded alone.
+   */
+  inline virtual bool GetHasThreadedVolumeLoad() const { return false; }
+
   /*!
    * \brief Set the value of a volume output field
    * \param[in] name - Name of the field.
    * \param[in] iPoint - The point location in the field.
    */
-  su2double GetVolumeOutputValue(string name, unsigned long iPoint);
+  su2double GetVolumeOutputValue(const char* name, unsigned long iPoint);
+  inline su2double GetVolumeOutputValue(const string& name, unsigned long iPoint) {
+    return GetVolumeOutputValue(name.c_str(), iPoint);
+  }
 
   /*!
    * \brief Set the value of a volume output field
+   * \note The name is only used while the offset cache is built, overloads for literals and strings
+   *        avoid constructing a string for every call.
    * \param[in] name - Name of the field.
    * \param[in] iPoint - The point location in the field.
    * \param[in] value - The new value of this field.
    */
-  void SetVolumeOutputValue(string name, unsigned long iPoint, su2double value);
+  void SetVolumeOutputValue(const char* name, unsigned long iPoint, su2double value);
+  inline void SetVolumeOutputValue(const string& name, unsigned long iPoint, su2double value) {
+    SetVolumeOutputValue(name.c_str(), iPoint, value);
+  }
 
   /*!
    * \brief Set the value of a volume output field
@@ -740,7 +789,10 @@ protected:
    * \param[in] iPoint - The point location in the field.
    * \param[in] value - The new value of this field.
    */
-  void SetAvgVolumeOutputValue(string name, unsigned long iPoint, su2double value);
+  void SetAvgVolumeOutputValue(const char* name, unsigned long iPoint, su2double value);
+  inline void SetAvgVolumeOutputValue(const string& name, unsigned long iPoint, su2double value) {
+    SetAvgVolumeOutputValue(name.c_str(), iPoint, value);
+  }
 
   /*!
    * \brief CheckHistoryOutput
@@ -0,0 +1,126 @@
+/*!
+ * \file CAsyncWriteQueue.hpp
+ * \brief Headers of the queue of snapshots written to file on a background thread.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*!
+ * \class CAsyncWriteQueue
+ * \brief Per-rank queue of file snapshots that are written by a helper thread.
+ * \note A snapshot (job) is the list of byte ranges this rank owns in one file, i.e. what the MPI-IO
+ * routines of CFileWriter would have written. The helper thread writes them with positioned writes,
+ * it does not make MPI calls, therefore it works with the default MPI threading level. Errors are
+ * reported (by the main thread) on the next call to Submit or Flush.
+ * \ingroup Output
+ */
+class CAsyncWriteQueue {
+ public:
+  /*!
+   * \brief One contiguous range of bytes of a file.
+   */
+  struct Piece {
+    unsigned long offset = 0;
+    std::vector<char> bytes;
+  };
+
+  /*!
+   * \brief The pieces of one file written by this rank.
+   */
+  struct Job {
+    std::string fileName;        /*!< \brief Name of the file, including the extension. */
+    unsigned long fileSize = 0;  /*!< \brief Size of the complete file. */
+    bool setSize = false;        /*!< \brief Whether this rank truncates the file to its final size. */
+    std::vector<Piece> pieces;   /*!< \brief Data of this rank. */
+
+    /*!
+     * \brief Copy a range of bytes into the job.
+     */
+    void AddPiece(unsigned long offset, const void* data, unsigned long sizeInBytes);
+  };
+
+ private:
+  std::deque<Job> jobs;            /*!< \brief Submitted jobs, the front one may be in progress. */
+  unsigned long maxPending = 1;    /*!< \brief Maximum number of jobs in the queue. */
+  bool stop = false;               /*!< \brief Signals the helper thread to exit. */
+  std::string error;               /*!< \brief First error of the helper thread. */
+  std::mutex mtx;
+  std::condition_variable cond;
+  std::thread worker;
+
+  CAsyncWriteQueue() = default;
+
+  /*!
+   * \brief Loop of the helper thread.
+   */
+  void Run();
+
+  /*!
+   * \brief Write a job to file.
+   * \return An error message, empty if the writing was successful.
+   */
+  static std::string Write(const Job& job);
+
+  /*!
+   * \brief Get and clear the error of the helper thread (must be called with the lock held).
+   * \note The error must be raised after releasing the lock, the error exit destroys the queue.
+   */
+  std::string TakeError();
+
+ public:
+  CAsyncWriteQueue(const CAsyncWriteQueue&) = delete;
+  CAsyncWriteQueue& operator=(const CAsyncWriteQueue&) = delete;
+
+  /*!
+   * \brief Finish pending jobs and stop the helper thread.
+   */
+  ~CAsyncWriteQueue();
+
+  /*!
+   * \brief Get the queue of this process.
+   */
+  static CAsyncWriteQueue& GetInstance();
+
+  /*!
+   * \brief Set the maximum number of snapshots in flight, Submit blocks when this number is reached.
+   */
+  void SetMaxPending(unsigned long val);
+
+  /*!
+   * \brief Hand a job over to the helper thread.
+   */
+  void Submit(Job&& job);
+
+  /*!
+   * \brief Wait for all submitted jobs to be written.
+   */
+  void Flush();
+};
@@ -32,6 +32,11 @@
 #include <basetsd.h>
 #endif
 #include "cgnslib.h"
+#if defined(HAVE_MPI) && CG_BUILD_PARALLEL
+/*--- The parallel CGNS library (HDF5 based) is available, each rank writes its own part of the file. ---*/
+#define HAVE_PCGNS
+#include "pcgnslib.h"
+#endif
 #endif
 
 #include "CFileWriter.hpp"
@@ -114,7 +119,11 @@ class CCGNSFileWriter final : public CFileWriter {
    * \param[in] ier - error value.
    */
   static inline void CallCGNS(const int& ier) {
+#ifdef HAVE_PCGNS
+    if (ier) cgp_error_exit();
+#else
     if (ier) cg_error_exit();
+#endif
   }
 
   /*!
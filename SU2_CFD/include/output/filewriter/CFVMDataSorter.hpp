@@ -59,7 +59,7 @@ public:
    * \return Global index of a specific point.
    */
   unsigned long GetGlobalIndex(unsigned long iPoint) const override {
-    return linearPartitioner.GetFirstIndexOnRank(rank) + iPoint;
+    return GetnPointCumulative(rank) + iPoint;
   }
 
   /*!
@@ -35,6 +35,7 @@
 #include <fstream>
 
 #include "../../output/filewriter/CParallelDataSorter.hpp"
+#include "../../output/filewriter/CAsyncWriteQueue.hpp"
 
 using namespace std;
 
@@ -96,6 +97,21 @@ protected:
   FILE* fhw;
 #endif
 
+  /*!
+   * \brief Whether the MPI-IO routines record the data for the background writer instead of writing it.
+   */
+  bool asyncWrite = false;
+
+  /*!
+   * \brief Whether the last file was handed over to the background writer.
+   */
+  bool asyncSubmitted = false;
+
+  /*!
+   * \brief The snapshot of the file being recorded in asynchronous mode.
+   */
+  CAsyncWriteQueue::Job asyncJob;
+
 public:
   /*!
    * \brief Construct a file writer using field names, the data sorter and the file extension.
@@ -137,6 +153,23 @@ public:
    */
   su2double Get_UsedTime() const {return usedTime;}
 
+  /*!
+   * \brief Write the files asynchronously (only applies to writers based on the MPI-IO routines).
+   * \note The data is copied by the calling thread and written to file by a helper thread, the
+   * bandwidth is not measured in this mode.
+   */
+  void SetAsyncWrite(bool val) {asyncWrite = val;}
+
+  /*!
+   * \brief Get whether the last file was handed over to the background writer (no bandwidth is available).
+   */
+  bool Get_AsyncSubmitted() const {return asyncSubmitted;}
+
+  /*!
+   * \brief Wait for all asynchronous writes of this process to finish.
+   */
+  static void FlushAsyncWrites() {CAsyncWriteQueue::GetInstance().Flush();}
+
 protected:
 
   /*!
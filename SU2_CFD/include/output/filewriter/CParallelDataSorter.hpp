@@ -112,6 +112,9 @@ protected:
 
   unsigned short nDim;                 //!< Spatial dimension of the data
 
+  vector<unsigned long> subVolumeCumulative; //!< Cumulative number of points per rank after RestrictToBox, empty if not restricted
+  vector<unsigned long> subVolumeID;         //!< New global ID (plus one) of each sorted point, 0 if outside of the box
+
   /*!
    * \brief Prepare the send buffers by filling them with the global indices.
    * After calling this function, the data buffer for sending can be filled with the
@@ -155,6 +158,21 @@ public:
    */
   virtual void SortConnectivity(CConfig *config, CGeometry *geometry, const vector<string> &markerList){}
 
+  /*!
+   * \brief Keep only the sorted points inside a box and the elements whose nodes are all kept.
+   * \note Must be called after ::SortOutputData and ::SortConnectivity, the points are renumbered
+   * contiguously (keeping their order) and the data remains restricted until the next ::SortOutputData.
+   * The first nDim fields must be the coordinates.
+   * \param[in] bounds - Minimum and maximum of each coordinate (xmin, xmax, ymin, ...).
+   */
+  void RestrictToBox(const su2double* bounds);
+
+  /*!
+   * \brief Check whether the sorted data was restricted to a box since the last ::SortOutputData.
+   * \return <TRUE> if the data must be sorted again to recover all points.
+   */
+  bool GetRestrictedToBox() const { return !subVolumeCumulative.empty(); }
+
   /*!
    * \brief Get the number of points the local rank owns.
    * \return local number of points.
@@ -254,6 +272,7 @@ public:
    * \return The beginning node ID.
    */
   virtual unsigned long GetNodeBegin(unsigned short rank) const {
+    if (!subVolumeCumulative.empty()) return subVolumeCumulative[rank];
     return linearPartitioner.GetFirstIndexOnRank(rank);
   }
 
@@ -263,6 +282,7 @@ public:
    * \return The ending node ID.
    */
   unsigned long GetNodeEnd(unsigned short rank) const {
+    if (!subVolumeCumulative.empty()) return subVolumeCumulative[rank+1];
     return linearPartitioner.GetLastIndexOnRank(rank);
   }
 
@@ -292,7 +312,10 @@ public:
    * \input rank - the processor rank.
    * \return The cumulated number of points up to certain processor rank.
    */
-  virtual unsigned long GetnPointCumulative(unsigned short rank) const {return linearPartitioner.GetCumulativeSizeBeforeRank(rank);}
+  virtual unsigned long GetnPointCumulative(unsigned short rank) const {
+    if (!subVolumeCumulative.empty()) return subVolumeCumulative[rank];
+    return linearPartitioner.GetCumulativeSizeBeforeRank(rank);
+  }
 
   /*!
    * \brief Get the linear number of points
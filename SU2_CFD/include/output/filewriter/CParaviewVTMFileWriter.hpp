@@ -122,9 +122,11 @@ public:
    * \param[in] name - The name of the dataset
    * \param[in] file - The name of the vtu dataset file to write
    * \param[in] dataSorter - Datasorter object containing the actual data. Note, data must be sorted.
+   * \param[in] config - Definition of the particular problem (compression of the dataset).
    */
   //void AddDataset(string name, string file, CParallelDataSorter* dataSorter);
-  void AddDataset(string foldername, string name, string file, CParallelDataSorter* dataSorter);
+  void AddDataset(string foldername, string name, string file, CParallelDataSorter* dataSorter,
+                  const CConfig* config);
 
   /*!
    * \brief Start a new block
@@ -52,6 +52,28 @@ private:
    */
   unsigned long dataOffset;
 
+  /*!
+   * \brief Uncompressed size of the blocks of compressed arrays (same as VTK).
+   */
+  static constexpr unsigned long COMPRESSION_BLOCK_SIZE = 32768;
+
+  /*!
+   * \brief An array in VTK's compressed format (header and blocks), split over the ranks.
+   */
+  struct CompressedArray {
+    vector<uint64_t> header;        /*!< \brief Number of blocks, block size, last block size, compressed sizes (master only). */
+    vector<char> bytes;             /*!< \brief Compressed blocks of this rank. */
+    unsigned long headerSize = 0;   /*!< \brief Size of the header in bytes. */
+    unsigned long totalSize = 0;    /*!< \brief Compressed size of the array over all ranks. */
+    unsigned long rankOffset = 0;   /*!< \brief Position of the blocks of this rank in the compressed array. */
+  };
+
+  OUTPUT_COMPRESSION compression = OUTPUT_COMPRESSION::NONE; /*!< \brief Compression of the appended data. */
+  vector<string> quantizedFields;     /*!< \brief Fields whose mantissa is rounded before writing. */
+  unsigned short quantizationBits = 23; /*!< \brief Number of mantissa bits kept for the quantized fields. */
+  vector<CompressedArray> compressedArrays; /*!< \brief Encoded arrays waiting to be written. */
+  unsigned long arrayIndex = 0;       /*!< \brief Index of the next array added to the header. */
+
 public:
 
   /*!
@@ -82,8 +104,51 @@ public:
    */
   void Write_Data(string val_filename) override;
 
+  /*!
+   * \brief Set the compression of the appended data and the (lossy) quantization of some fields.
+   * \param[in] kind - Compression algorithm.
+   * \param[in] fields - Names of the fields to quantize (vectors without the "_x" suffix).
+   * \param[in] bits - Number of mantissa bits kept for those fields (23 keeps full single precision).
+   */
+  void SetCompression(OUTPUT_COMPRESSION kind, vector<string> fields, unsigned short bits) {
+    compression = kind;
+    quantizedFields = std::move(fields);
+    quantizationBits = bits;
+  }
+
 private:
 
+  /*!
+   * \brief Write the XML header, i.e. the definition of all data arrays.
+   */
+  void WriteHeader();
+
+  /*!
+   * \brief Load and write (or encode if the output is compressed) all data arrays.
+   */
+  void WriteAppendedData();
+
+  /*!
+   * \brief Compress this rank's part of an array, exchanging the bytes of blocks that cross rank boundaries.
+   * \param[in] data - Pointer to the data of this rank.
+   * \param[in] byteSize - Size of the data of this rank in bytes.
+   * \param[in] totalByteSize - Size of the array over all ranks in bytes.
+   * \param[in] offset - Position of the data of this rank in the array, in bytes.
+   * \param[out] array - The compressed array.
+   */
+  void CompressDataArray(const void* data, unsigned long byteSize, unsigned long totalByteSize,
+                         unsigned long offset, CompressedArray& array) const;
+
+  /*!
+   * \brief Check whether a field is quantized.
+   */
+  bool IsQuantized(const string& fieldname) const;
+
+  /*!
+   * \brief Round the mantissa of the values to the number of quantization bits.
+   */
+  void Quantize(float* data, unsigned long size) const;
+
   /*!
    * \brief Add a new data array definition to the vtu file.
    * \param[in] type - The vtk datatype
@@ -33,6 +33,12 @@ class CSurfaceFVMDataSorter final: public CParallelDataSorter{
 
   const CFVMDataSorter* volumeSorter;               //!< Pointer to the volume sorter instance
   map<unsigned long,unsigned long> Renumber2Global; //! Structure to map the local sorted point ID to the global point ID
+
+  /*--- The surface topology does not change between writes, the renumbered connectivity and the
+   *    points extracted from the volume sorter are kept and only the values are copied again. ---*/
+  vector<string> sortedMarkers;         //!< Markers of the current (sorted) connectivity
+  vector<unsigned long> surfaceToVolume; //!< Local index in the volume sorter of each surface point
+  bool sortingPlanCached = false;       //!< Whether the connectivity was renumbered and surfaceToVolume is valid
 public:
 
   /*!
@@ -116,6 +122,11 @@ public:
 
 private:
 
+  /*!
+   * \brief Copy the values of the surface points from the volume sorter into the data buffer.
+   */
+  void CopySurfaceData();
+
   /*!
    * \brief Sort the connectivity for a single surface element type into a linear partitioning across all processors.
    * \param[in] config - Definition of the particular problem.
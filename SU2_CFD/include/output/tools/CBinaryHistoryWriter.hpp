@@ -0,0 +1,79 @@
+/*!
+ * \file CBinaryHistoryWriter.hpp
+ * \brief Buffered writer of the history in a binary columnar format.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <fstream>
+#include <string>
+#include <vector>
+#include "../../../../Common/include/code_config.hpp"
+
+/*!
+ * \class CBinaryHistoryWriter
+ * \brief Writes the history lines without text formatting. The lines are buffered and written as
+ *        blocks in which the values are stored by column.
+ * \note File layout (native byte order, see SU2_PY/history_to_csv.py):
+ *       - Header: the 8 characters "SU2HIST1", int32 number of columns, then for each column an int32
+ *         length followed by the characters of its name (no terminator).
+ *       - Blocks until the end of the file: int32 number of lines N, then N doubles for each column.
+ */
+class CBinaryHistoryWriter {
+ private:
+  std::ofstream file;
+  std::vector<passivedouble> buffer; /*!< \brief Buffered lines, by line. */
+  unsigned long nColumns = 0;
+  unsigned long nLines = 0;
+  unsigned long flushLines = 1;      /*!< \brief Number of lines in a block. */
+
+ public:
+  CBinaryHistoryWriter() = default;
+  CBinaryHistoryWriter(const CBinaryHistoryWriter&) = delete;
+  CBinaryHistoryWriter& operator=(const CBinaryHistoryWriter&) = delete;
+
+  /*!
+   * \brief Writes the buffered lines.
+   */
+  ~CBinaryHistoryWriter() { Flush(); }
+
+  /*!
+   * \brief Create the file and write the header.
+   * \param[in] filename - Name of the file.
+   * \param[in] names - Names of the columns.
+   * \param[in] linesPerFlush - Number of lines buffered before they are written.
+   */
+  void Open(const std::string& filename, const std::vector<std::string>& names, unsigned long linesPerFlush);
+
+  /*!
+   * \brief Add a line, the values are copied.
+   * \param[in] values - Pointers to the values of the columns.
+   */
+  void AddLine(const std::vector<const su2double*>& values);
+
+  /*!
+   * \brief Write the buffered lines as one block.
+   */
+  void Flush();
+};
@@ -29,6 +29,7 @@
 
 #include "CSolver.hpp"
 #include "../variables/CAdjEulerVariable.hpp"
+#include "../../../Common/include/parallelization/omp_structure.hpp"
 
 /*!
  * \class CAdjEulerSolver
@@ -73,6 +74,57 @@ protected:
 
   CAdjEulerVariable* nodes = nullptr;  /*!< \brief The highest level in the variable hierarchy this solver can safely use. */
 
+  enum : size_t { MAXNDIM = 3 };        /*!< \brief Max number of space dimensions, used in some static arrays. */
+  enum : size_t { MAXNVAR = 5 };        /*!< \brief Max number of variables, for static arrays. */
+  enum : size_t { OMP_MAX_SIZE = 512 }; /*!< \brief Max chunk size for light point loops. */
+  enum : size_t { OMP_MIN_SIZE = 32 };  /*!< \brief Min chunk size for edge loops (max is color group size). */
+
+  unsigned long omp_chunk_size = OMP_MAX_SIZE; /*!< \brief Chunk size used in light point loops. */
+
+  /*--- Shallow copy of grid coloring for OpenMP parallelization. The adjoint residuals are
+   *    not conservative (the contributions to i and j differ), therefore there is no reducer
+   *    strategy, when the coloring is poor the edge loops are simply not threaded. ---*/
+
+#ifdef HAVE_OMP
+  vector<GridColor<> > EdgeColoring; /*!< \brief Edge colors. */
+  bool SerialEdgeLoops = false;      /*!< \brief If the edge loops cannot be threaded. */
+#else
+  array<DummyGridColor<>, 1> EdgeColoring;
+  static constexpr bool SerialEdgeLoops = true;
+#endif
+
+  /*!
+   * \brief Thread-local residuals and Jacobians of an edge, the solver members cannot be used in threaded loops.
+   */
+  struct CEdgeWorkspace {
+    su2double Res_i[MAXNVAR], Res_j[MAXNVAR], ResVisc_i[MAXNVAR], ResVisc_j[MAXNVAR];
+    su2double Solution_i[MAXNVAR], Solution_j[MAXNVAR];
+    su2double Jac[4][MAXNVAR][MAXNVAR];
+    su2double *Jac_ii[MAXNVAR], *Jac_ij[MAXNVAR], *Jac_ji[MAXNVAR], *Jac_jj[MAXNVAR];
+
+    CEdgeWorkspace() {
+      for (auto iVar = 0ul; iVar < MAXNVAR; ++iVar) {
+        Jac_ii[iVar] = Jac[0][iVar]; Jac_ij[iVar] = Jac[1][iVar];
+        Jac_ji[iVar] = Jac[2][iVar]; Jac_jj[iVar] = Jac[3][iVar];
+      }
+    }
+  };
+
+  /*!
+   * \brief Set up the edge coloring and the chunk sizes used by the threaded loops.
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  void HybridParallelInitialization(CGeometry* geometry);
+
+  /*!
+   * \brief Set the primitive (bounded) adjoint variables and clear the residual.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] Output - If the residual is not cleared.
+   * \return Number of non-physical points.
+   */
+  unsigned long SetPrimitive_Variables(CGeometry *geometry, CConfig *config, bool Output);
+
   /*!
    * \brief Return nodes to allow CSolver::base_nodes to be set.
    */
@@ -85,6 +85,9 @@ protected:
 
   CProperty** element_properties = nullptr; /*!< \brief Vector which stores the properties of each element */
 
+  vector<unsigned long> RefGradientsIdx;  /*!< \brief Start of the stored reference gradients of each element. */
+  vector<su2double> RefGradients;         /*!< \brief Reference gradients of all elements (empty if not stored). */
+
 #ifdef HAVE_OMP
   vector<GridColor<> > ElemColoring;   /*!< \brief Element colors. */
   bool LockStrategy = false;           /*!< \brief Whether to use an OpenMP lock to guard updates of the Jacobian. */
@@ -134,6 +137,23 @@ protected:
    */
   void HybridParallelInitialization(CGeometry* geometry);
 
+  /*!
+   * \brief Compute and store the gradients of the shape functions wrt the reference configuration of
+   *        each element, they are then reused by all element loops instead of being recomputed.
+   * \note Only applicable when the reference configuration is fixed, i.e. no prestretch and no AD.
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  void Set_RefGradients(CGeometry* geometry);
+
+  /*!
+   * \brief Get the stored reference gradients of an element.
+   * \param[in] iElem - Index of the element.
+   * \return Pointer to the gradients, or nullptr if they are not stored.
+   */
+  inline const su2double* Get_RefGradients(unsigned long iElem) const {
+    return RefGradients.empty() ? nullptr : &RefGradients[RefGradientsIdx[iElem]];
+  }
+
   /*!
    * \brief Set container of element properties.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -29,6 +29,7 @@
 #pragma once
 
 #include "CSolver.hpp"
+#include "../../../Common/include/toolboxes/CSquareMatrixCM.hpp"
 
 /*!
  * \class CFEM_DG_EulerSolver
@@ -43,7 +44,7 @@ protected:
   su2double Gamma;           /*!< \brief Fluid's Gamma constant (ratio of specific heats). */
   su2double Gamma_Minus_One; /*!< \brief Fluids's Gamma - 1.0  . */
 
-  CFluidModel  *FluidModel; /*!< \brief fluid model used in the solver */
+  vector<CFluidModel*> FluidModel; /*!< \brief Fluid model used in the solver, one object per OpenMP thread. */
 
   su2double
   Mach_Inf,         /*!< \brief Mach number at infinity. */
@@ -210,6 +211,10 @@ protected:
                                                                           faces for the time levels of internal faces
                                                                           between an owned and a halo element. */
 
+  vector<unsigned long> startLocResMatchingFaces; /*!< \brief The starting location in the residual of the faces
+                                                              for each internal matching face, such that
+                                                              chunks of faces can be treated independently. */
+
   bool symmetrizingTermsPresent;    /*!< \brief Whether or not symmetrizing terms are present in the
                                                 discretization. */
 
@@ -229,6 +234,12 @@ protected:
                                                                   the color does not contribute to the Jacobian
                                                                   of the DOF. */
 
+  CSysSolve<su2double> SystemJFNK;       /*!< \brief Linear solver of the Jacobian-free Newton-Krylov method. */
+  vector<CSquareMatrixCM> blockJacobiInv; /*!< \brief Inverse of the diagonal block of every owned element,
+                                                      used as preconditioner of the Newton-Krylov method. */
+  unsigned long nIterPrecondJFNK = 0;    /*!< \brief Number of implicit iterations since the start, used to
+                                                     determine when the preconditioner must be updated. */
+
   CBlasStructure *blasFunctions; /*!< \brief  Pointer to the object to carry out the BLAS functionalities. */
 
 private:
@@ -324,7 +335,7 @@ public:
    * \brief Compute the pressure at the infinity.
    * \return Value of the pressure at the infinity.
    */
-  inline CFluidModel* GetFluidModel(void) const final { return FluidModel;}
+  inline CFluidModel* GetFluidModel(void) const final { return FluidModel[omp_get_thread_num()]; }
 
   /*!
    * \brief Compute the density at the infinity.
@@ -434,7 +445,9 @@ public:
 
   /*!
    * \brief Function, which processes the list of tasks to be executed by
-            the DG solver.
+            the DG solver. The master thread follows the dependencies of the
+            tasks and carries out the communication, the other tasks are split
+            in chunks of elements or faces, which are executed as OpenMP tasks.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] solver_container - Container vector with all the solutions.
    * \param[in] numerics - Description of the numerical method.
@@ -891,6 +904,23 @@ public:
                               CConfig *config,
                               unsigned short iRKStep) final;
 
+  /*!
+   * \brief Update the solution with the backward Euler method, for which the
+            nonlinear system is linearized and solved with a Jacobian-free
+            Newton-Krylov method. The residual of the current solution must
+            be available in VecResDOFs.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   */
+  void ImplicitNewtonKrylov_Iteration(CGeometry *geometry,
+                                      CSolver **solver_container,
+                                      CNumerics **numerics,
+                                      CConfig *config,
+                                      unsigned short iMesh) final;
+
   /*!
    * \brief Update the solution using the classical fourth-order Runge-Kutta scheme.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -1557,6 +1587,28 @@ private:
   void MetaDataJacobianComputation(const CMeshFEM    *FEMGeometry,
                                    const vector<int> &colorLocalDOFs);
 
+  /*!
+   * \brief Function, which computes the element block Jacobi preconditioner of
+            the Newton-Krylov method. The diagonal blocks of the Jacobian are
+            computed with finite differences, using the graph coloring of the
+            spatial Jacobian, after which the time step term is added and the
+            blocks are inverted.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   * \param[in] resBase - Residual of the unperturbed solution.
+   * \param[in] stepFD - Finite difference step.
+   */
+  void ComputeBlockJacobiPreconditioner(CGeometry               *geometry,
+                                        CSolver                 **solver_container,
+                                        CNumerics               **numerics,
+                                        CConfig                 *config,
+                                        unsigned short          iMesh,
+                                        const vector<su2double> &resBase,
+                                        const su2double         stepFD);
+
   /*!
    * \brief Function, which sets up the list of tasks to be carried out in the
             computationally expensive part of the solver.
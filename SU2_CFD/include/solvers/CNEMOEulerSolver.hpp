@@ -55,11 +55,12 @@ protected:
   su2double *Source;              /*!< \brief Auxiliary vector to store source terms. */
 
   unsigned long ErrorCounter = 0; /*!< \brief Counter for number of un-physical states. */
+  unsigned long SourceErrorCounter[3] = {0}; /*!< \brief Counters of NaN axisymmetric, chemistry, and relaxation sources. */
 
   su2double Global_Delta_Time = 0.0, /*!< \brief Time-step for TIME_STEPPING time marching strategy. */
   Global_Delta_UnstTimeND = 0.0;     /*!< \brief Unsteady time step for the dual time strategy. */
 
-  CNEMOGas  *FluidModel;          /*!< \brief fluid model used in the solver */
+  vector<CNEMOGas*> FluidModel;   /*!< \brief Fluid model used in the solver (one per thread). */
 
   CNEMOEulerVariable* node_infty = nullptr;
 
@@ -90,6 +91,19 @@ protected:
    */
   void SetReferenceValues(const CConfig& config) final;
 
+  /*!
+   * \brief Update the residual and Jacobian with the convective flux of an edge.
+   * \note Used by the colored edge loops, fluxes with NaNs are discarded.
+   * \param[in] iEdge - Edge index.
+   * \param[in] iPoint - First point of the edge.
+   * \param[in] jPoint - Second point of the edge.
+   * \param[in] residual - Flux and Jacobians of the edge.
+   * \param[in] err - The flux or Jacobians contain NaNs.
+   * \param[in] implicit - Update the Jacobian.
+   */
+  void UpdateEdgeResidual(unsigned long iEdge, unsigned long iPoint, unsigned long jPoint,
+                          const CNumerics::ResidualType<>& residual, bool err, bool implicit);
+
 public:
   CNEMOEulerSolver() = delete;
 
@@ -105,6 +119,11 @@ public:
    */
   ~CNEMOEulerSolver(void) override;
 
+  /*!
+   * \brief The NEMO Euler and NS solvers support MPI+OpenMP.
+   */
+  inline bool GetHasHybridParallel() const final { return true; }
+
   /*!
    * \brief Compute the time step for solving the Euler equations.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -224,7 +243,7 @@ public:
    * \brief Compute the pressure at the infinity.
    * \return Value of the pressure at the infinity.
    */
-  inline CNEMOGas* GetFluidModel(void) const final { return FluidModel;}
+  inline CNEMOGas* GetFluidModel(void) const final { return FluidModel[omp_get_thread_num()]; }
 
   /*!
    * \brief Impose the far-field boundary condition using characteristics.
@@ -28,10 +28,48 @@
 #pragma once
 
 #include "CRadSolver.hpp"
+#include "../../../Common/include/parallelization/omp_structure.hpp"
 
 class CRadP1Solver final: public CRadSolver {
 private:
 
+  enum : size_t { OMP_MAX_SIZE = 512 }; /*!< \brief Max chunk size for light point loops. */
+  enum : size_t { OMP_MIN_SIZE = 32 };  /*!< \brief Min chunk size for edge loops (max is color group size). */
+
+  unsigned long omp_chunk_size; /*!< \brief Chunk size used in light point loops. */
+
+  /*--- Shallow copy of grid coloring for OpenMP parallelization. ---*/
+
+#ifdef HAVE_OMP
+  vector<GridColor<> > EdgeColoring; /*!< \brief Edge colors. */
+  bool ReducerStrategy = false;      /*!< \brief If the reducer strategy is in use. */
+#else
+  array<DummyGridColor<>, 1> EdgeColoring;
+  /*--- Never use the reducer strategy if compiling for MPI-only. ---*/
+  static constexpr bool ReducerStrategy = false;
+#endif
+
+  /*--- Edge fluxes for reducer strategy (see the notes in CEulerSolver.hpp). ---*/
+  CSysVector<su2double> EdgeFluxes; /*!< \brief Flux across each edge. */
+
+  /*!
+   * \brief Sum the edge fluxes for each cell to populate the residual vector (reducer strategy).
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  void SumEdgeFluxes(const CGeometry* geometry);
+
+  /*!
+   * \brief Apply the weak radiative heat flux boundary condition to a marker.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_marker - Surface marker where the boundary condition is applied.
+   * \param[in] Theta - Wall emissivity factor.
+   * \param[in] flowNodes - Variables of the flow solver, if not null their temperature is used at the wall.
+   * \param[in] Twall - Uniform wall temperature (when flowNodes is null).
+   */
+  void WeakRadiativeFlux(const CGeometry *geometry, const CConfig *config, unsigned short val_marker,
+                         su2double Theta, const CVariable* flowNodes, su2double Twall);
+
 protected:
 
   su2double Temperature_Inf;      /*!< \brief Temperature at the infinity. */
@@ -256,4 +294,9 @@ public:
    */
   inline su2double GetTemperature_Inf(void) const { return Temperature_Inf; }
 
+  /*!
+   * \brief The P1 solver supports OpenMP+MPI.
+   */
+  inline bool GetHasHybridParallel() const override { return true; }
+
 };
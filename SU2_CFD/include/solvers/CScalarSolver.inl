@@ -439,6 +439,8 @@ void CScalarSolver<VariableType>::SetTime_Step(CGeometry *geometry, CSolver **so
 template <class VariableType>
 void CScalarSolver<VariableType>::PrepareImplicitIteration(CGeometry* geometry, CSolver** solver_container,
                                                            CConfig* config) {
+  SU2_PROFILE_SCOPE("Jacobian_Assembly");
+
   /*--- Set shared residual variables to 0 and declare
    *    local ones for current thread to work on. ---*/
 
@@ -55,6 +55,7 @@
 #include "../../../Common/include/linear_algebra/blas_structure.hpp"
 #include "../../../Common/include/graph_coloring_structure.hpp"
 #include "../../../Common/include/toolboxes/MMS/CVerificationSolution.hpp"
+#include "../../../Common/include/toolboxes/CRegionProfiler.hpp"
 #include "../variables/CVariable.hpp"
 
 #ifdef HAVE_LIBROM
@@ -446,6 +447,21 @@ public:
    */
   inline su2double GetRes_RMS(unsigned short val_var) const { return Residual_RMS[val_var]; }
 
+  /*!
+   * \brief Combine the residuals with those of another solution (e.g. of another adjoint direction),
+   *        keeping the largest values.
+   * \param[in] val_var - Index of the variable.
+   * \param[in] res_rms - Mean residual of the other solution.
+   * \param[in] res_max - Maximal residual of the other solution.
+   * \param[in] point_max - Global index of the point of the maximal residual.
+   * \param[in] coord_max - Location (x, y, z) of the maximal residual.
+   */
+  inline void CombineRes(unsigned short val_var, su2double res_rms, su2double res_max,
+                         unsigned long point_max, const su2double* coord_max) {
+    Residual_RMS[val_var] = max(Residual_RMS[val_var], res_rms);
+    AddRes_Max(val_var, res_max, point_max, coord_max);
+  }
+
   /*!
    * \brief Get the maximal residual, this is useful for the convergence history.
    * \param[in] val_var - Index of the variable.
@@ -662,6 +678,18 @@ public:
                                              CNumerics **numerics, CConfig *config,
                                              unsigned short iMesh, unsigned short RunTime_EqSystem) {}
 
+  /*!
+   * \brief A virtual member.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   */
+  inline virtual void ImplicitNewtonKrylov_Iteration(CGeometry *geometry, CSolver **solver_container,
+                                                     CNumerics **numerics, CConfig *config,
+                                                     unsigned short iMesh) {}
+
   /*!
    * \brief A virtual member.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -28,8 +28,11 @@
 #pragma once
 
 #include "../../Common/include/parallelization/mpi_structure.hpp"
+#include "../../Common/include/parallelization/omp_structure.hpp"
 
 #include <iostream>
+#include <vector>
+#include <functional>
 
 using namespace std;
 
@@ -126,4 +129,156 @@ private:
   void Copy(const CTaskDefinition &other);
 };
 
+/*!
+ * \class CTaskListRunner
+ * \brief Class to carry out a list of tasks, in which a task can only be carried out once the tasks
+ *        given by its indMustBeCompleted are completed.
+ * \note The thread that calls Run walks the list and carries out the tasks that cannot be split,
+ *       e.g. the MPI communication, itself. The other tasks are split in chunks of items, which
+ *       are executed as OpenMP tasks by the threads of the team. When no task can be started the
+ *       thread waits for the chunks (taskwait), and helps executing them. With one thread all
+ *       tasks are carried out inline, in the order of the list, without a parallel region.
+ */
+class CTaskListRunner {
+public:
+  /*!
+   * \brief Kernel of a task, called for the items [beg,end) with the index of the executing thread.
+   */
+  using Kernel = std::function<void(unsigned long beg, unsigned long end, int thread)>;
+
+  /*!
+   * \brief Function that attempts to carry out task i, by calling StartTask or CompleteTask.
+   *        If wait is true no other task can be carried out and the task should block until it
+   *        can be completed (e.g. MPI_Waitall). Returns false if the task was not carried out.
+   */
+  using TaskFunction = std::function<bool(unsigned long i, bool wait)>;
+
+private:
+  enum : short {NOT_STARTED = -1, COMPLETED = 0, IN_PROGRESS = 1};
+
+  const std::vector<CTaskDefinition>& tasksList; /*!< \brief The list of tasks. */
+  const int nThreads;                             /*!< \brief Number of threads that execute the chunks. */
+  std::vector<short> taskState;                   /*!< \brief State of each task, only accessed by the walking thread. */
+  bool tasksInProgress = false;                   /*!< \brief Whether chunks may still be executed by the threads. */
+
+  /*!
+   * \brief Wait for the chunks that were started, after which their tasks are completed.
+   */
+  void WaitForTasks() {
+    SU2_OMP(taskwait)
+    for(auto& state : taskState) if(state == IN_PROGRESS) state = COMPLETED;
+    tasksInProgress = false;
+  }
+
+  /*!
+   * \brief Walk the list until all tasks are completed.
+   */
+  void Walk(const TaskFunction& carryOut) {
+
+    unsigned long lowestIndexInList = 0;
+    while(lowestIndexInList < tasksList.size()) {
+
+      /* Find the next task that can be carried out. The outer loop is there
+         to make sure that a communication is completed in case there are no
+         other tasks, and no chunks are being executed by the threads. */
+      for(unsigned short j=0; j<2; ++j) {
+        bool taskCarriedOut = false;
+        for(unsigned long i=lowestIndexInList; i<tasksList.size(); ++i) {
+
+          bool taskCanBeCarriedOut = (taskState[i] == NOT_STARTED);
+          for(unsigned short ind=0; ind<tasksList[i].nIndMustBeCompleted; ++ind) {
+            if(taskState[tasksList[i].indMustBeCompleted[ind]] != COMPLETED)
+              taskCanBeCarriedOut = false;
+          }
+
+          if(taskCanBeCarriedOut && carryOut(i, j==1)) {
+            taskCarriedOut = true;
+            break;
+          }
+        }
+
+        /* If nothing could be carried out while the threads are working, help
+           them and wait for their chunks rather than for the communication. */
+        if( taskCarriedOut ) break;
+        if( tasksInProgress ) {
+          WaitForTasks();
+          break;
+        }
+      }
+
+      /* Update the value of lowestIndexInList. */
+      for(; lowestIndexInList < tasksList.size(); ++lowestIndexInList)
+        if(taskState[lowestIndexInList] != COMPLETED) break;
+    }
+  }
+
+public:
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] list    - The list of tasks, it must outlive the object.
+   * \param[in] threads - Number of threads used to carry out the tasks.
+   */
+  CTaskListRunner(const std::vector<CTaskDefinition>& list, int threads)
+    : tasksList(list), nThreads(max(threads, 1)) {}
+
+  /*!
+   * \brief Carry out all tasks of the list.
+   * \param[in] carryOut - Function that attempts to carry out a task (see TaskFunction).
+   */
+  void Run(const TaskFunction& carryOut) {
+
+    taskState.assign(tasksList.size(), NOT_STARTED);
+    tasksInProgress = false;
+
+    if(nThreads == 1) {
+      Walk(carryOut);
+      return;
+    }
+
+    SU2_OMP_PARALLEL_ON(nThreads)
+    {
+      SU2_OMP_MASTER
+      Walk(carryOut);
+      END_SU2_OMP_MASTER
+    }
+    END_SU2_OMP_PARALLEL
+  }
+
+  /*!
+   * \brief Start task i, which consists of nItems items (e.g. elements or faces), by splitting it
+   *        in chunks that are executed by the threads. With one thread it is carried out inline.
+   * \param[in] i      - Index of the task in the list.
+   * \param[in] nItems - Number of items of the task.
+   * \param[in] kernel - Function that carries out a range of the items.
+   */
+  void StartTask(unsigned long i, unsigned long nItems, Kernel kernel) {
+
+    if(nThreads == 1) {
+      kernel(0, nItems, 0);
+      taskState[i] = COMPLETED;
+      return;
+    }
+
+    const unsigned long minChunkSize = 16, chunksPerThread = 4;
+    unsigned long nChunks = 1;
+    if(nItems > minChunkSize)
+      nChunks = min<unsigned long>(roundUpDiv(nItems, minChunkSize), chunksPerThread*nThreads);
+
+    for(unsigned long iChunk=0; iChunk<nChunks; ++iChunk) {
+      const unsigned long beg = iChunk*nItems/nChunks;
+      const unsigned long end = (iChunk+1)*nItems/nChunks;
+
+      SU2_OMP(task firstprivate(beg, end, kernel))
+      kernel(beg, end, omp_get_thread_num());
+    }
+    taskState[i] = IN_PROGRESS;
+    tasksInProgress = true;
+  }
+
+  /*!
+   * \brief Mark task i as completed, for the tasks carried out by the walking thread itself.
+   */
+  void CompleteTask(unsigned long i) { taskState[i] = COMPLETED; }
+};
+
 #include "task_definition.inl"
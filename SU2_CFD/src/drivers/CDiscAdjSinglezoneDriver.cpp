@@ -55,6 +55,12 @@ CDiscAdjSinglezoneDriver::CDiscAdjSinglezoneDriver(char* confFile,
   /*--- Store the recording state ---*/
   RecordingState = RECORDING::CLEAR_INDICES;
 
+  /*--- Unsteady tape replay, keep track of what is needed to re-evaluate the main and secondary tapes. ---*/
+  TapeRecordIter[0] = TapeRecordIter[1] = numeric_limits<unsigned long>::max();
+  if (config->GetTime_Domain() && config->GetUnst_Adj_TapeReplay() > 0) {
+    AD::SetTapeTracking(true);
+  }
+
   /*--- Initialize the direct iteration ---*/
 
   switch (config->GetKind_Solver()) {
@@ -118,6 +124,39 @@ CDiscAdjSinglezoneDriver::CDiscAdjSinglezoneDriver(char* confFile,
 
   }
 
+  /*--- Vector mode, each objective is seeded in its own adjoint direction such that one
+   *    evaluation of the tape advances the adjoint solutions of all objectives. ---*/
+
+  if (AD::nDirections > 1 && config->GetnObj() > 1) {
+
+    if (config->GetnObj() > AD::nDirections) {
+      SU2_MPI::Error("The number of objective functions exceeds the number of adjoint directions\n"
+                     "of this build (meson option codi-vector-dim).", CURRENT_FUNCTION);
+    }
+    if (!config->GetFluidProblem() || config->GetBoolTurbomachinery() || config->GetTime_Domain()) {
+      SU2_MPI::Error("The vector mode of the discrete adjoint is only available for steady flow problems.",
+                     CURRENT_FUNCTION);
+    }
+    if (config->GetnQuasiNewtonSamples() > 1) {
+      SU2_MPI::Error("QUASI_NEWTON_NUM_SAMPLES is not compatible with the vector mode of the discrete adjoint.",
+                     CURRENT_FUNCTION);
+    }
+
+    nObjDirections = config->GetnObj();
+    ObjFuncs.resize(nObjDirections);
+
+    /*--- All directions start from the initial (or restart) adjoint solution. ---*/
+
+    AdjointStates.resize(nObjDirections);
+    for (auto& state : AdjointStates) {
+      state.resize(geometry->GetnPoint(), GetTotalNumberOfVariables(ZONE_0, true));
+      GetAllSolutions(ZONE_0, true, state);
+    }
+
+    if (rank == MASTER_NODE)
+      cout << "Vector mode: the adjoints of " << nObjDirections << " objective functions are computed simultaneously." << endl;
+  }
+
  direct_output->PreprocessHistoryOutput(config, false);
 
 }
@@ -143,7 +182,7 @@ void CDiscAdjSinglezoneDriver::Preprocess(unsigned long TimeIter) {
    *--- respect to the conservative variables. Since these derivatives do not change in the steady state case
    *--- we only have to record if the current recording is different from the main variables. ---*/
 
-  if (RecordingState != MainVariables){
+  if (RecordingState != MainVariables && !ReplayRecording(MainVariables)){
     MainRecording();
   }
 
@@ -169,7 +208,13 @@ void CDiscAdjSinglezoneDriver::Run() {
 
     config->SetInnerIter(Adjoint_Iter);
 
-    iteration->InitializeAdjoint(solver_container, geometry_container, config_container, ZONE_0, INST_0);
+    /*--- In vector mode this is done for each direction (objective). ---*/
+
+    for (auto iDir = 0u; iDir < nObjDirections; iDir++) {
+      if (nObjDirections > 1) LoadDirection(iDir);
+
+      iteration->InitializeAdjoint(solver_container, geometry_container, config_container, ZONE_0, INST_0);
+    }
 
     /*--- Initialize the adjoint of the objective function with 1.0. ---*/
 
@@ -179,12 +224,22 @@ void CDiscAdjSinglezoneDriver::Run() {
 
     AD::ComputeAdjoint();
 
-    /*--- Extract the computed adjoint values of the input variables and store them for the next iteration. ---*/
+    for (auto iDir = 0u; iDir < nObjDirections; iDir++) {
+      if (nObjDirections > 1) LoadDirection(iDir);
+
+      /*--- Extract the computed adjoint values of the input variables and store them for the next iteration. ---*/
 
-    iteration->IterateDiscAdj(geometry_container, solver_container,
-                              config_container, ZONE_0, INST_0, false);
+      iteration->IterateDiscAdj(geometry_container, solver_container,
+                                config_container, ZONE_0, INST_0, false);
 
-    /*--- Monitor the pseudo-time ---*/
+      if (nObjDirections > 1) {
+        CombineResiduals(iDir);
+        StoreDirection();
+      }
+    }
+
+    /*--- Monitor the pseudo-time, once per iteration. In vector mode the residuals are the largest over the
+     *--- directions, the iteration converges when all the objectives converge. ---*/
 
     StopCalc = iteration->Monitor(output_container[ZONE_0], integration_container, geometry_container,
                                   solver_container, numerics_container, config_container,
@@ -194,9 +249,9 @@ void CDiscAdjSinglezoneDriver::Run() {
 
     AD::ClearAdjoints();
 
-    /*--- Output files for steady state simulations. ---*/
+    /*--- Output files for steady state simulations (in vector mode the files are written by Output). ---*/
 
-    if (!config->GetTime_Domain()) {
+    if (!config->GetTime_Domain() && nObjDirections == 1) {
       iteration->Output(output_container[ZONE_0], geometry_container, solver_container,
                         config_container, Adjoint_Iter, false, ZONE_0, INST_0);
     }
@@ -279,6 +334,12 @@ void CDiscAdjSinglezoneDriver::SetRecording(RECORDING kind_recording){
     iteration->RegisterInput(solver_container, geometry_container, config_container, ZONE_0, INST_0, kind_recording);
   }
 
+  /*--- Values that change between time steps are inputs of the tapes that are replayed. ---*/
+
+  if (config->GetTime_Domain() && config->GetUnst_Adj_TapeReplay() > 0) {
+    RegisterTimeDependentInputs(kind_recording == RECORDING::CLEAR_INDICES);
+  }
+
   /*--- Set the dependencies of the iteration ---*/
 
   iteration->SetDependencies(solver_container, geometry_container, numerics_container, config_container, ZONE_0,
@@ -291,6 +352,9 @@ void CDiscAdjSinglezoneDriver::SetRecording(RECORDING kind_recording){
   /*--- Store the recording state ---*/
 
   RecordingState = kind_recording;
+  if (kind_recording != RECORDING::CLEAR_INDICES) {
+    TapeRecordIter[kind_recording != MainVariables] = config->GetTimeIter();
+  }
 
   /*--- Register Output of the iteration ---*/
 
@@ -337,6 +401,15 @@ void CDiscAdjSinglezoneDriver::SetAdj_ObjFunction(){
     }
   }
 
+  if (nObjDirections > 1) {
+    /*--- Vector mode, seed each objective in its own direction. ---*/
+    for (auto iDir = 0u; iDir < nObjDirections; iDir++) {
+      AD::SetDirection(iDir);
+      SU2_TYPE::SetDerivative(ObjFuncs[iDir], (rank == MASTER_NODE) ? SU2_TYPE::GetValue(seeding) : 0.0);
+    }
+    return;
+  }
+
   if (rank == MASTER_NODE){
     SU2_TYPE::SetDerivative(ObjFunc, SU2_TYPE::GetValue(seeding));
   } else {
@@ -403,10 +476,78 @@ void CDiscAdjSinglezoneDriver::SetObjFunction(){
     break;
   }
 
+  if (nObjDirections > 1) {
+
+    /*--- Vector mode, evaluate each objective on its own by zeroing the weights of the others. ---*/
+
+    vector<su2double> weights(nObjDirections);
+    for (auto iObj = 0u; iObj < nObjDirections; iObj++) weights[iObj] = config->GetWeight_ObjFunc(iObj);
+
+    for (auto iDir = 0u; iDir < nObjDirections; iDir++) {
+      for (auto iObj = 0u; iObj < nObjDirections; iObj++)
+        config->SetWeight_ObjFunc(iObj, (iObj == iDir) ? weights[iObj] : su2double(0.0));
+
+      solver[FLOW_SOL]->Evaluate_ObjFunc(config, solver);
+      ObjFuncs[iDir] = solver[FLOW_SOL]->GetTotal_ComboObj();
+    }
+
+    for (auto iObj = 0u; iObj < nObjDirections; iObj++) config->SetWeight_ObjFunc(iObj, weights[iObj]);
+    solver[FLOW_SOL]->Evaluate_ObjFunc(config, solver);
+  }
+
+  RegisterObjFunction();
+
+}
+
+void CDiscAdjSinglezoneDriver::RegisterObjFunction() {
+
   if (rank == MASTER_NODE){
-    AD::RegisterOutput(ObjFunc);
+    if (nObjDirections > 1) {
+      for (auto& obj : ObjFuncs) AD::RegisterOutput(obj);
+    }
+    else { AD::RegisterOutput(ObjFunc); }
   }
+}
 
+void CDiscAdjSinglezoneDriver::RegisterTimeDependentInputs(bool reset) {
+
+  auto Register = [reset](su2double value) {
+    if (reset) AD::ResetInput(value);
+    else AD::RegisterInput(value);
+    return value;
+  };
+
+  config->SetDelta_UnstTimeND(Register(config->GetDelta_UnstTimeND()));
+
+  /*--- Boundary data set through the Python wrapper. ---*/
+
+  for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); iMarker++) {
+    if (!config->GetMarker_All_PyCustom(iMarker)) continue;
+
+    for (auto iVertex = 0ul; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+      switch (config->GetMarker_All_KindBC(iMarker)) {
+        case ISOTHERMAL:
+          geometry->SetCustomBoundaryTemperature(iMarker, iVertex,
+            Register(geometry->GetCustomBoundaryTemperature(iMarker, iVertex)));
+          break;
+        case HEAT_FLUX:
+          geometry->SetCustomBoundaryHeatFlux(iMarker, iVertex,
+            Register(geometry->GetCustomBoundaryHeatFlux(iMarker, iVertex)));
+          break;
+        case INLET_FLOW: {
+          auto flow = solver[FLOW_SOL];
+          if (!flow) break;
+          flow->SetInlet_Ttotal(iMarker, iVertex, Register(flow->GetInlet_Ttotal(iMarker, iVertex)));
+          flow->SetInlet_Ptotal(iMarker, iVertex, Register(flow->GetInlet_Ptotal(iMarker, iVertex)));
+          for (auto iDim = 0u; iDim < nDim; iDim++)
+            flow->SetInlet_FlowDir(iMarker, iVertex, iDim, Register(flow->GetInlet_FlowDir(iMarker, iVertex, iDim)));
+          break;
+        }
+        default:
+          break;
+      }
+    }
+  }
 }
 
 void CDiscAdjSinglezoneDriver::DirectRun(RECORDING kind_recording){
@@ -449,16 +590,22 @@ void CDiscAdjSinglezoneDriver::SecondaryRecording(){
   /*--- SetRecording stores the computational graph on one iteration of the direct problem. Calling it with
    *    RECORDING::CLEAR_INDICES as argument ensures that all information from a previous recording is removed. ---*/
 
-  SetRecording(RECORDING::CLEAR_INDICES);
+  if (!ReplayRecording(SecondaryVariables)) {
+    SetRecording(RECORDING::CLEAR_INDICES);
 
-  /*--- Store the computational graph of one direct iteration with the secondary variables as input. ---*/
+    /*--- Store the computational graph of one direct iteration with the secondary variables as input. ---*/
 
-  SetRecording(SecondaryVariables);
+    SetRecording(SecondaryVariables);
+  }
 
   /*--- Initialize the adjoint of the output variables of the iteration with the adjoint solution
    *    of the current iteration. The values are passed to the AD tool. ---*/
 
-  iteration->InitializeAdjoint(solver_container, geometry_container, config_container, ZONE_0, INST_0);
+  for (auto iDir = 0u; iDir < nObjDirections; iDir++) {
+    if (nObjDirections > 1) LoadDirection(iDir);
+
+    iteration->InitializeAdjoint(solver_container, geometry_container, config_container, ZONE_0, INST_0);
+  }
 
   /*--- Initialize the adjoint of the objective function with 1.0. ---*/
 
@@ -468,13 +615,28 @@ void CDiscAdjSinglezoneDriver::SecondaryRecording(){
 
   AD::ComputeAdjoint();
 
-  /*--- Extract the computed sensitivity values. ---*/
+  /*--- Extract the computed sensitivity values, in vector mode keep those of each direction. ---*/
 
-  if (SecondaryVariables == RECORDING::MESH_COORDS) {
-    solver[MainSolver]->SetSensitivity(geometry, config);
-  }
-  else { // MESH_DEFORM
-    solver[ADJMESH_SOL]->SetSensitivity(geometry, config, solver[MainSolver]);
+  if (nObjDirections > 1) Sensitivities.resize(nObjDirections);
+
+  for (auto iDir = 0u; iDir < nObjDirections; iDir++) {
+    if (nObjDirections > 1) LoadDirection(iDir);
+
+    if (SecondaryVariables == RECORDING::MESH_COORDS) {
+      solver[MainSolver]->SetSensitivity(geometry, config);
+    }
+    else { // MESH_DEFORM
+      solver[ADJMESH_SOL]->SetSensitivity(geometry, config, solver[MainSolver]);
+    }
+
+    if (nObjDirections > 1) {
+      const auto nodes = solver[MainSolver]->GetNodes();
+      auto& sens = Sensitivities[iDir];
+      sens.resize(geometry->GetnPoint(), nDim);
+      for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); iPoint++)
+        for (auto iDim = 0u; iDim < nDim; iDim++)
+          sens(iPoint,iDim) = SU2_TYPE::GetValue(nodes->GetSensitivity(iPoint,iDim));
+    }
   }
 
   /*--- Clear the stored adjoint information to be ready for a new evaluation. ---*/
@@ -482,3 +644,146 @@ void CDiscAdjSinglezoneDriver::SecondaryRecording(){
   AD::ClearAdjoints();
 
 }
+
+void CDiscAdjSinglezoneDriver::LoadDirection(unsigned short iDir) {
+
+  AD::SetDirection(iDir);
+  SetAllSolutions(ZONE_0, true, AdjointStates[iDir]);
+}
+
+void CDiscAdjSinglezoneDriver::StoreDirection() {
+
+  GetAllSolutions(ZONE_0, true, AdjointStates[AD::GetDirection()]);
+}
+
+void CDiscAdjSinglezoneDriver::CombineResiduals(unsigned short iDir) {
+
+  CombinedResiduals.resize(MAX_SOLS);
+
+  for (auto iSol = 0u; iSol < MAX_SOLS; iSol++) {
+    auto* sol = solver[iSol];
+    if (sol == nullptr || !sol->GetAdjoint()) continue;
+
+    auto& res = CombinedResiduals[iSol];
+    const auto nVar = sol->GetnVar();
+
+    /*--- Keep the largest residuals of the previous directions. ---*/
+
+    if (iDir > 0) {
+      for (auto iVar = 0u; iVar < nVar; iVar++)
+        sol->CombineRes(iVar, res.rms[iVar], res.max[iVar], res.point[iVar], res.coord[iVar].data());
+    }
+
+    res.rms.resize(nVar);
+    res.max.resize(nVar);
+    res.point.resize(nVar);
+    res.coord.resize(nVar);
+
+    for (auto iVar = 0u; iVar < nVar; iVar++) {
+      res.rms[iVar] = sol->GetRes_RMS(iVar);
+      res.max[iVar] = sol->GetRes_Max(iVar);
+      res.point[iVar] = sol->GetPoint_Max(iVar);
+      for (auto iDim = 0u; iDim < nDim; iDim++) res.coord[iVar][iDim] = sol->GetPoint_Max_Coord(iVar)[iDim];
+    }
+  }
+}
+
+bool CDiscAdjSinglezoneDriver::ReplayRecording(RECORDING kind_recording) {
+
+  const auto nReplay = config->GetUnst_Adj_TapeReplay();
+  if (!config->GetTime_Domain() || nReplay == 0) return false;
+
+  /*--- Each kind of recording lives in its own tape, which is replayed until it becomes too old. ---*/
+
+  const unsigned short slot = (kind_recording != MainVariables);
+  AD::SetTapeSlot(slot);
+
+  const auto TimeIter = config->GetTimeIter();
+  const auto recordIter = TapeRecordIter[slot];
+  if (recordIter > TimeIter || TimeIter - recordIter >= nReplay) return false;
+
+  /*--- External functions without a primal function (e.g. a linear solver with a passive preconditioner)
+   *    cannot be re-evaluated, such tapes are recorded at every time step. ---*/
+
+  if (!AD::BeginReplay()) {
+    if (rank == MASTER_NODE) cout << "The computational graph cannot be re-evaluated, it is recorded again." << endl;
+    return false;
+  }
+
+  /*--- Reset the solution to the converged one, as for a recording, and re-evaluate the tape. ---*/
+
+  for (unsigned short iSol=0; iSol < MAX_SOLS; iSol++) {
+    for (unsigned short iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++) {
+      auto solver = solver_container[ZONE_0][INST_0][iMesh][iSol];
+      if (solver && solver->GetAdjoint()) {
+        solver->SetRecording(geometry_container[ZONE_0][INST_0][iMesh], config);
+      }
+    }
+  }
+
+  if (rank == MASTER_NODE) {
+    cout << "\n-------------------------------------------------------------------------\n";
+    cout << "Re-evaluating the computational graph recorded at time iteration " << recordIter << "." << endl;
+  }
+
+  /*--- The inputs and outputs are registered by the same code as in the recording, which gives them the
+   *    identifiers of the recording and the new values, wherever they are stored now. ---*/
+
+  iteration->RegisterInput(solver_container, geometry_container, config_container, ZONE_0, INST_0, kind_recording);
+  RegisterTimeDependentInputs(false);
+
+  AD::ReplayTape();
+
+  iteration->RegisterOutput(solver_container, geometry_container, config_container, ZONE_0, INST_0);
+  RegisterObjFunction();
+
+  if (!AD::EndReplay()) {
+    SU2_MPI::Error("The inputs or outputs registered to re-evaluate the computational graph do not match the recording.",
+                   CURRENT_FUNCTION);
+  }
+
+  RecordingState = kind_recording;
+  return true;
+}
+
+void CDiscAdjSinglezoneDriver::Output(unsigned long TimeIter) {
+
+  if (nObjDirections == 1) {
+    CSinglezoneDriver::Output(TimeIter);
+    return;
+  }
+
+  /*--- Vector mode, write the files of each objective, with the suffix of the objective function. ---*/
+
+  auto output = output_container[ZONE_0];
+  const auto volumeFilename = output->GetVolume_Filename();
+  const auto surfaceFilename = output->GetSurface_Filename();
+  const auto restartFilename = output->GetRestart_Filename();
+
+  auto restartBase = config->GetRestart_AdjFileName();
+  restartBase = restartBase.substr(0, restartBase.find_last_of('.'));
+
+  for (auto iDir = 0u; iDir < nObjDirections; iDir++) {
+
+    LoadDirection(iDir);
+
+    if (!Sensitivities.empty()) {
+      const auto nodes = solver[MainSolver]->GetNodes();
+      for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); iPoint++)
+        for (auto iDim = 0u; iDim < nDim; iDim++)
+          nodes->SetSensitivity(iPoint, iDim, Sensitivities[iDir](iPoint,iDim));
+      solver[MainSolver]->SetSurface_Sensitivity(geometry, config);
+    }
+
+    const auto suffix = config->GetObjFunc_Suffix(iDir);
+    output->SetVolume_Filename(volumeFilename + suffix);
+    output->SetSurface_Filename(surfaceFilename + suffix);
+    output->SetRestart_Filename(restartBase + suffix + ".dat");
+
+    CSinglezoneDriver::Output(TimeIter);
+  }
+
+  output->SetVolume_Filename(volumeFilename);
+  output->SetSurface_Filename(surfaceFilename);
+  output->SetRestart_Filename(restartFilename);
+}
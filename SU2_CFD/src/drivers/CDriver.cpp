@@ -42,6 +42,7 @@
 
 #include "../../../Common/include/interface_interpolation/CInterpolator.hpp"
 #include "../../../Common/include/interface_interpolation/CInterpolatorFactory.hpp"
+#include "../../../Common/include/toolboxes/CRegionProfiler.hpp"
 
 #include "../../include/interfaces/cfd/CConservativeVarsInterface.hpp"
 #include "../../include/interfaces/cfd/CMixingPlaneInterface.hpp"
@@ -134,6 +135,12 @@ CDriver::CDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunica
 
   Input_Preprocessing(config_container, driver_config);
 
+  /*--- Start the profiler of the solver phases, the remainder of the constructor is measured too. ---*/
+
+  CRegionProfiler::Initialize(config_container[ZONE_0]->GetKind_Profiling(),
+                              config_container[ZONE_0]->GetProfiling_Counters());
+  SU2_PROFILE_SCOPE("Preprocessing");
+
   /*--- Retrieve dimension from mesh file ---*/
 
   nDim = CConfig::GetnDim(config_container[ZONE_0]->GetMesh_FileName(),
@@ -375,6 +382,10 @@ void CDriver::Postprocessing() {
       cout << "Warning: " << config_container[ZONE_0]->GetNonphysical_Reconstr() << " reconstructed states for upwinding are non-physical." << endl;
   }
 
+  /*--- Summary of the profiled regions of the solver. ---*/
+
+  CRegionProfiler::Finalize("profiling_summary.csv", "profiling_trace.json");
+
   if (rank == MASTER_NODE)
     cout << endl <<"------------------------- Solver Postprocessing -------------------------" << endl;
 
@@ -2135,13 +2146,13 @@ void CDriver::Numerics_Preprocessing(CConfig *config, CGeometry **geometry, CSol
 
   if (config->AddRadiation()) {
     /*--- Definition of the viscous scheme for each equation and mesh level ---*/
-    numerics[MESH_0][RAD_SOL][VISC_TERM] = new CAvgGradCorrected_P1(nDim, nVar_Rad, config);
+    numerics[MESH_0][RAD_SOL][visc_term] = new CAvgGradCorrected_P1(nDim, nVar_Rad, config);
 
     /*--- Definition of the source term integration scheme for each equation and mesh level ---*/
-    numerics[MESH_0][RAD_SOL][SOURCE_FIRST_TERM] = new CSourceP1(nDim, nVar_Rad, config);
+    numerics[MESH_0][RAD_SOL][source_first_term] = new CSourceP1(nDim, nVar_Rad, config);
 
     /*--- Definition of the boundary condition method ---*/
-    numerics[MESH_0][RAD_SOL][VISC_BOUND_TERM] = new CAvgGradCorrected_P1(nDim, nVar_Rad, config);
+    numerics[MESH_0][RAD_SOL][visc_bound_term] = new CAvgGradCorrected_P1(nDim, nVar_Rad, config);
   }
 
   /*--- Solver definition for the flow adjoint problem ---*/
@@ -211,6 +211,8 @@ void CMultizoneDriver::StartSolver() {
 
 void CMultizoneDriver::Preprocess(unsigned long TimeIter) {
 
+  SU2_PROFILE_SCOPE("Preprocess");
+
   /*--- Set the current time iteration in the config ---*/
   driver_config->SetTimeIter(TimeIter);
 
@@ -275,6 +277,8 @@ void CMultizoneDriver::Preprocess(unsigned long TimeIter) {
 
 void CMultizoneDriver::Run_GaussSeidel() {
 
+  SU2_PROFILE_SCOPE("Run");
+
   unsigned short UpdateMesh;
   bool DeformMesh = false;
 
@@ -325,6 +329,8 @@ void CMultizoneDriver::Run_GaussSeidel() {
 
 void CMultizoneDriver::Run_Jacobi() {
 
+  SU2_PROFILE_SCOPE("Run");
+
   unsigned short UpdateMesh;
   bool DeformMesh = false;
 
@@ -456,6 +462,8 @@ void CMultizoneDriver::Update() {
 
 void CMultizoneDriver::Output(unsigned long TimeIter) {
 
+  SU2_PROFILE_SCOPE("Output");
+
   /*--- Time the output for performance benchmarking. ---*/
 
   StopTime = SU2_MPI::Wtime();
@@ -112,6 +112,8 @@ void CSinglezoneDriver::StartSolver() {
 
 void CSinglezoneDriver::Preprocess(unsigned long TimeIter) {
 
+  SU2_PROFILE_SCOPE("Preprocess");
+
   /*--- Set runtime option ---*/
 
   Runtime_Options();
@@ -159,6 +161,8 @@ void CSinglezoneDriver::Preprocess(unsigned long TimeIter) {
 
 void CSinglezoneDriver::Run() {
 
+  SU2_PROFILE_SCOPE("Run");
+
   unsigned long OuterIter = 0;
   config_container[ZONE_0]->SetOuterIter(OuterIter);
 
@@ -191,6 +195,8 @@ void CSinglezoneDriver::Update() {
 
 void CSinglezoneDriver::Output(unsigned long TimeIter) {
 
+  SU2_PROFILE_SCOPE("Output");
+
   /*--- Time the output for performance benchmarking. ---*/
 
   StopTime = SU2_MPI::Wtime();
@@ -153,6 +153,11 @@ su2double CNEMOGas::ComputerhoCvve() {
     return rhoCvve;
 }
 
+void CNEMOGas::ComputeNetProductionRates(unsigned long nPoints, const su2double* val_rhos, const su2double* val_T,
+                                         const su2double* val_Tve, su2double* val_ws) const {
+  SU2_MPI::Error("The batched production rates are not implemented for this gas model.", CURRENT_FUNCTION);
+}
+
 void CNEMOGas::ComputedPdU(const su2double *V, const vector<su2double>& val_eves, su2double *val_dPdU){
 
   // Note: Electron energy not included properly.
@@ -43,7 +43,6 @@ CSU2TCLib::CSU2TCLib(const CConfig* config, unsigned short val_nDim, bool viscou
   CharVibTemp.resize(nSpecies,0.0);
   RotationModes.resize(nSpecies,0.0);
   Diss.resize(nSpecies,0.0);
-  A.resize(5,0.0);
   Omega00.resize(nSpecies,nSpecies,4,0.0);
   Omega11.resize(nSpecies,nSpecies,4,0.0);
   RxnConstantTable.resize(6,5) = su2double(0.0);
@@ -1097,6 +1096,28 @@ CSU2TCLib::CSU2TCLib(const CConfig* config, unsigned short val_nDim, bool viscou
 
   if (ionization) { nHeavy = nSpecies-1; nEl = 1; }
   else            { nHeavy = nSpecies;   nEl = 0; }
+
+  if (nSpecies > MAXNSPECIES) {
+    SU2_MPI::Error("Too many species in the gas model.", CURRENT_FUNCTION);
+  }
+
+  /*--- Tabulate the equilibrium constants and the stoichiometry of each reaction, so that
+   *    the chemistry routines do not need to look them up (and modify the object) per point. ---*/
+  KeqConstants.resize(nReactions,6,5);
+  ReactantStoich.resize(nReactions,nSpecies) = 0;
+  ProductStoich.resize(nReactions,nSpecies) = 0;
+
+  for (unsigned short iReaction = 0; iReaction < nReactions; iReaction++) {
+    GetChemistryEquilConstants(iReaction);
+    for (unsigned short iRow = 0; iRow < 6; iRow++)
+      for (unsigned short ii = 0; ii < 5; ii++)
+        KeqConstants(iReaction,iRow,ii) = RxnConstantTable(iRow,ii);
+
+    for (unsigned short ii = 0; ii < 3; ii++) {
+      if (Reactions(iReaction,0,ii) != nSpecies) ReactantStoich(iReaction,Reactions(iReaction,0,ii))++;
+      if (Reactions(iReaction,1,ii) != nSpecies) ProductStoich(iReaction,Reactions(iReaction,1,ii))++;
+    }
+  }
 }
 
 CSU2TCLib::~CSU2TCLib(){}
@@ -1282,178 +1303,207 @@ vector<su2double>& CSU2TCLib::ComputeNetProductionRates(bool implicit, const su2
   /*---                          ---*/
 
   /*--- Initialize variables ---*/
-  unsigned short ii, iReaction;
-  su2double Keq;
   ws.resize(nSpecies,0.0);
   for (iSpecies = 0; iSpecies < nSpecies; iSpecies ++)
     ws[iSpecies] = 0.0;
 
-  /*--- Define artificial chemistry parameters ---*/
-  // Note: These parameters artificially increase the rate-controlling reaction
-  //       temperature.  This relaxes some of the stiffness in the chemistry
-  //       source term.
-  su2double T_min   = 800.0;
-  su2double epsilon = 80;
+  su2double conc[MAXNSPECIES];
+  for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+    conc[iSpecies] = 0.001*rhos[iSpecies]/MolarMass[iSpecies];
+
+  const su2double N = ComputeNumberDensity(rhos.data());
 
   /*--- Define preferential dissociation coefficient ---*/
   //alpha = 0.3; //TODO: make this a config option?
 
   /*--- Loop over all reactions ---*/
-  for (iReaction = 0; iReaction < nReactions; iReaction++) {
-
-    /*--- Determine the rate-controlling temperature ---*/
-    af = Tcf_a[iReaction];
-    bf = Tcf_b[iReaction];
-    ab = Tcb_a[iReaction];
-    bb = Tcb_b[iReaction];
-    Trxnf = pow(T, af)*pow(Tve, bf);
-    Trxnb = pow(T, ab)*pow(Tve, bb);
-
-    /*--- Calculate the modified temperature ---*/
-    Thf = 0.5 * (Trxnf+T_min + sqrt((Trxnf-T_min)*(Trxnf-T_min)+epsilon*epsilon));
-    Thb = 0.5 * (Trxnb+T_min + sqrt((Trxnb-T_min)*(Trxnb-T_min)+epsilon*epsilon));
-
-    /*--- Get the Keq & Arrhenius coefficients ---*/
-    ComputeKeqConstants(iReaction);
-
-    /*--- Calculate Keq ---*/
-    Keq = exp(  A[0]*(Thb/1E4) + A[1] + A[2]*log(1E4/Thb)
-        + A[3]*(1E4/Thb) + A[4]*(1E4/Thb)*(1E4/Thb) );
+  for (unsigned short iReaction = 0; iReaction < nReactions; iReaction++) {
 
-    /*--- Calculate rate coefficients ---*/
-    kf  = ArrheniusCoefficient[iReaction] * exp(ArrheniusEta[iReaction]*log(Thf)) * exp(-ArrheniusTheta[iReaction]/Thf);
-    kfb = ArrheniusCoefficient[iReaction] * exp(ArrheniusEta[iReaction]*log(Thb)) * exp(-ArrheniusTheta[iReaction]/Thb);
-    kb  = kfb / Keq;
+    ReactionRates rxn;
+    ComputeRateCoefficients(iReaction, T, Tve, N, rxn);
+    ComputeRatesOfProgress(iReaction, conc, 1, rxn);
 
-    /*--- Determine production & destruction of each species ---*/
-    fwdRxn = 1.0;
-    bkwRxn = 1.0;
-    for (ii = 0; ii < 3; ii++) {
-
-      /*--- Reactants ---*/
-      iSpecies = Reactions(iReaction,0,ii);
-      if ( iSpecies != nSpecies)
-        fwdRxn *= 0.001*rhos[iSpecies]/MolarMass[iSpecies];
-
-      /*--- Products ---*/
-      jSpecies = Reactions(iReaction,1,ii);
-      if (jSpecies != nSpecies) {
-        bkwRxn *= 0.001*rhos[jSpecies]/MolarMass[jSpecies];
-      }
-    }
-
-    fwdRxn = 1000.0 * kf * fwdRxn;
-    bkwRxn = 1000.0 * kb * bkwRxn;
-
-    for (ii = 0; ii < 3; ii++) {
+    for (unsigned short ii = 0; ii < 3; ii++) {
 
       /*--- Products ---*/
       iSpecies = Reactions(iReaction,1,ii);
       if (iSpecies != nSpecies)
-        ws[iSpecies] += MolarMass[iSpecies] * (fwdRxn-bkwRxn);
+        ws[iSpecies] += MolarMass[iSpecies] * (rxn.fwdRxn-rxn.bkwRxn);
 
       /*--- Reactants ---*/
       iSpecies = Reactions(iReaction,0,ii);
       if (iSpecies != nSpecies)
-        ws[iSpecies] -= MolarMass[iSpecies] * (fwdRxn-bkwRxn);
+        ws[iSpecies] -= MolarMass[iSpecies] * (rxn.fwdRxn-rxn.bkwRxn);
     }
 
     if (implicit) {
-      ChemistryJacobian(iReaction, V, eve, cvve, dTdU, dTvedU, val_jacobian);
+      ChemistryJacobian(iReaction, rxn, conc, eve, cvve, dTdU, dTvedU, val_jacobian);
     }
   } //iReaction
 
   return ws;
 }
 
+void CSU2TCLib::ComputeNetProductionRates(unsigned long nPoints, const su2double* val_rhos, const su2double* val_T,
+                                          const su2double* val_Tve, su2double* val_ws) const {
+
+  for (unsigned long i = 0; i < nSpecies*nPoints; i++) val_ws[i] = 0.0;
+
+  /*--- The block is processed in chunks, the per-point auxiliary data lives on the stack.
+   *    Within a chunk the loops over points are innermost, and the reaction data is hoisted. ---*/
+
+  for (unsigned long start = 0; start < nPoints; start += BLOCK_SIZE) {
+    const unsigned long size = (nPoints-start < BLOCK_SIZE) ? nPoints-start : BLOCK_SIZE;
+
+    su2double conc[MAXNSPECIES][BLOCK_SIZE], N[BLOCK_SIZE], netRxn[BLOCK_SIZE];
+
+    for (unsigned short jSpecies = 0; jSpecies < nSpecies; jSpecies++) {
+      const su2double* rho_s = &val_rhos[jSpecies*nPoints+start];
+      for (unsigned long k = 0; k < size; k++)
+        conc[jSpecies][k] = 0.001*rho_s[k]/MolarMass[jSpecies];
+    }
+    for (unsigned long k = 0; k < size; k++)
+      N[k] = ComputeNumberDensity(&val_rhos[start+k], nPoints);
+
+    for (unsigned short iReaction = 0; iReaction < nReactions; iReaction++) {
+
+      for (unsigned long k = 0; k < size; k++) {
+        ReactionRates rxn;
+        ComputeRateCoefficients(iReaction, val_T[start+k], val_Tve[start+k], N[k], rxn);
+        ComputeRatesOfProgress(iReaction, &conc[0][k], BLOCK_SIZE, rxn);
+        netRxn[k] = rxn.fwdRxn - rxn.bkwRxn;
+      }
+
+      for (unsigned short ii = 0; ii < 3; ii++) {
+        const auto jProd = Reactions(iReaction,1,ii);
+        if (jProd != nSpecies) {
+          su2double* ws_s = &val_ws[jProd*nPoints+start];
+          for (unsigned long k = 0; k < size; k++) ws_s[k] += MolarMass[jProd] * netRxn[k];
+        }
+        const auto jReac = Reactions(iReaction,0,ii);
+        if (jReac != nSpecies) {
+          su2double* ws_s = &val_ws[jReac*nPoints+start];
+          for (unsigned long k = 0; k < size; k++) ws_s[k] -= MolarMass[jReac] * netRxn[k];
+        }
+      }
+    }
+  }
+}
+
+void CSU2TCLib::ComputeRateCoefficients(unsigned short iReaction, su2double val_T, su2double val_Tve,
+                                        su2double N, ReactionRates& rxn) const {
+
+  /*--- Define artificial chemistry parameters ---*/
+  // Note: These parameters artificially increase the rate-controlling reaction
+  //       temperature.  This relaxes some of the stiffness in the chemistry
+  //       source term.
+  const su2double T_min   = 800.0;
+  const su2double epsilon = 80;
+
+  /*--- Determine the rate-controlling temperature ---*/
+  rxn.Trxnf = pow(val_T, Tcf_a[iReaction])*pow(val_Tve, Tcf_b[iReaction]);
+  rxn.Trxnb = pow(val_T, Tcb_a[iReaction])*pow(val_Tve, Tcb_b[iReaction]);
+
+  /*--- Calculate the modified temperature ---*/
+  rxn.Thf = 0.5 * (rxn.Trxnf+T_min + sqrt((rxn.Trxnf-T_min)*(rxn.Trxnf-T_min)+epsilon*epsilon));
+  rxn.Thb = 0.5 * (rxn.Trxnb+T_min + sqrt((rxn.Trxnb-T_min)*(rxn.Trxnb-T_min)+epsilon*epsilon));
+
+  /*--- Get the Keq & Arrhenius coefficients ---*/
+  ComputeKeqConstants(iReaction, N, rxn.A);
+  const su2double* A = rxn.A;
+
+  /*--- Calculate Keq ---*/
+  const su2double Keq = exp(  A[0]*(rxn.Thb/1E4) + A[1] + A[2]*log(1E4/rxn.Thb)
+                            + A[3]*(1E4/rxn.Thb) + A[4]*(1E4/rxn.Thb)*(1E4/rxn.Thb) );
+
+  /*--- Calculate rate coefficients ---*/
+  rxn.kf = ArrheniusCoefficient[iReaction] * exp(ArrheniusEta[iReaction]*log(rxn.Thf)) * exp(-ArrheniusTheta[iReaction]/rxn.Thf);
+  const su2double kfb = ArrheniusCoefficient[iReaction] * exp(ArrheniusEta[iReaction]*log(rxn.Thb)) * exp(-ArrheniusTheta[iReaction]/rxn.Thb);
+  rxn.kb = kfb / Keq;
+}
+
 void CSU2TCLib::ChemistryJacobian(unsigned short iReaction, const su2double *V,
                                   const su2double* eve, const su2double *cvve,
                                   const su2double* dTdU, const su2double* dTvedU,
                                   su2double **val_jacobian) {
 
-  unsigned short ii, iVar, jVar, iSpecies;
-  unsigned short nEve = nSpecies+nDim+1;
-  unsigned short nVar = nSpecies+nDim+2;
+  su2double conc[MAXNSPECIES];
+  for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+    conc[iSpecies] = 0.001*rhos[iSpecies]/MolarMass[iSpecies];
 
-  su2double T_min   = 800.0;
-  su2double epsilon = 80;
+  ReactionRates rxn;
+  ComputeRateCoefficients(iReaction, T, Tve, ComputeNumberDensity(rhos.data()), rxn);
+  ComputeRatesOfProgress(iReaction, conc, 1, rxn);
 
-  /*--- Initializing derivative variables ---*/
-  dkf.resize(nVar,0.0);      dkb.resize(nVar,0.0);
-  dRfok.resize(nVar,0.0);    dRbok.resize(nVar,0.0);
-  alphak.resize(nSpecies,0); betak.resize(nSpecies,0);
+  ChemistryJacobian(iReaction, rxn, conc, eve, cvve, dTdU, dTvedU, val_jacobian);
+}
 
-  for (iVar=0;iVar<nVar;iVar++){
-   dkf[iVar]=0.0; dRfok[iVar]=0.0;
-   dkb[iVar]=0.0; dRbok[iVar]=0.0;
-  }
+void CSU2TCLib::ChemistryJacobian(unsigned short iReaction, const ReactionRates& rxn, const su2double* conc,
+                                  const su2double* eve, const su2double* cvve, const su2double* dTdU,
+                                  const su2double* dTvedU, su2double **val_jacobian) const {
 
-  for (iSpecies=0;iSpecies<nSpecies;iSpecies++){
-   alphak[iSpecies]=0; betak[iSpecies]=0;
-  }
+  unsigned short ii, iVar, jVar, iSpecies, jSpecies;
+  const unsigned short nEve = nSpecies+nDim+1;
+  const unsigned short nVar = nSpecies+nDim+2;
+
+  const su2double T_min   = 800.0;
+  const su2double epsilon = 80;
+
+  /*--- Initializing derivative variables ---*/
+  su2double dkf[MAXNVAR] = {0.0}, dkb[MAXNVAR] = {0.0};
+  su2double dRfok[MAXNVAR] = {0.0}, dRbok[MAXNVAR] = {0.0};
+
+  const int* alphak = &ReactantStoich(iReaction,0);
+  const int* betak = &ProductStoich(iReaction,0);
 
   /*--- Extract additional Arrhenius information ---*/
-  su2double eta   = ArrheniusEta[iReaction];
-  su2double theta = ArrheniusTheta[iReaction];
+  const su2double eta   = ArrheniusEta[iReaction];
+  const su2double theta = ArrheniusTheta[iReaction];
+  const su2double af = Tcf_a[iReaction], bf = Tcf_b[iReaction];
+  const su2double ab = Tcb_a[iReaction], bb = Tcb_b[iReaction];
+  const su2double* A = rxn.A;
 
   /*--- Derivative of modified temperature wrt Trxnf ---*/
-  dThf = 0.5 * (1.0 + (Trxnf-T_min)/sqrt((Trxnf-T_min)*(Trxnf-T_min)
-                                                  + epsilon*epsilon));
-  dThb = 0.5 * (1.0 + (Trxnb-T_min)/sqrt((Trxnb-T_min)*(Trxnb-T_min)
-                                                  + epsilon*epsilon));
+  const su2double dThf = 0.5 * (1.0 + (rxn.Trxnf-T_min)/sqrt((rxn.Trxnf-T_min)*(rxn.Trxnf-T_min)
+                                                             + epsilon*epsilon));
+  const su2double dThb = 0.5 * (1.0 + (rxn.Trxnb-T_min)/sqrt((rxn.Trxnb-T_min)*(rxn.Trxnb-T_min)
+                                                             + epsilon*epsilon));
 
   /*--- Fwd rate coefficient derivatives ---*/
-  coeff = kf * (eta/Thf+theta/(Thf*Thf)) * dThf;
+  su2double coeff = rxn.kf * (eta/rxn.Thf+theta/(rxn.Thf*rxn.Thf)) * dThf;
   for (iVar = 0; iVar < nVar; iVar++) {
-    dkf[iVar] = coeff * ( af*Trxnf/T*dTdU[iVar] +
-                          bf*Trxnf/Tve*dTvedU[iVar] );
+    dkf[iVar] = coeff * ( af*rxn.Trxnf/T*dTdU[iVar] +
+                          bf*rxn.Trxnf/Tve*dTvedU[iVar] );
   }
 
   /*--- Bkwd rate coefficient derivatives ---*/
-  coeff = kb * (eta/Thb+theta/(Thb*Thb)) * dThb;
+  coeff = rxn.kb * (eta/rxn.Thb+theta/(rxn.Thb*rxn.Thb)) * dThb;
   for (iVar = 0; iVar < nVar; iVar++) {
-    dkb[iVar] = coeff*( ab*Trxnb/T*dTdU[iVar] + bb*Trxnb/Tve*dTvedU[iVar])
-                      - kb*((A[0]*Thb/1E4 - A[2] - A[3]*1E4/Thb
-                      - 2*A[4]*(1E4/Thb)*(1E4/Thb))/Thb) * dThb *
-                      ( ab*Trxnb/T*dTdU[iVar] + bb*Trxnb/Tve*dTvedU[iVar]);
+    dkb[iVar] = coeff*( ab*rxn.Trxnb/T*dTdU[iVar] + bb*rxn.Trxnb/Tve*dTvedU[iVar])
+                      - rxn.kb*((A[0]*rxn.Thb/1E4 - A[2] - A[3]*1E4/rxn.Thb
+                      - 2*A[4]*(1E4/rxn.Thb)*(1E4/rxn.Thb))/rxn.Thb) * dThb *
+                      ( ab*rxn.Trxnb/T*dTdU[iVar] + bb*rxn.Trxnb/Tve*dTvedU[iVar]);
   }
 
   /*--- Rxn rate derivatives ---*/
-  for (ii = 0; ii < 3; ii++) {
-
-    /*--- Products ---*/
-    iSpecies = Reactions(iReaction,1,ii);
-    if (iSpecies != nSpecies)
-      betak[iSpecies]++;
-
-    /*--- Reactants ---*/
-    iSpecies = Reactions(iReaction,0,ii);
-    if (iSpecies != nSpecies)
-      alphak[iSpecies]++;
-  }
-
   for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
 
     // Fwd
     dRfok[iSpecies] =  0.001*alphak[iSpecies]/MolarMass[iSpecies] *
-                       pow(0.001*rhos[iSpecies]/MolarMass[iSpecies],
-                       max(0, alphak[iSpecies]-1));
+                       pow(conc[iSpecies], max(0, alphak[iSpecies]-1));
 
     for (jSpecies = 0; jSpecies < nSpecies; jSpecies++)
       if (jSpecies != iSpecies)
-        dRfok[iSpecies] *= pow(0.001*rhos[jSpecies]/MolarMass[jSpecies],
-                                                       alphak[jSpecies]);
+        dRfok[iSpecies] *= pow(conc[jSpecies], alphak[jSpecies]);
     dRfok[iSpecies] *= 1000.0;
 
     // Bkw
     dRbok[iSpecies] =  0.001*betak[iSpecies]/MolarMass[iSpecies] *
-                       pow(0.001*rhos[iSpecies]/MolarMass[iSpecies],
-                       max(0, betak[iSpecies]-1));
+                       pow(conc[iSpecies], max(0, betak[iSpecies]-1));
 
     for (jSpecies = 0; jSpecies < nSpecies; jSpecies++)
       if (jSpecies != iSpecies)
-        dRbok[iSpecies] *= pow(0.001*rhos[jSpecies]/MolarMass[jSpecies],
-                                                        betak[jSpecies]);
+        dRbok[iSpecies] *= pow(conc[jSpecies], betak[jSpecies]);
     dRbok[iSpecies] *= 1000.0;
   }
 
@@ -1463,16 +1513,16 @@ void CSU2TCLib::ChemistryJacobian(unsigned short iReaction, const su2double *V,
     iSpecies = Reactions(iReaction,1,ii);
     if (iSpecies != nSpecies) {
       for (iVar = 0; iVar < nVar; iVar++) {
-        val_jacobian[iSpecies][iVar] += MolarMass[iSpecies] * ( dkf[iVar]*(fwdRxn/kf) + kf*dRfok[iVar] -
-                                                                dkb[iVar]*(bkwRxn/kb) - kb*dRbok[iVar]); //TODO * Volume;
-        val_jacobian[nEve][iVar]     += MolarMass[iSpecies] * ( dkf[iVar]*(fwdRxn/kf) + kf*dRfok[iVar] -
-                                                                dkb[iVar]*(bkwRxn/kb) - kb*dRbok[iVar]) *
+        val_jacobian[iSpecies][iVar] += MolarMass[iSpecies] * ( dkf[iVar]*(rxn.fwdRxn/rxn.kf) + rxn.kf*dRfok[iVar] -
+                                                                dkb[iVar]*(rxn.bkwRxn/rxn.kb) - rxn.kb*dRbok[iVar]); //TODO * Volume;
+        val_jacobian[nEve][iVar]     += MolarMass[iSpecies] * ( dkf[iVar]*(rxn.fwdRxn/rxn.kf) + rxn.kf*dRfok[iVar] -
+                                                                dkb[iVar]*(rxn.bkwRxn/rxn.kb) - rxn.kb*dRbok[iVar]) *
                                                                 eve[iSpecies];//TODO * Volume;
       }
 
       for (jVar = 0; jVar < nVar; jVar++) {
-        val_jacobian[nEve][jVar] += MolarMass[iSpecies] * (fwdRxn-bkwRxn)* cvve[iSpecies] *
-                                                                             dTvedU[jVar];//TODO * Volume;
+        val_jacobian[nEve][jVar] += MolarMass[iSpecies] * (rxn.fwdRxn-rxn.bkwRxn)* cvve[iSpecies] *
+                                                                                 dTvedU[jVar];//TODO * Volume;
       }
     }
 
@@ -1480,38 +1530,26 @@ void CSU2TCLib::ChemistryJacobian(unsigned short iReaction, const su2double *V,
     iSpecies = Reactions(iReaction,0,ii);
     if (iSpecies != nSpecies) {
       for (iVar = 0; iVar < nVar; iVar++) {
-        val_jacobian[iSpecies][iVar] -= MolarMass[iSpecies] * ( dkf[iVar]*(fwdRxn/kf) + kf*dRfok[iVar] -
-                                                                dkb[iVar]*(bkwRxn/kb) - kb*dRbok[iVar]);//TODO * Volume;
-        val_jacobian[nEve][iVar] -=     MolarMass[iSpecies] * ( dkf[iVar]*(fwdRxn/kf) + kf*dRfok[iVar] -
-                                                                dkb[iVar]*(bkwRxn/kb) - kb*dRbok[iVar]) *
-                                                                                         eve[iSpecies];//TODO * Volume;
+        val_jacobian[iSpecies][iVar] -= MolarMass[iSpecies] * ( dkf[iVar]*(rxn.fwdRxn/rxn.kf) + rxn.kf*dRfok[iVar] -
+                                                                dkb[iVar]*(rxn.bkwRxn/rxn.kb) - rxn.kb*dRbok[iVar]);//TODO * Volume;
+        val_jacobian[nEve][iVar] -=     MolarMass[iSpecies] * ( dkf[iVar]*(rxn.fwdRxn/rxn.kf) + rxn.kf*dRfok[iVar] -
+                                                                dkb[iVar]*(rxn.bkwRxn/rxn.kb) - rxn.kb*dRbok[iVar]) *
+                                                                                             eve[iSpecies];//TODO * Volume;
       }
 
       for (jVar = 0; jVar < nVar; jVar++) {
-        val_jacobian[nEve][jVar] -= MolarMass[iSpecies] * (fwdRxn-bkwRxn) * cvve[iSpecies] *
-                                                                              dTvedU[jVar];//TODO * Volume;
+        val_jacobian[nEve][jVar] -= MolarMass[iSpecies] * (rxn.fwdRxn-rxn.bkwRxn) * cvve[iSpecies] *
+                                                                                  dTvedU[jVar];//TODO * Volume;
       }
     }
   } // ii
 }
 
-void CSU2TCLib::ComputeKeqConstants(unsigned short val_Reaction) {
+void CSU2TCLib::ComputeKeqConstants(unsigned short val_Reaction, su2double N, su2double* A) const {
 
   unsigned short ii;
 
-  /*--- Acquire database constants from CConfig ---*/
-  GetChemistryEquilConstants(val_Reaction);
-
-  /*--- Calculate mixture number density ---*/
-  su2double N = 0.0;
-  for (iSpecies =0 ; iSpecies < nSpecies; iSpecies++) {
-    N += rhos[iSpecies]/MolarMass[iSpecies]*AVOGAD_CONSTANT;
-  }
-
-  /*--- Convert number density from 1/m^3 to 1/cm^3 for table look-up ---*/
-  N = N*(1E-6);
-
-  /*--- Determine table index based on mixture N ---*/
+  /*--- Determine table index based on mixture N [1/cm^3] ---*/
   unsigned short tbl_offset = 14;
   unsigned short pwr        = floor(log10(N));
 
@@ -1519,11 +1557,11 @@ void CSU2TCLib::ComputeKeqConstants(unsigned short val_Reaction) {
   unsigned short iIndex = int(pwr) - tbl_offset;
   if (iIndex <= 0) {
     for (ii = 0; ii < 5; ii++)
-      A[ii] = RxnConstantTable(0,ii);
+      A[ii] = KeqConstants(val_Reaction,0,ii);
     return;
   } else if (iIndex >= 5) {
     for (ii = 0; ii < 5; ii++)
-      A[ii] = RxnConstantTable(5,ii);
+      A[ii] = KeqConstants(val_Reaction,5,ii);
     return;
   }
 
@@ -1538,9 +1576,9 @@ void CSU2TCLib::ComputeKeqConstants(unsigned short val_Reaction) {
 
   /*--- Interpolate ---*/
   for (ii = 0; ii < 5; ii++) {
-    A[ii] =  (RxnConstantTable(iIndex+1,ii) - RxnConstantTable(iIndex,ii))
+    A[ii] =  (KeqConstants(val_Reaction,iIndex+1,ii) - KeqConstants(val_Reaction,iIndex,ii))
         / (tmp2 - tmp1) * (N - tmp1)
-        + RxnConstantTable(iIndex,ii);
+        + KeqConstants(val_Reaction,iIndex,ii);
   }
 }
 
@@ -1821,6 +1859,7 @@ void CSU2TCLib::DiffusionCoeffGY(){
 
   su2double pi = PI_NUMBER;
   su2double kb = BOLTZMANN_CONSTANT;
+  const su2double logT = log(T);
 
   /*--- Calculate mixture gas constant ---*/
   su2double gam_t = 0.0;
@@ -1846,8 +1885,8 @@ void CSU2TCLib::DiffusionCoeffGY(){
 
         /*--- Calculate the Omega^(0,0)_ij collision cross section ---*/
         su2double Omega_ij = 1E-20 * Omega00(iSpecies,jSpecies,3)
-                            * pow(T, Omega00(iSpecies,jSpecies,0)*log(T)*log(T)
-                                   + Omega00(iSpecies,jSpecies,1)*log(T)
+                            * pow(T, Omega00(iSpecies,jSpecies,0)*logT*logT
+                                   + Omega00(iSpecies,jSpecies,1)*logT
                                    + Omega00(iSpecies,jSpecies,2));
         /*--- Calculate "delta1_ij" ---*/
         su2double d1_ij = 8.0/3.0 * sqrt((2.0*Mi*Mj) / (pi*Ru*T*(Mi+Mj))) * Omega_ij;
@@ -1915,6 +1954,7 @@ void CSU2TCLib::ViscosityGY(){
   su2double pi = PI_NUMBER;
   su2double Na = AVOGAD_CONSTANT;
   su2double Mu = 0.0;
+  const su2double logT = log(T), logTve = log(Tve);
 
   /*--- Mixture viscosity via Gupta-Yos approximation ---*/
   for (iSpecies = 0; iSpecies < nHeavy; iSpecies++) {
@@ -1931,8 +1971,8 @@ void CSU2TCLib::ViscosityGY(){
 
       /*--- Calculate "delta" quantities ---*/
       su2double Omega_ij = 1E-20 * Omega11(iSpecies,jSpecies,3)
-          * pow(T, Omega11(iSpecies,jSpecies,0)*log(T)*log(T)
-          + Omega11(iSpecies,jSpecies,1)*log(T)
+          * pow(T, Omega11(iSpecies,jSpecies,0)*logT*logT
+          + Omega11(iSpecies,jSpecies,1)*logT
           + Omega11(iSpecies,jSpecies,2));
       su2double d2_ij = 16.0/5.0 * sqrt((2.0*Mi*Mj) / (pi*Ru*T*(Mi+Mj))) * Omega_ij;
 
@@ -1946,8 +1986,8 @@ void CSU2TCLib::ViscosityGY(){
 
       /*--- Calculate "delta" quantities ---*/
       su2double Omega_ij = 1E-20 * Omega11(iSpecies,jSpecies,3)
-          * pow(Tve, Omega11(iSpecies,jSpecies,0)*log(Tve)*log(Tve)
-          + Omega11(iSpecies,jSpecies,1)*log(Tve)
+          * pow(Tve, Omega11(iSpecies,jSpecies,0)*logTve*logTve
+          + Omega11(iSpecies,jSpecies,1)*logTve
           + Omega11(iSpecies,jSpecies,2));
       su2double d2_ij = 16.0/5.0 * sqrt((2.0*Mi*Mj) / (pi*Ru*Tve*(Mi+Mj))) * Omega_ij;
       denom += gam_j*d2_ij;
@@ -1986,6 +2026,7 @@ void CSU2TCLib::ThermalConductivitiesGY(){
   su2double pi   = PI_NUMBER;
   su2double Na   = AVOGAD_CONSTANT;
   su2double kb   = BOLTZMANN_CONSTANT;
+  const su2double logT = log(T);
 
   if (ionization) {
     SU2_MPI::Error("NEEDS REVISION w/ IONIZATION",CURRENT_FUNCTION);
@@ -2023,8 +2064,8 @@ void CSU2TCLib::ThermalConductivitiesGY(){
 
       /*--- Calculate the Omega^(0,0)_ij collision cross section ---*/
       Omega_ij = 1E-20 * Omega00(iSpecies,jSpecies,3)
-          * pow(T, Omega00(iSpecies,jSpecies,0)*log(T)*log(T)
-          + Omega00(iSpecies,jSpecies,1)*log(T)
+          * pow(T, Omega00(iSpecies,jSpecies,0)*logT*logT
+          + Omega00(iSpecies,jSpecies,1)*logT
           + Omega00(iSpecies,jSpecies,2));
 
       /*--- Calculate "delta1_ij" ---*/
@@ -2032,8 +2073,8 @@ void CSU2TCLib::ThermalConductivitiesGY(){
 
       /*--- Calculate the Omega^(1,1)_ij collision cross section ---*/
       Omega_ij = 1E-20 * Omega11(iSpecies,jSpecies,3)
-          * pow(T, Omega11(iSpecies,jSpecies,0)*log(T)*log(T)
-          + Omega11(iSpecies,jSpecies,1)*log(T)
+          * pow(T, Omega11(iSpecies,jSpecies,0)*logT*logT
+          + Omega11(iSpecies,jSpecies,1)*logT
           + Omega11(iSpecies,jSpecies,2));
 
       /*--- Calculate "delta2_ij" ---*/
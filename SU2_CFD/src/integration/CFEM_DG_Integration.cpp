@@ -60,12 +60,13 @@ void CFEM_DG_Integration::SingleGrid_Iteration(CGeometry ****geometry,
         complicated algorithm must be used to facilitate time accurate
         local time stepping.  Note that we are currently hard-coding
         the classical RK4 scheme. ---*/
-  bool useADER = false;
+  bool useADER = false, useImplicit = false;
   switch (config[iZone]->GetKind_TimeIntScheme()) {
     case RUNGE_KUTTA_EXPLICIT: iLimit = config[iZone]->GetnRKStep(); break;
     case CLASSICAL_RK4_EXPLICIT: iLimit = 4; break;
     case ADER_DG: iLimit = 1; useADER = true; break;
-    case EULER_EXPLICIT: case EULER_IMPLICIT: iLimit = 1; break; }
+    case EULER_EXPLICIT: iLimit = 1; break;
+    case EULER_IMPLICIT: iLimit = 1; useImplicit = true; break; }
 
   /*--- In case an unsteady simulation is carried out, it is possible that a
         synchronization time step is specified. If so, set the boolean
@@ -120,9 +121,16 @@ void CFEM_DG_Integration::SingleGrid_Iteration(CGeometry ****geometry,
                           numerics_container[iZone][iInst][iMesh][SolContainer_Position],
                           config[iZone], iMesh, iStep, RunTime_EqSystem);
 
-        /*--- Time integration, update solution using the old solution plus the solution increment ---*/
-        Time_Integration(geometry[iZone][iInst][iMesh], solver_container[iZone][iInst][iMesh],
-                         config[iZone], iStep, RunTime_EqSystem);
+        /*--- Time integration, update solution using the old solution plus the solution increment.
+              The implicit scheme needs the numerics for the residual evaluations of the
+              Jacobian-free Newton-Krylov method. ---*/
+        if( useImplicit )
+          solver_container[iZone][iInst][iMesh][SolContainer_Position]->ImplicitNewtonKrylov_Iteration(geometry[iZone][iInst][iMesh], solver_container[iZone][iInst][iMesh],
+                                                                                                       numerics_container[iZone][iInst][iMesh][SolContainer_Position],
+                                                                                                       config[iZone], iMesh);
+        else
+          Time_Integration(geometry[iZone][iInst][iMesh], solver_container[iZone][iInst][iMesh],
+                           config[iZone], iStep, RunTime_EqSystem);
 
         /*--- Postprocessing ---*/
         solver_container[iZone][iInst][iMesh][SolContainer_Position]->Postprocessing(geometry[iZone][iInst][iMesh], solver_container[iZone][iInst][iMesh],
@@ -27,6 +27,7 @@
 
 #include "../../include/integration/CIntegration.hpp"
 #include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/CRegionProfiler.hpp"
 
 
 CIntegration::CIntegration() {
@@ -51,26 +52,37 @@ void CIntegration::Space_Integration(CGeometry *geometry,
 
   /*--- Compute inviscid residuals ---*/
 
-  switch (config->GetKind_ConvNumScheme()) {
-    case SPACE_CENTERED:
-      solver_container[MainSolver]->Centered_Residual(geometry, solver_container, numerics, config, iMesh, iRKStep);
-      break;
-    case SPACE_UPWIND:
-      solver_container[MainSolver]->Upwind_Residual(geometry, solver_container, numerics, config, iMesh);
-      break;
+  {
+    SU2_PROFILE_SCOPE("Convective_Residual");
+    switch (config->GetKind_ConvNumScheme()) {
+      case SPACE_CENTERED:
+        solver_container[MainSolver]->Centered_Residual(geometry, solver_container, numerics, config, iMesh, iRKStep);
+        break;
+      case SPACE_UPWIND:
+        solver_container[MainSolver]->Upwind_Residual(geometry, solver_container, numerics, config, iMesh);
+        break;
+    }
   }
 
   /*--- Compute viscous residuals ---*/
-  solver_container[MainSolver]->Viscous_Residual(geometry, solver_container, numerics, config, iMesh, iRKStep);
+  {
+    SU2_PROFILE_SCOPE("Viscous_Residual");
+    solver_container[MainSolver]->Viscous_Residual(geometry, solver_container, numerics, config, iMesh, iRKStep);
+  }
 
   /*--- Compute source term residuals ---*/
-  solver_container[MainSolver]->Source_Residual(geometry, solver_container, numerics, config, iMesh);
+  {
+    SU2_PROFILE_SCOPE("Source_Residual");
+    solver_container[MainSolver]->Source_Residual(geometry, solver_container, numerics, config, iMesh);
+  }
 
   /*--- Add viscous and convective residuals, and compute the Dual Time Source term ---*/
 
   if (dual_time)
     solver_container[MainSolver]->SetResidual_DualTime(geometry, solver_container, config, iRKStep, iMesh, RunTime_EqSystem);
 
+  SU2_PROFILE_SCOPE("Boundary_Conditions");
+
   /*--- Pick convective and viscous numerics objects for the current thread. ---*/
 
   CNumerics* conv_bound_numerics = numerics[CONV_BOUND_TERM + omp_get_thread_num()*MAX_TERMS];
@@ -192,6 +204,8 @@ void CIntegration::Space_Integration(CGeometry *geometry,
 void CIntegration::Time_Integration(CGeometry *geometry, CSolver **solver_container, CConfig *config,
                                     unsigned short iRKStep, unsigned short RunTime_EqSystem) {
 
+  SU2_PROFILE_SCOPE("Time_Integration");
+
   unsigned short MainSolver = config->GetContainerPosition(RunTime_EqSystem);
 
   switch (config->GetKind_TimeIntScheme()) {
@@ -26,7 +26,24 @@
  */
 
 #include "../../include/iteration/CDiscAdjFluidIteration.hpp"
+#include "../../include/iteration/CFluidIteration.hpp"
 #include "../../include/output/COutput.hpp"
+#include "../../include/output/COutputFactory.hpp"
+#include "../../../Common/include/toolboxes/CBinomialCheckpointing.hpp"
+
+CDiscAdjFluidIteration::CDiscAdjFluidIteration(const CConfig *config) : CIteration(config),
+  turbulent(config->GetKind_Solver() == MAIN_SOLVER::DISC_ADJ_RANS || config->GetKind_Solver() == MAIN_SOLVER::DISC_ADJ_INC_RANS) {
+
+  if (config->GetTime_Domain() && config->GetKind_Unst_Adj_Primal() == UNST_ADJ_PRIMAL::CHECKPOINTING) {
+    /*--- The window must at least hold the time levels of one adjoint time step. ---*/
+    const unsigned long window = max<unsigned long>(config->GetUnst_Adj_StoreWindow(), 3);
+    PrimalStore = std::unique_ptr<CPrimalStateStore>(
+        new CPrimalStateStore(window, config->GetKind_Primal_Store_Compression()));
+    PrimalIteration = std::unique_ptr<CFluidIteration>(new CFluidIteration(config));
+  }
+}
+
+CDiscAdjFluidIteration::~CDiscAdjFluidIteration() = default;
 
 void CDiscAdjFluidIteration::Preprocess(COutput* output, CIntegration**** integration, CGeometry**** geometry,
                                         CSolver***** solver, CNumerics****** numerics, CConfig** config,
@@ -52,7 +69,16 @@ void CDiscAdjFluidIteration::Preprocess(COutput* output, CIntegration**** integr
 
     /*--- For dual-time stepping we want to load the already converged solution at timestep n ---*/
 
-    if (TimeIter == 0) {
+    if (PrimalStore) {
+      /*--- The trajectory is in memory, ensure the states of this time step are available and
+       *    set all the time levels, as loading from memory is cheap compared to shifting them. ---*/
+
+      ComputePrimalStates(output, integration, geometry, solver, numerics, config, surface_movement,
+                          grid_movement, FFDBox, iZone, iInst, Direct_Iter);
+
+      SetPrimalTimeLevels(geometry, solver, config, iZone, iInst, Direct_Iter, true);
+    }
+    else if (TimeIter == 0) {
       if (dual_time_2nd) {
         /*--- Load solution at timestep n-2 ---*/
         LoadUnsteady_Solution(geometry, solver, config, iZone, iInst, Direct_Iter - 2);
@@ -411,6 +437,233 @@ void CDiscAdjFluidIteration::LoadUnsteady_Solution(CGeometry**** geometry, CSolv
   }
 }
 
+vector<su2activematrix*> CDiscAdjFluidIteration::GetPrimalState(CSolver*** solvers, const CConfig* config) const {
+
+  const bool species = config->GetKind_Species_Model() != SPECIES_MODEL::NONE;
+  const bool heat = config->GetWeakly_Coupled_Heat();
+
+  vector<su2activematrix*> state;
+  for (auto iMesh = 0u; iMesh <= config->GetnMGLevels(); iMesh++) {
+    state.push_back(&solvers[iMesh][FLOW_SOL]->GetNodes()->GetSolution());
+    if (turbulent) state.push_back(&solvers[iMesh][TURB_SOL]->GetNodes()->GetSolution());
+    if (solvers[iMesh][TRANS_SOL]) state.push_back(&solvers[iMesh][TRANS_SOL]->GetNodes()->GetSolution());
+    if (species) state.push_back(&solvers[iMesh][SPECIES_SOL]->GetNodes()->GetSolution());
+    if (heat) state.push_back(&solvers[iMesh][HEAT_SOL]->GetNodes()->GetSolution());
+  }
+  return state;
+}
+
+void CDiscAdjFluidIteration::RestorePrimalState(CGeometry**** geometry, CSolver***** solver, CConfig** config,
+                                                unsigned short iZone, unsigned short iInst, long DirectIter) {
+
+  /*--- Negative iterations are the freestream solution. ---*/
+
+  if (DirectIter < 0) {
+    LoadUnsteady_Solution(geometry, solver, config, iZone, iInst, DirectIter);
+    return;
+  }
+
+  auto solvers = solver[iZone][iInst];
+  auto geometries = geometry[iZone][iInst];
+  const bool species = config[iZone]->GetKind_Species_Model() != SPECIES_MODEL::NONE;
+  const bool heat = config[iZone]->GetWeakly_Coupled_Heat();
+
+  if (!PrimalStore->Retrieve(DirectIter, GetPrimalState(solvers, config[iZone]))) {
+    SU2_MPI::Error("The primal state of direct iteration " + to_string(DirectIter) + " is not available.",
+                   CURRENT_FUNCTION);
+  }
+
+  /*--- The states are stored on all grid levels (including halos), update the
+   *    dependent quantities in the same way as when loading a restart. ---*/
+
+  for (auto iMesh = 0u; iMesh <= config[iZone]->GetnMGLevels(); iMesh++) {
+    solvers[iMesh][FLOW_SOL]->Preprocessing(geometries[iMesh], solvers[iMesh], config[iZone], iMesh, NO_RK_ITER,
+                                            RUNTIME_FLOW_SYS, false);
+    if (turbulent) {
+      solvers[iMesh][TURB_SOL]->Postprocessing(geometries[iMesh], solvers[iMesh], config[iZone], iMesh);
+    }
+    if (solvers[iMesh][TRANS_SOL]) {
+      solvers[iMesh][TRANS_SOL]->Postprocessing(geometries[iMesh], solvers[iMesh], config[iZone], iMesh);
+    }
+    if (species && iMesh == MESH_0) {
+      solvers[iMesh][SPECIES_SOL]->Preprocessing(geometries[iMesh], solvers[iMesh], config[iZone], iMesh, NO_RK_ITER,
+                                                 RUNTIME_SPECIES_SYS, false);
+    }
+    if (heat) {
+      solvers[iMesh][HEAT_SOL]->Preprocessing(geometries[iMesh], solvers[iMesh], config[iZone], iMesh, NO_RK_ITER,
+                                              RUNTIME_HEAT_SYS, false);
+    }
+  }
+}
+
+void CDiscAdjFluidIteration::SetPrimalTimeLevels(CGeometry**** geometry, CSolver***** solver, CConfig** config,
+                                                 unsigned short iZone, unsigned short iInst, long DirectIter,
+                                                 bool setSolution) {
+
+  const bool dual_time_2nd = (config[iZone]->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND);
+  const bool species = config[iZone]->GetKind_Species_Model() != SPECIES_MODEL::NONE;
+  const bool heat = config[iZone]->GetWeakly_Coupled_Heat();
+  const long order = dual_time_2nd ? 2 : 1;
+
+  for (auto iter = DirectIter - order; iter < DirectIter; ++iter) {
+
+    RestorePrimalState(geometry, solver, config, iZone, iInst, iter);
+
+    /*--- The oldest state is pushed to all the time levels. ---*/
+
+    const bool both = (iter == DirectIter - order) && dual_time_2nd;
+
+    for (auto iMesh = 0u; iMesh <= config[iZone]->GetnMGLevels(); iMesh++) {
+      auto solvers = solver[iZone][iInst][iMesh];
+
+      for (auto iSol : {FLOW_SOL, TURB_SOL, TRANS_SOL, SPECIES_SOL, HEAT_SOL}) {
+        if ((iSol == TURB_SOL && !turbulent) || (iSol == SPECIES_SOL && !species) || (iSol == HEAT_SOL && !heat) ||
+            !solvers[iSol])
+          continue;
+        solvers[iSol]->GetNodes()->Set_Solution_time_n();
+        if (both) solvers[iSol]->GetNodes()->Set_Solution_time_n1();
+      }
+    }
+  }
+
+  if (setSolution) RestorePrimalState(geometry, solver, config, iZone, iInst, DirectIter);
+}
+
+void CDiscAdjFluidIteration::PushCheckpoint(long DirectIter, const CConfig* config) {
+
+  const long order = (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND) ? 2 : 1;
+
+  Checkpoints.push_back(DirectIter);
+  for (auto iter = DirectIter - order + 1; iter <= DirectIter; ++iter) PrimalStore->SetCheckpoint(iter, true);
+}
+
+void CDiscAdjFluidIteration::PopCheckpoint(const CConfig* config) {
+
+  const long order = (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND) ? 2 : 1;
+
+  const auto top = Checkpoints.back();
+  Checkpoints.pop_back();
+
+  /*--- States shared with the checkpoint below remain pinned. ---*/
+  for (auto iter = top - order + 1; iter <= top; ++iter) {
+    if (iter > Checkpoints.back()) PrimalStore->SetCheckpoint(iter, false);
+  }
+}
+
+void CDiscAdjFluidIteration::ComputePrimalStates(COutput* output, CIntegration**** integration, CGeometry**** geometry,
+                                                 CSolver***** solver, CNumerics****** numerics, CConfig** config,
+                                                 CSurfaceMovement** surface_movement,
+                                                 CVolumetricMovement*** grid_movement, CFreeFormDefBox*** FFDBox,
+                                                 unsigned short iZone, unsigned short iInst, long DirectIter) {
+
+  const long order = (config[iZone]->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND) ? 2 : 1;
+
+  /*--- At the start of the reverse sweep, load the base states from which the whole trajectory
+   *    is computed, i.e. the oldest ones needed by the adjoint (restart files or freestream). ---*/
+
+  if (Checkpoints.empty()) {
+    const long base = config[iZone]->GetUnst_AdjointIter() - static_cast<long>(config[iZone]->GetnTime_Iter()) - 1;
+
+    for (auto iter = base - order + 1; iter <= base; ++iter) {
+      if (iter < 0) continue;
+      LoadUnsteady_Solution(geometry, solver, config, iZone, iInst, iter);
+      const auto state = GetPrimalState(solver[iZone][iInst], config[iZone]);
+      PrimalStore->Store(iter, vector<const su2activematrix*>(state.begin(), state.end()), true);
+    }
+    Checkpoints.push_back(base);
+  }
+
+  PrimalStore->SetWorkingRange(DirectIter - order, DirectIter);
+
+  /*--- Ensure the states of the current and of the previous time level sets are available,
+   *    each set is one state in the checkpointing sense (for 2nd order it spans two time steps). ---*/
+
+  for (auto target : {DirectIter, DirectIter - 1}) {
+
+    /*--- Checkpoints at or above the target are no longer needed to recompute states. ---*/
+    while (Checkpoints.size() > 1 && Checkpoints.back() >= target) PopCheckpoint(config[iZone]);
+
+    bool available = true;
+    for (auto iter = target - order + 1; iter <= target; ++iter)
+      available &= (iter < 0) || PrimalStore->Contains(iter);
+    if (available) continue;
+
+    long current = Checkpoints.back();
+
+    if (rank == MASTER_NODE)
+      cout << " Recomputing the primal solution from direct iteration " << current << " to " << target
+           << " for zone " << iZone << "." << endl;
+
+    SetPrimalTimeLevels(geometry, solver, config, iZone, iInst, current + 1, false);
+
+    while (current < target) {
+      const auto nFree = config[iZone]->GetUnst_Adj_nCheckpoints() + 1 - Checkpoints.size();
+      const auto next = current + static_cast<long>(CBinomialCheckpointing::Advance(target - current, nFree));
+
+      for (auto iter = current + 1; iter <= next; ++iter) {
+        AdvancePrimal(output, integration, geometry, solver, numerics, config, surface_movement, grid_movement,
+                      FFDBox, iZone, iInst, iter);
+      }
+      current = next;
+      if (current < target) PushCheckpoint(current, config[iZone]);
+    }
+
+    if (rank == MASTER_NODE)
+      cout << " Primal states in memory: " << PrimalStore->GetnStates() << " (" << Checkpoints.size() - 1
+           << " checkpoints), recomputed time steps: " << nRecomputedSteps << "." << endl;
+  }
+}
+
+void CDiscAdjFluidIteration::AdvancePrimal(COutput* output, CIntegration**** integration, CGeometry**** geometry,
+                                           CSolver***** solver, CNumerics****** numerics, CConfig** config,
+                                           CSurfaceMovement** surface_movement, CVolumetricMovement*** grid_movement,
+                                           CFreeFormDefBox*** FFDBox, unsigned short iZone, unsigned short iInst,
+                                           long DirectIter) {
+
+  const auto adjTimeIter = config[iZone]->GetTimeIter();
+  const auto adjInnerIter = config[iZone]->GetInnerIter();
+
+  /*--- Run the time step as the direct solver would, the tape is not recording at this point. ---*/
+
+  config[iZone]->SetTimeIter(DirectIter);
+  config[iZone]->SetPhysicalTime(static_cast<su2double>(DirectIter) * config[iZone]->GetDelta_UnstTimeND());
+
+  /*--- The convergence of the inner iterations is monitored by a (non-writing) direct output, such that
+   *    the criteria are the same as in the direct solver (CONV_FIELD, CONV_RESIDUAL_MINVAL, Cauchy, etc.). ---*/
+
+  if (!PrimalOutput) {
+    const auto kind = (config[iZone]->GetKind_Regime() == ENUM_REGIME::COMPRESSIBLE) ? MAIN_SOLVER::EULER
+                                                                                        : MAIN_SOLVER::INC_EULER;
+    PrimalOutput.reset(COutputFactory::CreateOutput(kind, config[iZone], geometry[iZone][iInst][MESH_0]->GetnDim()));
+    PrimalOutput->PreprocessHistoryOutput(config[iZone], false);
+  }
+
+  PrimalIteration->Preprocess(PrimalOutput.get(), integration, geometry, solver, numerics, config, surface_movement,
+                              grid_movement, FFDBox, iZone, iInst);
+
+  for (auto iInner = 0ul; iInner < config[iZone]->GetnInner_Iter(); iInner++) {
+    config[iZone]->SetInnerIter(iInner);
+
+    PrimalIteration->Iterate(PrimalOutput.get(), integration, geometry, solver, numerics, config, surface_movement,
+                             grid_movement, FFDBox, iZone, iInst);
+
+    if (PrimalIteration->Monitor(PrimalOutput.get(), integration, geometry, solver, numerics, config,
+                                 surface_movement, grid_movement, FFDBox, iZone, iInst)) break;
+  }
+
+  const auto state = GetPrimalState(solver[iZone][iInst], config[iZone]);
+  PrimalStore->Store(DirectIter, vector<const su2activematrix*>(state.begin(), state.end()));
+
+  /*--- Shift the time levels for the next time step. ---*/
+
+  PrimalIteration->Update(PrimalOutput.get(), integration, geometry, solver, numerics, config, surface_movement,
+                          grid_movement, FFDBox, iZone, iInst);
+
+  config[iZone]->SetTimeIter(adjTimeIter);
+  config[iZone]->SetInnerIter(adjInnerIter);
+  ++nRecomputedSteps;
+}
+
 void CDiscAdjFluidIteration::IterateDiscAdj(CGeometry**** geometry, CSolver***** solver, CConfig** config,
                                             unsigned short iZone, unsigned short iInst, bool CrossTerm) {
 
@@ -46,7 +46,13 @@ void CFEALinearElasticity::Compute_Tangent_Matrix(CElement *element, const CConf
 
   su2double Weight, Jac_X;
 
-  su2double AuxMatrix[3][6], *res_aux = new su2double[nVar];
+  su2double AuxMatrix[3][6], res_aux[MAXNDIM];
+
+  /*--- Rows of the B matrices that can be non-zero in each column (nDim per column),
+   *    skipping the structural zeros avoids most of the operations of the products. ---*/
+  const unsigned short nzRows2D[2][3] = {{0,2,0}, {1,2,0}};
+  const unsigned short nzRows3D[3][3] = {{0,3,4}, {1,3,5}, {2,4,5}};
+  const auto& nzRows = (nDim == 2) ? nzRows2D : nzRows3D;
 
   /*--- Set element properties and recompute the constitutive matrix, this is needed
         for multiple material cases and for correct differentiation ---*/
@@ -122,7 +128,8 @@ void CFEALinearElasticity::Compute_Tangent_Matrix(CElement *element, const CConf
       for (iVar = 0; iVar < nDim; iVar++) {
         for (jVar = 0; jVar < bDim; jVar++) {
           AuxMatrix[iVar][jVar] = 0.0;
-          for (kVar = 0; kVar < bDim; kVar++) {
+          for (iDim = 0; iDim < nDim; iDim++) {
+            kVar = nzRows[iVar][iDim];
             AuxMatrix[iVar][jVar] += Ba_Mat[kVar][iVar]*D_Mat[kVar][jVar];
           }
         }
@@ -151,7 +158,8 @@ void CFEALinearElasticity::Compute_Tangent_Matrix(CElement *element, const CConf
         for (iVar = 0; iVar < nDim; iVar++) {
           for (jVar = 0; jVar < nDim; jVar++) {
             KAux_ab[iVar][jVar] = 0.0;
-            for (kVar = 0; kVar < bDim; kVar++) {
+            for (iDim = 0; iDim < nDim; iDim++) {
+              kVar = nzRows[jVar][iDim];
               KAux_ab[iVar][jVar] += Weight * AuxMatrix[iVar][kVar] * Bb_Mat[kVar][jVar] * Jac_X;
             }
           }
@@ -189,8 +197,6 @@ void CFEALinearElasticity::Compute_Tangent_Matrix(CElement *element, const CConf
   /*--- Register the stress residual as preaccumulation output ---*/
   element->SetPreaccOut_Kt_a();
   AD::EndPreacc();
-
-  delete[] res_aux;
 }
 
 
@@ -69,6 +69,7 @@ CMultizoneOutput::CMultizoneOutput(const CConfig* driver_config, const CConfig*
 
   string hist_ext = ".csv";
   if (driver_config->GetTabular_FileFormat() == TAB_OUTPUT::TAB_TECPLOT) hist_ext = ".dat";
+  if (driver_config->GetHistory_FileFormat() == HISTORY_FORMAT::BINARY) hist_ext = ".bin";
 
   historyFilename += hist_ext;
 
@@ -29,6 +29,7 @@
 #include "../../include/solvers/CSolver.hpp"
 
 #include "../../include/output/COutput.hpp"
+#include "../../../Common/include/parallelization/omp_structure.hpp"
 #include "../../include/output/filewriter/CFVMDataSorter.hpp"
 #include "../../include/output/filewriter/CFEMDataSorter.hpp"
 #include "../../include/output/filewriter/CCGNSFileWriter.hpp"
@@ -77,6 +78,7 @@ COutput::COutput(const CConfig *config, unsigned short ndim, bool fem_output):
 
   string hist_ext = ".csv";
   if (config->GetTabular_FileFormat() == TAB_OUTPUT::TAB_TECPLOT) hist_ext = ".dat";
+  if (config->GetHistory_FileFormat() == HISTORY_FORMAT::BINARY) hist_ext = ".bin";
 
   /*--- Append the zone ID ---*/
 
@@ -110,6 +112,8 @@ COutput::COutput(const CConfig *config, unsigned short ndim, bool fem_output):
     requestedVolumeFields.push_back(config->GetVolumeOutput_Field(iField));
   }
 
+  volumeAvgStartIter = config->GetVolumeAvg_StartIter();
+
   /*--- Default is to write history to file and screen --- */
 
   noWriting = false;
@@ -160,6 +164,7 @@ COutput::COutput(const CConfig *config, unsigned short ndim, bool fem_output):
   convergence        = false;
 
   buildFieldIndexCache = false;
+  ResetFieldIndexCache();
 
   curInnerIter = 0;
   curOuterIter = 0;
@@ -170,6 +175,10 @@ COutput::COutput(const CConfig *config, unsigned short ndim, bool fem_output):
 
   headerNeeded = false;
 
+  /*--- Limit the number of snapshots written asynchronously at the same time. ---*/
+
+  if (config->GetWrt_Async()) CAsyncWriteQueue::GetInstance().SetMaxPending(config->GetWrt_Async_MaxPending());
+
 }
 
 COutput::~COutput(void) {
@@ -181,6 +190,10 @@ COutput::~COutput(void) {
   delete volumeDataSorter;
   delete surfaceDataSorter;
 
+  /*--- Make sure the asynchronous writes of this output finish while MPI is still initialized. ---*/
+
+  CFileWriter::FlushAsyncWrites();
+
 }
 
 void COutput::SetHistory_Output(CGeometry *geometry,
@@ -190,6 +203,8 @@ void COutput::SetHistory_Output(CGeometry *geometry,
                                   unsigned long OuterIter,
                                   unsigned long InnerIter) {
 
+  SU2_PROFILE_SCOPE("History_Output");
+
   curTimeIter  = TimeIter;
   curAbsTimeIter = TimeIter - config->GetRestart_Iter();
   curOuterIter = OuterIter;
@@ -344,6 +359,11 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
 
   string filename_iter, extension;
 
+  /*--- A format written before may have restricted the volume data to a box (in place), the data is
+   *    sorted again so that every format (including the surface ones) starts from all the points. ---*/
+
+  if (volumeDataSorter->GetRestrictedToBox()) volumeDataSorter->SortOutputData();
+
   /*--- Write files depending on the format --- */
 
   switch (format) {
@@ -459,6 +479,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
       /*--- Load and sort the output data and connectivity. ---*/
 
       volumeDataSorter->SortConnectivity(config, geometry, false);
+      if (config->GetVolumeOutput_Box()) volumeDataSorter->RestrictToBox(config->GetVolumeOutput_BoxBounds());
 
       /*--- Write tecplot binary ---*/
       if (rank == MASTER_NODE) {
@@ -486,6 +507,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
       /*--- Load and sort the output data and connectivity. ---*/
 
       volumeDataSorter->SortConnectivity(config, geometry, true);
+      if (config->GetVolumeOutput_Box()) volumeDataSorter->RestrictToBox(config->GetVolumeOutput_BoxBounds());
 
       /*--- Write tecplot ascii ---*/
       if (rank == MASTER_NODE) {
@@ -513,6 +535,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
       /*--- Load and sort the output data and connectivity. ---*/
 
       volumeDataSorter->SortConnectivity(config, geometry, true);
+      if (config->GetVolumeOutput_Box()) volumeDataSorter->RestrictToBox(config->GetVolumeOutput_BoxBounds());
 
       /*--- Write paraview binary ---*/
       if (rank == MASTER_NODE) {
@@ -539,6 +562,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
       /*--- Load and sort the output data and connectivity. ---*/
 
       volumeDataSorter->SortConnectivity(config, geometry, true);
+      if (config->GetVolumeOutput_Box()) volumeDataSorter->RestrictToBox(config->GetVolumeOutput_BoxBounds());
 
       /*--- Write paraview binary ---*/
       if (rank == MASTER_NODE) {
@@ -583,6 +607,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
         /*--- We cast the pointer to its true type, to avoid virtual functions ---*/
 
         CParaviewVTMFileWriter* vtmWriter = dynamic_cast<CParaviewVTMFileWriter*>(fileWriter);
+        vtmWriter->SetAsyncWrite(config->GetWrt_Async());
 
         /*--- then we write the data into the folder---*/
         vtmWriter->WriteFolderData(fileName, config, multiZoneHeaderString, volumeDataSorter,surfaceDataSorter, geometry);
@@ -609,6 +634,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
       /*--- Load and sort the output data and connectivity. ---*/
 
       volumeDataSorter->SortConnectivity(config, geometry, true);
+      if (config->GetVolumeOutput_Box()) volumeDataSorter->RestrictToBox(config->GetVolumeOutput_BoxBounds());
 
       /*--- Write paraview ascii ---*/
       if (rank == MASTER_NODE) {
@@ -808,6 +834,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
 
       /*--- Load and sort the output data and connectivity. ---*/
       volumeDataSorter->SortConnectivity(config, geometry, true);
+      if (config->GetVolumeOutput_Box()) volumeDataSorter->RestrictToBox(config->GetVolumeOutput_BoxBounds());
 
       /*--- Write CGNS ---*/
       if (rank == MASTER_NODE) {
@@ -856,6 +883,15 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
 
   if (fileWriter != nullptr){
 
+    /*--- Writers based on MPI-IO can record the data and leave the writing to a background thread. ---*/
+
+    fileWriter->SetAsyncWrite(config->GetWrt_Async());
+
+    if (auto* xmlWriter = dynamic_cast<CParaviewXMLFileWriter*>(fileWriter)) {
+      xmlWriter->SetCompression(config->GetKind_Output_Compression(), config->GetOutput_QuantizedFields(),
+                                config->GetOutput_QuantizationBits());
+    }
+
     /*--- Write data to file ---*/
 
     fileWriter->Write_Data(fileName);
@@ -881,7 +917,8 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
 
     if (config->GetWrt_Performance() && (rank == MASTER_NODE)){
       fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::RIGHT);
-      (*fileWritingTable) << " " << "(" + PrintingToolbox::to_string(BandWidth) + " MB/s)";
+      if (fileWriter->Get_AsyncSubmitted()) (*fileWritingTable) << " " << "(async)";
+      else (*fileWritingTable) << " " << "(" + PrintingToolbox::to_string(BandWidth) + " MB/s)";
       fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::LEFT);
     }
 
@@ -906,7 +943,9 @@ bool COutput::GetCauchyCorrectedTimeConvergence(const CConfig *config){
 bool COutput::SetResult_Files(CGeometry *geometry, CConfig *config, CSolver** solver_container,
                               unsigned long iter, bool force_writing) {
 
-  bool isFileWrite = false, dataIsLoaded = false;
+  SU2_PROFILE_SCOPE("Result_Files");
+
+  bool isFileWrite = false, dataIsLoaded = false, dataIsSorted = false;
   const auto nVolumeFiles = config->GetnVolumeOutputFiles();
   const auto* VolumeFiles = config->GetVolumeOutputFiles();
 
@@ -926,9 +965,12 @@ bool COutput::SetResult_Files(CGeometry *geometry, CConfig *config, CSolver** so
     }
     if (!write_file) continue;
 
-    /*--- Partition and sort the data --- */
+    /*--- Partition and sort the data, once for all the files (see WriteToFile for the box restriction). --- */
 
-    volumeDataSorter->SortOutputData();
+    if (!dataIsSorted) {
+      volumeDataSorter->SortOutputData();
+      dataIsSorted = true;
+    }
 
     if (rank == MASTER_NODE && !isFileWrite) {
       fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::CENTER);
@@ -1146,41 +1188,39 @@ bool COutput::MonitorTimeConvergence(CConfig *config, unsigned long TimeIteratio
   return TimeConvergence;
 }
 
-void COutput::SetHistoryFile_Header(const CConfig *config) {
+std::vector<const COutput::HistoryOutputField*> COutput::GetHistoryFileFields() const {
 
-  unsigned short iField_Output = 0,
-      iReqField = 0,
-      iMarker = 0;
-  stringstream out;
-  int width = 20;
-
-  for (iField_Output = 0; iField_Output < historyOutput_List.size(); iField_Output++){
-    const string &fieldIdentifier = historyOutput_List[iField_Output];
-    const HistoryOutputField &field = historyOutput_Map.at(fieldIdentifier);
-    for (iReqField = 0; iReqField < nRequestedHistoryFields; iReqField++){
-      const string & requestedField = requestedHistoryFields[iReqField];
-      if (requestedField == field.outputGroup || (requestedField == fieldIdentifier)){
-        if (field.screenFormat == ScreenOutputFormat::INTEGER) width = std::max((int)field.fieldName.size()+2, 10);
-        else{ width = std::max((int)field.fieldName.size()+2, 18);}
-        historyFileTable->AddColumn("\"" + field.fieldName + "\"", width);
+  std::vector<const HistoryOutputField*> fields;
+
+  for (const auto& fieldIdentifier : historyOutput_List){
+    const auto& field = historyOutput_Map.at(fieldIdentifier);
+    for (const auto& requestedField : requestedHistoryFields) {
+      if ((requestedField == field.outputGroup) || (requestedField == fieldIdentifier)) {
+        fields.push_back(&field);
       }
     }
   }
 
-  for (iField_Output = 0; iField_Output < historyOutputPerSurface_List.size(); iField_Output++){
-    const string &fieldIdentifier = historyOutputPerSurface_List[iField_Output];
-    for (iMarker = 0; iMarker < historyOutputPerSurface_Map[fieldIdentifier].size(); iMarker++){
-      const HistoryOutputField &field = historyOutputPerSurface_Map.at(fieldIdentifier)[iMarker];
-      for (iReqField = 0; iReqField < nRequestedHistoryFields; iReqField++){
-        const string &requestedField = requestedHistoryFields[iReqField];
-        if (requestedField == field.outputGroup || (requestedField == fieldIdentifier)){
-          if (field.screenFormat == ScreenOutputFormat::INTEGER) width = std::max((int)field.fieldName.size()+2, 10);
-          else{ width = std::max((int)field.fieldName.size()+2, 18);}
-          historyFileTable->AddColumn("\"" + field.fieldName + "\"", width);
+  for (const auto& fieldIdentifier : historyOutputPerSurface_List) {
+    for (const auto& field : historyOutputPerSurface_Map.at(fieldIdentifier)) {
+      for (const auto& requestedField : requestedHistoryFields){
+        if ((requestedField == field.outputGroup) || (requestedField == fieldIdentifier)) {
+          fields.push_back(&field);
         }
       }
     }
   }
+  return fields;
+}
+
+void COutput::SetHistoryFile_Header(const CConfig *config) {
+
+  for (const auto* field : GetHistoryFileFields()) {
+    int width = 0;
+    if (field->screenFormat == ScreenOutputFormat::INTEGER) width = std::max((int)field->fieldName.size()+2, 10);
+    else{ width = std::max((int)field->fieldName.size()+2, 18);}
+    historyFileTable->AddColumn("\"" + field->fieldName + "\"", width);
+  }
 
   if (config->GetTabular_FileFormat() == TAB_OUTPUT::TAB_TECPLOT) {
     histFile << "VARIABLES = \\" << endl;
@@ -1193,33 +1233,26 @@ void COutput::SetHistoryFile_Header(const CConfig *config) {
 void COutput::SetHistoryFile_Output(const CConfig *config) {
 
   if (requestedHistoryFieldCache.empty()) {
-    for (const auto& fieldIdentifier : historyOutput_List){
-      const auto& field = historyOutput_Map.at(fieldIdentifier);
-      for (const auto& requestedField : requestedHistoryFields) {
-        if ((requestedField == field.outputGroup) || (requestedField == fieldIdentifier)) {
-          requestedHistoryFieldCache.push_back(&field.value);
-        }
-      }
+    for (const auto* field : GetHistoryFileFields()) {
+      requestedHistoryFieldCache.push_back(&field->value);
     }
+  }
 
-    for (const auto& fieldIdentifier : historyOutputPerSurface_List) {
-      for (const auto& field : historyOutputPerSurface_Map.at(fieldIdentifier)) {
-        for (const auto& requestedField : requestedHistoryFields){
-          if ((requestedField == field.outputGroup) || (requestedField == fieldIdentifier)) {
-            requestedHistoryFieldCache.push_back(&field.value);
-          }
-        }
-      }
-    }
+  /*--- The binary file stores the values as they are, and is flushed by the writer. ---*/
+
+  if (config->GetHistory_FileFormat() == HISTORY_FORMAT::BINARY) {
+    binaryHistoryFile.AddLine(requestedHistoryFieldCache);
+    return;
   }
 
   for (const auto* valPtr : requestedHistoryFieldCache) {
     (*historyFileTable) << *valPtr;
   }
 
-  /*--- Print the string to file and remove the last two characters (a separator and a space) ---*/
-
-  histFile.flush();
+  if (++historyLinesSinceFlush >= config->GetHistory_Flush_Iter()) {
+    histFile.flush();
+    historyLinesSinceFlush = 0;
+  }
 }
 
 void COutput::SetScreen_Header(const CConfig *config) {
@@ -1369,6 +1402,15 @@ void COutput::PreprocessMultizoneHistoryOutput(COutput **output, CConfig **confi
 
 void COutput::PrepareHistoryFile(CConfig *config){
 
+  /*--- The binary history has no text table. ---*/
+
+  if (config->GetHistory_FileFormat() == HISTORY_FORMAT::BINARY) {
+    std::vector<std::string> names;
+    for (const auto* field : GetHistoryFileFields()) names.push_back(field->fieldName);
+    binaryHistoryFile.Open(historyFilename, names, config->GetHistory_Flush_Iter());
+    return;
+  }
+
   /*--- Open the history file ---*/
 
   histFile.open(historyFilename, ios::out);
@@ -1671,6 +1713,16 @@ void COutput::PreprocessVolumeOutput(CConfig *config){
 
   nRequestedVolumeFields = requestedVolumeFields.size();
 
+  /*--- Quantized fields are matched by the name of the array in the file, i.e. without the "_x" of vectors. ---*/
+
+  for (const auto& quantizedField : config->GetOutput_QuantizedFields()) {
+    if (std::find(volumeFieldNames.begin(), volumeFieldNames.end(), quantizedField) == volumeFieldNames.end() &&
+        std::find(volumeFieldNames.begin(), volumeFieldNames.end(), quantizedField + "_x") == volumeFieldNames.end()) {
+      SU2_MPI::Error("OUTPUT_QUANTIZED_FIELDS: " + quantizedField + " is not one of the volume output fields.",
+                     CURRENT_FUNCTION);
+    }
+  }
+
   if (rank == MASTER_NODE){
     cout <<"Volume output fields: ";
     for (unsigned short iReqField = 0; iReqField < nRequestedVolumeFields; iReqField++){
@@ -1689,10 +1741,7 @@ void COutput::LoadDataIntoSorter(CConfig* config, CGeometry* geometry, CSolver**
   unsigned long iVertex = 0;
 
   /*--- Reset the offset cache and index --- */
-  cachePosition = 0;
-  fieldIndexCache.clear();
-  curGetFieldIndex = 0;
-  fieldGetIndexCache.clear();
+  ResetFieldIndexCache();
 
   if (femOutput){
 
@@ -1722,21 +1771,34 @@ void COutput::LoadDataIntoSorter(CConfig* config, CGeometry* geometry, CSolver**
 
   } else {
 
-    for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
+    const unsigned long nPointDomain = geometry->GetnPointDomain();
 
-      /*--- Load the volume data into the data sorter. --- */
+    /*--- The first point builds the offset cache (and triggers any lazy initialization
+     *    of the data used by the output fields), then the other points only use the cache,
+     *    which allows loading them in parallel if the child class supports it. ---*/
+
+    if (nPointDomain > 0) {
+      buildFieldIndexCache = true;
+      LoadVolumeData(config, geometry, solver, 0);
+      buildFieldIndexCache = false;
+    }
 
-      buildFieldIndexCache = fieldIndexCache.empty();
+    SU2_OMP_PARALLEL_(if(GetHasThreadedVolumeLoad() && !AD::TapeActive()))
+    {
+      SU2_OMP_FOR_STAT(OMP_VOLUME_LOAD_CHUNK)
+      for (iPoint = 1; iPoint < nPointDomain; iPoint++) {
 
-      LoadVolumeData(config, geometry, solver, iPoint);
+        /*--- Load the volume data into the data sorter. --- */
 
+        LoadVolumeData(config, geometry, solver, iPoint);
+
+      }
+      END_SU2_OMP_FOR
     }
+    END_SU2_OMP_PARALLEL
 
     /*--- Reset the offset cache and index --- */
-    cachePosition = 0;
-    fieldIndexCache.clear();
-    curGetFieldIndex = 0;
-    fieldGetIndexCache.clear();
+    ResetFieldIndexCache();
 
     for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
 
@@ -1762,7 +1824,13 @@ void COutput::LoadDataIntoSorter(CConfig* config, CGeometry* geometry, CSolver**
   }
 }
 
-void COutput::SetVolumeOutputValue(string name, unsigned long iPoint, su2double value){
+void COutput::ResetFieldIndexCache() {
+  fieldIndexCache.clear();
+  fieldGetIndexCache.clear();
+  cacheCursors.assign(omp_get_max_threads(), CacheCursor());
+}
+
+short COutput::GetFieldIndex(const char* name, std::vector<short>& indexCache, unsigned short& position) const {
 
   if (buildFieldIndexCache){
 
@@ -1770,104 +1838,57 @@ void COutput::SetVolumeOutputValue(string name, unsigned long iPoint, su2double
      * calls of this routine since the order of calls is
      * the same for every value of iPoint --- */
 
-    if (volumeOutput_Map.count(name) > 0){
-      const short Offset = volumeOutput_Map.at(name).offset;
-      fieldIndexCache.push_back(Offset);
-      if (Offset != -1){
-        volumeDataSorter->SetUnsorted_Data(iPoint, Offset, value);
-      }
-    } else {
+    const auto it = volumeOutput_Map.find(name);
+    if (it == volumeOutput_Map.end()) {
       SU2_MPI::Error(string("Cannot find output field with name ") + name, CURRENT_FUNCTION);
     }
-  } else {
+    indexCache.push_back(it->second.offset);
+    return it->second.offset;
+  }
 
-    /*--- Use the offset cache for the access ---*/
+  /*--- Use the offset cache for the access ---*/
 
-    const short Offset = fieldIndexCache[cachePosition++];
-    if (Offset != -1){
-      volumeDataSorter->SetUnsorted_Data(iPoint, Offset, value);
-    }
-    if (cachePosition == fieldIndexCache.size()){
-      cachePosition = 0;
-    }
+  const short Offset = indexCache[position++];
+  if (position == indexCache.size()){
+    position = 0;
   }
-
+  return Offset;
 }
 
-su2double COutput::GetVolumeOutputValue(string name, unsigned long iPoint){
-
-  if (buildFieldIndexCache){
-
-    /*--- Build up the offset cache to speed up subsequent
-     * calls of this routine since the order of calls is
-     * the same for every value of iPoint --- */
-
-    if (volumeOutput_Map.count(name) > 0){
-      const short Offset = volumeOutput_Map.at(name).offset;
-      fieldGetIndexCache.push_back(Offset);
-      if (Offset != -1){
-        return volumeDataSorter->GetUnsorted_Data(iPoint, Offset);
-      }
-    } else {
-      SU2_MPI::Error(string("Cannot find output field with name ") + name, CURRENT_FUNCTION);
-    }
-  } else {
+void COutput::SetVolumeOutputValue(const char* name, unsigned long iPoint, su2double value){
 
-    /*--- Use the offset cache for the access ---*/
+  const short Offset = GetFieldIndex(name, fieldIndexCache, cacheCursors[omp_get_thread_num()].set);
+  if (Offset != -1){
+    volumeDataSorter->SetUnsorted_Data(iPoint, Offset, value);
+  }
+}
 
-    const short Offset = fieldGetIndexCache[curGetFieldIndex++];
+su2double COutput::GetVolumeOutputValue(const char* name, unsigned long iPoint){
 
-    if (curGetFieldIndex == fieldGetIndexCache.size()){
-      curGetFieldIndex = 0;
-    }
-    if (Offset != -1){
-      return volumeDataSorter->GetUnsorted_Data(iPoint, Offset);
-    }
+  const short Offset = GetFieldIndex(name, fieldGetIndexCache, cacheCursors[omp_get_thread_num()].get);
+  if (Offset != -1){
+    return volumeDataSorter->GetUnsorted_Data(iPoint, Offset);
   }
-
   return 0.0;
 }
 
-void COutput::SetAvgVolumeOutputValue(string name, unsigned long iPoint, su2double value){
-
-  const su2double scaling = 1.0 / su2double(curAbsTimeIter + 1);
-
-  if (buildFieldIndexCache){
-
-    /*--- Build up the offset cache to speed up subsequent
-     * calls of this routine since the order of calls is
-     * the same for every value of iPoint --- */
-
-    if (volumeOutput_Map.count(name) > 0){
-      const short Offset = volumeOutput_Map.at(name).offset;
-      fieldIndexCache.push_back(Offset);
-      if (Offset != -1){
+void COutput::SetAvgVolumeOutputValue(const char* name, unsigned long iPoint, su2double value){
 
-        const su2double old_value = volumeDataSorter->GetUnsorted_Data(iPoint, Offset);
-        const su2double new_value = value * scaling + old_value *( 1.0 - scaling);
+  /*--- Running average since the restart or VOLUME_AVERAGE_START_ITER (whichever is later),
+   *    before the start the fields hold the instantaneous values. ---*/
+  const unsigned long nSample = (curTimeIter < volumeAvgStartIter)? 0 :
+                                min(curAbsTimeIter, curTimeIter - volumeAvgStartIter);
 
-        volumeDataSorter->SetUnsorted_Data(iPoint, Offset, new_value);
-      }
-    } else {
-      SU2_MPI::Error(string("Cannot find output field with name ") + name, CURRENT_FUNCTION);
-    }
-  } else {
-
-    /*--- Use the offset cache for the access ---*/
+  const su2double scaling = 1.0 / su2double(nSample + 1);
 
-    const short Offset = fieldIndexCache[cachePosition++];
-    if (Offset != -1){
+  const short Offset = GetFieldIndex(name, fieldIndexCache, cacheCursors[omp_get_thread_num()].set);
+  if (Offset != -1){
 
-      const su2double old_value = volumeDataSorter->GetUnsorted_Data(iPoint, Offset);
-      const su2double new_value = value * scaling + old_value *( 1.0 - scaling);
+    const su2double old_value = volumeDataSorter->GetUnsorted_Data(iPoint, Offset);
+    const su2double new_value = value * scaling + old_value *( 1.0 - scaling);
 
-      volumeDataSorter->SetUnsorted_Data(iPoint, Offset, new_value);
-    }
-    if (cachePosition == fieldIndexCache.size()){
-      cachePosition = 0;
-    }
+    volumeDataSorter->SetUnsorted_Data(iPoint, Offset, new_value);
   }
-
 }
 
 void COutput::Postprocess_HistoryData(CConfig *config){
@@ -0,0 +1,155 @@
+/*!
+ * \file CAsyncWriteQueue.cpp
+ * \brief Queue of snapshots written to file on a background thread.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/filewriter/CAsyncWriteQueue.hpp"
+#include "../../../../Common/include/parallelization/mpi_structure.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <fcntl.h>
+#include <unistd.h>
+
+void CAsyncWriteQueue::Job::AddPiece(unsigned long offset, const void* data, unsigned long sizeInBytes) {
+  if (sizeInBytes == 0) return;
+  pieces.emplace_back();
+  pieces.back().offset = offset;
+  pieces.back().bytes.resize(sizeInBytes);
+  memcpy(pieces.back().bytes.data(), data, sizeInBytes);
+}
+
+CAsyncWriteQueue& CAsyncWriteQueue::GetInstance() {
+  static CAsyncWriteQueue queue;
+  return queue;
+}
+
+CAsyncWriteQueue::~CAsyncWriteQueue() {
+  {
+    std::unique_lock<std::mutex> lock(mtx);
+    cond.wait(lock, [this]() { return jobs.empty(); });
+    stop = true;
+  }
+  cond.notify_all();
+  if (worker.joinable()) worker.join();
+
+  /*--- MPI may be finalized by now, the error can only be printed. ---*/
+  if (!error.empty()) std::cerr << error << std::endl;
+}
+
+void CAsyncWriteQueue::SetMaxPending(unsigned long val) {
+  std::lock_guard<std::mutex> lock(mtx);
+  maxPending = std::max(val, 1ul);
+}
+
+std::string CAsyncWriteQueue::TakeError() {
+  std::string msg;
+  msg.swap(error);
+  return msg;
+}
+
+void CAsyncWriteQueue::Submit(Job&& job) {
+  std::string msg;
+  {
+    std::unique_lock<std::mutex> lock(mtx);
+    cond.wait(lock, [this]() { return jobs.size() < maxPending; });
+    msg = TakeError();
+
+    if (msg.empty()) {
+      if (!worker.joinable()) worker = std::thread(&CAsyncWriteQueue::Run, this);
+      jobs.push_back(std::move(job));
+    }
+  }
+  /*--- The error exit runs the destructor of the queue, which needs the lock. ---*/
+  if (!msg.empty()) SU2_MPI::Error(msg, CURRENT_FUNCTION);
+
+  cond.notify_all();
+}
+
+void CAsyncWriteQueue::Flush() {
+  std::string msg;
+  {
+    std::unique_lock<std::mutex> lock(mtx);
+    cond.wait(lock, [this]() { return jobs.empty(); });
+    msg = TakeError();
+  }
+  if (!msg.empty()) SU2_MPI::Error(msg, CURRENT_FUNCTION);
+}
+
+void CAsyncWriteQueue::Run() {
+  std::unique_lock<std::mutex> lock(mtx);
+
+  while (true) {
+    cond.wait(lock, [this]() { return stop || !jobs.empty(); });
+    if (jobs.empty()) return;
+
+    /*--- The front job stays in the queue while it is written, so that it counts
+     *    towards the pending jobs, references to deque elements are not invalidated
+     *    by the main thread pushing to the back. ---*/
+    const auto& job = jobs.front();
+    lock.unlock();
+    const auto msg = Write(job);
+    lock.lock();
+
+    if (error.empty()) error = msg;
+    jobs.pop_front();
+    cond.notify_all();
+  }
+}
+
+std::string CAsyncWriteQueue::Write(const Job& job) {
+  /*--- The file is not truncated on open, other ranks may be writing their pieces already. ---*/
+  const int fd = open(job.fileName.c_str(), O_WRONLY | O_CREAT, 0644);
+  if (fd < 0) return "Unable to open file " + job.fileName;
+
+  std::string msg;
+
+  for (const auto& piece : job.pieces) {
+    const char* ptr = piece.bytes.data();
+    size_t remaining = piece.bytes.size();
+    auto pos = static_cast<off_t>(piece.offset);
+
+    while (remaining > 0 && msg.empty()) {
+      const auto written = pwrite(fd, ptr, remaining, pos);
+      if (written < 0) {
+        if (errno != EINTR) msg = "Unable to write file " + job.fileName + ": " + strerror(errno);
+        continue;
+      }
+      ptr += written;
+      pos += written;
+      remaining -= written;
+    }
+    if (!msg.empty()) break;
+  }
+
+  /*--- Remove the tail of a previous (larger) file with the same name. ---*/
+  if (msg.empty() && job.setSize && ftruncate(fd, static_cast<off_t>(job.fileSize)) != 0) {
+    msg = "Unable to set the size of file " + job.fileName;
+  }
+  if (close(fd) != 0 && msg.empty()) msg = "Unable to close file " + job.fileName;
+
+  return msg;
+}
@@ -71,7 +71,11 @@ void CCGNSFileWriter::Write_Data(string val_filename) {
   }
 
   /*--- Close the CGNS file. ---*/
+#ifdef HAVE_PCGNS
+  CallCGNS(cgp_close(cgnsFileID));
+#else
   if (rank == MASTER_NODE) CallCGNS(cg_close(cgnsFileID));
+#endif
 
 #endif
 }
@@ -91,25 +95,33 @@ void CCGNSFileWriter::InitializeMeshFile(string val_filename) {
   /*--- If surface file cell dimension is decreased. ---*/
   const auto nCell = static_cast<int>(nDim - isSurface);
 
-  if (rank == MASTER_NODE) {
-    /*--- Remove the previous file if present. ---*/
-    remove(val_filename.c_str());
+#ifdef HAVE_PCGNS
+  /*--- All ranks open the file (truncating it) and write the same metadata, the data
+   *    is then written collectively. ---*/
+  CallCGNS(cgp_mpi_comm(SU2_MPI::GetComm()));
+  CallCGNS(cgp_pio_mode(CGP_COLLECTIVE));
+  CallCGNS(cgp_open(val_filename.c_str(), CG_MODE_WRITE, &cgnsFileID));
+#else
+  if (rank != MASTER_NODE) return;
 
-    /*--- Create CGNS file and open in write mode. ---*/
-    CallCGNS(cg_open(val_filename.c_str(), CG_MODE_WRITE, &cgnsFileID));
+  /*--- Remove the previous file if present. ---*/
+  remove(val_filename.c_str());
 
-    /*--- Create Base. ---*/
-    CallCGNS(cg_base_write(cgnsFileID, "Base", nCell, nDim, &cgnsBase));
+  /*--- Create CGNS file and open in write mode. ---*/
+  CallCGNS(cg_open(val_filename.c_str(), CG_MODE_WRITE, &cgnsFileID));
+#endif
 
-    /*--- Create Zone. ---*/
-    array<cgsize_t, 3> zoneData;
+  /*--- Create Base. ---*/
+  CallCGNS(cg_base_write(cgnsFileID, "Base", nCell, nDim, &cgnsBase));
 
-    zoneData[0] = GlobalPoint;
-    zoneData[1] = GlobalElem;
-    zoneData[2] = 0;
+  /*--- Create Zone. ---*/
+  array<cgsize_t, 3> zoneData;
 
-    CallCGNS(cg_zone_write(cgnsFileID, cgnsBase, "Zone", zoneData.data(), Unstructured, &cgnsZone));
-  }
+  zoneData[0] = GlobalPoint;
+  zoneData[1] = GlobalElem;
+  zoneData[2] = 0;
+
+  CallCGNS(cg_zone_write(cgnsFileID, cgnsBase, "Zone", zoneData.data(), Unstructured, &cgnsZone));
 }
 
 void CCGNSFileWriter::WriteField(int iField, const string& FieldName) {
@@ -123,6 +135,27 @@ void CCGNSFileWriter::WriteField(int iField, const string& FieldName) {
     sendBufferField[iPoint] = static_cast<dataPrecision>(dataSorter->GetData(iField, iPoint));
   }
 
+#ifdef HAVE_PCGNS
+  {
+    /*--- Each rank writes its range of the sorted points, ranks without points take part with no data. ---*/
+    cgsize_t nodeBegin = static_cast<cgsize_t>(dataSorter->GetnPointCumulative(rank) + 1);
+    cgsize_t nodeEnd = nodeBegin + static_cast<cgsize_t>(nLocalPoints) - 1;
+    const void* data = (nLocalPoints > 0) ? sendBufferField.data() : nullptr;
+
+    if (isCoord) {
+      int CoordinateNumber;
+      CallCGNS(cgp_coord_write(cgnsFileID, cgnsBase, cgnsZone, dataType, FieldName.c_str(), &CoordinateNumber));
+      CallCGNS(cgp_coord_write_data(cgnsFileID, cgnsBase, cgnsZone, CoordinateNumber, &nodeBegin, &nodeEnd, data));
+    } else {
+      int fieldNumber;
+      CallCGNS(cgp_field_write(cgnsFileID, cgnsBase, cgnsZone, cgnsFields, dataType, FieldName.c_str(), &fieldNumber));
+      CallCGNS(cgp_field_write_data(cgnsFileID, cgnsBase, cgnsZone, cgnsFields, fieldNumber, &nodeBegin, &nodeEnd,
+                                    data));
+    }
+    return;
+  }
+#endif
+
   if (rank != MASTER_NODE) {
     SU2_MPI::Send(sendBufferField.data(), nLocalPoints * sizeof(dataPrecision), MPI_CHAR, MASTER_NODE, 0,
                   SU2_MPI::GetComm());
@@ -178,20 +211,18 @@ void CCGNSFileWriter::WriteConnectivity(GEO_TYPE type, const string& SectionName
   cgsize_t endElem = cumulative + static_cast<cgsize_t>(nTotElem);
 
   int cgnsSection;
+#ifdef HAVE_PCGNS
+  CallCGNS(cgp_section_write(cgnsFileID, cgnsBase, cgnsZone, SectionName.c_str(), elementType, firstElem, endElem, 0,
+                             &cgnsSection));
+#else
   if (rank == MASTER_NODE)
     CallCGNS(cg_section_partial_write(cgnsFileID, cgnsBase, cgnsZone, SectionName.c_str(), elementType, firstElem,
                                       endElem, 0, &cgnsSection));
+#endif
 
   /*--- Retrieve element distribution among processes. ---*/
   const auto nLocalElem = dataSorter->GetnElem(type);
 
-  vector<unsigned long> distElem(size);
-
-  SU2_MPI::Allgather(&nLocalElem, 1, MPI_UNSIGNED_LONG, distElem.data(), 1, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
-
-  firstElem = cumulative + 1;
-  endElem = cumulative + static_cast<cgsize_t>(distElem[rank]);
-
   /*--- Connectivity is stored in send buffer. ---*/
   const auto nPointsElem = nPointsOfElementType(type);
   sendBufferConnectivity.resize(nLocalElem * nPointsElem);
@@ -203,6 +234,31 @@ void CCGNSFileWriter::WriteConnectivity(GEO_TYPE type, const string& SectionName
     }
   }
 
+#ifdef HAVE_PCGNS
+  {
+    /*--- Only the offset of this rank in the section is needed, the elements are written collectively. ---*/
+    unsigned long offset = 0;
+    SU2_MPI::Exscan(&nLocalElem, &offset, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+    if (rank == MASTER_NODE) offset = 0;
+
+    firstElem = cumulative + 1 + static_cast<cgsize_t>(offset);
+    endElem = firstElem + static_cast<cgsize_t>(nLocalElem) - 1;
+    const cgsize_t* data = (nLocalElem > 0) ? sendBufferConnectivity.data() : nullptr;
+
+    CallCGNS(cgp_elements_write_data(cgnsFileID, cgnsBase, cgnsZone, cgnsSection, firstElem, endElem, data));
+
+    cumulative += static_cast<cgsize_t>(nTotElem);
+    return;
+  }
+#endif
+
+  vector<unsigned long> distElem(size);
+
+  SU2_MPI::Allgather(&nLocalElem, 1, MPI_UNSIGNED_LONG, distElem.data(), 1, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+  firstElem = cumulative + 1;
+  endElem = cumulative + static_cast<cgsize_t>(distElem[rank]);
+
   const auto bufferSize = static_cast<int>(nLocalElem * nPointsElem * sizeof(cgsize_t));
   if (rank != MASTER_NODE) {
     SU2_MPI::Send(sendBufferConnectivity.data(), bufferSize, MPI_CHAR, MASTER_NODE, 1, SU2_MPI::GetComm());
@@ -234,6 +290,10 @@ void CCGNSFileWriter::WriteConnectivity(GEO_TYPE type, const string& SectionName
 
 void CCGNSFileWriter::InitializeFields() {
   /*--- Create "Fields" node to store solution. ---*/
+#ifdef HAVE_PCGNS
+  CallCGNS(cg_sol_write(cgnsFileID, cgnsBase, cgnsZone, "Fields", Vertex, &cgnsFields));
+#else
   if (rank == MASTER_NODE) CallCGNS(cg_sol_write(cgnsFileID, cgnsBase, cgnsZone, "Fields", Vertex, &cgnsFields));
+#endif
 }
 #endif  // HAVE_CGNS
@@ -26,7 +26,9 @@
  */
 
 #include "../../../include/output/filewriter/CParallelDataSorter.hpp"
+#include <algorithm>
 #include <cassert>
+#include <functional>
 #include <numeric>
 
 CParallelDataSorter::CParallelDataSorter(CConfig *config, const vector<string> &valFieldNames) :
@@ -96,6 +98,10 @@ void CParallelDataSorter::SortOutputData() {
 
   const int VARS_PER_POINT = GlobalField_Counter;
 
+  /*--- The data is re-sorted from scratch, any restriction to a box is lost. ---*/
+
+  subVolumeCumulative.clear();
+
   /*--- Allocate the memory that we need for receiving the conn
    values and then cue up the non-blocking receives. Note that
    we do not include our own rank in the communications. We will
@@ -330,6 +336,111 @@ void CParallelDataSorter::PrepareSendBuffers(std::vector<unsigned long>& globalI
 
 }
 
+void CParallelDataSorter::RestrictToBox(const su2double* bounds) {
+
+  const int VARS_PER_POINT = GlobalField_Counter;
+
+  /*--- Select and compact the points, unless that was done since the last sort. ---*/
+
+  if (subVolumeCumulative.empty()) {
+
+    subVolumeID.assign(nPoints, 0);
+    unsigned long nKeep = 0;
+
+    for (unsigned long iPoint = 0; iPoint < nPoints; iPoint++) {
+      bool inside = true;
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+        const passivedouble coord = dataBuffer[iPoint*VARS_PER_POINT + iDim];
+        inside &= (coord >= SU2_TYPE::GetValue(bounds[2*iDim])) && (coord <= SU2_TYPE::GetValue(bounds[2*iDim+1]));
+      }
+      if (!inside) continue;
+
+      for (int iField = 0; iField < VARS_PER_POINT; iField++)
+        dataBuffer[nKeep*VARS_PER_POINT + iField] = dataBuffer[iPoint*VARS_PER_POINT + iField];
+      subVolumeID[iPoint] = ++nKeep;
+    }
+
+    vector<unsigned long> nKeepRank(size);
+    SU2_MPI::Allgather(&nKeep, 1, MPI_UNSIGNED_LONG, nKeepRank.data(), 1, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+    subVolumeCumulative.assign(size+1, 0);
+    for (int ii = 0; ii < size; ii++) subVolumeCumulative[ii+1] = subVolumeCumulative[ii] + nKeepRank[ii];
+
+    for (auto& id : subVolumeID) if (id != 0) id += subVolumeCumulative[rank];
+
+    nPoints = nKeep;
+    nPointsGlobal = subVolumeCumulative[size];
+  }
+
+  /*--- The connectivity refers to the global IDs of the full (linear) partition, the new IDs
+   *    are requested from the ranks that own the points. ---*/
+
+  struct ElemTypeInfo { GEO_TYPE type; int* conn; unsigned short nNodes; };
+  const ElemTypeInfo elemTypes[] = {
+    {LINE, Conn_Line_Par, N_POINTS_LINE}, {TRIANGLE, Conn_Tria_Par, N_POINTS_TRIANGLE},
+    {QUADRILATERAL, Conn_Quad_Par, N_POINTS_QUADRILATERAL}, {TETRAHEDRON, Conn_Tetr_Par, N_POINTS_TETRAHEDRON},
+    {HEXAHEDRON, Conn_Hexa_Par, N_POINTS_HEXAHEDRON}, {PRISM, Conn_Pris_Par, N_POINTS_PRISM},
+    {PYRAMID, Conn_Pyra_Par, N_POINTS_PYRAMID}};
+
+  auto forEachNode = [&](const std::function<void(int&)>& visit) {
+    for (const auto& info : elemTypes) {
+      const unsigned long nEntries = GetnElem(info.type)*info.nNodes;
+      for (unsigned long i = 0; i < nEntries; i++) visit(info.conn[i]);
+    }
+  };
+
+  vector<int> nSend(size, 0), nRecv(size), sendDispl(size+1, 0), recvDispl(size+1, 0);
+
+  forEachNode([&](int& node) { nSend[linearPartitioner.GetRankContainingIndex(node-1)]++; });
+
+  SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, SU2_MPI::GetComm());
+
+  for (int ii = 0; ii < size; ii++) {
+    sendDispl[ii+1] = sendDispl[ii] + nSend[ii];
+    recvDispl[ii+1] = recvDispl[ii] + nRecv[ii];
+  }
+
+  vector<unsigned long> request(sendDispl[size]), reply(recvDispl[size]);
+  vector<int> cursor(sendDispl.begin(), sendDispl.end()-1);
+
+  forEachNode([&](int& node) {
+    const auto iProcessor = linearPartitioner.GetRankContainingIndex(node-1);
+    request[cursor[iProcessor]++] = node-1 - linearPartitioner.GetFirstIndexOnRank(iProcessor);
+  });
+
+  SU2_MPI::Alltoallv(request.data(), nSend.data(), sendDispl.data(), MPI_UNSIGNED_LONG,
+                     reply.data(), nRecv.data(), recvDispl.data(), MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+  for (auto& id : reply) id = subVolumeID[id];
+
+  SU2_MPI::Alltoallv(reply.data(), nRecv.data(), recvDispl.data(), MPI_UNSIGNED_LONG,
+                     request.data(), nSend.data(), sendDispl.data(), MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+  /*--- Replace the IDs (in the same order as the requests were made), and keep the elements
+   *    that only have points inside of the box. ---*/
+
+  cursor.assign(sendDispl.begin(), sendDispl.end()-1);
+
+  forEachNode([&](int& node) {
+    const auto iProcessor = linearPartitioner.GetRankContainingIndex(node-1);
+    node = static_cast<int>(request[cursor[iProcessor]++]);
+  });
+
+  for (const auto& info : elemTypes) {
+    unsigned long nKeep = 0;
+    for (unsigned long iElem = 0; iElem < GetnElem(info.type); iElem++) {
+      const int* nodes = &info.conn[iElem*info.nNodes];
+      if (std::find(nodes, nodes+info.nNodes, 0) != nodes+info.nNodes) continue;
+      std::copy(nodes, nodes+info.nNodes, &info.conn[nKeep*info.nNodes]);
+      nKeep++;
+    }
+    nElemPerType[TypeMap.at(info.type)] = nKeep;
+  }
+
+  SetTotalElements();
+
+}
+
 unsigned long CParallelDataSorter::GetElem_Connectivity(GEO_TYPE type, unsigned long iElem, unsigned long iNode) const {
 
   switch (type) {
@@ -57,6 +57,13 @@ CFileWriter::~CFileWriter(){
 bool CFileWriter::WriteMPIBinaryDataAll(const void *data, unsigned long sizeInBytes,
                                         unsigned long totalSizeInBytes, unsigned long offsetInBytes){
 
+  if (asyncWrite) {
+    asyncJob.AddPiece(asyncJob.fileSize + offsetInBytes, data, sizeInBytes);
+    asyncJob.fileSize += totalSizeInBytes;
+    fileSize += sizeInBytes;
+    return true;
+  }
+
 #ifdef HAVE_MPI
 
   startTime = SU2_MPI::Wtime();
@@ -111,6 +118,13 @@ bool CFileWriter::WriteMPIBinaryDataAll(const void *data, unsigned long sizeInBy
 
 bool CFileWriter::WriteMPIBinaryData(const void *data, unsigned long sizeInBytes, unsigned short processor){
 
+  if (asyncWrite) {
+    if (rank == processor) asyncJob.AddPiece(asyncJob.fileSize, data, sizeInBytes);
+    asyncJob.fileSize += sizeInBytes;
+    fileSize += sizeInBytes;
+    return true;
+  }
+
 #ifdef HAVE_MPI
 
   startTime = SU2_MPI::Wtime();
@@ -155,6 +169,8 @@ bool CFileWriter::WriteMPIBinaryData(const void *data, unsigned long sizeInBytes
 
 bool CFileWriter::WriteMPIString(const string &str, unsigned short processor){
 
+  if (asyncWrite) return WriteMPIBinaryData(str.c_str(), str.size()*sizeof(char), processor);
+
 #ifdef HAVE_MPI
 
   startTime = SU2_MPI::Wtime();
@@ -203,6 +219,18 @@ bool CFileWriter::OpenMPIFile(string val_filename){
   /*--- We append the pre-defined suffix (extension) to the filename (prefix) ---*/
   val_filename.append(fileExt);
 
+  fileSize = 0.0;
+  usedTime = 0;
+
+  /*--- In asynchronous mode the file is only opened by the background writer. ---*/
+
+  if (asyncWrite) {
+    asyncJob = CAsyncWriteQueue::Job();
+    asyncJob.fileName = val_filename;
+    asyncJob.setSize = (rank == MASTER_NODE);
+    return true;
+  }
+
 #ifdef HAVE_MPI
   int ierr;
   disp     = 0.0;
@@ -240,14 +268,23 @@ bool CFileWriter::OpenMPIFile(string val_filename){
   }
 #endif
 
-  fileSize = 0.0;
-  usedTime = 0;
-
   return true;
 }
 
 bool CFileWriter::CloseMPIFile(){
 
+  if (asyncWrite) {
+    CAsyncWriteQueue::GetInstance().Submit(std::move(asyncJob));
+    asyncJob = CAsyncWriteQueue::Job();
+    asyncSubmitted = true;
+
+    su2double my_fileSize = fileSize;
+    SU2_MPI::Allreduce(&my_fileSize, &fileSize, 1,
+                       MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+    bandwidth = 0.0;
+    return true;
+  }
+
 #ifdef HAVE_MPI
   /*--- All ranks close the file after writing. ---*/
 
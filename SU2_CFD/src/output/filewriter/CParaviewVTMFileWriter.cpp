@@ -87,7 +87,8 @@ void CParaviewVTMFileWriter::Write_Data(string val_filename){
 
 }
 
-void CParaviewVTMFileWriter::AddDataset(string foldername, string name, string file, CParallelDataSorter* dataSorter){
+void CParaviewVTMFileWriter::AddDataset(string foldername, string name, string file, CParallelDataSorter* dataSorter,
+                                        const CConfig* config){
 
   /*--- Construct the full file name incl. folder ---*/
   /*--- Note that the folder name is simply the filename ---*/
@@ -97,6 +98,9 @@ void CParaviewVTMFileWriter::AddDataset(string foldername, string name, string f
   /*--- Create an XML writer and dump data into file ---*/
 
   CParaviewXMLFileWriter XMLWriter(dataSorter);
+  XMLWriter.SetCompression(config->GetKind_Output_Compression(), config->GetOutput_QuantizedFields(),
+                           config->GetOutput_QuantizationBits());
+  XMLWriter.SetAsyncWrite(asyncWrite);
   XMLWriter.Write_Data(fullFilename);
 
   /*--- Add the dataset to the vtm file ---*/
@@ -136,7 +140,7 @@ void CParaviewVTMFileWriter::WriteFolderData(string foldername, CConfig *config,
   StartBlock(multiZoneHeaderString);
 
   StartBlock("Internal");
-  AddDataset(foldername,"Internal", "Internal", volumeDataSorter);
+  AddDataset(foldername,"Internal", "Internal", volumeDataSorter, config);
   EndBlock();
 
   /*--- Open a block for the boundary ---*/
@@ -180,7 +184,7 @@ void CParaviewVTMFileWriter::WriteFolderData(string foldername, CConfig *config,
 
       /*--- Add the dataset ---*/
 
-      AddDataset(foldername, markerTag, markerTag, surfaceDataSorter);
+      AddDataset(foldername, markerTag, markerTag, surfaceDataSorter, config);
 
     }
   }
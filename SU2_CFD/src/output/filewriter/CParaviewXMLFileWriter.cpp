@@ -27,6 +27,11 @@
 
 #include "../../../include/output/filewriter/CParaviewXMLFileWriter.hpp"
 #include "../../../../Common/include/toolboxes/printing_toolbox.hpp"
+#include "../../../../Common/include/parallelization/omp_structure.hpp"
+
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
 
 const string CParaviewXMLFileWriter::fileExt = ".vtu";
 
@@ -55,24 +60,66 @@ void CParaviewXMLFileWriter::Write_Data(string val_filename){
     SU2_MPI::Error("Connectivity must be sorted.", CURRENT_FUNCTION);
   }
 
+  const bool compress = (compression != OUTPUT_COMPRESSION::NONE);
+
+#ifndef HAVE_ZLIB
+  if (compress) {
+    SU2_MPI::Error("SU2 was not compiled with zlib support, compressed Paraview output is not available.",
+                   CURRENT_FUNCTION);
+  }
+#endif
+
+  OpenMPIFile(val_filename);
+
+  dataOffset = 0;
+  arrayIndex = 0;
+  compressedArrays.clear();
+
+  /*--- The size of compressed arrays is only known after encoding them, therefore in that
+   case the data is encoded (by each rank in parallel) before the header is written. ---*/
+
+  if (compress) WriteAppendedData();
+
+  WriteHeader();
+
+  /*--- Now write all the data we have previously defined into the binary section of the file ---*/
+
+  WriteMPIString("<AppendedData encoding=\"raw\">\n_", MASTER_NODE);
+
+  if (compress) {
+    for (const auto& array : compressedArrays) {
+      if (!WriteMPIBinaryData(array.header.data(), array.headerSize, MASTER_NODE)){
+        SU2_MPI::Error("Writing array header failed", CURRENT_FUNCTION);
+      }
+      if (!WriteMPIBinaryDataAll(array.bytes.data(), array.bytes.size(), array.totalSize, array.rankOffset)){
+        SU2_MPI::Error("Writing data array failed", CURRENT_FUNCTION);
+      }
+    }
+    compressedArrays.clear();
+  } else {
+    WriteAppendedData();
+  }
+
+  WriteMPIString("</AppendedData>\n", MASTER_NODE);
+  WriteMPIString("</VTKFile>\n", MASTER_NODE);
+
+  CloseMPIFile();
+
+}
+
+void CParaviewXMLFileWriter::WriteHeader(){
+
   /*--- We always have 3 coords, independent of the actual value of nDim ---*/
 
   const int NCOORDS = 3;
   const unsigned short nDim = dataSorter->GetnDim();
-  unsigned short iDim = 0;
 
   /*--- Array containing the field names we want to output ---*/
 
   const vector<string>& fieldNames = dataSorter->GetFieldNames();
 
-  unsigned long iPoint, iElem;
-
   char str_buf[255];
 
-  OpenMPIFile(val_filename);
-
-  dataOffset = 0;
-
   /*--- Communicate the number of total points that will be
    written by each rank. After this communication, each proc knows how
    many poinnts will be written before its location in the file and the
@@ -88,14 +135,6 @@ void CParaviewXMLFileWriter::Write_Data(string val_filename){
 
   unsigned long myElem, myElemStorage, GlobalElem, GlobalElemStorage;
 
-  unsigned long nParallel_Line = dataSorter->GetnElem(LINE),
-                nParallel_Tria = dataSorter->GetnElem(TRIANGLE),
-                nParallel_Quad = dataSorter->GetnElem(QUADRILATERAL),
-                nParallel_Tetr = dataSorter->GetnElem(TETRAHEDRON),
-                nParallel_Hexa = dataSorter->GetnElem(HEXAHEDRON),
-                nParallel_Pris = dataSorter->GetnElem(PRISM),
-                nParallel_Pyra = dataSorter->GetnElem(PYRAMID);
-
   myElem            = dataSorter->GetnElem();
   myElemStorage     = dataSorter->GetnConn();
   GlobalElem        = dataSorter->GetnElemGlobal();
@@ -105,10 +144,12 @@ void CParaviewXMLFileWriter::Write_Data(string val_filename){
   * which means that all data is appended at the end of the file in one binary blob.
   */
 
+  const string compressor = (compression == OUTPUT_COMPRESSION::ZLIB)? " compressor=\"vtkZLibDataCompressor\"" : "";
+
   if (!bigEndian){
-    WriteMPIString("<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"LittleEndian\" header_type=\"UInt64\">\n", MASTER_NODE);
+    WriteMPIString("<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"LittleEndian\" header_type=\"UInt64\"" + compressor + ">\n", MASTER_NODE);
   } else {
-    WriteMPIString("<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"BigEndian\" header_type=\"UInt64\">\n", MASTER_NODE);
+    WriteMPIString("<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"BigEndian\" header_type=\"UInt64\"" + compressor + ">\n", MASTER_NODE);
   }
 
   WriteMPIString("<UnstructuredGrid>\n", MASTER_NODE);
@@ -184,9 +225,41 @@ void CParaviewXMLFileWriter::Write_Data(string val_filename){
   WriteMPIString("</Piece>\n", MASTER_NODE);
   WriteMPIString("</UnstructuredGrid>\n", MASTER_NODE);
 
-  /*--- Now write all the data we have previously defined into the binary section of the file ---*/
+}
 
-  WriteMPIString("<AppendedData encoding=\"raw\">\n_", MASTER_NODE);
+void CParaviewXMLFileWriter::WriteAppendedData(){
+
+  /*--- We always have 3 coords, independent of the actual value of nDim ---*/
+
+  const int NCOORDS = 3;
+  const unsigned short nDim = dataSorter->GetnDim();
+  unsigned short iDim = 0;
+
+  /*--- Array containing the field names we want to output ---*/
+
+  const vector<string>& fieldNames = dataSorter->GetFieldNames();
+
+  unsigned long iPoint, iElem;
+
+  unsigned long myPoint, GlobalPoint;
+
+  GlobalPoint = dataSorter->GetnPointsGlobal();
+  myPoint     = dataSorter->GetnPoints();
+
+  unsigned long myElem, myElemStorage, GlobalElem, GlobalElemStorage;
+
+  unsigned long nParallel_Line = dataSorter->GetnElem(LINE),
+                nParallel_Tria = dataSorter->GetnElem(TRIANGLE),
+                nParallel_Quad = dataSorter->GetnElem(QUADRILATERAL),
+                nParallel_Tetr = dataSorter->GetnElem(TETRAHEDRON),
+                nParallel_Hexa = dataSorter->GetnElem(HEXAHEDRON),
+                nParallel_Pris = dataSorter->GetnElem(PRISM),
+                nParallel_Pyra = dataSorter->GetnElem(PYRAMID);
+
+  myElem            = dataSorter->GetnElem();
+  myElemStorage     = dataSorter->GetnConn();
+  GlobalElem        = dataSorter->GetnElemGlobal();
+  GlobalElemStorage = dataSorter->GetnConnGlobal();
 
   /*--- Load/write the 1D buffer of point coordinates. Note that we
    always have 3 coordinate dimensions, even for 2D problems. ---*/
@@ -250,11 +323,20 @@ void CParaviewXMLFileWriter::Write_Data(string val_filename){
 
   WriteDataArray(typeBuf.data(), VTKDatatype::UINT8, myElem, GlobalElem, dataSorter->GetnElemCumulative(rank));
 
+  /*--- Adjust container start location to avoid point coords. ---*/
+
+  unsigned short varStart = 2;
+  if (nDim == 3) varStart++;
+
   /*--- Loop over all variables that have been registered in the output. ---*/
 
-  VarCounter = varStart;
+  unsigned short iField, VarCounter = varStart;
   for (iField = varStart; iField < fieldNames.size(); iField++) {
 
+    string fieldname = fieldNames[iField];
+    fieldname.erase(remove(fieldname.begin(), fieldname.end(), '"'),
+                    fieldname.end());
+
     /*--- Check whether this field is a vector or scalar. ---*/
 
     bool output_variable = true, isVector = false;
@@ -280,6 +362,8 @@ void CParaviewXMLFileWriter::Write_Data(string val_filename){
 
     if (output_variable && isVector) {
 
+      fieldname.erase(fieldname.end()-2,fieldname.end());
+
       /*--- Load up the buffer for writing this rank's vector data. ---*/
 
       float val = 0.0;
@@ -294,6 +378,8 @@ void CParaviewXMLFileWriter::Write_Data(string val_filename){
         }
       }
 
+      if (IsQuantized(fieldname)) Quantize(dataBufferFloat.data(), myPoint*NCOORDS);
+
       WriteDataArray(dataBufferFloat.data(), VTKDatatype::FLOAT32, myPoint*NCOORDS, GlobalPoint*NCOORDS,
                      dataSorter->GetnPointCumulative(rank)*NCOORDS);
 
@@ -310,6 +396,8 @@ void CParaviewXMLFileWriter::Write_Data(string val_filename){
         dataBufferFloat[iPoint] = val;
       }
 
+      if (IsQuantized(fieldname)) Quantize(dataBufferFloat.data(), myPoint);
+
       WriteDataArray(dataBufferFloat.data(), VTKDatatype::FLOAT32, myPoint, GlobalPoint,
                      dataSorter->GetnPointCumulative(rank));
 
@@ -318,11 +406,31 @@ void CParaviewXMLFileWriter::Write_Data(string val_filename){
 
   }
 
-  WriteMPIString("</AppendedData>\n", MASTER_NODE);
-  WriteMPIString("</VTKFile>\n", MASTER_NODE);
+}
 
-  CloseMPIFile();
+bool CParaviewXMLFileWriter::IsQuantized(const string& fieldname) const {
+  return std::find(quantizedFields.begin(), quantizedFields.end(), fieldname) != quantizedFields.end();
+}
+
+void CParaviewXMLFileWriter::Quantize(float* data, unsigned long size) const {
+
+  /*--- Round the mantissa to the requested number of bits, the discarded bits become zeros,
+   which compress well, and the values remain valid Float32 for any reader. ---*/
+
+  if (quantizationBits >= 23) return;
 
+  const uint32_t shift = 23 - quantizationBits;
+  const uint32_t half = uint32_t(1) << (shift-1);
+  const uint32_t mask = ~((uint32_t(1) << shift) - 1);
+  const uint32_t expMask = 0x7F800000;
+
+  for (unsigned long i = 0; i < size; i++) {
+    uint32_t bits;
+    memcpy(&bits, &data[i], sizeof(float));
+    if ((bits & expMask) == expMask) continue;  // inf or nan
+    bits = (bits + half) & mask;
+    memcpy(&data[i], &bits, sizeof(float));
+  }
 }
 
 void CParaviewXMLFileWriter::WriteDataArray(void* data, VTKDatatype type, unsigned long arraySize,
@@ -340,6 +448,14 @@ void CParaviewXMLFileWriter::WriteDataArray(void* data, VTKDatatype type, unsign
   /*--- The total data size ---*/
   size_t totalByteSize = globalSize*typeSize;
 
+  /*--- Compressed arrays are stored, they are written after the header. ---*/
+
+  if (compression != OUTPUT_COMPRESSION::NONE) {
+    compressedArrays.emplace_back();
+    CompressDataArray(data, byteSize, totalByteSize, offset*typeSize, compressedArrays.back());
+    return;
+  }
+
   /*--- Only the master node writes the total size in bytes as unsigned long in front of the array data ---*/
 
   if (!WriteMPIBinaryData(&totalByteSize, sizeof(size_t), MASTER_NODE)){
@@ -386,6 +502,150 @@ void CParaviewXMLFileWriter::AddDataArray(VTKDatatype type, string name,
                  string(" offset=") + offsetStr +
                  string(" format=\"appended\"/>\n"), MASTER_NODE);
 
-  dataOffset += totalByteSize + sizeof(size_t);
+  if (compression != OUTPUT_COMPRESSION::NONE) {
+    const auto& array = compressedArrays[arrayIndex];
+    dataOffset += array.headerSize + array.totalSize;
+  } else {
+    dataOffset += totalByteSize + sizeof(size_t);
+  }
+  arrayIndex++;
+
+}
+
+void CParaviewXMLFileWriter::CompressDataArray(const void* data, unsigned long byteSize, unsigned long totalByteSize,
+                                               unsigned long offset, CompressedArray& array) const {
+
+  /*--- The VTK format splits an array into blocks of equal (uncompressed) size, except the last one.
+   Each rank compresses the blocks that start in its part of the array, for which it needs the bytes
+   up to the end of its last block from the next rank(s). ---*/
+
+  const unsigned long blockSize = COMPRESSION_BLOCK_SIZE;
+  auto roundUp = [&](unsigned long val) { return ((val + blockSize - 1) / blockSize) * blockSize; };
+
+  vector<unsigned long> ranges(2*size);
+  const unsigned long myRange[2] = {offset, offset + byteSize};
+  SU2_MPI::Allgather(myRange, 2, MPI_UNSIGNED_LONG, ranges.data(), 2, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+  auto blockRange = [&](int iRank, unsigned long& lo, unsigned long& hi) {
+    lo = roundUp(ranges[2*iRank]);
+    hi = (lo < ranges[2*iRank+1])? min(roundUp(ranges[2*iRank+1]), totalByteSize) : lo;
+  };
+
+  unsigned long myLo, myHi;
+  blockRange(rank, myLo, myHi);
+
+  /*--- Contiguous buffer of the bytes covered by the blocks of this rank. ---*/
+
+  vector<char> buffer(myHi - myLo);
+  if (myHi > myLo) {
+    const unsigned long nOwn = min(myRange[1], myHi) - myLo;
+    memcpy(buffer.data(), static_cast<const char*>(data) + (myLo - offset), nOwn);
+  }
+
+  if (size > 1) {
+    /*--- The exchanged pieces are smaller than one block, displacements are relative to the
+     start of the data of the sender and to the end of the data of the receiver. ---*/
+    vector<int> sendCount(size, 0), sendDisp(size, 0), recvCount(size, 0), recvDisp(size, 0);
+
+    for (int iRank = 0; iRank < size; iRank++) {
+      if (iRank == rank) continue;
+      unsigned long lo, hi;
+      blockRange(iRank, lo, hi);
+      auto begin = max(myRange[0], lo), end = min(myRange[1], hi);
+      if (begin < end) {
+        sendCount[iRank] = int(end - begin);
+        sendDisp[iRank] = int(begin - myRange[0]);
+      }
+      begin = max(ranges[2*iRank], max(myLo, myRange[1]));
+      end = min(ranges[2*iRank+1], myHi);
+      if (begin < end) {
+        recvCount[iRank] = int(end - begin);
+        recvDisp[iRank] = int(begin - myRange[1]);
+      }
+    }
+
+    const unsigned long tailStart = max(myLo, myRange[1]);
+    vector<char> tail(max(myHi, tailStart) - tailStart);
+
+    SU2_MPI::Alltoallv(data, sendCount.data(), sendDisp.data(), MPI_CHAR,
+                       tail.data(), recvCount.data(), recvDisp.data(), MPI_CHAR, SU2_MPI::GetComm());
+
+    if (!tail.empty()) memcpy(buffer.data() + (tailStart - myLo), tail.data(), tail.size());
+  }
+
+  /*--- Compress the blocks independently, with threads if available. ---*/
+
+  const unsigned long nMyBlocks = (buffer.size() + blockSize - 1) / blockSize;
+  vector<vector<char> > blocks(nMyBlocks);
+  vector<int> status(nMyBlocks, 0);
+
+#ifdef HAVE_ZLIB
+  SU2_OMP_PARALLEL
+  {
+    SU2_OMP_FOR_DYN(1)
+    for (unsigned long iBlock = 0; iBlock < nMyBlocks; iBlock++) {
+      const unsigned long begin = iBlock * blockSize;
+      const unsigned long len = min<unsigned long>(blockSize, buffer.size() - begin);
+      uLongf compLen = compressBound(len);
+      blocks[iBlock].resize(compLen);
+      status[iBlock] = compress2(reinterpret_cast<Bytef*>(blocks[iBlock].data()), &compLen,
+                                 reinterpret_cast<const Bytef*>(buffer.data() + begin), len, Z_DEFAULT_COMPRESSION);
+      blocks[iBlock].resize(compLen);
+    }
+    END_SU2_OMP_FOR
+  }
+  END_SU2_OMP_PARALLEL
+
+  for (const auto ierr : status) {
+    if (ierr != Z_OK) SU2_MPI::Error("Compression of data array failed", CURRENT_FUNCTION);
+  }
+#endif
+
+  vector<unsigned long> mySizes(nMyBlocks);
+  unsigned long myBytes = 0;
+  for (unsigned long iBlock = 0; iBlock < nMyBlocks; iBlock++) {
+    mySizes[iBlock] = blocks[iBlock].size();
+    myBytes += mySizes[iBlock];
+  }
+
+  array.bytes.resize(myBytes);
+  myBytes = 0;
+  for (const auto& block : blocks) {
+    if (!block.empty()) memcpy(array.bytes.data() + myBytes, block.data(), block.size());
+    myBytes += block.size();
+  }
+
+  /*--- Gather the compressed sizes of all blocks, they define the header and the offset of each rank. ---*/
+
+  vector<int> nBlocks(size), displ(size);
+  int nBlocksTotal = 0;
+  for (int iRank = 0; iRank < size; iRank++) {
+    unsigned long lo, hi;
+    blockRange(iRank, lo, hi);
+    nBlocks[iRank] = int((hi - lo + blockSize - 1) / blockSize);
+    displ[iRank] = nBlocksTotal;
+    nBlocksTotal += nBlocks[iRank];
+  }
+
+  vector<unsigned long> allSizes(nBlocksTotal);
+  SU2_MPI::Allgatherv(mySizes.data(), int(nMyBlocks), MPI_UNSIGNED_LONG, allSizes.data(), nBlocks.data(),
+                      displ.data(), MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+  array.totalSize = 0;
+  array.rankOffset = 0;
+  for (int iBlock = 0; iBlock < nBlocksTotal; iBlock++) {
+    if (iBlock < displ[rank]) array.rankOffset += allSizes[iBlock];
+    array.totalSize += allSizes[iBlock];
+  }
+
+  array.headerSize = (3 + nBlocksTotal) * sizeof(uint64_t);
+
+  if (rank == MASTER_NODE) {
+    array.header.resize(3 + nBlocksTotal);
+    array.header[0] = nBlocksTotal;
+    array.header[1] = blockSize;
+    array.header[2] = totalByteSize % blockSize;
+    for (int iBlock = 0; iBlock < nBlocksTotal; iBlock++) array.header[3+iBlock] = allSizes[iBlock];
+  }
 
 }
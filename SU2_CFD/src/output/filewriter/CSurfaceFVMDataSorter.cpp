@@ -63,6 +63,14 @@ void CSurfaceFVMDataSorter::SortOutputData() {
   int ind;
 #endif
 
+  /*--- If the connectivity was not sorted again since the last call, the surface points and
+   their renumbering are still valid and only the values need to be extracted. ---*/
+
+  if (sortingPlanCached) {
+    CopySurfaceData();
+    return;
+  }
+
   const unsigned long nElemLine = GetnElem(LINE);
   const unsigned long nElemTria = GetnElem(TRIANGLE);
   const unsigned long nElemQuad = GetnElem(QUADRILATERAL);
@@ -393,13 +401,16 @@ void CSurfaceFVMDataSorter::SortOutputData() {
 
   nPoints = 0;
   Renumber2Global.clear();
+  surfaceToVolume.clear();
 
   for (iPoint = 0; iPoint < volumeSorter->GetnPoints(); iPoint++) {
     if (surfPoint[iPoint] != -1) {
 
-      /*--- Save the global index values for CSV output. ---*/
+      /*--- Save the global index values for CSV output, and the local
+       index for extracting the values on later calls. ---*/
 
       Renumber2Global[nPoints] = surfPoint[iPoint];
+      surfaceToVolume.push_back(iPoint);
 
       /*--- Increment total number of surface points found locally. ---*/
 
@@ -434,15 +445,8 @@ void CSurfaceFVMDataSorter::SortOutputData() {
   delete [] dataBuffer;
   dataBuffer = new passivedouble[nPoints*VARS_PER_POINT];
 
-  for (int jj = 0; jj < VARS_PER_POINT; jj++) {
-    count = 0;
-    for (int ii = 0; ii < (int)volumeSorter->GetnPoints(); ii++) {
-      if (surfPoint[ii] !=-1) {
-        dataBuffer[count*VARS_PER_POINT + jj] = volumeSorter->GetData(jj,ii);
-        count++;
-      }
-    }
-  }
+  CopySurfaceData();
+
   /*--- Reduce the total number of surf points we have. This will be
    needed for writing the surface solution files later. ---*/
 
@@ -1047,6 +1051,8 @@ void CSurfaceFVMDataSorter::SortOutputData() {
     Conn_Quad_Par[iNode+3] = (int)Global2Renumber[Conn_Quad_Par[iNode+3]-1];
   }
 
+  sortingPlanCached = true;
+
   /*--- Free temporary memory ---*/
 
   delete [] idIndex;
@@ -1067,6 +1073,18 @@ void CSurfaceFVMDataSorter::SortOutputData() {
 
 }
 
+void CSurfaceFVMDataSorter::CopySurfaceData() {
+
+  const int VARS_PER_POINT = GlobalField_Counter;
+
+  for (unsigned long iPoint = 0; iPoint < nPoints; iPoint++) {
+    for (int iVar = 0; iVar < VARS_PER_POINT; iVar++) {
+      dataBuffer[iPoint*VARS_PER_POINT + iVar] = volumeSorter->GetData(iVar, surfaceToVolume[iPoint]);
+    }
+  }
+
+}
+
 void CSurfaceFVMDataSorter::SortConnectivity(CConfig *config, CGeometry *geometry, bool val_sort) {
 
   std::vector<string> markerList;
@@ -1085,6 +1103,16 @@ void CSurfaceFVMDataSorter::SortConnectivity(CConfig *config, CGeometry *geometr
 
 void CSurfaceFVMDataSorter::SortConnectivity(CConfig *config, CGeometry *geometry, const vector<string> &markerList) {
 
+  /*--- The surface topology does not change, if the same markers were sorted before, the
+   connectivity (already renumbered by SortOutputData) is kept. The lists of markers are
+   local, ranks without a marker must take the same decision as the others. ---*/
+
+  int newMarkers = !connectivitySorted || (markerList != sortedMarkers);
+  int anyNewMarkers = 0;
+  SU2_MPI::Allreduce(&newMarkers, &anyNewMarkers, 1, MPI_INT, MPI_MAX, SU2_MPI::GetComm());
+
+  if (anyNewMarkers == 0) return;
+
   /*--- Sort connectivity for each type of element (excluding halos). Note
    In these routines, we sort the connectivity into a linear partitioning
    across all processors based on the global index of the grid nodes. ---*/
@@ -1099,6 +1127,8 @@ void CSurfaceFVMDataSorter::SortConnectivity(CConfig *config, CGeometry *geometr
 
   SetTotalElements();
 
+  sortedMarkers = markerList;
+  sortingPlanCached = false;
   connectivitySorted = true;
 
 }
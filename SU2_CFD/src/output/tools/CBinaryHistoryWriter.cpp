@@ -0,0 +1,82 @@
+/*!
+ * \file CBinaryHistoryWriter.cpp
+ * \brief Buffered writer of the history in a binary columnar format.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/tools/CBinaryHistoryWriter.hpp"
+#include "../../../../Common/include/parallelization/mpi_structure.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+void CBinaryHistoryWriter::Open(const std::string& filename, const std::vector<std::string>& names,
+                                unsigned long linesPerFlush) {
+  file.open(filename, std::ios::out | std::ios::binary);
+  if (!file.is_open()) {
+    SU2_MPI::Error("Unable to open the history file " + filename, CURRENT_FUNCTION);
+  }
+
+  nColumns = names.size();
+  nLines = 0;
+  flushLines = std::max<unsigned long>(linesPerFlush, 1);
+  buffer.clear();
+  buffer.reserve(nColumns * flushLines);
+
+  file.write("SU2HIST1", 8);
+  const int32_t n = nColumns;
+  file.write(reinterpret_cast<const char*>(&n), sizeof(int32_t));
+  for (const auto& name : names) {
+    const int32_t len = name.size();
+    file.write(reinterpret_cast<const char*>(&len), sizeof(int32_t));
+    file.write(name.data(), len);
+  }
+  file.flush();
+}
+
+void CBinaryHistoryWriter::AddLine(const std::vector<const su2double*>& values) {
+  if (!file.is_open()) return;
+
+  for (const auto* val : values) buffer.push_back(SU2_TYPE::GetValue(*val));
+  ++nLines;
+
+  if (nLines >= flushLines) Flush();
+}
+
+void CBinaryHistoryWriter::Flush() {
+  if (!file.is_open() || nLines == 0) return;
+
+  /*--- Transpose the buffered lines into columns. ---*/
+  std::vector<passivedouble> block(buffer.size());
+  for (auto iLine = 0ul; iLine < nLines; ++iLine)
+    for (auto iCol = 0ul; iCol < nColumns; ++iCol)
+      block[iCol * nLines + iLine] = buffer[iLine * nColumns + iCol];
+
+  const int32_t n = nLines;
+  file.write(reinterpret_cast<const char*>(&n), sizeof(int32_t));
+  file.write(reinterpret_cast<const char*>(block.data()), block.size() * sizeof(passivedouble));
+  file.flush();
+
+  buffer.clear();
+  nLines = 0;
+}
@@ -893,3 +893,219 @@ vector<passivedouble> CDriver::GetFlowLoad(unsigned short iMarker, unsigned long
   return FlowLoad_passive;
 
 }
+
+////////////////////////////////////////////////////////////////////////////////
+/* Functions for bulk access to marker and volume data (NumPy arrays)         */
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+void CheckArrayShape(int nRows, int nCols, unsigned long nRowsExpected, unsigned long nColsExpected,
+                     const string& caller) {
+  if ((nRows < 0) || (nCols < 0) || (static_cast<unsigned long>(nRows) != nRowsExpected) ||
+      (static_cast<unsigned long>(nCols) != nColsExpected)) {
+    SU2_MPI::Error("Array of size " + to_string(nRows) + " x " + to_string(nCols) + " given, " +
+                   to_string(nRowsExpected) + " x " + to_string(nColsExpected) + " expected.", caller);
+  }
+}
+}
+
+void CDriver::GetMarkerGlobalIndices(unsigned short iMarker, unsigned long* indices, int nRows) const {
+
+  const auto geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  CheckArrayShape(nRows, 1, geometry->GetnVertex(iMarker), 1, CURRENT_FUNCTION);
+
+  for (auto iVertex = 0ul; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+    const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+    indices[iVertex] = geometry->nodes->GetGlobalIndex(iPoint);
+  }
+}
+
+void CDriver::GetMarkerInitialCoordinates(unsigned short iMarker, passivedouble* values, int nRows, int nCols) const {
+
+  const auto geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  CheckArrayShape(nRows, nCols, geometry->GetnVertex(iMarker), nDim, CURRENT_FUNCTION);
+
+  const auto nodes = solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL]->GetNodes();
+
+  for (auto iVertex = 0ul; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+    const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+    for (auto iDim = 0u; iDim < nDim; iDim++)
+      values[iVertex*nDim + iDim] = SU2_TYPE::GetValue(nodes->GetMesh_Coord(iPoint, iDim));
+  }
+}
+
+void CDriver::GetMarkerNormals(unsigned short iMarker, passivedouble* values, int nRows, int nCols,
+                               bool unitNormals) const {
+
+  const auto geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  CheckArrayShape(nRows, nCols, geometry->GetnVertex(iMarker), nDim, CURRENT_FUNCTION);
+
+  for (auto iVertex = 0ul; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+    const su2double* Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+    const su2double Area = unitNormals ? GeometryToolbox::Norm(nDim, Normal) : su2double(1.0);
+
+    for (auto iDim = 0u; iDim < nDim; iDim++)
+      values[iVertex*nDim + iDim] = SU2_TYPE::GetValue(Normal[iDim] / Area);
+  }
+}
+
+void CDriver::GetMarkerTemperatures(unsigned short iMarker, passivedouble* values, int nRows) const {
+
+  const auto nVertex = geometry_container[ZONE_0][INST_0][MESH_0]->GetnVertex(iMarker);
+  CheckArrayShape(nRows, 1, nVertex, 1, CURRENT_FUNCTION);
+
+  for (auto iVertex = 0ul; iVertex < nVertex; iVertex++)
+    values[iVertex] = GetVertexTemperature(iMarker, iVertex);
+}
+
+void CDriver::SetMarkerTemperatures(unsigned short iMarker, passivedouble* newValues, int nRows) {
+
+  const auto geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  CheckArrayShape(nRows, 1, geometry->GetnVertex(iMarker), 1, CURRENT_FUNCTION);
+
+  for (auto iVertex = 0ul; iVertex < geometry->GetnVertex(iMarker); iVertex++)
+    geometry->SetCustomBoundaryTemperature(iMarker, iVertex, newValues[iVertex]);
+}
+
+void CDriver::GetMarkerHeatFluxes(unsigned short iMarker, passivedouble* values, int nRows, int nCols) const {
+
+  const auto nVertex = geometry_container[ZONE_0][INST_0][MESH_0]->GetnVertex(iMarker);
+  CheckArrayShape(nRows, nCols, nVertex, nDim, CURRENT_FUNCTION);
+
+  for (auto iVertex = 0ul; iVertex < nVertex; iVertex++) {
+    const auto heatFlux = GetVertexHeatFluxes(iMarker, iVertex);
+    for (auto iDim = 0u; iDim < nDim; iDim++) values[iVertex*nDim + iDim] = heatFlux[iDim];
+  }
+}
+
+void CDriver::SetMarkerDisplacements(unsigned short iMarker, passivedouble* newValues, int nRows, int nCols) {
+
+  const auto geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  CheckArrayShape(nRows, nCols, geometry->GetnVertex(iMarker), nDim, CURRENT_FUNCTION);
+
+  auto nodes = solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL]->GetNodes();
+
+  for (auto iVertex = 0ul; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+    su2double MeshDispl[3] = {0.0, 0.0, 0.0};
+    for (auto iDim = 0u; iDim < nDim; iDim++) MeshDispl[iDim] = newValues[iVertex*nDim + iDim];
+
+    nodes->SetBound_Disp(geometry->vertex[iMarker][iVertex]->GetNode(), MeshDispl);
+  }
+}
+
+void CDriver::GetMarkerFlowLoads(unsigned short iMarker, passivedouble* values, int nRows, int nCols) const {
+
+  const auto nVertex = geometry_container[ZONE_0][INST_0][MESH_0]->GetnVertex(iMarker);
+  CheckArrayShape(nRows, nCols, nVertex, nDim, CURRENT_FUNCTION);
+
+  const CSolver* solver = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL];
+  const bool wall = config_container[ZONE_0]->GetSolid_Wall(iMarker);
+
+  for (auto iVertex = 0ul; iVertex < nVertex; iVertex++) {
+    for (auto iDim = 0u; iDim < nDim; iDim++) {
+      values[iVertex*nDim + iDim] = wall ? SU2_TYPE::GetValue(solver->GetVertexTractions(iMarker, iVertex, iDim)) : 0.0;
+    }
+  }
+}
+
+void CDriver::SetMarkerFEALoads(unsigned short iMarker, passivedouble* newValues, int nRows, int nCols) {
+
+  const auto geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  CheckArrayShape(nRows, nCols, geometry->GetnVertex(iMarker), nDim, CURRENT_FUNCTION);
+
+  auto nodes = solver_container[ZONE_0][INST_0][MESH_0][FEA_SOL]->GetNodes();
+
+  for (auto iVertex = 0ul; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+    su2double NodalForce[3] = {0.0, 0.0, 0.0};
+    for (auto iDim = 0u; iDim < nDim; iDim++) NodalForce[iDim] = newValues[iVertex*nDim + iDim];
+
+    nodes->Set_FlowTraction(geometry->vertex[iMarker][iVertex]->GetNode(), NodalForce);
+  }
+}
+
+void CDriver::GetMarkerFEADisplacements(unsigned short iMarker, passivedouble* values, int nRows, int nCols) const {
+
+  const auto geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  CheckArrayShape(nRows, nCols, geometry->GetnVertex(iMarker), nDim, CURRENT_FUNCTION);
+
+  const auto nodes = solver_container[ZONE_0][INST_0][MESH_0][FEA_SOL]->GetNodes();
+
+  for (auto iVertex = 0ul; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+    const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+    for (auto iDim = 0u; iDim < nDim; iDim++)
+      values[iVertex*nDim + iDim] = SU2_TYPE::GetValue(nodes->GetSolution(iPoint, iDim));
+  }
+}
+
+void CDriver::GetCoordinates(passivedouble* values, int nRows, int nCols) const {
+
+  const auto geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  CheckArrayShape(nRows, nCols, geometry->GetnPoint(), nDim, CURRENT_FUNCTION);
+
+  const auto& coord = geometry->nodes->GetCoord();
+
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); iPoint++)
+    for (auto iDim = 0u; iDim < nDim; iDim++)
+      values[iPoint*nDim + iDim] = SU2_TYPE::GetValue(coord(iPoint, iDim));
+}
+
+void CDriver::GetSolution(unsigned short iSolver, passivedouble* values, int nRows, int nCols) const {
+
+  const auto solver = solver_container[ZONE_0][INST_0][MESH_0][iSolver];
+  if (solver == nullptr) SU2_MPI::Error("The requested solver does not exist.", CURRENT_FUNCTION);
+
+  const auto nPoint = geometry_container[ZONE_0][INST_0][MESH_0]->GetnPoint();
+  const auto nVar = solver->GetnVar();
+  CheckArrayShape(nRows, nCols, nPoint, nVar, CURRENT_FUNCTION);
+
+  const auto& sol = solver->GetNodes()->GetSolution();
+
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+    for (auto iVar = 0u; iVar < nVar; iVar++)
+      values[iPoint*nVar + iVar] = SU2_TYPE::GetValue(sol(iPoint, iVar));
+}
+
+void CDriver::SetSolution(unsigned short iSolver, passivedouble* newValues, int nRows, int nCols) {
+
+  const auto solver = solver_container[ZONE_0][INST_0][MESH_0][iSolver];
+  if (solver == nullptr) SU2_MPI::Error("The requested solver does not exist.", CURRENT_FUNCTION);
+
+  const auto nPoint = geometry_container[ZONE_0][INST_0][MESH_0]->GetnPoint();
+  const auto nVar = solver->GetnVar();
+  CheckArrayShape(nRows, nCols, nPoint, nVar, CURRENT_FUNCTION);
+
+  auto nodes = solver->GetNodes();
+
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+    for (auto iVar = 0u; iVar < nVar; iVar++)
+      nodes->SetSolution(iPoint, iVar, newValues[iPoint*nVar + iVar]);
+}
+
+void CDriver::GetCoordinatesView(passivedouble** view, int* nRows, int* nCols) {
+
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+  SU2_MPI::Error("Views of the data are not available in AD builds, use GetCoordinates.", CURRENT_FUNCTION);
+#else
+  const auto geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+
+  /*--- The coordinates are stored row-major without padding (C2DContainer). ---*/
+  *view = const_cast<passivedouble*>(geometry->nodes->GetCoord().data());
+  *nRows = static_cast<int>(geometry->GetnPoint());
+  *nCols = static_cast<int>(nDim);
+#endif
+}
+
+void CDriver::GetSolutionView(unsigned short iSolver, passivedouble** view, int* nRows, int* nCols) {
+
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+  SU2_MPI::Error("Views of the data are not available in AD builds, use GetSolution.", CURRENT_FUNCTION);
+#else
+  const auto solver = solver_container[ZONE_0][INST_0][MESH_0][iSolver];
+  if (solver == nullptr) SU2_MPI::Error("The requested solver does not exist.", CURRENT_FUNCTION);
+
+  auto& sol = solver->GetNodes()->GetSolution();
+  *view = sol.data();
+  *nRows = static_cast<int>(sol.rows());
+  *nCols = static_cast<int>(sol.cols());
+#endif
+}
@@ -153,6 +153,10 @@ CAdjEulerSolver::CAdjEulerSolver(CGeometry *geometry, CConfig *config, unsigned
   LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
   LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
 
+  /*--- OpenMP initialization. ---*/
+
+  HybridParallelInitialization(geometry);
+
   /*--- Jacobians and vector structures for implicit computations ---*/
   if (config->GetKind_TimeIntScheme_AdjFlow() == EULER_IMPLICIT) {
     Jacobian_ii = new su2double* [nVar];
@@ -375,6 +379,71 @@ CAdjEulerSolver::~CAdjEulerSolver(void) {
   delete nodes;
 }
 
+void CAdjEulerSolver::HybridParallelInitialization(CGeometry* geometry) {
+#ifdef HAVE_OMP
+  /*--- Get the edge coloring, see notes in CEulerSolver's constructor. The flow solver
+   *    on this grid already made the decision of using the natural coloring or not. ---*/
+  su2double parallelEff = 1.0;
+  const auto& coloring = geometry->GetEdgeColoring(&parallelEff);
+
+  SerialEdgeLoops = parallelEff < COLORING_EFF_THRESH;
+
+  if (!coloring.empty()) {
+    auto groupSize = geometry->GetEdgeColorGroupSize();
+    auto nColor = coloring.getOuterSize();
+    EdgeColoring.reserve(nColor);
+
+    for (auto iColor = 0ul; iColor < nColor; ++iColor)
+      EdgeColoring.emplace_back(coloring.innerIdx(iColor), coloring.getNumNonZeros(iColor), groupSize);
+  }
+
+  omp_chunk_size = computeStaticChunkSize(nPoint, omp_get_max_threads(), OMP_MAX_SIZE);
+#else
+  EdgeColoring[0] = DummyGridColor<>(geometry->GetnEdge());
+#endif
+}
+
+unsigned long CAdjEulerSolver::SetPrimitive_Variables(CGeometry *geometry, CConfig *config, bool Output) {
+
+  unsigned long nonPhysicalPoints = 0;
+
+  SU2_OMP_PARALLEL
+  {
+    /*--- Thread-local counter, reduced at the end. ---*/
+    unsigned long counter = 0;
+
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint ++) {
+
+      /*--- Get the distance form a sharp edge ---*/
+
+      const su2double SharpEdge_Distance = geometry->nodes->GetSharpEdge_Distance(iPoint);
+
+      /*--- Set the primitive variables compressible
+       adjoint variables ---*/
+
+      const bool physical = nodes->SetPrimVar(iPoint,SharpEdge_Distance, false, config);
+
+      /* Check for non-realizable states for reporting. */
+
+      if (!physical) counter++;
+
+      /*--- Initialize the convective residual vector ---*/
+
+      if (!Output) LinSysRes.SetBlock_Zero(iPoint);
+
+    }
+    END_SU2_OMP_FOR
+
+    SU2_OMP_CRITICAL
+    nonPhysicalPoints += counter;
+    END_SU2_OMP_CRITICAL
+  }
+  END_SU2_OMP_PARALLEL
+
+  return nonPhysicalPoints;
+}
+
 void CAdjEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container, CConfig *config,
                             unsigned short iMesh, unsigned long Iteration) {
 
@@ -918,10 +987,6 @@ void CAdjEulerSolver::SetInitialCondition(CGeometry **geometry, CSolver ***solve
 
 void CAdjEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh, unsigned short iRKStep, unsigned short RunTime_EqSystem, bool Output) {
 
-  unsigned long iPoint, nonPhysicalPoints = 0;
-  su2double SharpEdge_Distance;
-  bool physical = true;
-
   /*--- Retrieve information about the spatial and temporal integration for the
    adjoint equations (note that the flow problem may use different methods). ---*/
 
@@ -939,26 +1004,7 @@ void CAdjEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_contai
 
   /*--- Residual initialization ---*/
 
-  for (iPoint = 0; iPoint < nPoint; iPoint ++) {
-
-    /*--- Get the distance form a sharp edge ---*/
-
-    SharpEdge_Distance = geometry->nodes->GetSharpEdge_Distance(iPoint);
-
-    /*--- Set the primitive variables compressible
-     adjoint variables ---*/
-
-    physical = nodes->SetPrimVar(iPoint,SharpEdge_Distance, false, config);
-
-    /* Check for non-realizable states for reporting. */
-
-    if (!physical) nonPhysicalPoints++;
-
-    /*--- Initialize the convective residual vector ---*/
-
-    if (!Output) LinSysRes.SetBlock_Zero(iPoint);
-
-  }
+  unsigned long nonPhysicalPoints = SetPrimitive_Variables(geometry, config, Output);
 
   if ((muscl) && (iMesh == MESH_0)) {
 
@@ -1007,20 +1053,31 @@ void CAdjEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_contai
 void CAdjEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                                         CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
 
-  CNumerics* numerics = numerics_container[CONV_TERM];
+  const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  const bool jst_scheme = ((config->GetKind_Centered_AdjFlow() == CENTERED::JST) && (iMesh == MESH_0));
+  const bool grid_movement  = config->GetGrid_Movement();
 
-  unsigned long iEdge, iPoint, jPoint;
+  const auto flowNodes = solver_container[FLOW_SOL]->GetNodes();
 
-  bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
-  bool jst_scheme = ((config->GetKind_Centered_AdjFlow() == CENTERED::JST) && (iMesh == MESH_0));
-  bool grid_movement  = config->GetGrid_Movement();
+  SU2_OMP_PARALLEL_(if(!SerialEdgeLoops))
+  {
+  /*--- Pick one numerics object per thread. ---*/
+  CNumerics* numerics = numerics_container[CONV_TERM + omp_get_thread_num()*MAX_TERMS];
+
+  CEdgeWorkspace work;
 
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  /*--- Loop over edge colors, edges of the same color do not share points. ---*/
+  for (auto color : EdgeColoring)
+  {
+  SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+  for (auto k = 0ul; k < color.size; ++k) {
+
+    auto iEdge = color.indices[k];
 
     /*--- Points in edge, normal, and neighbors---*/
 
-    iPoint = geometry->edges->GetNode(iEdge,0);
-    jPoint = geometry->edges->GetNode(iEdge,1);
+    auto iPoint = geometry->edges->GetNode(iEdge,0);
+    auto jPoint = geometry->edges->GetNode(iEdge,1);
     numerics->SetNormal(geometry->edges->GetNormal(iEdge));
     numerics->SetNeighbor(geometry->nodes->GetnNeighbor(iPoint), geometry->nodes->GetnNeighbor(jPoint));
 
@@ -1030,17 +1087,12 @@ void CAdjEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_co
 
     /*--- Conservative variables w/o reconstruction ---*/
 
-    numerics->SetConservative(solver_container[FLOW_SOL]->GetNodes()->GetSolution(iPoint),
-                              solver_container[FLOW_SOL]->GetNodes()->GetSolution(jPoint));
-
-    numerics->SetSoundSpeed(solver_container[FLOW_SOL]->GetNodes()->GetSoundSpeed(iPoint),
-                            solver_container[FLOW_SOL]->GetNodes()->GetSoundSpeed(jPoint));
-    numerics->SetEnthalpy(solver_container[FLOW_SOL]->GetNodes()->GetEnthalpy(iPoint),
-                          solver_container[FLOW_SOL]->GetNodes()->GetEnthalpy(jPoint));
+    numerics->SetConservative(flowNodes->GetSolution(iPoint), flowNodes->GetSolution(jPoint));
 
+    numerics->SetSoundSpeed(flowNodes->GetSoundSpeed(iPoint), flowNodes->GetSoundSpeed(jPoint));
+    numerics->SetEnthalpy(flowNodes->GetEnthalpy(iPoint), flowNodes->GetEnthalpy(jPoint));
 
-    numerics->SetLambda(solver_container[FLOW_SOL]->GetNodes()->GetLambda(iPoint),
-                        solver_container[FLOW_SOL]->GetNodes()->GetLambda(jPoint));
+    numerics->SetLambda(flowNodes->GetLambda(iPoint), flowNodes->GetLambda(jPoint));
 
     if (jst_scheme) {
       numerics->SetUndivided_Laplacian(nodes->GetUndivided_Laplacian(iPoint), nodes->GetUndivided_Laplacian(jPoint));
@@ -1055,63 +1107,83 @@ void CAdjEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_co
 
     /*--- Compute residuals ---*/
 
-    numerics->ComputeResidual(Res_Conv_i, Res_Visc_i, Res_Conv_j, Res_Visc_j,
-                              Jacobian_ii, Jacobian_ij, Jacobian_ji, Jacobian_jj, config);
+    numerics->ComputeResidual(work.Res_i, work.ResVisc_i, work.Res_j, work.ResVisc_j,
+                              work.Jac_ii, work.Jac_ij, work.Jac_ji, work.Jac_jj, config);
 
     /*--- Update convective and artificial dissipation residuals ---*/
 
-    LinSysRes.SubtractBlock(iPoint, Res_Conv_i);
-    LinSysRes.SubtractBlock(jPoint, Res_Conv_j);
-    LinSysRes.SubtractBlock(iPoint, Res_Visc_i);
-    LinSysRes.SubtractBlock(jPoint, Res_Visc_j);
+    LinSysRes.SubtractBlock(iPoint, work.Res_i);
+    LinSysRes.SubtractBlock(jPoint, work.Res_j);
+    LinSysRes.SubtractBlock(iPoint, work.ResVisc_i);
+    LinSysRes.SubtractBlock(jPoint, work.ResVisc_j);
 
     /*--- Implicit contribution to the residual ---*/
 
     if (implicit) {
-      Jacobian.SubtractBlock2Diag(iPoint, Jacobian_ii);
-      Jacobian.SubtractBlock(iPoint, jPoint, Jacobian_ij);
-      Jacobian.SubtractBlock(jPoint, iPoint, Jacobian_ji);
-      Jacobian.SubtractBlock2Diag(jPoint, Jacobian_jj);
+      Jacobian.SubtractBlock2Diag(iPoint, work.Jac_ii);
+      Jacobian.SubtractBlock(iPoint, jPoint, work.Jac_ij);
+      Jacobian.SubtractBlock(jPoint, iPoint, work.Jac_ji);
+      Jacobian.SubtractBlock2Diag(jPoint, work.Jac_jj);
     }
 
   }
+  END_SU2_OMP_FOR
+  } // end color loop
+  }
+  END_SU2_OMP_PARALLEL
 }
 
 
 void CAdjEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container,
                                       CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
-  CNumerics* numerics = numerics_container[CONV_TERM];
+  unsigned long counter_local = 0, counter_global = 0;
 
-  su2double Project_Grad_i, Project_Grad_j, *Limiter_i = nullptr,
-  *Limiter_j = nullptr, *Psi_i = nullptr, *Psi_j = nullptr, *V_i, *V_j;
-  unsigned long iEdge, iPoint, jPoint, counter_local = 0, counter_global = 0;
-  unsigned short iDim, iVar;
+  const bool implicit         = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  const bool muscl            = (config->GetMUSCL_AdjFlow() && (iMesh == MESH_0));
+  const bool limiter          = (config->GetKind_SlopeLimit_AdjFlow() != LIMITER::NONE);
+  const bool grid_movement    = config->GetGrid_Movement();
+  const su2double adj_limit   = config->GetAdjointLimit();
+
+  const auto flowNodes = solver_container[FLOW_SOL]->GetNodes();
 
-  bool implicit         = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
-  bool muscl            = (config->GetMUSCL_AdjFlow() && (iMesh == MESH_0));
-  bool limiter          = (config->GetKind_SlopeLimit_AdjFlow() != LIMITER::NONE);
-  bool grid_movement    = config->GetGrid_Movement();
+  SU2_OMP_PARALLEL_(if(!SerialEdgeLoops))
+  {
+  /*--- Pick one numerics object per thread. ---*/
+  CNumerics* numerics = numerics_container[CONV_TERM + omp_get_thread_num()*MAX_TERMS];
 
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  CEdgeWorkspace work;
+  auto& Solution_i = work.Solution_i;
+  auto& Solution_j = work.Solution_j;
+  su2double Vector_i[MAXNDIM] = {0.0}, Vector_j[MAXNDIM] = {0.0};
+  const su2double *Limiter_i = nullptr, *Limiter_j = nullptr;
+
+  /*--- Non-physical reconstructions of this thread. ---*/
+  unsigned long counter_thread = 0;
+
+  /*--- Loop over edge colors, edges of the same color do not share points. ---*/
+  for (auto color : EdgeColoring)
+  {
+  SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+  for (auto k = 0ul; k < color.size; ++k) {
+
+    auto iEdge = color.indices[k];
 
     /*--- Points in edge and normal vectors ---*/
 
-    iPoint = geometry->edges->GetNode(iEdge,0);
-    jPoint = geometry->edges->GetNode(iEdge,1);
+    auto iPoint = geometry->edges->GetNode(iEdge,0);
+    auto jPoint = geometry->edges->GetNode(iEdge,1);
     numerics->SetNormal(geometry->edges->GetNormal(iEdge));
 
     /*--- Adjoint variables w/o reconstruction ---*/
 
-    Psi_i = nodes->GetSolution(iPoint);
-    Psi_j = nodes->GetSolution(jPoint);
+    auto Psi_i = nodes->GetSolution(iPoint);
+    auto Psi_j = nodes->GetSolution(jPoint);
     numerics->SetAdjointVar(Psi_i, Psi_j);
 
     /*--- Primitive variables w/o reconstruction ---*/
 
-    V_i = solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(iPoint);
-    V_j = solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(jPoint);
-    numerics->SetPrimitive(V_i, V_j);
+    numerics->SetPrimitive(flowNodes->GetPrimitive(iPoint), flowNodes->GetPrimitive(jPoint));
 
     /*--- Grid velocities for dynamic meshes ---*/
 
@@ -1123,6 +1195,8 @@ void CAdjEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_cont
 
     if (muscl) {
 
+      unsigned short iDim;
+
       for (iDim = 0; iDim < nDim; iDim++) {
         Vector_i[iDim] = 0.5*(geometry->nodes->GetCoord(jPoint, iDim) - geometry->nodes->GetCoord(iPoint, iDim));
         Vector_j[iDim] = 0.5*(geometry->nodes->GetCoord(iPoint, iDim) - geometry->nodes->GetCoord(jPoint, iDim));
@@ -1138,8 +1212,8 @@ void CAdjEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_cont
         Limiter_j = nodes->GetLimiter(jPoint);
       }
 
-      for (iVar = 0; iVar < nVar; iVar++) {
-        Project_Grad_i = 0; Project_Grad_j = 0;
+      for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+        su2double Project_Grad_i = 0, Project_Grad_j = 0;
         for (iDim = 0; iDim < nDim; iDim++) {
           Project_Grad_i += Vector_i[iDim]*Gradient_i[iVar][iDim];
           Project_Grad_j += Vector_j[iDim]*Gradient_j[iVar][iDim];
@@ -1157,7 +1231,6 @@ void CAdjEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_cont
       /* Check our reconstruction for exceeding bounds on the
        adjoint density. */
 
-      su2double adj_limit = config->GetAdjointLimit();
       bool phi_bound_i = (fabs(Solution_i[0]) > adj_limit);
       bool phi_bound_j = (fabs(Solution_j[0]) > adj_limit);
 
@@ -1171,13 +1244,13 @@ void CAdjEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_cont
        from previous iterations. */
 
       if (nodes->GetNon_Physical(iPoint)) {
-        counter_local++;
-        for (iVar = 0; iVar < nVar; iVar++)
+        counter_thread++;
+        for (unsigned short iVar = 0; iVar < nVar; iVar++)
           Solution_i[iVar] = Psi_i[iVar];
       }
       if (nodes->GetNon_Physical(jPoint)) {
-        counter_local++;
-        for (iVar = 0; iVar < nVar; iVar++)
+        counter_thread++;
+        for (unsigned short iVar = 0; iVar < nVar; iVar++)
           Solution_j[iVar] = Psi_j[iVar];
       }
 
@@ -1187,23 +1260,31 @@ void CAdjEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_cont
 
     /*--- Compute the residual---*/
 
-    numerics->ComputeResidual(Residual_i, Residual_j, Jacobian_ii, Jacobian_ij, Jacobian_ji, Jacobian_jj, config);
+    numerics->ComputeResidual(work.Res_i, work.Res_j, work.Jac_ii, work.Jac_ij, work.Jac_ji, work.Jac_jj, config);
 
     /*--- Add and Subtract Residual ---*/
 
-    LinSysRes.SubtractBlock(iPoint, Residual_i);
-    LinSysRes.SubtractBlock(jPoint, Residual_j);
+    LinSysRes.SubtractBlock(iPoint, work.Res_i);
+    LinSysRes.SubtractBlock(jPoint, work.Res_j);
 
     /*--- Implicit contribution to the residual ---*/
 
     if (implicit) {
-      Jacobian.SubtractBlock2Diag(iPoint, Jacobian_ii);
-      Jacobian.SubtractBlock(iPoint, jPoint, Jacobian_ij);
-      Jacobian.SubtractBlock(jPoint, iPoint, Jacobian_ji);
-      Jacobian.SubtractBlock2Diag(jPoint, Jacobian_jj);
+      Jacobian.SubtractBlock2Diag(iPoint, work.Jac_ii);
+      Jacobian.SubtractBlock(iPoint, jPoint, work.Jac_ij);
+      Jacobian.SubtractBlock(jPoint, iPoint, work.Jac_ji);
+      Jacobian.SubtractBlock2Diag(jPoint, work.Jac_jj);
     }
 
   }
+  END_SU2_OMP_FOR
+  } // end color loop
+
+  SU2_OMP_CRITICAL
+  counter_local += counter_thread;
+  END_SU2_OMP_CRITICAL
+  }
+  END_SU2_OMP_PARALLEL
 
   /*--- Warning message about non-physical reconstructions. ---*/
 
@@ -1329,8 +1410,7 @@ void CAdjEulerSolver::Source_Template(CGeometry *geometry, CSolver **solver_cont
 
 void CAdjEulerSolver::SetCentered_Dissipation_Sensor(CGeometry *geometry, CConfig *config) {
 
-  unsigned long iPoint;
-  su2double SharpEdge_Distance, eps, ds, scale, Sensor, Param_Kappa_2, Param_Kappa_4;
+  su2double eps, scale, Param_Kappa_2, Param_Kappa_4;
 
   eps = config->GetVenkat_LimiterCoeff()*config->GetRefElemLength();
   Param_Kappa_2 = config->GetKappa_2nd_AdjFlow();
@@ -1339,20 +1419,26 @@ void CAdjEulerSolver::SetCentered_Dissipation_Sensor(CGeometry *geometry, CConfi
   if (Param_Kappa_2 != 0.0) scale = 2.0 * Param_Kappa_4 / Param_Kappa_2;
   else scale = 0.0;
 
-  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+  const su2double sharpOffset = config->GetAdjSharp_LimiterCoeff()*eps;
+
+  SU2_OMP_PARALLEL
+  {
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
 
-    SharpEdge_Distance = (geometry->nodes->GetSharpEdge_Distance(iPoint) - config->GetAdjSharp_LimiterCoeff()*eps);
+    const su2double SharpEdge_Distance = (geometry->nodes->GetSharpEdge_Distance(iPoint) - sharpOffset);
 
-    ds = 0.0;
+    su2double ds = 0.0;
     if (SharpEdge_Distance < -eps) ds = 1.0;
     if (fabs(SharpEdge_Distance) <= eps) ds = 1.0 - (0.5*(1.0+(SharpEdge_Distance/eps)+(1.0/PI_NUMBER)*sin(PI_NUMBER*SharpEdge_Distance/eps)));
     if (SharpEdge_Distance > eps) ds = 0.0;
 
-    Sensor = scale * ds;
-
-    nodes->SetSensor(iPoint,Sensor);
+    nodes->SetSensor(iPoint, scale * ds);
 
   }
+  END_SU2_OMP_FOR
+  }
+  END_SU2_OMP_PARALLEL
 
   /*--- MPI parallelization ---*/
 
@@ -1434,62 +1520,66 @@ void CAdjEulerSolver::ExplicitEuler_Iteration(CGeometry *geometry, CSolver **sol
 
 void CAdjEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
-  unsigned short iVar;
-  unsigned long iPoint, total_index;
-  su2double Delta, *local_Res_TruncError, Vol;
+  const auto flowNodes = solver_container[FLOW_SOL]->GetNodes();
+  const su2double relax = config->GetRelaxation_Factor_Adjoint();
 
-  /*--- Set maximum residual to zero ---*/
+  SU2_OMP_PARALLEL
+  {
+  /*--- Set shared residual variables to 0 and declare
+   *    local ones for current thread to work on. ---*/
 
   SetResToZero();
 
+  su2double resMax[MAXNVAR] = {0.0}, resRMS[MAXNVAR] = {0.0};
+  unsigned long idxMax[MAXNVAR] = {0};
+
   /*--- Build implicit system ---*/
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+  SU2_OMP_FOR_(schedule(static,omp_chunk_size) SU2_NOWAIT)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
     /*--- Read the residual ---*/
 
-    local_Res_TruncError = nodes->GetResTruncError(iPoint);
-
-    /*--- Read the volume ---*/
-
-    Vol = geometry->nodes->GetVolume(iPoint);
+    su2double* local_Res_TruncError = nodes->GetResTruncError(iPoint);
 
     /*--- Modify matrix diagonal to assure diagonal dominance ---*/
 
-    if (solver_container[FLOW_SOL]->GetNodes()->GetDelta_Time(iPoint) != 0.0) {
-      Delta = Vol / solver_container[FLOW_SOL]->GetNodes()->GetDelta_Time(iPoint);
-      Jacobian.AddVal2Diag(iPoint, Delta);
+    const su2double dt = flowNodes->GetDelta_Time(iPoint);
+
+    if (dt != 0.0) {
+      Jacobian.AddVal2Diag(iPoint, geometry->nodes->GetVolume(iPoint) / dt);
     }
     else {
       Jacobian.SetVal2Diag(iPoint, 1.0);
-      for (iVar = 0; iVar < nVar; iVar++) {
-        total_index = iPoint*nVar + iVar;
-        LinSysRes[total_index] = 0.0;
-        local_Res_TruncError[iVar] = 0.0;
-      }
+      LinSysRes.SetBlock_Zero(iPoint);
+      for (unsigned short iVar = 0; iVar < nVar; iVar++) local_Res_TruncError[iVar] = 0.0;
     }
 
     /*--- Right hand side of the system (-Residual) and initial guess (x = 0) ---*/
 
-    for (iVar = 0; iVar < nVar; iVar++) {
-      total_index = iPoint*nVar+iVar;
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      const auto total_index = iPoint*nVar+iVar;
       LinSysRes[total_index] = -(LinSysRes[total_index] + local_Res_TruncError[iVar]);
       LinSysSol[total_index] = 0.0;
-      Residual_RMS[iVar] += LinSysRes[total_index]*LinSysRes[total_index];
-      AddRes_Max(iVar, fabs(LinSysRes[total_index]), geometry->nodes->GetGlobalIndex(iPoint), geometry->nodes->GetCoord(iPoint));
+      ResidualReductions_PerThread(iPoint, iVar, LinSysRes[total_index], resRMS, resMax, idxMax);
     }
 
   }
+  END_SU2_OMP_FOR
 
   /*--- Initialize residual and solution at the ghost points ---*/
 
-  for (iPoint = nPointDomain; iPoint < nPoint; iPoint++) {
-    for (iVar = 0; iVar < nVar; iVar++) {
-      total_index = iPoint*nVar + iVar;
-      LinSysRes[total_index] = 0.0;
-      LinSysSol[total_index] = 0.0;
-    }
+  SU2_OMP_FOR_(schedule(static,OMP_MIN_SIZE) SU2_NOWAIT)
+  for (unsigned long iPoint = nPointDomain; iPoint < nPoint; iPoint++) {
+    LinSysRes.SetBlock_Zero(iPoint);
+    LinSysSol.SetBlock_Zero(iPoint);
   }
+  END_SU2_OMP_FOR
+
+  /*--- "Add" residuals from all threads to global residual variables
+   *    (this also computes the root mean square residual). ---*/
+
+  ResidualReductions_FromAllThreads(geometry, config, resRMS, resMax, idxMax);
 
   /*--- Solve or smooth the linear system ---*/
 
@@ -1497,19 +1587,19 @@ void CAdjEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **sol
 
   /*--- Update solution (system written in terms of increments) ---*/
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
-    for (iVar = 0; iVar < nVar; iVar++) {
-      nodes->AddSolution(iPoint,iVar, config->GetRelaxation_Factor_Adjoint()*LinSysSol[iPoint*nVar+iVar]);
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      nodes->AddSolution(iPoint,iVar, relax*LinSysSol(iPoint,iVar));
     }
+  END_SU2_OMP_FOR
 
   /*--- MPI solution ---*/
 
   InitiateComms(geometry, config, SOLUTION);
   CompleteComms(geometry, config, SOLUTION);
-
-  /*--- Compute the root mean square residual ---*/
-
-  SetResidual_RMS(geometry, config);
+  }
+  END_SU2_OMP_PARALLEL
 
 }
 
@@ -124,6 +124,10 @@ CAdjNSSolver::CAdjNSSolver(CGeometry *geometry, CConfig *config, unsigned short
   LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
   LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
 
+  /*--- OpenMP initialization. ---*/
+
+  HybridParallelInitialization(geometry);
+
   /*--- Jacobians and vector structures for implicit computations ---*/
 
   if (config->GetKind_TimeIntScheme_AdjFlow() == EULER_IMPLICIT) {
@@ -309,10 +313,6 @@ void CAdjNSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
 
 void CAdjNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh, unsigned short iRKStep, unsigned short RunTime_EqSystem, bool Output) {
 
-  unsigned long iPoint, nonPhysicalPoints = 0;
-  su2double SharpEdge_Distance;
-  bool physical = true;
-
   /*--- Retrieve information about the spatial and temporal integration for the
    adjoint equations (note that the flow problem may use different methods). ---*/
 
@@ -328,26 +328,7 @@ void CAdjNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 
   /*--- Residual initialization ---*/
 
-  for (iPoint = 0; iPoint < nPoint; iPoint ++) {
-
-    /*--- Get the distance form a sharp edge ---*/
-
-    SharpEdge_Distance = geometry->nodes->GetSharpEdge_Distance(iPoint);
-
-    /*--- Set the primitive variables compressible
-     adjoint variables ---*/
-
-    physical = nodes->SetPrimVar(iPoint,SharpEdge_Distance, false, config);
-
-    /* Check for non-realizable states for reporting. */
-
-    if (!physical) nonPhysicalPoints++;
-
-    /*--- Initialize the convective residual vector ---*/
-
-    if (!Output) LinSysRes.SetBlock_Zero(iPoint);
-
-  }
+  unsigned long nonPhysicalPoints = SetPrimitive_Variables(geometry, config, Output);
 
   /*--- Compute gradients adj for solution reconstruction and viscous term ---*/
 
@@ -399,26 +380,36 @@ void CAdjNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 void CAdjNSSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                                     CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
 
-  CNumerics* numerics = numerics_container[VISC_TERM];
+  const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
 
-  unsigned long iPoint, jPoint, iEdge;
+  const auto flowNodes = solver_container[FLOW_SOL]->GetNodes();
 
-  bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  SU2_OMP_PARALLEL_(if(!SerialEdgeLoops))
+  {
+  /*--- Pick one numerics object per thread. ---*/
+  CNumerics* numerics = numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS];
+
+  CEdgeWorkspace work;
 
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  /*--- Loop over edge colors, edges of the same color do not share points. ---*/
+  for (auto color : EdgeColoring)
+  {
+  SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+  for (auto k = 0ul; k < color.size; ++k) {
+
+    auto iEdge = color.indices[k];
 
     /*--- Points in edge, coordinates and normal vector---*/
 
-    iPoint = geometry->edges->GetNode(iEdge,0);
-    jPoint = geometry->edges->GetNode(iEdge,1);
+    auto iPoint = geometry->edges->GetNode(iEdge,0);
+    auto jPoint = geometry->edges->GetNode(iEdge,1);
 
     numerics->SetCoord(geometry->nodes->GetCoord(iPoint), geometry->nodes->GetCoord(jPoint));
     numerics->SetNormal(geometry->edges->GetNormal(iEdge));
 
     /*--- Primitive variables w/o reconstruction and adjoint variables w/o reconstruction---*/
 
-    numerics->SetPrimitive(solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(iPoint),
-                           solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(jPoint));
+    numerics->SetPrimitive(flowNodes->GetPrimitive(iPoint), flowNodes->GetPrimitive(jPoint));
 
     numerics->SetAdjointVar(nodes->GetSolution(iPoint), nodes->GetSolution(jPoint));
 
@@ -428,21 +419,25 @@ void CAdjNSSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_contai
 
     /*--- Compute residual ---*/
 
-    numerics->ComputeResidual(Residual_i, Residual_j, Jacobian_ii, Jacobian_ij, Jacobian_ji, Jacobian_jj, config);
+    numerics->ComputeResidual(work.Res_i, work.Res_j, work.Jac_ii, work.Jac_ij, work.Jac_ji, work.Jac_jj, config);
 
     /*--- Update adjoint viscous residual ---*/
 
-    LinSysRes.SubtractBlock(iPoint, Residual_i);
-    LinSysRes.AddBlock(jPoint, Residual_j);
+    LinSysRes.SubtractBlock(iPoint, work.Res_i);
+    LinSysRes.AddBlock(jPoint, work.Res_j);
 
     if (implicit) {
-      Jacobian.SubtractBlock2Diag(iPoint, Jacobian_ii);
-      Jacobian.SubtractBlock(iPoint, jPoint, Jacobian_ij);
-      Jacobian.AddBlock(jPoint, iPoint, Jacobian_ji);
-      Jacobian.AddBlock2Diag(jPoint, Jacobian_jj);
+      Jacobian.SubtractBlock2Diag(iPoint, work.Jac_ii);
+      Jacobian.SubtractBlock(iPoint, jPoint, work.Jac_ij);
+      Jacobian.AddBlock(jPoint, iPoint, work.Jac_ji);
+      Jacobian.AddBlock2Diag(jPoint, work.Jac_jj);
     }
 
   }
+  END_SU2_OMP_FOR
+  } // end color loop
+  }
+  END_SU2_OMP_PARALLEL
 
 }
 
@@ -2445,6 +2445,8 @@ void CEulerSolver::ExplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
 
 void CEulerSolver::PrepareImplicitIteration(CGeometry *geometry, CSolver**, CConfig *config) {
 
+  SU2_PROFILE_SCOPE("Jacobian_Assembly");
+
   struct LowMachPrec {
     const CEulerSolver* solver;
     const bool active;
@@ -163,6 +163,11 @@ CFEASolver::CFEASolver(CGeometry *geometry, CConfig *config) : CFEASolverBase(ge
   /*--- Initialize structures for hybrid-parallel mode. ---*/
   HybridParallelInitialization(geometry);
 
+  /*--- Store the reference gradients of the elements, the reference coordinates are registered
+   *    as AD inputs for the adjoint, and with prestretch they are not the mesh coordinates. ---*/
+  if (config->GetCache_RefGradients() && !config->GetDiscrete_Adjoint() && !config->GetPrestretch())
+    Set_RefGradients(geometry);
+
   /*--- Initialize the value of the total objective function ---*/
   Total_OFRefGeom = 0.0;
   Total_OFRefNode = 0.0;
@@ -278,6 +283,47 @@ void CFEASolver::HybridParallelInitialization(CGeometry* geometry) {
 #endif
 }
 
+void CFEASolver::Set_RefGradients(CGeometry* geometry) {
+
+  /*--- Offsets of each element in the storage. ---*/
+
+  RefGradientsIdx.resize(nElement+1);
+  RefGradientsIdx[0] = 0;
+
+  for (auto iElem = 0ul; iElem < nElement; iElem++) {
+    int EL_KIND;
+    unsigned short nNodes;
+    GetElemKindAndNumNodes(geometry->elem[iElem]->GetVTK_Type(), EL_KIND, nNodes);
+    RefGradientsIdx[iElem+1] = RefGradientsIdx[iElem] + element_container[FEA_TERM][EL_KIND]->GetnRefGradients();
+  }
+  RefGradients.resize(RefGradientsIdx[nElement]);
+
+  /*--- Compute the gradients, each element writes to its own range. ---*/
+
+  SU2_OMP_PARALLEL
+  {
+    SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+    for (auto iElem = 0ul; iElem < nElement; iElem++) {
+
+      int EL_KIND;
+      unsigned short nNodes;
+      GetElemKindAndNumNodes(geometry->elem[iElem]->GetVTK_Type(), EL_KIND, nNodes);
+
+      CElement* element = element_container[FEA_TERM][EL_KIND+omp_get_thread_num()*MAX_FE_KINDS];
+
+      for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
+        auto iPoint = geometry->elem[iElem]->GetNode(iNode);
+        for (unsigned short iDim = 0; iDim < nDim; iDim++)
+          element->SetRef_Coord(iNode, iDim, Get_ValCoord(geometry, iPoint, iDim));
+      }
+      element->ComputeGrad_Linear();
+      element->GetRefGradients(&RefGradients[RefGradientsIdx[iElem]]);
+    }
+    END_SU2_OMP_FOR
+  }
+  END_SU2_OMP_PARALLEL
+}
+
 void CFEASolver::Set_ElementProperties(CGeometry *geometry, CConfig *config) {
 
   const auto iZone = config->GetiZone();
@@ -693,7 +739,9 @@ void CFEASolver::Compute_StiffMatrix(CGeometry *geometry, CNumerics **numerics,
         /*--- Compute the components of the jacobian and the stress term, one numerics per thread. ---*/
         int NUM_TERM = thread*MAX_TERMS + element_properties[iElem]->GetMat_Mod();
 
+        element->SetRefGradients(Get_RefGradients(iElem));
         numerics[NUM_TERM]->Compute_Tangent_Matrix(element, config);
+        element->SetRefGradients(nullptr);
 
         /*--- Update residual and stiffness matrix with contributions from the element. ---*/
         for (iNode = 0; iNode < nNodes; iNode++) {
@@ -802,7 +850,9 @@ void CFEASolver::Compute_StiffMatrix_NodalStressRes(CGeometry *geometry, CNumeri
         /*--- Compute the components of the Jacobian and the stress term for the material. ---*/
         int NUM_TERM = thread*MAX_TERMS + element_properties[iElem]->GetMat_Mod();
 
+        fea_elem->SetRefGradients(Get_RefGradients(iElem));
         numerics[NUM_TERM]->Compute_Tangent_Matrix(fea_elem, config);
+        fea_elem->SetRefGradients(nullptr);
 
         /*--- Compute the electric component of the Jacobian and the stress term. ---*/
         if (de_effects)
@@ -1098,7 +1148,9 @@ void CFEASolver::Compute_NodalStressRes(CGeometry *geometry, CNumerics **numeric
         /*--- Compute the components of the Jacobian and the stress term for the material. ---*/
         int NUM_TERM = thread*MAX_TERMS + element_properties[iElem]->GetMat_Mod();
 
+        element->SetRefGradients(Get_RefGradients(iElem));
         numerics[NUM_TERM]->Compute_NodalStress_Term(element, config);
+        element->SetRefGradients(nullptr);
 
         for (iNode = 0; iNode < nNodes; iNode++) {
           if (LockStrategy) omp_set_lock(&UpdateLocks[indexNode[iNode]]);
@@ -1214,7 +1266,9 @@ void CFEASolver::Compute_NodalStress(CGeometry *geometry, CNumerics **numerics,
         /*--- Compute the averaged nodal stresses. ---*/
         int NUM_TERM = thread*MAX_TERMS + element_properties[iElem]->GetMat_Mod();
 
+        element->SetRefGradients(Get_RefGradients(iElem));
         auto elStress = numerics[NUM_TERM]->Compute_Averaged_NodalStress(element, config);
+        element->SetRefGradients(nullptr);
 
         stressPen += exp(ks_mult * elStress*simp_penalty*stress_scale);
 
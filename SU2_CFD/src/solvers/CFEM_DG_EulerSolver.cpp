@@ -32,6 +32,9 @@
 #include "../../include/fluid/CVanDerWaalsGas.hpp"
 #include "../../include/fluid/CPengRobinson.hpp"
 #include "../../include/fluid/CCoolProp.hpp"
+#include "../../../Common/include/linear_algebra/CMatrixVectorProduct.hpp"
+#include "../../../Common/include/linear_algebra/CPreconditioner.hpp"
+#include <functional>
 
 #define SIZE_ARR_NORM 8
 
@@ -39,8 +42,6 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(void) : CSolver() {
 
   /*--- Basic array initialization ---*/
 
-  FluidModel = nullptr;
-
   CD_Inv = nullptr; CL_Inv = nullptr; CSF_Inv = nullptr;  CEff_Inv = nullptr;
   CMx_Inv = nullptr; CMy_Inv = nullptr; CMz_Inv = nullptr;
   CFx_Inv = nullptr; CFy_Inv = nullptr; CFz_Inv = nullptr;
@@ -73,8 +74,6 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CConfig *config, unsigned short val_nDi
 
   /*--- Basic array initialization ---*/
 
-  FluidModel = nullptr;
-
   CD_Inv = nullptr; CL_Inv = nullptr; CSF_Inv = nullptr;  CEff_Inv = nullptr;
   CMx_Inv = nullptr; CMy_Inv = nullptr; CMz_Inv = nullptr;
   CFx_Inv = nullptr; CFy_Inv = nullptr; CFz_Inv = nullptr;
@@ -118,7 +117,6 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CConfig *config, unsigned short val_nDi
 CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh) : CSolver() {
 
   /*--- Array initialization ---*/
-  FluidModel = nullptr;
 
   CD_Inv = nullptr; CL_Inv = nullptr; CSF_Inv = nullptr; CEff_Inv = nullptr;
   CMx_Inv = nullptr;   CMy_Inv = nullptr;   CMz_Inv = nullptr;
@@ -262,6 +260,11 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
     sizeWorkArray = max(sizeWorkArray, sizePredictorADER);
   }
 
+  /*--- Additional storage for the work tensors of the sum factorization
+        kernels, which are used in the volume residual. ---*/
+  if( config->GetSum_Factorization_DGFEM() )
+    sizeWorkArray += 3*nPadGemm*max(nIntegrationMax, nDOFsMax);
+
   /*--- Perform the non-dimensionalization for the flow equations using the
         specified reference values. ---*/
   SetNondimensionalization(config, iMesh, true);
@@ -419,8 +422,12 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
 
   /*--- First the internal matching faces. ---*/
   unsigned long sizeVecResFaces = 0;
+  startLocResMatchingFaces.resize(nMatchingInternalFacesWithHaloElem[nTimeLevels]+1);
   for(unsigned long i=0; i<nMatchingInternalFacesWithHaloElem[nTimeLevels]; ++i) {
 
+    /* Store the starting location of the residual of this face. */
+    startLocResMatchingFaces[i] = sizeVecResFaces;
+
     /* Determine the time level of the face. */
     const unsigned long  elem0     = matchingInternalFaces[i].elemID0;
     const unsigned long  elem1     = matchingInternalFaces[i].elemID1;
@@ -487,6 +494,8 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
       startLocResInternalFacesWithHaloElem[timeLevel+1] = sizeVecResFaces;
   }
 
+  startLocResMatchingFaces.back() = sizeVecResFaces;
+
   /* Set the uninitialized values of startLocResInternalFacesLocalElem. */
   for(unsigned short i=1; i<=nTimeLevels; ++i) {
     if(startLocResInternalFacesLocalElem[i] == 0)
@@ -686,9 +695,11 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
   }
 
   /* Check if the exact Jacobian of the spatial discretization must be
-     determined. If so, the color of each DOF must be determined, which
-     is converted to the DOFs for each color. */
-  if( config->GetJacobian_Spatial_Discretization_Only() ) {
+     determined or if the implicit time integration is used, which needs the
+     diagonal blocks of the Jacobian for its preconditioner. If so, the color
+     of each DOF must be determined, which is converted to the DOFs for each color. */
+  if( config->GetJacobian_Spatial_Discretization_Only() ||
+      config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT ) {
 
     /* Write a message that the graph coloring is performed. */
     if(rank == MASTER_NODE)
@@ -729,7 +740,7 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
 
 CFEM_DG_EulerSolver::~CFEM_DG_EulerSolver(void) {
 
-  delete FluidModel;
+  for(auto& model : FluidModel) delete model;
   delete blasFunctions;
 
   /*--- Array deallocation ---*/
@@ -813,6 +824,8 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
   config->SetViscosity_Ref(1.0);
   config->SetConductivity_Ref(1.0);
 
+  CFluidModel* auxFluidModel = nullptr;
+
   switch (config->GetKind_FluidModel()) {
 
     case STANDARD_AIR:
@@ -820,84 +833,84 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
       if (config->GetSystemMeasurements() == SI) config->SetGas_Constant(287.058);
       else if (config->GetSystemMeasurements() == US) config->SetGas_Constant(1716.49);
 
-      FluidModel = new CIdealGas(1.4, config->GetGas_Constant(), config->GetCompute_Entropy());
+      auxFluidModel = new CIdealGas(1.4, config->GetGas_Constant(), config->GetCompute_Entropy());
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
       break;
 
     case IDEAL_GAS:
 
-      FluidModel = new CIdealGas(Gamma, config->GetGas_Constant(), config->GetCompute_Entropy());
+      auxFluidModel = new CIdealGas(Gamma, config->GetGas_Constant(), config->GetCompute_Entropy());
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
       break;
 
     case VW_GAS:
 
-      FluidModel = new CVanDerWaalsGas(Gamma, config->GetGas_Constant(),
+      auxFluidModel = new CVanDerWaalsGas(Gamma, config->GetGas_Constant(),
                                        config->GetPressure_Critical(), config->GetTemperature_Critical());
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
       break;
 
     case PR_GAS:
 
-      FluidModel = new CPengRobinson(Gamma, config->GetGas_Constant(), config->GetPressure_Critical(),
+      auxFluidModel = new CPengRobinson(Gamma, config->GetGas_Constant(), config->GetPressure_Critical(),
                                      config->GetTemperature_Critical(), config->GetAcentric_Factor());
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
       break;
 
     case COOLPROP:
 
-      FluidModel = new CCoolProp(config->GetFluid_Name());
+      auxFluidModel = new CCoolProp(config->GetFluid_Name());
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
       break;
 
   }
 
-  Mach2Vel_FreeStream = FluidModel->GetSoundSpeed();
+  Mach2Vel_FreeStream = auxFluidModel->GetSoundSpeed();
 
   /*--- Compute the Free Stream velocity, using the Mach number ---*/
 
@@ -937,17 +950,17 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
             from the dimensional version of Sutherland's law or the constant
             viscosity, depending on the input option.---*/
 
-      FluidModel->SetLaminarViscosityModel(config);
+      auxFluidModel->SetLaminarViscosityModel(config);
 
-      Viscosity_FreeStream = FluidModel->GetLaminarViscosity();
+      Viscosity_FreeStream = auxFluidModel->GetLaminarViscosity();
       config->SetViscosity_FreeStream(Viscosity_FreeStream);
 
       Density_FreeStream = Reynolds*Viscosity_FreeStream/(Velocity_Reynolds*config->GetLength_Reynolds());
       config->SetDensity_FreeStream(Density_FreeStream);
-      FluidModel->SetTDState_rhoT(Density_FreeStream, Temperature_FreeStream);
-      Pressure_FreeStream = FluidModel->GetPressure();
+      auxFluidModel->SetTDState_rhoT(Density_FreeStream, Temperature_FreeStream);
+      Pressure_FreeStream = auxFluidModel->GetPressure();
       config->SetPressure_FreeStream(Pressure_FreeStream);
-      Energy_FreeStream = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
+      Energy_FreeStream = auxFluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
 
     }
 
@@ -955,10 +968,10 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
 
     else {
 
-      FluidModel->SetLaminarViscosityModel(config);
-      Viscosity_FreeStream = FluidModel->GetLaminarViscosity();
+      auxFluidModel->SetLaminarViscosityModel(config);
+      Viscosity_FreeStream = auxFluidModel->GetLaminarViscosity();
       config->SetViscosity_FreeStream(Viscosity_FreeStream);
-      Energy_FreeStream = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
+      Energy_FreeStream = auxFluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
 
     }
 
@@ -972,7 +985,7 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
     /*--- For inviscid flow, energy is calculated from the specified
      FreeStream quantities using the proper gas law. ---*/
 
-    Energy_FreeStream = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
+    Energy_FreeStream = auxFluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
 
   }
 
@@ -1049,49 +1062,56 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
   Omega_FreeStreamND = Density_FreeStreamND*Tke_FreeStreamND/max((Viscosity_FreeStreamND*config->GetTurb2LamViscRatio_FreeStream()), 1.e-25);
   config->SetOmega_FreeStreamND(Omega_FreeStreamND);
 
-  /*--- Initialize the dimensionless Fluid Model that will be used to solve the dimensionless problem ---*/
+  /*--- Auxilary (dimensional) FluidModel no longer needed. ---*/
 
-  /*--- Delete the original (dimensional) FluidModel object before replacing. ---*/
+  delete auxFluidModel;
 
-  delete FluidModel;
+  /*--- Initialize the dimensionless Fluid Model that will be used to solve the dimensionless problem.
+   *    One object is created per OpenMP thread, such that the tasks of the task list can be carried
+   *    out in parallel. GetFluidModel() gives the object of each thread. ---*/
 
-  switch (config->GetKind_FluidModel()) {
+  for(auto& model : FluidModel) delete model;
+  FluidModel.assign(omp_get_max_threads(), nullptr);
 
-    case STANDARD_AIR:
-      FluidModel = new CIdealGas(1.4, Gas_ConstantND, config->GetCompute_Entropy());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+  for(int thread = 0; thread < omp_get_max_threads(); ++thread) {
+    switch (config->GetKind_FluidModel()) {
 
-    case IDEAL_GAS:
-      FluidModel = new CIdealGas(Gamma, Gas_ConstantND, config->GetCompute_Entropy());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+      case STANDARD_AIR:
+        FluidModel[thread] = new CIdealGas(1.4, Gas_ConstantND, config->GetCompute_Entropy());
+        FluidModel[thread]->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
+        break;
 
-    case VW_GAS:
-      FluidModel = new CVanDerWaalsGas(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
-                                       config->GetTemperature_Critical()/config->GetTemperature_Ref());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+      case IDEAL_GAS:
+        FluidModel[thread] = new CIdealGas(Gamma, Gas_ConstantND, config->GetCompute_Entropy());
+        FluidModel[thread]->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
+        break;
 
-    case PR_GAS:
-      FluidModel = new CPengRobinson(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
-                                     config->GetTemperature_Critical()/config->GetTemperature_Ref(), config->GetAcentric_Factor());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+      case VW_GAS:
+        FluidModel[thread] = new CVanDerWaalsGas(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
+                                                 config->GetTemperature_Critical()/config->GetTemperature_Ref());
+        FluidModel[thread]->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
+        break;
 
-    case COOLPROP:
-      FluidModel = new CCoolProp(config->GetFluid_Name());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
-  }
+      case PR_GAS:
+        FluidModel[thread] = new CPengRobinson(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
+                                               config->GetTemperature_Critical()/config->GetTemperature_Ref(), config->GetAcentric_Factor());
+        FluidModel[thread]->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
+        break;
 
-  Energy_FreeStreamND = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStreamND*ModVel_FreeStreamND;
+      case COOLPROP:
+        FluidModel[thread] = new CCoolProp(config->GetFluid_Name());
+        FluidModel[thread]->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
+        break;
+    }
 
-  if (viscous) {
-    FluidModel->SetLaminarViscosityModel(config);
-    FluidModel->SetThermalConductivityModel(config);
+    if (viscous) {
+      FluidModel[thread]->SetLaminarViscosityModel(config);
+      FluidModel[thread]->SetThermalConductivityModel(config);
+    }
   }
 
+  Energy_FreeStreamND = FluidModel[0]->GetStaticEnergy() + 0.5*ModVel_FreeStreamND*ModVel_FreeStreamND;
+
   if (tkeNeeded) { Energy_FreeStreamND += Tke_FreeStreamND; };  config->SetEnergy_FreeStreamND(Energy_FreeStreamND);
 
   Energy_Ref = Energy_FreeStream/Energy_FreeStreamND; config->SetEnergy_Ref(Energy_Ref);
@@ -3204,9 +3224,9 @@ void CFEM_DG_EulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_co
           const su2double Mom2         = solDOF[1]*solDOF[1] + solDOF[2]*solDOF[2];
           const su2double StaticEnergy = DensityInv*(solDOF[3] - 0.5*DensityInv*Mom2);
 
-          FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-          const su2double Pressure    = FluidModel->GetPressure();
-          const su2double Temperature = FluidModel->GetTemperature();
+          GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+          const su2double Pressure    = GetFluidModel()->GetPressure();
+          const su2double Temperature = GetFluidModel()->GetTemperature();
 
           if((Pressure < 0.0) || (solDOF[0] < 0.0) || (Temperature < 0.0)) {
             ++ErrorCounter;
@@ -3230,9 +3250,9 @@ void CFEM_DG_EulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_co
                                        + solDOF[3]*solDOF[3];
           const su2double StaticEnergy = DensityInv*(solDOF[4] - 0.5*DensityInv*Mom2);
 
-          FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-          const su2double Pressure    = FluidModel->GetPressure();
-          const su2double Temperature = FluidModel->GetTemperature();
+          GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+          const su2double Pressure    = GetFluidModel()->GetPressure();
+          const su2double Temperature = GetFluidModel()->GetTemperature();
 
           if((Pressure < 0.0) || (solDOF[0] < 0.0) || (Temperature < 0.0)) {
             ++ErrorCounter;
@@ -3690,8 +3710,8 @@ void CFEM_DG_EulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_con
 
               /*--- Compute the maximum value of the wave speed. This is a rather
                     conservative estimate. ---*/
-              FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-              const su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
+              GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+              const su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
               const su2double SoundSpeed  = sqrt(fabs(SoundSpeed2));
 
               const su2double radx     = fabs(u-gridVel[0]) + SoundSpeed;
@@ -3722,8 +3742,8 @@ void CFEM_DG_EulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_con
 
               /*--- Compute the maximum value of the wave speed. This is a rather
                     conservative estimate. ---*/
-              FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-              const su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
+              GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+              const su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
               const su2double SoundSpeed  = sqrt(fabs(SoundSpeed2));
 
               const su2double radx     = fabs(u-gridVel[0]) + SoundSpeed;
@@ -3834,311 +3854,265 @@ void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **sol
   /* Easier storage of the number of time levels.. */
   const unsigned short nTimeLevels = config->GetnLevels_TimeAccurateLTS();
 
-  /* Define and initialize the bool vector, that indicates whether or
-     not the tasks from the list have been completed. */
-  vector<bool> taskCompleted(tasksList.size(), false);
-
-  /* Allocate the memory for the work array and initialize it to zero to avoid
-     warnings in debug mode  about uninitialized memory when padding is applied. */
-  vector<su2double> workArrayVec(sizeWorkArray, 0.0);
-  su2double *workArray = workArrayVec.data();
-
-  /* While loop to carry out all the tasks in tasksList. */
-  unsigned long lowestIndexInList = 0;
-  while(lowestIndexInList < tasksList.size()) {
-
-    /* Find the next task that can be carried out. The outer loop is there
-       to make sure that a communication is completed in case there are no
-       other tasks */
-    for(unsigned short j=0; j<2; ++j) {
-      bool taskCarriedOut = false;
-      for(unsigned long i=lowestIndexInList; i<tasksList.size(); ++i) {
-
-        /* Determine whether or not it can be attempted to carry out
-           this task. */
-        bool taskCanBeCarriedOut = !taskCompleted[i];
-        for(unsigned short ind=0; ind<tasksList[i].nIndMustBeCompleted; ++ind) {
-          if( !taskCompleted[tasksList[i].indMustBeCompleted[ind]] )
-            taskCanBeCarriedOut = false;
-        }
-
-        if( taskCanBeCarriedOut ) {
-
-          /*--- Determine the actual task to be carried out and do so. The
-                only tasks that may fail are the completion of the non-blocking
-                communication. If that is the case the next task needs to be
-                found. ---*/
-          switch( tasksList[i].task ) {
-
-            case CTaskDefinition::ADER_PREDICTOR_STEP_COMM_ELEMENTS: {
-
-              /* Carry out the ADER predictor step for the elements whose
-                 solution must be communicated for this time level. */
-              const unsigned short level   = tasksList[i].timeLevel;
-              const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level]
-                                           + nVolElemInternalPerTimeLevel[level];
-              const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level+1];
-
-              ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
-
-            case CTaskDefinition::ADER_PREDICTOR_STEP_INTERNAL_ELEMENTS: {
-
-              /* Carry out the ADER predictor step for the elements whose
-                 solution must not be communicated for this time level. */
-              const unsigned short level   = tasksList[i].timeLevel;
-              const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level];
-              const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level]
-                                           + nVolElemInternalPerTimeLevel[level];
-              ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
-
-            case CTaskDefinition::INITIATE_MPI_COMMUNICATION: {
-
-              /* Start the MPI communication of the solution in the halo elements. */
-              Initiate_MPI_Communication(config, tasksList[i].timeLevel);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
-
-            case CTaskDefinition::COMPLETE_MPI_COMMUNICATION: {
-
-              /* Attempt to complete the MPI communication of the solution data.
-                 For j==0, SU2_MPI::Testall will be used, which returns false if
-                 not all requests can be completed. In that case the next task on
-                 the list is carried out. If j==1, this means that the next
-                 tasks are waiting for this communication to be completed and
-                 hence MPI_Waitall is used. */
-              if( Complete_MPI_Communication(config, tasksList[i].timeLevel,
-                                             j==1) )
-                taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
-
-            case CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION: {
-
-              /* Start the communication of the residuals, for which the
-                 reverse communication must be used. */
-              Initiate_MPI_ReverseCommunication(config, tasksList[i].timeLevel);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
-
-            case CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION: {
-
-              /* Attempt to complete the MPI communication of the residual data.
-                 For j==0, SU2_MPI::Testall will be used, which returns false if
-                 not all requests can be completed. In that case the next task on
-                 the list is carried out. If j==1, this means that the next
-                 tasks are waiting for this communication to be completed and
-                 hence MPI_Waitall is used. */
-              if( Complete_MPI_ReverseCommunication(config, tasksList[i].timeLevel,
-                                                    j==1) )
-                taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
-
-            case CTaskDefinition::ADER_TIME_INTERPOLATE_OWNED_ELEMENTS: {
-
-              /* Interpolate the predictor solution of the owned elements
-                 in time to the given time integration point for the
-                 given time level. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long nAdjElem = 0, *adjElem = nullptr;
-              if(level < (nTimeLevels-1)) {
-                nAdjElem = ownedElemAdjLowTimeLevel[level+1].size();
-                adjElem  = ownedElemAdjLowTimeLevel[level+1].data();
-              }
-
-              ADER_DG_TimeInterpolatePredictorSol(config, tasksList[i].intPointADER,
-                                                  nVolElemOwnedPerTimeLevel[level],
-                                                  nVolElemOwnedPerTimeLevel[level+1],
-                                                  nAdjElem, adjElem,
-                                                  tasksList[i].secondPartTimeIntADER,
-                                                  VecWorkSolDOFs[level].data());
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
-
-            case CTaskDefinition::ADER_TIME_INTERPOLATE_HALO_ELEMENTS: {
-
-              /* Interpolate the predictor solution of the halo elements
-                 in time to the given time integration point for the
-                 given time level. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long nAdjElem = 0, *adjElem = nullptr;
-              if(level < (nTimeLevels-1)) {
-                nAdjElem = haloElemAdjLowTimeLevel[level+1].size();
-                adjElem  = haloElemAdjLowTimeLevel[level+1].data();
-              }
+  /*--- The tasks are carried out by CTaskListRunner. The master thread walks the
+        list, carries out the MPI communication itself, and splits the other
+        tasks in chunks of elements or faces that are executed by all threads
+        as OpenMP tasks. With a single thread the list is processed inline. ---*/
+  const int nThreads = omp_get_max_threads();
+
+  /* Allocate the memory for the work arrays of the threads and initialize them to zero
+     to avoid warnings in debug mode about uninitialized memory when padding is applied. */
+  vector<vector<su2double> > workArrays(nThreads, vector<su2double>(sizeWorkArray, 0.0));
+
+  CTaskListRunner runner(tasksList, nThreads);
+
+  /* Function to start task i, which consists of nItems elements or faces. The kernel
+     is called for sub-ranges [beg,end) of [0,nItems) with the work array of the thread. */
+  using TaskKernel = std::function<void(unsigned long, unsigned long, su2double*)>;
+
+  auto startTask = [&](unsigned long i, unsigned long nItems, TaskKernel kernel) {
+    runner.StartTask(i, nItems, [&workArrays, kernel](unsigned long beg, unsigned long end, int thread) {
+      kernel(beg, end, workArrays[thread].data());
+    });
+  };
+
+  /* Carry out all the tasks in tasksList. */
+  runner.Run([&](unsigned long i, bool wait) {
+
+    /*--- Determine the actual task to be carried out and do so. The
+          only tasks that may fail are the completion of the non-blocking
+          communication. If that is the case the next task needs to be
+          found. ---*/
+    switch( tasksList[i].task ) {
+
+      case CTaskDefinition::ADER_PREDICTOR_STEP_COMM_ELEMENTS: {
+
+        /* Carry out the ADER predictor step for the elements whose
+           solution must be communicated for this time level. */
+        const unsigned short level   = tasksList[i].timeLevel;
+        const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level]
+                                     + nVolElemInternalPerTimeLevel[level];
+        const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level+1];
+
+        startTask(i, elemEnd-elemBeg, [=](unsigned long beg, unsigned long end, su2double *workArray) {
+          ADER_DG_PredictorStep(config, elemBeg+beg, elemBeg+end, workArray);
+        });
+        return true;
+      }
 
-              ADER_DG_TimeInterpolatePredictorSol(config, tasksList[i].intPointADER,
-                                                  nVolElemHaloPerTimeLevel[level],
-                                                  nVolElemHaloPerTimeLevel[level+1],
-                                                  nAdjElem, adjElem,
-                                                  tasksList[i].secondPartTimeIntADER,
-                                                  VecWorkSolDOFs[level].data());
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      case CTaskDefinition::ADER_PREDICTOR_STEP_INTERNAL_ELEMENTS: {
 
-            case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS: {
+        /* Carry out the ADER predictor step for the elements whose
+           solution must not be communicated for this time level. */
+        const unsigned short level   = tasksList[i].timeLevel;
+        const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level];
+        const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level]
+                                     + nVolElemInternalPerTimeLevel[level];
 
-              /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              Shock_Capturing_DG(config, nVolElemOwnedPerTimeLevel[level],
-                                 nVolElemOwnedPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+        startTask(i, elemEnd-elemBeg, [=](unsigned long beg, unsigned long end, su2double *workArray) {
+          ADER_DG_PredictorStep(config, elemBeg+beg, elemBeg+end, workArray);
+        });
+        return true;
+      }
 
-            case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_HALO_ELEMENTS: {
+      case CTaskDefinition::INITIATE_MPI_COMMUNICATION: {
 
-              /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              Shock_Capturing_DG(config, nVolElemHaloPerTimeLevel[level],
-                                 nVolElemHaloPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+        /* Start the MPI communication of the solution in the halo elements. */
+        Initiate_MPI_Communication(config, tasksList[i].timeLevel);
+        runner.CompleteTask(i);
+        return true;
+      }
 
-            case CTaskDefinition::VOLUME_RESIDUAL: {
+      case CTaskDefinition::COMPLETE_MPI_COMMUNICATION: {
+
+        /* Attempt to complete the MPI communication of the solution data.
+           If wait is false, SU2_MPI::Testall will be used, which returns false
+           if not all requests can be completed. In that case the next task on
+           the list is carried out. If wait is true, this means that the next
+           tasks are waiting for this communication to be completed and
+           hence MPI_Waitall is used. */
+        if( Complete_MPI_Communication(config, tasksList[i].timeLevel, wait) ) {
+          runner.CompleteTask(i);
+          return true;
+        }
+        return false;
+      }
 
-              /*--- Compute the volume portion of the residual. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              Volume_Residual(config, nVolElemOwnedPerTimeLevel[level],
-                              nVolElemOwnedPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      case CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION: {
 
-            case CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS: {
+        /* Start the communication of the residuals, for which the
+           reverse communication must be used. */
+        Initiate_MPI_ReverseCommunication(config, tasksList[i].timeLevel);
+        runner.CompleteTask(i);
+        return true;
+      }
 
-              /* Compute the residual of the faces that only involve owned elements. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long indResFaces = startLocResInternalFacesLocalElem[level];
-              ResidualFaces(config, nMatchingInternalFacesLocalElem[level],
-                            nMatchingInternalFacesLocalElem[level+1],
-                            indResFaces, numerics[CONV_TERM], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      case CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION: {
+
+        /* Attempt to complete the MPI communication of the residual data.
+           If wait is false, SU2_MPI::Testall will be used, which returns false
+           if not all requests can be completed. In that case the next task on
+           the list is carried out. If wait is true, this means that the next
+           tasks are waiting for this communication to be completed and
+           hence MPI_Waitall is used. */
+        if( Complete_MPI_ReverseCommunication(config, tasksList[i].timeLevel, wait) ) {
+          runner.CompleteTask(i);
+          return true;
+        }
+        return false;
+      }
 
-            case CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS: {
+      case CTaskDefinition::ADER_TIME_INTERPOLATE_OWNED_ELEMENTS:
+      case CTaskDefinition::ADER_TIME_INTERPOLATE_HALO_ELEMENTS: {
+
+        /* Interpolate the predictor solution of the owned or halo elements
+           in time to the given time integration point for the given time
+           level. The items of this task are the elements of the time level
+           followed by the adjacent elements of the next time level. */
+        const bool owned = tasksList[i].task == CTaskDefinition::ADER_TIME_INTERPOLATE_OWNED_ELEMENTS;
+        const unsigned short level = tasksList[i].timeLevel;
+        const auto &elemPerTimeLevel = owned ? nVolElemOwnedPerTimeLevel : nVolElemHaloPerTimeLevel;
+        const unsigned long elemBeg = elemPerTimeLevel[level];
+        const unsigned long nElem   = elemPerTimeLevel[level+1] - elemBeg;
+
+        unsigned long nAdjElem = 0;
+        const unsigned long *adjElem = nullptr;
+        if(level < (nTimeLevels-1)) {
+          const auto &elemAdjLowTimeLevel = owned ? ownedElemAdjLowTimeLevel : haloElemAdjLowTimeLevel;
+          nAdjElem = elemAdjLowTimeLevel[level+1].size();
+          adjElem  = elemAdjLowTimeLevel[level+1].data();
+        }
 
-              /* Compute the residual of the faces that involve a halo element. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long indResFaces = startLocResInternalFacesWithHaloElem[level];
-              ResidualFaces(config, nMatchingInternalFacesWithHaloElem[level],
-                            nMatchingInternalFacesWithHaloElem[level+1],
-                            indResFaces, numerics[CONV_TERM], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+        const unsigned short intPoint = tasksList[i].intPointADER;
+        const bool secondPart = tasksList[i].secondPartTimeIntADER;
+        su2double *solTimeLevel = VecWorkSolDOFs[level].data();
+
+        startTask(i, nElem+nAdjElem, [=](unsigned long beg, unsigned long end, su2double*) {
+          const unsigned long adjBeg = max(beg, nElem) - nElem, adjEnd = max(end, nElem) - nElem;
+          ADER_DG_TimeInterpolatePredictorSol(config, intPoint, elemBeg + min(beg, nElem),
+                                              elemBeg + min(end, nElem), adjEnd - adjBeg,
+                                              adjElem + adjBeg, secondPart, solTimeLevel);
+        });
+        return true;
+      }
 
-            case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_OWNED: {
+      case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS:
+      case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_HALO_ELEMENTS: {
 
-              /*--- Apply the boundary conditions that only depend on data
-                    of owned elements. ---*/
-              Boundary_Conditions(tasksList[i].timeLevel, config, numerics, false,
-                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+        /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
+        const bool owned = tasksList[i].task == CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS;
+        const unsigned short level = tasksList[i].timeLevel;
+        const auto &elemPerTimeLevel = owned ? nVolElemOwnedPerTimeLevel : nVolElemHaloPerTimeLevel;
+        const unsigned long elemBeg = elemPerTimeLevel[level];
 
-            case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO: {
+        startTask(i, elemPerTimeLevel[level+1]-elemBeg, [=](unsigned long beg, unsigned long end, su2double *workArray) {
+          Shock_Capturing_DG(config, elemBeg+beg, elemBeg+end, workArray);
+        });
+        return true;
+      }
 
-              /*--- Apply the boundary conditions that also depend on data
-                    of halo elements. ---*/
-              Boundary_Conditions(tasksList[i].timeLevel, config, numerics, true,
-                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      case CTaskDefinition::VOLUME_RESIDUAL: {
 
-            case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_OWNED_ELEMENTS: {
+        /*--- Compute the volume portion of the residual. ---*/
+        const unsigned short level = tasksList[i].timeLevel;
+        const unsigned long elemBeg = nVolElemOwnedPerTimeLevel[level];
 
-              /* Create the final residual by summing up all contributions. */
-              CreateFinalResidual(tasksList[i].timeLevel, true);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+        startTask(i, nVolElemOwnedPerTimeLevel[level+1]-elemBeg, [=](unsigned long beg, unsigned long end, su2double *workArray) {
+          Volume_Residual(config, elemBeg+beg, elemBeg+end, workArray);
+        });
+        return true;
+      }
 
-            case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_HALO_ELEMENTS: {
+      case CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS:
+      case CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS: {
+
+        /* Compute the residual of the faces that only involve owned elements,
+           or the faces that involve a halo element. Each chunk of faces
+           stores its residual starting at the location of its first face. */
+        const bool owned = tasksList[i].task == CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS;
+        const unsigned short level = tasksList[i].timeLevel;
+        const auto &facesPerTimeLevel = owned ? nMatchingInternalFacesLocalElem : nMatchingInternalFacesWithHaloElem;
+        const unsigned long faceBeg = facesPerTimeLevel[level];
+
+        startTask(i, facesPerTimeLevel[level+1]-faceBeg, [=](unsigned long beg, unsigned long end, su2double *workArray) {
+          unsigned long indResFaces = startLocResMatchingFaces[faceBeg+beg];
+          ResidualFaces(config, faceBeg+beg, faceBeg+end, indResFaces, numerics[CONV_TERM], workArray);
+        });
+        return true;
+      }
 
-              /* Create the final residual by summing up all contributions. */
-              CreateFinalResidual(tasksList[i].timeLevel, false);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_OWNED:
+      case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO: {
+
+        /*--- Apply the boundary conditions that only depend on data
+              of owned elements, or that also depend on data of halo elements. ---*/
+        const bool haloInfo = tasksList[i].task == CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO;
+        const unsigned short level = tasksList[i].timeLevel;
+        startTask(i, 1, [=](unsigned long, unsigned long, su2double *workArray) {
+          Boundary_Conditions(level, config, numerics, haloInfo, workArray);
+        });
+        return true;
+      }
 
-            case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS: {
+      case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_OWNED_ELEMENTS:
+      case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_HALO_ELEMENTS: {
 
-              /* Accumulate the space time residuals for the owned elements
-                 for ADER-DG. */
-              AccumulateSpaceTimeResidualADEROwnedElem(config, tasksList[i].timeLevel,
-                                                       tasksList[i].intPointADER);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+        /* Create the final residual by summing up all contributions. */
+        const bool owned = tasksList[i].task == CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_OWNED_ELEMENTS;
+        const unsigned short level = tasksList[i].timeLevel;
+        startTask(i, 1, [=](unsigned long, unsigned long, su2double*) {
+          CreateFinalResidual(level, owned);
+        });
+        return true;
+      }
 
-            case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_HALO_ELEMENTS: {
+      case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS:
+      case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_HALO_ELEMENTS: {
+
+        /* Accumulate the space time residuals for the owned or halo elements
+           for ADER-DG. */
+        const bool owned = tasksList[i].task == CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS;
+        const unsigned short level = tasksList[i].timeLevel;
+        const unsigned short intPoint = tasksList[i].intPointADER;
+        startTask(i, 1, [=](unsigned long, unsigned long, su2double*) {
+          if( owned ) AccumulateSpaceTimeResidualADEROwnedElem(config, level, intPoint);
+          else        AccumulateSpaceTimeResidualADERHaloElem(config, level, intPoint);
+        });
+        return true;
+      }
 
-              /* Accumulate the space time residuals for the halo elements
-                 for ADER-DG. */
-              AccumulateSpaceTimeResidualADERHaloElem(config, tasksList[i].timeLevel,
-                                                      tasksList[i].intPointADER);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      case CTaskDefinition::MULTIPLY_INVERSE_MASS_MATRIX: {
 
-            case CTaskDefinition::MULTIPLY_INVERSE_MASS_MATRIX: {
+        /*--- Multiply the residual by the (lumped) mass matrix, to obtain the final value. ---*/
+        const unsigned short level = tasksList[i].timeLevel;
+        const bool useADER = config->GetKind_TimeIntScheme() == ADER_DG;
+        const unsigned long elemBeg = nVolElemOwnedPerTimeLevel[level];
 
-              /*--- Multiply the residual by the (lumped) mass matrix, to obtain the final value. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              const bool useADER = config->GetKind_TimeIntScheme() == ADER_DG;
-              MultiplyResidualByInverseMassMatrix(config, useADER,
-                                                  nVolElemOwnedPerTimeLevel[level],
-                                                  nVolElemOwnedPerTimeLevel[level+1],
-                                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+        startTask(i, nVolElemOwnedPerTimeLevel[level+1]-elemBeg, [=](unsigned long beg, unsigned long end, su2double *workArray) {
+          MultiplyResidualByInverseMassMatrix(config, useADER, elemBeg+beg, elemBeg+end, workArray);
+        });
+        return true;
+      }
 
-            case CTaskDefinition::ADER_UPDATE_SOLUTION: {
+      case CTaskDefinition::ADER_UPDATE_SOLUTION: {
 
-              /*--- Perform the update step for ADER-DG. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              ADER_DG_Iteration(nVolElemOwnedPerTimeLevel[level],
-                                nVolElemOwnedPerTimeLevel[level+1]);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+        /*--- Perform the update step for ADER-DG. ---*/
+        const unsigned short level = tasksList[i].timeLevel;
+        const unsigned long elemBeg = nVolElemOwnedPerTimeLevel[level];
 
-            default: {
+        startTask(i, nVolElemOwnedPerTimeLevel[level+1]-elemBeg, [=](unsigned long beg, unsigned long end, su2double*) {
+          ADER_DG_Iteration(elemBeg+beg, elemBeg+end);
+        });
+        return true;
+      }
 
-              cout << "Task not defined. This should not happen." << endl;
-              exit(1);
-            }
-          }
-        }
+      default: {
 
-        /* Break the inner loop if a task has been carried out. */
-        if( taskCarriedOut ) break;
+        cout << "Task not defined. This should not happen." << endl;
+        exit(1);
       }
-
-      /* Break the outer loop if a task has been carried out. */
-      if( taskCarriedOut ) break;
     }
-
-    /* Update the value of lowestIndexInList. */
-    for(; lowestIndexInList < tasksList.size(); ++lowestIndexInList)
-      if( !taskCompleted[lowestIndexInList] ) break;
-  }
+  });
 }
 
 void CFEM_DG_EulerSolver::ADER_SpaceTimeIntegration(CGeometry *geometry,  CSolver **solver_container,
@@ -4795,8 +4769,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
       const su2double v            = DensityInv*solDOF[2];
       const su2double StaticEnergy = DensityInv*solDOF[3] - 0.5*(u*u + v*v);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
 
       /* The Cartesian fluxes in the x-direction. */
       const su2double uRel = u - gridVel[0];
@@ -5044,8 +5018,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
       const su2double w            = DensityInv*solDOF[3];
       const su2double StaticEnergy = DensityInv*solDOF[4] - 0.5*(u*u + v*v + w*w);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
 
       /* The Cartesian fluxes in the x-direction. */
       const su2double uRel = u - gridVel[0];
@@ -5334,8 +5308,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
       const su2double kinEnergy    = 0.5*(u*u + v*v);
       const su2double StaticEnergy = rhoInv*rE - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Set the pointer to the grid velocities in this integration point.
@@ -5549,8 +5523,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
       const su2double kinEnergy    = 0.5*(u*u + v*v + w*w);
       const su2double StaticEnergy = rhoInv*rE - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Set the pointer to the grid velocities in this integration point.
@@ -5856,11 +5830,16 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
     const su2double *matDerBasisIntTrans = standardElementsSol[ind].GetDerMatBasisFunctionsIntTrans();
     const su2double *weights             = standardElementsSol[ind].GetWeightsIntegration();
 
+    /* Determine whether sum factorization can be used for this element type. */
+    const bool tensorProduct = config->GetSum_Factorization_DGFEM() &&
+                               standardElementsSol[ind].TensorProductBasis();
+
     /*--- Set the pointers for the local arrays. ---*/
-    su2double *solDOFs = workArray;
-    su2double *sources = solDOFs + nDOFs*NPad;
-    su2double *solInt  = sources + nInt *NPad;
-    su2double *fluxes  = solInt  + nInt *NPad;
+    su2double *solDOFs    = workArray;
+    su2double *sources    = solDOFs + nDOFs*NPad;
+    su2double *solInt     = sources + nInt *NPad;
+    su2double *fluxes     = solInt  + nInt *NPad;
+    su2double *workTensor = fluxes  + nInt *NPad*nDim;
 
     /*------------------------------------------------------------------------*/
     /*--- Step 1: Interpolate the solution to the integration points of    ---*/
@@ -5884,8 +5863,12 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
     }
 
     /* Call the general function to carry out the matrix product to determine
-       the solution in the integration points of the chunk of elements. */
-    blasFunctions->gemm(nInt, NPad, nDOFs, matBasisInt, solDOFs, solInt, config);
+       the solution in the integration points of the chunk of elements, or
+       use sum factorization for quadrilaterals and hexahedra. */
+    if( tensorProduct )
+      standardElementsSol[ind].SolAndGradIntTensorProduct(NPad, false, solDOFs, solInt, workTensor);
+    else
+      blasFunctions->gemm(nInt, NPad, nDOFs, matBasisInt, solDOFs, solInt, config);
 
     /*------------------------------------------------------------------------*/
     /*--- Step 2: Compute the inviscid fluxes, multiplied by minus the     ---*/
@@ -5936,8 +5919,8 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
             const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v);
 
             /*--- Compute the pressure. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure = FluidModel->GetPressure();
+            GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure = GetFluidModel()->GetPressure();
 
             /* Compute the relative velocities w.r.t. the grid. */
             const su2double uRel = u - gridVel[0];
@@ -6031,8 +6014,8 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
             const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v + w*w);
 
             /*--- Compute the pressure. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure = FluidModel->GetPressure();
+            GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure = GetFluidModel()->GetPressure();
 
             /* Compute the relative velocities w.r.t. the grid. */
             const su2double uRel = u - gridVel[0];
@@ -6150,20 +6133,29 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
     /*---         integration over the volume element.                     ---*/
     /*------------------------------------------------------------------------*/
 
-    /* Call the general function to carry out the matrix product.
-       Use solDOFs as a temporary storage for the matrix product. */
-    blasFunctions->gemm(nDOFs, NPad, nInt*nDim, matDerBasisIntTrans, fluxes, solDOFs, config);
+    /* Sum factorization for quadrilaterals and hexahedra, which includes
+       the source terms. Use solDOFs as storage for the residual. */
+    if( tensorProduct ) {
+      standardElementsSol[ind].ResidualTensorProduct(NPad, fluxes, addSourceTerms ? sources : nullptr,
+                                                     solDOFs, workTensor);
+    }
+    else {
 
-    /* Add the contribution from the source terms, if needed. Use solInt
-       as temporary storage for the matrix product. */
-    if( addSourceTerms ) {
+      /* Call the general function to carry out the matrix product.
+         Use solDOFs as a temporary storage for the matrix product. */
+      blasFunctions->gemm(nDOFs, NPad, nInt*nDim, matDerBasisIntTrans, fluxes, solDOFs, config);
 
-      /* Call the general function to carry out the matrix product. */
-      blasFunctions->gemm(nDOFs, NPad, nInt, matBasisIntTrans, sources, solInt, config);
+      /* Add the contribution from the source terms, if needed. Use solInt
+         as temporary storage for the matrix product. */
+      if( addSourceTerms ) {
 
-      /* Add the residuals due to source terms to the volume residuals */
-      for(unsigned short i=0; i<(nDOFs*NPad); ++i)
-        solDOFs[i] += solInt[i];
+        /* Call the general function to carry out the matrix product. */
+        blasFunctions->gemm(nDOFs, NPad, nInt, matBasisIntTrans, sources, solInt, config);
+
+        /* Add the residuals due to source terms to the volume residuals */
+        for(unsigned short i=0; i<(nDOFs*NPad); ++i)
+          solDOFs[i] += solInt[i];
+      }
     }
 
     /* Loop over the elements in this chunk to store the residuals
@@ -6937,8 +6929,8 @@ void CFEM_DG_EulerSolver::Pressure_Forces(const CGeometry* geometry, const CConf
                   const su2double v            = sol[2]*DensityInv;
                   const su2double StaticEnergy = sol[3]*DensityInv - 0.5*(u*u + v*v);
 
-                  FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-                  const su2double Pressure = FluidModel->GetPressure();
+                  GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+                  const su2double Pressure = GetFluidModel()->GetPressure();
 
                   /*-- Compute the vector from the reference point to the integration
                        point and update the inviscid force. Note that the normal points
@@ -6990,8 +6982,8 @@ void CFEM_DG_EulerSolver::Pressure_Forces(const CGeometry* geometry, const CConf
                   const su2double w            = sol[3]*DensityInv;
                   const su2double StaticEnergy = sol[4]*DensityInv - 0.5*(u*u + v*v + w*w);
 
-                  FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-                  const su2double Pressure = FluidModel->GetPressure();
+                  GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+                  const su2double Pressure = GetFluidModel()->GetPressure();
 
                   /*-- Compute the vector from the reference point to the integration
                        point and update the inviscid force. Note that the normal points
@@ -7268,6 +7260,224 @@ void CFEM_DG_EulerSolver::ClassicalRK4_Iteration(CGeometry *geometry, CSolver **
   }
 }
 
+namespace {
+
+/*!
+ * \brief Matrix-vector product and preconditioner of the Jacobian-free Newton-Krylov
+ *        method of the DG solver, which are defined by a function of the solver.
+ */
+using CDGOperatorFunction = std::function<void(const CSysVector<su2double>&, CSysVector<su2double>&)>;
+
+class CDGMatrixFreeProduct final : public CMatrixVectorProduct<su2double> {
+  const CDGOperatorFunction func;
+public:
+  explicit CDGMatrixFreeProduct(CDGOperatorFunction f) : func(std::move(f)) {}
+  void operator()(const CSysVector<su2double>& u, CSysVector<su2double>& v) const override { func(u, v); }
+};
+
+class CDGPreconditioner final : public CPreconditioner<su2double> {
+  const CDGOperatorFunction func;
+public:
+  explicit CDGPreconditioner(CDGOperatorFunction f) : func(std::move(f)) {}
+  void operator()(const CSysVector<su2double>& u, CSysVector<su2double>& v) const override { func(u, v); }
+};
+
+} // namespace
+
+void CFEM_DG_EulerSolver::ImplicitNewtonKrylov_Iteration(CGeometry *geometry, CSolver **solver_container,
+                                                         CNumerics **numerics, CConfig *config,
+                                                         unsigned short iMesh) {
+
+  /*--- The backward Euler method leads, after linearization, to the system
+        (I/dt + dRes/dU) dU = -Res(U), where Res is the residual multiplied by
+        the inverse of the mass matrix. The residual of the current solution
+        is stored, because VecResDOFs is overwritten by the perturbed
+        residual evaluations of the Jacobian-free matrix-vector products. ---*/
+  const unsigned long nOwned = nVar*nDOFsLocOwned;
+  const vector<su2double> resBase(VecResDOFs.begin(), VecResDOFs.begin()+nOwned);
+
+  /* Determine the inverse of the time step of every owned DOF. */
+  vector<su2double> invDtDOFs(nDOFsLocOwned);
+  for(unsigned long l=0; l<nVolElemOwned; ++l) {
+    for(unsigned short j=0; j<volElem[l].nDOFsSol; ++j)
+      invDtDOFs[volElem[l].offsetDOFsSolLocal+j] = 1.0/VecDeltaTime[l];
+  }
+
+  /*--- Determine the finite difference step, which is scaled with the root
+        mean square value of the solution, as in CNewtonIntegration. ---*/
+  su2double locSumSol2 = 0.0;
+  for(unsigned long i=0; i<nOwned; ++i)
+    locSumSol2 += VecSolDOFs[i]*VecSolDOFs[i];
+
+  su2double sumSol2 = locSumSol2;
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(&locSumSol2, &sumSol2, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+#endif
+
+  const passivedouble stepND = SU2_TYPE::GetValue(config->GetNewtonKrylovDblParam()[3]);
+  const su2double stepFD = stepND*max(su2double(1.0), sqrt(sumSol2/(nVar*nDOFsGlobal)));
+
+  /*--- Update the element block Jacobi preconditioner, if needed. ---*/
+  const unsigned short precondFreq = config->GetImplicit_Precond_Freq_DGFEM();
+  if(blockJacobiInv.empty() || (precondFreq && !(nIterPrecondJFNK%precondFreq)))
+    ComputeBlockJacobiPreconditioner(geometry, solver_container, numerics, config,
+                                     iMesh, resBase, stepFD);
+  ++nIterPrecondJFNK;
+
+  /*--- Set up the linear system. Only the owned DOFs are unknowns. ---*/
+  LinSysSol.Initialize(nDOFsLocOwned, nDOFsLocOwned, nVar, 0.0);
+  LinSysRes.Initialize(nDOFsLocOwned, nDOFsLocOwned, nVar, 0.0);
+  for(unsigned long i=0; i<nOwned; ++i)
+    LinSysRes[i] = -resBase[i];
+
+  /* Matrix-free product v = (Res(U + eps*u) - Res(U))/eps + u/dt. */
+  CDGMatrixFreeProduct product([&](const CSysVector<su2double>& u, CSysVector<su2double>& v) {
+
+    const su2double normU = u.norm();
+    if(normU == 0.0) {
+      v = su2double(0.0);
+      return;
+    }
+    const su2double eps = stepFD/normU;
+
+    Set_OldSolution();
+    for(unsigned long i=0; i<nOwned; ++i)
+      VecWorkSolDOFs[0][i] += eps*u[i];
+
+    ProcessTaskList_DG(geometry, solver_container, numerics, config, iMesh);
+
+    for(unsigned long i=0; i<nOwned; ++i)
+      v[i] = (VecResDOFs[i]-resBase[i])/eps + invDtDOFs[i/nVar]*u[i];
+  });
+
+  /* Element block Jacobi preconditioner. */
+  CDGPreconditioner precond([&](const CSysVector<su2double>& u, CSysVector<su2double>& v) {
+
+    for(unsigned long l=0; l<nVolElemOwned; ++l) {
+      const unsigned long offset = nVar*volElem[l].offsetDOFsSolLocal;
+      const CSquareMatrixCM &blockInv = blockJacobiInv[l];
+      const int sizeBlock = blockInv.Size();
+
+      for(int i=0; i<sizeBlock; ++i) {
+        su2double val = 0.0;
+        for(int k=0; k<sizeBlock; ++k)
+          val += blockInv(i,k)*u[offset+k];
+        v[offset+i] = val;
+      }
+    }
+  });
+
+  /*--- Solve the linear system with FGMRES. ---*/
+  const su2double tol = config->GetLinear_Solver_Error();
+  su2double residual = 0.0;
+  const unsigned long iter = SystemJFNK.FGMRES_LinSolver(LinSysRes, LinSysSol, product, precond,
+                                                         tol, config->GetLinear_Solver_Iter(),
+                                                         residual, false, config);
+  SetIterLinSolver(iter);
+  SetResLinSolver(residual);
+
+  /*--- Update the solution of the owned DOFs. ---*/
+  for(unsigned long i=0; i<nOwned; ++i)
+    VecSolDOFs[i] += LinSysSol[i];
+
+  /*--- Restore the residual of the current solution, which is used for the
+        convergence monitoring, as is done for the explicit schemes. ---*/
+  for(unsigned long i=0; i<nOwned; ++i)
+    VecResDOFs[i] = resBase[i];
+
+  /*--- Compute the root mean square residual. Note that the SetResidual_RMS
+        function of CSolver cannot be used, because that is for the FV solver. ---*/
+  SetResidual_RMS_FEM(geometry, config);
+
+  /*--- For verification cases, compute the global error metrics. ---*/
+  ComputeVerificationError(geometry, config);
+}
+
+void CFEM_DG_EulerSolver::ComputeBlockJacobiPreconditioner(CGeometry               *geometry,
+                                                           CSolver                 **solver_container,
+                                                           CNumerics               **numerics,
+                                                           CConfig                 *config,
+                                                           unsigned short          iMesh,
+                                                           const vector<su2double> &resBase,
+                                                           const su2double         stepFD) {
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 1: Allocate the diagonal blocks and determine the element of  ---*/
+  /*---         every owned DOF.                                           ---*/
+  /*--------------------------------------------------------------------------*/
+
+  blockJacobiInv.resize(nVolElemOwned);
+  vector<unsigned long> elemOwnedDOFs(nDOFsLocOwned);
+
+  for(unsigned long l=0; l<nVolElemOwned; ++l) {
+    const int sizeBlock = nVar*volElem[l].nDOFsSol;
+    blockJacobiInv[l].Initialize(sizeBlock);
+
+    for(int i=0; i<sizeBlock; ++i)
+      for(int j=0; j<sizeBlock; ++j)
+        blockJacobiInv[l](i,j) = 0.0;
+
+    for(unsigned short j=0; j<volElem[l].nDOFsSol; ++j)
+      elemOwnedDOFs[volElem[l].offsetDOFsSolLocal+j] = l;
+  }
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 2: Compute the diagonal blocks with finite differences. The   ---*/
+  /*---         DOFs of a color do not share entries in the Jacobian, such ---*/
+  /*---         that they can be disturbed simultaneously, see also        ---*/
+  /*---         ComputeSpatialJacobian. Only the entries for which the     ---*/
+  /*---         disturbed DOF belongs to the element of the row are kept.  ---*/
+  /*--------------------------------------------------------------------------*/
+
+  const unsigned long offsetGlobal = nDOFsPerRank[rank];
+
+  for(int color=0; color<nGlobalColors; ++color) {
+    for(unsigned short var=0; var<nVar; ++var) {
+
+      /* Disturb the DOFs of this color. */
+      Set_OldSolution();
+      for(unsigned long j=0; j<localDOFsPerColor[color].size(); ++j) {
+        const unsigned long jj = localDOFsPerColor[color][j];
+        VecWorkSolDOFs[0][jj*nVar+var] += stepFD;
+      }
+
+      /* Carry out all the tasks to compute the residual. */
+      ProcessTaskList_DG(geometry, solver_container, numerics, config, iMesh);
+
+      /* Loop over the owned DOFs and store the entries of the diagonal blocks. */
+      for(unsigned long i=0; i<nDOFsLocOwned; ++i) {
+        const int ind = colorToIndEntriesJacobian[i][color];
+        if(ind < 0) continue;
+
+        const unsigned long l        = elemOwnedDOFs[i];
+        const unsigned long firstDOF = offsetGlobal + volElem[l].offsetDOFsSolLocal;
+        const unsigned long jGlobal  = nonZeroEntriesJacobian[i][ind];
+        if((jGlobal < firstDOF) || (jGlobal >= firstDOF + volElem[l].nDOFsSol)) continue;
+
+        const unsigned long iLoc = i - volElem[l].offsetDOFsSolLocal;
+        const unsigned long jLoc = jGlobal - firstDOF;
+
+        for(unsigned short k=0; k<nVar; ++k) {
+          const su2double dRes = (VecResDOFs[i*nVar+k] - resBase[i*nVar+k])/stepFD;
+          blockJacobiInv[l](nVar*iLoc+k, nVar*jLoc+var) = SU2_TYPE::GetValue(dRes);
+        }
+      }
+    }
+  }
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 3: Add the time step term and invert the blocks.              ---*/
+  /*--------------------------------------------------------------------------*/
+
+  for(unsigned long l=0; l<nVolElemOwned; ++l) {
+    const passivedouble invDt = SU2_TYPE::GetValue(1.0/VecDeltaTime[l]);
+    for(int i=0; i<blockJacobiInv[l].Size(); ++i)
+      blockJacobiInv[l](i,i) += invDt;
+
+    blockJacobiInv[l].Invert();
+  }
+}
+
 void CFEM_DG_EulerSolver::SetResidual_RMS_FEM(CGeometry *geometry,
                                               CConfig *config) {
 
@@ -7596,9 +7806,9 @@ void CFEM_DG_EulerSolver::BoundaryStates_Inlet(CConfig                  *config,
 
       su2double StaticEnergy = UL[nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(UL[0], StaticEnergy);
-      su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
-      su2double Pressure    = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(UL[0], StaticEnergy);
+      su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
+      su2double Pressure    = GetFluidModel()->GetPressure();
 
       /*--- Compute the Riemann invariant to be extrapolated. ---*/
       const su2double Riemann = 2.0*sqrt(SoundSpeed2)/Gamma_Minus_One + VelocityNormal;
@@ -7704,9 +7914,9 @@ void CFEM_DG_EulerSolver::BoundaryStates_Outlet(CConfig                  *config
 
       su2double StaticEnergy = UL[nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(UL[0], StaticEnergy);
-      su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
-      su2double Pressure    = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(UL[0], StaticEnergy);
+      su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
+      su2double Pressure    = GetFluidModel()->GetPressure();
 
       /*--- Subsonic exit flow: there is one incoming characteristic,
             therefore one variable can be specified (back pressure) and is used
@@ -7768,10 +7978,10 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
       T_Total /= config->GetTemperature_Ref();
 
       /* Compute the total enthalpy and entropy from these values. */
-      FluidModel->SetTDState_PT(P_Total, T_Total);
-      const su2double Enthalpy_e = FluidModel->GetStaticEnergy()
-                                 + FluidModel->GetPressure()/FluidModel->GetDensity();
-      const su2double Entropy_e  = FluidModel->GetEntropy();
+      GetFluidModel()->SetTDState_PT(P_Total, T_Total);
+      const su2double Enthalpy_e = GetFluidModel()->GetStaticEnergy()
+                                 + GetFluidModel()->GetPressure()/GetFluidModel()->GetDensity();
+      const su2double Entropy_e  = GetFluidModel()->GetEntropy();
 
       /* Loop over the faces that are treated simultaneously. */
       for(unsigned short l=0; l<nFaceSimul; ++l) {
@@ -7798,9 +8008,9 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
              and total energy per unit mass for the right state. */
           const su2double StaticEnthalpy_e = Enthalpy_e - 0.5*Velocity2_e;
 
-          FluidModel->SetTDState_hs(StaticEnthalpy_e, Entropy_e);
-          const su2double Density_e = FluidModel->GetDensity();
-          const su2double StaticEnergy_e = FluidModel->GetStaticEnergy();
+          GetFluidModel()->SetTDState_hs(StaticEnthalpy_e, Entropy_e);
+          const su2double Density_e = GetFluidModel()->GetDensity();
+          const su2double StaticEnergy_e = GetFluidModel()->GetStaticEnergy();
           const su2double Energy_e       = StaticEnergy_e + 0.5*Velocity2_e;
 
           /* Set the conservative variables of the right state. */
@@ -7830,10 +8040,10 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
 
       /* Compute the prescribed density, static energy per unit mass
          and speed of sound. */
-      FluidModel->SetTDState_PT(P_static, T_static);
-      const su2double Density_e      = FluidModel->GetDensity();
-      const su2double StaticEnergy_e = FluidModel->GetStaticEnergy();
-      const su2double SoundSpeed     = FluidModel->GetSoundSpeed();
+      GetFluidModel()->SetTDState_PT(P_static, T_static);
+      const su2double Density_e      = GetFluidModel()->GetDensity();
+      const su2double StaticEnergy_e = GetFluidModel()->GetStaticEnergy();
+      const su2double SoundSpeed     = GetFluidModel()->GetSoundSpeed();
 
       /* Determine the magnitude of the Mach number. */
       su2double MachMag = 0.0;
@@ -7881,10 +8091,10 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
 
       /* Compute the prescribed pressure, static energy per unit mass
          and speed of sound. */
-      FluidModel->SetTDState_Prho(P_static, Rho_static);
-      const su2double Density_e      = FluidModel->GetDensity();
-      const su2double StaticEnergy_e = FluidModel->GetStaticEnergy();
-      const su2double SoundSpeed     = FluidModel->GetSoundSpeed();
+      GetFluidModel()->SetTDState_Prho(P_static, Rho_static);
+      const su2double Density_e      = GetFluidModel()->GetDensity();
+      const su2double StaticEnergy_e = GetFluidModel()->GetStaticEnergy();
+      const su2double SoundSpeed     = GetFluidModel()->GetSoundSpeed();
 
       /* Determine the magnitude of the Mach number. */
       su2double MachMag = 0.0;
@@ -7978,7 +8188,7 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
 
           /* Extrapolate the density and set the thermodynamic state. */
           UR[0] = UL[0];
-          FluidModel->SetTDState_Prho(Pressure_e, UR[0]);
+          GetFluidModel()->SetTDState_Prho(Pressure_e, UR[0]);
 
           /* Extrapolate the velocity. As the density is also extrapolated,
              this means that the momentum variables are identical for UL and UR.
@@ -7993,7 +8203,7 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
           }
 
           /* Compute the total energy per unit volume. */
-          UR[nDim+1] = UR[0]*(FluidModel->GetStaticEnergy() + 0.5*Velocity2_e);
+          UR[nDim+1] = UR[0]*(GetFluidModel()->GetStaticEnergy() + 0.5*Velocity2_e);
         }
       }
 
@@ -8044,11 +8254,11 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
           const su2double ny  = normals[1];
           const su2double vnL = vxL*nx + vyL*ny;
 
-          FluidModel->SetTDState_rhoe(UL[0], eL);
+          GetFluidModel()->SetTDState_rhoe(UL[0], eL);
 
-          const su2double aL  = FluidModel->GetSoundSpeed();
+          const su2double aL  = GetFluidModel()->GetSoundSpeed();
           const su2double a2L = aL*aL;
-          const su2double pL  = FluidModel->GetPressure();
+          const su2double pL  = GetFluidModel()->GetPressure();
           const su2double HL  = (UL[3] + pL)*tmp;
 
           const su2double ovaL  = 1.0/aL;
@@ -8123,11 +8333,11 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
           const su2double nz  = normals[2];
           const su2double vnL = vxL*nx + vyL*ny + vzL*nz;
 
-          FluidModel->SetTDState_rhoe(UL[0], eL);
+          GetFluidModel()->SetTDState_rhoe(UL[0], eL);
 
-          const su2double aL  = FluidModel->GetSoundSpeed();
+          const su2double aL  = GetFluidModel()->GetSoundSpeed();
           const su2double a2L = aL*aL;
-          const su2double pL  = FluidModel->GetPressure();
+          const su2double pL  = GetFluidModel()->GetPressure();
           const su2double HL  = (UL[4] + pL)*tmp;
 
           const su2double ovaL  = 1.0/aL;
@@ -9334,99 +9544,105 @@ void CFEM_DG_EulerSolver::ComputeInviscidFluxesFace(CConfig              *config
     default: {
 
       /* Riemann solver not explicitly implemented. Fall back to the
-         implementation via numerics. This is not efficient. */
-
-      /*--- Data for loading into the CNumerics Riemann solvers.
-       This is temporary and not efficient.. just replicating exactly
-       the arrays we typically have in order to avoid bugs. We can
-       probably be more clever with pointers, etc. ---*/
-      su2double Normal[3];
-      su2double Prim_L[8];
-      su2double Prim_R[8];
-
-      Jacobian_i = new su2double*[nVar];
-      Jacobian_j = new su2double*[nVar];
-      for (unsigned short iVar = 0; iVar < nVar; ++iVar) {
-        Jacobian_i[iVar] = new su2double[nVar];
-        Jacobian_j[iVar] = new su2double[nVar];
-      }
-
-      /* Loop over the number of faces treated simultaneously. */
-      for(unsigned short l=0; l<nFaceSimul; ++l) {
-
-        /* Easier storage for some variables of this face. */
-        const su2double *normals   = normalsFace[l];
-        const su2double *gridVels  = gridVelsFace[l];
-        const unsigned short lNVar = l*nVar;
-
-        /* Loop over the number of points for this face. */
-        for(unsigned long i=0; i<nPoints; ++i) {
-
-          /* Easier storage of the left and right solution, the face normals,
-             the grid velocities and the flux vector for this point. */
-          const unsigned long offPointer = i*NPad + lNVar;
+         implementation via numerics. This is not efficient.
+         The numerics class is not thread safe, hence only one thread
+         at a time can use it. */
+      SU2_OMP_CRITICAL
+      {
+
+        /*--- Data for loading into the CNumerics Riemann solvers.
+         This is temporary and not efficient.. just replicating exactly
+         the arrays we typically have in order to avoid bugs. We can
+         probably be more clever with pointers, etc. ---*/
+        su2double Normal[3];
+        su2double Prim_L[8];
+        su2double Prim_R[8];
+
+        Jacobian_i = new su2double*[nVar];
+        Jacobian_j = new su2double*[nVar];
+        for (unsigned short iVar = 0; iVar < nVar; ++iVar) {
+          Jacobian_i[iVar] = new su2double[nVar];
+          Jacobian_j[iVar] = new su2double[nVar];
+        }
 
-          const su2double *UL      = solL + offPointer;
-          const su2double *UR      = solR + offPointer;
-          const su2double *norm    = normals + i*(nDim+1);
-          const su2double *gridVel = gridVels + i*nDim;
-                su2double *flux    = fluxes + offPointer;
+        /* Loop over the number of faces treated simultaneously. */
+        for(unsigned short l=0; l<nFaceSimul; ++l) {
+
+          /* Easier storage for some variables of this face. */
+          const su2double *normals   = normalsFace[l];
+          const su2double *gridVels  = gridVelsFace[l];
+          const unsigned short lNVar = l*nVar;
+
+          /* Loop over the number of points for this face. */
+          for(unsigned long i=0; i<nPoints; ++i) {
+
+            /* Easier storage of the left and right solution, the face normals,
+               the grid velocities and the flux vector for this point. */
+            const unsigned long offPointer = i*NPad + lNVar;
+
+            const su2double *UL      = solL + offPointer;
+            const su2double *UR      = solR + offPointer;
+            const su2double *norm    = normals + i*(nDim+1);
+            const su2double *gridVel = gridVels + i*nDim;
+                  su2double *flux    = fluxes + offPointer;
+
+            /*--- Store and load the normal into numerics. ---*/
+            for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+              Normal[iDim] = norm[iDim]*norm[nDim];
+            numerics->SetNormal(Normal);
+
+            /*--- Load the grid velocities into numerics. ---*/
+            su2double vGrid[] = {0.0, 0.0, 0.0};
+            for(unsigned short iDim=0; iDim<nDim; ++iDim)
+              vGrid[iDim] = gridVel[iDim];
+            numerics->SetGridVel(vGrid, vGrid);
+
+            /*--- Prepare the primitive states for the numerics class. Note
+             that for the FV solver, we have the following primitive
+             variable ordering: Compressible flow, primitive variables nDim+5,
+             (T, vx, vy, vz, P, rho, h, c, lamMu, eddyMu, ThCond, Cp) ---*/
+
+            /*--- Left primitive state ---*/
+            Prim_L[0] = 0.0;                                        // Temperature (unused)
+            Prim_L[nDim+1] = gm1*UL[nVar-1];
+            for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+              Prim_L[iDim+1]  = UL[iDim+1]/UL[0];                   // Velocities
+              Prim_L[nDim+1] -= gm1*0.5*Prim_L[iDim+1]*UL[iDim+1];  // Pressure
+            }
+            Prim_L[nDim+2] = UL[0];                                 // Density
+            Prim_L[nDim+3] = (UL[nVar-1] + Prim_L[nDim+1]) / UL[0]; // Enthalpy
+
+            /*--- Right primitive state ---*/
+            Prim_R[0] = 0.0;                                        // Temperature (unused)
+            Prim_R[nDim+1] = gm1*UR[nVar-1];
+            for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+              Prim_R[iDim+1]  = UR[iDim+1]/UR[0];                   // Velocities
+              Prim_R[nDim+1] -= gm1*0.5*Prim_R[iDim+1]*UR[iDim+1];  // Pressure
+            }
+            Prim_R[nDim+2] = UR[0];                                 // Density
+            Prim_R[nDim+3] = (UR[nVar-1] + Prim_R[nDim+1]) / UR[0]; // Enthalpy
 
-          /*--- Store and load the normal into numerics. ---*/
-          for (unsigned short iDim = 0; iDim < nDim; ++iDim)
-            Normal[iDim] = norm[iDim]*norm[nDim];
-          numerics->SetNormal(Normal);
+            /*--- Load the primitive states into the numerics class. ---*/
+            numerics->SetPrimitive(Prim_L, Prim_R);
 
-          /*--- Load the grid velocities into numerics. ---*/
-          su2double vGrid[] = {0.0, 0.0, 0.0};
-          for(unsigned short iDim=0; iDim<nDim; ++iDim)
-            vGrid[iDim] = gridVel[iDim];
-          numerics->SetGridVel(vGrid, vGrid);
-
-          /*--- Prepare the primitive states for the numerics class. Note
-           that for the FV solver, we have the following primitive
-           variable ordering: Compressible flow, primitive variables nDim+5,
-           (T, vx, vy, vz, P, rho, h, c, lamMu, eddyMu, ThCond, Cp) ---*/
-
-          /*--- Left primitive state ---*/
-          Prim_L[0] = 0.0;                                        // Temperature (unused)
-          Prim_L[nDim+1] = gm1*UL[nVar-1];
-          for (unsigned short iDim = 0; iDim < nDim; iDim++) {
-            Prim_L[iDim+1]  = UL[iDim+1]/UL[0];                   // Velocities
-            Prim_L[nDim+1] -= gm1*0.5*Prim_L[iDim+1]*UL[iDim+1];  // Pressure
+            /*--- Now simply call the ComputeResidual() function to calculate
+             the flux using the chosen approximate Riemann solver. Note that
+             the Jacobian arrays here are just dummies for now (no implicit). ---*/
+            numerics->ComputeResidual(flux, Jacobian_i, Jacobian_j, config);
           }
-          Prim_L[nDim+2] = UL[0];                                 // Density
-          Prim_L[nDim+3] = (UL[nVar-1] + Prim_L[nDim+1]) / UL[0]; // Enthalpy
-
-          /*--- Right primitive state ---*/
-          Prim_R[0] = 0.0;                                        // Temperature (unused)
-          Prim_R[nDim+1] = gm1*UR[nVar-1];
-          for (unsigned short iDim = 0; iDim < nDim; iDim++) {
-            Prim_R[iDim+1]  = UR[iDim+1]/UR[0];                   // Velocities
-            Prim_R[nDim+1] -= gm1*0.5*Prim_R[iDim+1]*UR[iDim+1];  // Pressure
-          }
-          Prim_R[nDim+2] = UR[0];                                 // Density
-          Prim_R[nDim+3] = (UR[nVar-1] + Prim_R[nDim+1]) / UR[0]; // Enthalpy
-
-          /*--- Load the primitive states into the numerics class. ---*/
-          numerics->SetPrimitive(Prim_L, Prim_R);
+        }
 
-          /*--- Now simply call the ComputeResidual() function to calculate
-           the flux using the chosen approximate Riemann solver. Note that
-           the Jacobian arrays here are just dummies for now (no implicit). ---*/
-          numerics->ComputeResidual(flux, Jacobian_i, Jacobian_j, config);
+        for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+          delete [] Jacobian_i[iVar];
+          delete [] Jacobian_j[iVar];
         }
-      }
+        delete [] Jacobian_i;
+        delete [] Jacobian_j;
 
-      for (unsigned short iVar = 0; iVar < nVar; iVar++) {
-        delete [] Jacobian_i[iVar];
-        delete [] Jacobian_j[iVar];
+        Jacobian_i = nullptr;
+        Jacobian_j = nullptr;
       }
-      delete [] Jacobian_i;
-      delete [] Jacobian_j;
-
-      Jacobian_i = nullptr;
-      Jacobian_j = nullptr;
+      END_SU2_OMP_CRITICAL
     }
   }
 }
@@ -9519,9 +9735,9 @@ void CFEM_DG_EulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, C
 
       su2double StaticEnergy = VecSolDOFs[ii+nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(VecSolDOFs[ii], StaticEnergy);
-      su2double Pressure = FluidModel->GetPressure();
-      su2double Temperature = FluidModel->GetTemperature();
+      GetFluidModel()->SetTDState_rhoe(VecSolDOFs[ii], StaticEnergy);
+      su2double Pressure = GetFluidModel()->GetPressure();
+      su2double Temperature = GetFluidModel()->GetTemperature();
 
       /*--- Use the values at the infinity if the state is not physical. ---*/
       if((Pressure < 0.0) || (VecSolDOFs[ii] < 0.0) || (Temperature < 0.0)) {
@@ -342,10 +342,10 @@ void CFEM_DG_NSSolver::Friction_Forces(const CGeometry* geometry, const CConfig*
                 su2double vel2Mag = vel[0]*vel[0] + vel[1]*vel[1] + vel[2]*vel[2];
                 su2double eInt    = rhoInv*solInt[nVar-1] - 0.5*vel2Mag;
 
-                FluidModel->SetTDState_rhoe(solInt[0], eInt);
-                const su2double Pressure = FluidModel->GetPressure();
-                const su2double Temperature = FluidModel->GetTemperature();
-                const su2double LaminarViscosity= FluidModel->GetLaminarViscosity();
+                GetFluidModel()->SetTDState_rhoe(solInt[0], eInt);
+                const su2double Pressure = GetFluidModel()->GetPressure();
+                const su2double Temperature = GetFluidModel()->GetTemperature();
+                const su2double LaminarViscosity= GetFluidModel()->GetLaminarViscosity();
 
                 /* Subtract the prescribed wall velocity, i.e. grid velocity
                    from the velocity in the exchange point. */
@@ -373,7 +373,7 @@ void CFEM_DG_NSSolver::Friction_Forces(const CGeometry* geometry, const CConfig*
                                                                           LaminarViscosity, Pressure,
                                                                           Wall_HeatFlux, HeatFlux_Prescribed,
                                                                           Wall_Temperature, Temperature_Prescribed,
-                                                                          FluidModel, tauWall, qWall,
+                                                                          GetFluidModel(), tauWall, qWall,
                                                                           ViscosityWall, kOverCvWall);
 
                 /* Update the viscous forces and moments. Note that the force direction
@@ -544,8 +544,8 @@ void CFEM_DG_NSSolver::Friction_Forces(const CGeometry* geometry, const CConfig*
                     const su2double divVel = dudx + dvdy;
 
                     /* Compute the laminar viscosity. */
-                    FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-                    const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+                    GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+                    const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
 
                     /* Set the value of the second viscosity and compute the
                        divergence term in the viscous normal stresses. */
@@ -677,8 +677,8 @@ void CFEM_DG_NSSolver::Friction_Forces(const CGeometry* geometry, const CConfig*
                     const su2double divVel = dudx + dvdy + dwdz;
 
                     /* Compute the laminar viscosity. */
-                    FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-                    const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+                    GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+                    const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
 
                     /* Set the value of the second viscosity and compute the
                        divergence term in the viscous normal stresses. */
@@ -1037,8 +1037,8 @@ void CFEM_DG_NSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_contai
 
                 /*--- Compute the maximum value of the wave speed. This is a rather
                       conservative estimate. ---*/
-                FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-                const su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
+                GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+                const su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
                 const su2double SoundSpeed  = sqrt(fabs(SoundSpeed2));
 
                 const su2double radx     = fabs(u-gridVel[0]) + SoundSpeed;
@@ -1049,7 +1049,7 @@ void CFEM_DG_NSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_contai
 
                 /* Compute the laminar kinematic viscosity and check if an eddy
                    viscosity must be determined. */
-                const su2double muLam = FluidModel->GetLaminarViscosity();
+                const su2double muLam = GetFluidModel()->GetLaminarViscosity();
                 su2double muTurb      = 0.0;
 
                 if( SGSModelUsed ) {
@@ -1154,8 +1154,8 @@ void CFEM_DG_NSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_contai
 
                 /*--- Compute the maximum value of the wave speed. This is a rather
                       conservative estimate. ---*/
-                FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-                const su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
+                GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+                const su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
                 const su2double SoundSpeed  = sqrt(fabs(SoundSpeed2));
 
                 const su2double radx     = fabs(u-gridVel[0]) + SoundSpeed;
@@ -1167,7 +1167,7 @@ void CFEM_DG_NSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_contai
 
                 /* Compute the laminar kinematic viscosity and check if an eddy
                    viscosity must be determined. */
-                const su2double muLam = FluidModel->GetLaminarViscosity();
+                const su2double muLam = GetFluidModel()->GetLaminarViscosity();
                 su2double muTurb      = 0.0;
 
                 if( SGSModelUsed ) {
@@ -1411,9 +1411,9 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
       const su2double TotalEnergy  = DensityInv*solDOF[3];
       const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure     = FluidModel->GetPressure();
-      const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+      GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure     = GetFluidModel()->GetPressure();
+      const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
 
       /* Compute the Cartesian gradients of the velocities and static energy. */
       const su2double dudx = DensityInv*(drudx - u*drhodx);
@@ -1754,9 +1754,9 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
       const su2double TotalEnergy  = DensityInv*solDOF[4];
       const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v + w*w);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure     = FluidModel->GetPressure();
-      const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+      GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure     = GetFluidModel()->GetPressure();
+      const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
 
       /* Compute the Cartesian gradients of the velocities and static energy. */
       const su2double dudx = DensityInv*(drudx - u*drhodx);
@@ -2127,13 +2127,13 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
       const su2double TotalEnergy  = rhoInv*rE;
       const su2double StaticEnergy = TotalEnergy - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Compute the laminar viscosity and its derivative w.r.t. temperature. */
-      const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
-      const su2double dViscLamdT   = FluidModel->GetdmudT_rho();
+      const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
+      const su2double dViscLamdT   = GetFluidModel()->GetdmudT_rho();
 
       /* Set the pointer to the grid velocities in this integration point.
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
@@ -2526,13 +2526,13 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
       const su2double TotalEnergy  = rhoInv*rE;
       const su2double StaticEnergy = TotalEnergy - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
        /* Compute the laminar viscosity and its derivative w.r.t. temperature. */
-      const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
-      const su2double dViscLamdT   = FluidModel->GetdmudT_rho();
+      const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
+      const su2double dViscLamdT   = GetFluidModel()->GetdmudT_rho();
 
       /* Set the pointer to the grid velocities in this integration point.
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
@@ -3068,8 +3068,8 @@ void CFEM_DG_NSSolver::Shock_Capturing_DG_Persson(const unsigned long elemBeg,
 
       StaticEnergy = sol[nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-      SoundSpeed2 = FluidModel->GetSoundSpeed2();
+      GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+      SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
       machSolDOFs[iInd] = sqrt( Velocity2Rel/SoundSpeed2 );
       machMax = max(machSolDOFs[iInd],machMax);
     }
@@ -3199,11 +3199,16 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
     unsigned short nPoly = standardElementsSol[ind].GetNPoly();
     if(nPoly == 0) nPoly = 1;
 
+    /* Determine whether sum factorization can be used for this element type. */
+    const bool tensorProduct = config->GetSum_Factorization_DGFEM() &&
+                               standardElementsSol[ind].TensorProductBasis();
+
     /*--- Set the pointers for the local arrays. ---*/
     su2double *solDOFs       = workArray;
     su2double *sources       = solDOFs       + nDOFs*NPad;
     su2double *solAndGradInt = sources       + nInt *NPad;
     su2double *fluxes        = solAndGradInt + nInt *NPad*(nDim+1);
+    su2double *workTensor    = fluxes        + nInt *NPad*nDim;
 
     /*------------------------------------------------------------------------*/
     /*--- Step 1: Determine the solution variables and their gradients     ---*/
@@ -3229,8 +3234,11 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
 
     /* Call the general function to carry out the matrix product to determine
        the solution and gradients in the integration points of the chunk
-       of elements. */
-    blasFunctions->gemm(nInt*(nDim+1), NPad, nDOFs, matBasisInt, solDOFs, solAndGradInt, config);
+       of elements, or use sum factorization for quadrilaterals and hexahedra. */
+    if( tensorProduct )
+      standardElementsSol[ind].SolAndGradIntTensorProduct(NPad, true, solDOFs, solAndGradInt, workTensor);
+    else
+      blasFunctions->gemm(nInt*(nDim+1), NPad, nDOFs, matBasisInt, solDOFs, solAndGradInt, config);
 
     /*------------------------------------------------------------------------*/
     /*--- Step 2: Compute the total fluxes (inviscid fluxes minus the      ---*/
@@ -3324,9 +3332,9 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
             const su2double divVel = dudx + dvdy;
 
             /*--- Compute the pressure and the laminar viscosity. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure     = FluidModel->GetPressure();
-            const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+            GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure     = GetFluidModel()->GetPressure();
+            const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
 
             /*--- If an SGS model is used the eddy viscosity must be computed. ---*/
             su2double ViscosityTurb = 0.0;
@@ -3517,9 +3525,9 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
             const su2double divVel = dudx + dvdy + dwdz;
 
             /*--- Compute the pressure and the laminar viscosity. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure     = FluidModel->GetPressure();
-            const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+            GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure     = GetFluidModel()->GetPressure();
+            const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
 
             /*--- If an SGS model is used the eddy viscosity must be computed. ---*/
             su2double ViscosityTurb = 0.0;
@@ -3683,20 +3691,29 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
     /*---         integration over the volume element.                     ---*/
     /*------------------------------------------------------------------------*/
 
-    /* Call the general function to carry out the matrix product.
-       Use solDOFs as a temporary storage for the matrix product. */
-    blasFunctions->gemm(nDOFs, NPad, nInt*nDim, matDerBasisIntTrans, fluxes, solDOFs, config);
+    /* Sum factorization for quadrilaterals and hexahedra, which includes
+       the source terms. Use solDOFs as storage for the residual. */
+    if( tensorProduct ) {
+      standardElementsSol[ind].ResidualTensorProduct(NPad, fluxes, addSourceTerms ? sources : nullptr,
+                                                     solDOFs, workTensor);
+    }
+    else {
 
-    /* Add the contribution from the source terms, if needed. Use solAndGradInt
-       as temporary storage for the matrix product. */
-    if( addSourceTerms ) {
+      /* Call the general function to carry out the matrix product.
+         Use solDOFs as a temporary storage for the matrix product. */
+      blasFunctions->gemm(nDOFs, NPad, nInt*nDim, matDerBasisIntTrans, fluxes, solDOFs, config);
 
-      /* Call the general function to carry out the matrix product. */
-      blasFunctions->gemm(nDOFs, NPad, nInt, matBasisIntTrans, sources, solAndGradInt, config);
+      /* Add the contribution from the source terms, if needed. Use solAndGradInt
+         as temporary storage for the matrix product. */
+      if( addSourceTerms ) {
 
-      /* Add the residuals due to source terms to the volume residuals */
-      for(unsigned short i=0; i<(nDOFs*NPad); ++i)
-        solDOFs[i] += solAndGradInt[i];
+        /* Call the general function to carry out the matrix product. */
+        blasFunctions->gemm(nDOFs, NPad, nInt, matBasisIntTrans, sources, solAndGradInt, config);
+
+        /* Add the residuals due to source terms to the volume residuals */
+        for(unsigned short i=0; i<(nDOFs*NPad); ++i)
+          solDOFs[i] += solAndGradInt[i];
+      }
     }
 
     /* Loop over the elements in this chunk to store the residuals
@@ -4342,8 +4359,8 @@ void CFEM_DG_NSSolver::ViscousNormalFluxIntegrationPoint_2D(const su2double *sol
   const su2double divVel = dudx + dvdy;
 
   /*--- Compute the laminar viscosity. ---*/
-  FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-  const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+  GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+  const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
 
   /*--- Compute the eddy viscosity, if needed. ---*/
   su2double ViscosityTurb = 0.0;
@@ -4438,8 +4455,8 @@ void CFEM_DG_NSSolver::ViscousNormalFluxIntegrationPoint_3D(const su2double *sol
   const su2double divVel = dudx + dvdy + dwdz;
 
   /*--- Compute the laminar viscosity. ---*/
-  FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-  const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+  GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+  const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
 
   /*--- Compute the eddy viscosity, if needed. ---*/
   su2double ViscosityTurb = 0.0;
@@ -6320,10 +6337,10 @@ void CFEM_DG_NSSolver::WallTreatmentViscousFluxes(
         su2double vel2Mag = vel[0]*vel[0] + vel[1]*vel[1] + vel[2]*vel[2];
         su2double eInt    = rhoInv*solInt[nVar-1] - 0.5*vel2Mag;
 
-        FluidModel->SetTDState_rhoe(solInt[0], eInt);
-        const su2double Pressure = FluidModel->GetPressure();
-        const su2double Temperature = FluidModel->GetTemperature();
-        const su2double LaminarViscosity= FluidModel->GetLaminarViscosity();
+        GetFluidModel()->SetTDState_rhoe(solInt[0], eInt);
+        const su2double Pressure = GetFluidModel()->GetPressure();
+        const su2double Temperature = GetFluidModel()->GetTemperature();
+        const su2double LaminarViscosity= GetFluidModel()->GetLaminarViscosity();
 
         /* Subtract the prescribed wall velocity, i.e. grid velocity
            from the velocity in the exchange point. */
@@ -6350,7 +6367,7 @@ void CFEM_DG_NSSolver::WallTreatmentViscousFluxes(
         wallModel->WallShearStressAndHeatFlux(Temperature, velTan, LaminarViscosity, Pressure,
                                               Wall_HeatFlux, HeatFlux_Prescribed,
                                               Wall_Temperature, Temperature_Prescribed,
-                                              FluidModel, tauWall, qWall, ViscosityWall,
+                                              GetFluidModel(), tauWall, qWall, ViscosityWall,
                                               kOverCvWall);
 
         /* Compute the wall velocity in tangential direction. */
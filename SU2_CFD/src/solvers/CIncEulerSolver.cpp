@@ -1854,6 +1854,8 @@ void CIncEulerSolver::ExplicitEuler_Iteration(CGeometry *geometry, CSolver **sol
 
 void CIncEulerSolver::PrepareImplicitIteration(CGeometry *geometry, CSolver**, CConfig *config) {
 
+  SU2_PROFILE_SCOPE("Jacobian_Assembly");
+
   struct IncPrec {
     const CIncEulerSolver* solver;
     const bool active = true;
@@ -130,12 +130,16 @@ CNEMOEulerSolver::CNEMOEulerSolver(CGeometry *geometry, CConfig *config,
 
   Allocate(*config);
 
+  /*--- MPI + OpenMP initialization. ---*/
+
+  HybridParallelInitialization(*config, *geometry);
+
   /*--- Allocate Jacobians for implicit time-stepping ---*/
   if (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) {
 
     /*--- Jacobians and vector  structures for implicit computations ---*/
     if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (" << description << "). MG level: " << iMesh <<"." << endl;
-    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, ReducerStrategy);
   }
   else {
     if (rank == MASTER_NODE)  cout<< "Explicit Scheme. No Jacobian structure (" << description << "). MG level: " << iMesh <<"."<<endl;
@@ -194,24 +198,24 @@ CNEMOEulerSolver::CNEMOEulerSolver(CGeometry *geometry, CConfig *config,
     nodes      = new CNEMONSVariable    (Pressure_Inf, MassFrac_Inf, Mvec_Inf,
                                          Temperature_Inf, Temperature_ve_Inf,
                                          nPoint, nDim, nVar, nPrimVar, nPrimVarGrad,
-                                         config, FluidModel);
+                                         config, GetFluidModel());
     node_infty = new CNEMONSVariable    (Pressure_Inf, MassFrac_Inf, Mvec_Inf,
                                         Temperature_Inf, Temperature_ve_Inf,
                                         1, nDim, nVar, nPrimVar, nPrimVarGrad,
-                                        config, FluidModel);
+                                        config, GetFluidModel());
   } else {
     nodes      = new CNEMOEulerVariable(Pressure_Inf, MassFrac_Inf, Mvec_Inf,
                                         Temperature_Inf, Temperature_ve_Inf,
                                         nPoint, nDim, nVar, nPrimVar, nPrimVarGrad,
-                                        config, FluidModel);
+                                        config, GetFluidModel());
     node_infty = new CNEMOEulerVariable(Pressure_Inf, MassFrac_Inf, Mvec_Inf,
                                         Temperature_Inf, Temperature_ve_Inf,
                                         1, nDim, nVar, nPrimVar, nPrimVarGrad,
-                                        config, FluidModel);
+                                        config, GetFluidModel());
   }
   SetBaseClassPointerToNodes();
 
-  node_infty->SetPrimVar(0, FluidModel);
+  node_infty->SetPrimVar(0, GetFluidModel());
 
   /*--- Initial comms. ---*/
 
@@ -233,7 +237,7 @@ CNEMOEulerSolver::CNEMOEulerSolver(CGeometry *geometry, CConfig *config,
 CNEMOEulerSolver::~CNEMOEulerSolver(void) {
 
   delete node_infty;
-  delete FluidModel;
+  for (auto& model : FluidModel) delete model;
 
 }
 
@@ -318,14 +322,16 @@ void CNEMOEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_conta
 
 unsigned long CNEMOEulerSolver::SetPrimitive_Variables(CSolver **solver_container, CConfig *config, bool Output) {
 
-  unsigned long iPoint, nonPhysicalPoints = 0;
-  bool nonphysical = true;
+  /*--- Number of non-physical points, local to the thread, needs
+   *    further reduction if function is called in parallel ---*/
+  unsigned long nonPhysicalPoints = 0;
 
-  for (iPoint = 0; iPoint < nPoint; iPoint ++) {
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint ++) {
 
-    /*--- Incompressible flow, primitive variables ---*/
+    /*--- Compressible flow, primitive variables ---*/
 
-    nonphysical = nodes->SetPrimVar(iPoint,FluidModel);
+    bool nonphysical = nodes->SetPrimVar(iPoint, GetFluidModel());
 
     /* Check for non-realizable states for reporting. */
 
@@ -336,6 +342,7 @@ unsigned long CNEMOEulerSolver::SetPrimitive_Variables(CSolver **solver_containe
     if (!Output) LinSysRes.SetBlock_Zero(iPoint);
 
   }
+  END_SU2_OMP_FOR
 
   return nonPhysicalPoints;
 }
@@ -413,18 +420,36 @@ void CNEMOEulerSolver::SetMax_Eigenvalue(CGeometry *geometry, CConfig *config) {
 
 void CNEMOEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                                          CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
-  unsigned long iEdge, iPoint, jPoint;
 
-  CNumerics* numerics = numerics_container[CONV_TERM];
+  /*--- Pick one numerics object per thread. ---*/
+  CNumerics* numerics = numerics_container[CONV_TERM + omp_get_thread_num()*MAX_TERMS];
 
   /*--- Set booleans based on config settings ---*/
-  bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+
+  /*--- Non-physical counter (no reconstruction, but the counter is reduced at the end). ---*/
+  SU2_OMP_MASTER
+  ErrorCounter = 0;
+  END_SU2_OMP_MASTER
+
+  /*--- For hybrid parallel AD, pause preaccumulation if there is shared reading of
+  * variables, otherwise switch to the faster adjoint evaluation mode. ---*/
+  bool pausePreacc = false;
+  if (ReducerStrategy) pausePreacc = AD::PausePreaccumulation();
+  else AD::StartNoSharedReading();
 
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  /*--- Loop over edge colors. ---*/
+  for (auto color : EdgeColoring)
+  {
+  /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+  SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+  for(auto k = 0ul; k < color.size; ++k) {
+
+    auto iEdge = color.indices[k];
 
     /*--- Points in edge, set normal vectors, and number of neighbors ---*/
-    iPoint = geometry->edges->GetNode(iEdge, 0);
-    jPoint = geometry->edges->GetNode(iEdge, 1);
+    auto iPoint = geometry->edges->GetNode(iEdge, 0);
+    auto jPoint = geometry->edges->GetNode(iEdge, 1);
     numerics->SetNormal(geometry->edges->GetNormal(iEdge));
     numerics->SetNeighbor(geometry->nodes->GetnNeighbor(iPoint),
                           geometry->nodes->GetnNeighbor(jPoint));
@@ -448,17 +473,19 @@ void CNEMOEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_c
     auto residual = numerics->ComputeResidual(config);
 
     /*--- Check residuals/Jacobians --*/
-    bool err = CNumerics::CheckResidualNaNs(implicit, nVar, residual);
+    const bool err = CNumerics::CheckResidualNaNs(implicit, nVar, residual);
 
     /*--- Update the residual and Jacobian ---*/
-    if (!err) {
-      LinSysRes.AddBlock(iPoint, residual);
-      LinSysRes.SubtractBlock(jPoint, residual);
-      if (implicit) {
-        Jacobian.UpdateBlocks(iEdge, iPoint, jPoint, residual.jacobian_i, residual.jacobian_j);
-      }
-    }
+    UpdateEdgeResidual(iEdge, iPoint, jPoint, residual, err, implicit);
+
+    /*--- Viscous contribution. ---*/
+    Viscous_Residual(iEdge, geometry, solver_container,
+                     numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS], config);
   }
+  END_SU2_OMP_FOR
+  } // end color loop
+
+  FinalizeResidualComputation(geometry, pausePreacc, 0, config);
 }
 
 void CNEMOEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
@@ -477,7 +504,7 @@ void CNEMOEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_con
   END_SU2_OMP_MASTER
 
   /*--- Pick one numerics object per thread. ---*/
-  CNumerics* numerics = numerics_container[CONV_TERM];
+  CNumerics* numerics = numerics_container[CONV_TERM + omp_get_thread_num()*MAX_TERMS];
 
   /*--- Static arrays for MUSCL reconstructed variables ---*/
   su2double     Primitive_i[MAXNVAR] = {0.0},    Primitive_j[MAXNVAR] = {0.0};
@@ -490,8 +517,20 @@ void CNEMOEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_con
   su2double  Project_Grad_i[MAXNVAR] = {0.0}, Project_Grad_j[MAXNVAR] = {0.0};
   su2double Gamma_i = 0.0, Gamma_j = 0.0;
 
-  /*--- Loop over edges and calculate convective fluxes ---*/
-  for(unsigned long iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  /*--- For hybrid parallel AD, pause preaccumulation if there is shared reading of
+  * variables, otherwise switch to the faster adjoint evaluation mode. ---*/
+  bool pausePreacc = false;
+  if (ReducerStrategy) pausePreacc = AD::PausePreaccumulation();
+  else AD::StartNoSharedReading();
+
+  /*--- Loop over edge colors. ---*/
+  for (auto color : EdgeColoring)
+  {
+  /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+  SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+  for(auto k = 0ul; k < color.size; ++k) {
+
+    auto iEdge = color.indices[k];
 
     unsigned short iDim, iVar;
 
@@ -616,32 +655,41 @@ void CNEMOEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_con
     auto residual = numerics->ComputeResidual(config);
 
     /*--- Check for NaNs before applying the residual to the linear system ---*/
-    bool err = CNumerics::CheckResidualNaNs(implicit, nVar, residual);
+    const bool err = CNumerics::CheckResidualNaNs(implicit, nVar, residual);
 
     /*--- Update the residual and Jacobian ---*/
+    UpdateEdgeResidual(iEdge, iPoint, jPoint, residual, err, implicit);
+
+    /*--- Viscous contribution. ---*/
+    Viscous_Residual(iEdge, geometry, solver_container,
+                     numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS], config);
+  }
+  END_SU2_OMP_FOR
+  } // end color loop
+
+  FinalizeResidualComputation(geometry, pausePreacc, counter_local, config);
+}
+
+void CNEMOEulerSolver::UpdateEdgeResidual(unsigned long iEdge, unsigned long iPoint, unsigned long jPoint,
+                                          const CNumerics::ResidualType<>& residual, bool err, bool implicit) {
+  if (ReducerStrategy) {
+    /*--- The edge blocks are overwritten, fluxes with NaNs are replaced by zeros. ---*/
     if (!err) {
-      LinSysRes.AddBlock(iPoint, residual);
-      LinSysRes.SubtractBlock(jPoint, residual);
+      EdgeFluxes.SetBlock(iEdge, residual);
+      if (implicit) Jacobian.SetBlocks(iEdge, residual.jacobian_i, residual.jacobian_j);
+    } else {
+      EdgeFluxes.SetBlock_Zero(iEdge);
       if (implicit) {
-        Jacobian.UpdateBlocks(iEdge, iPoint, jPoint, residual.jacobian_i, residual.jacobian_j);
+        su2activematrix zeroBlock(nVar, nVar);
+        zeroBlock = su2double(0.0);
+        Jacobian.SetBlocks(iEdge, zeroBlock, zeroBlock);
       }
     }
   }
-
-  /*--- Warning message about non-physical reconstructions. ---*/
-  if ((iMesh == MESH_0) && (config->GetComm_Level() == COMM_FULL)) {
-    /*--- Add counter results for all threads. ---*/
-    SU2_OMP_ATOMIC
-    ErrorCounter += counter_local;
-
-    /*--- Add counter results for all ranks. ---*/
-    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
-    {
-      counter_local = ErrorCounter;
-      SU2_MPI::Reduce(&counter_local, &ErrorCounter, 1, MPI_UNSIGNED_LONG, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
-      config->SetNonphysical_Reconstr(ErrorCounter);
-    }
-    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  else if (!err) {
+    LinSysRes.AddBlock(iPoint, residual);
+    LinSysRes.SubtractBlock(jPoint, residual);
+    if (implicit) Jacobian.UpdateBlocks(iEdge, iPoint, jPoint, residual.jacobian_i, residual.jacobian_j);
   }
 }
 
@@ -707,8 +755,8 @@ void CNEMOEulerSolver::RecomputeConservativeVector(su2double *U, const su2double
   }
 
   /*--- Set the fluidmodel and recompute energies ---*/
-  FluidModel->SetTDStateRhosTTv( rhos, V[T_INDEX], V[TVE_INDEX]);
-  const auto& Energies = FluidModel->ComputeMixtureEnergies();
+  GetFluidModel()->SetTDStateRhosTTv( rhos, V[T_INDEX], V[TVE_INDEX]);
+  const auto& Energies = GetFluidModel()->ComputeMixtureEnergies();
 
   /*--- Set conservative energies ---*/
   U[nSpecies+nDim]   = V[RHO_INDEX]*(Energies[0]+0.5*sqvel);
@@ -753,27 +801,25 @@ bool CNEMOEulerSolver::CheckNonPhys(const su2double *V) const {
 
 void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
-  unsigned short iVar;
-  unsigned long iPoint;
-
   /*--- Assign booleans ---*/
-  bool err        = false;
-  bool implicit   = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
-  bool frozen     = config->GetFrozen();
-  bool monoatomic = config->GetMonoatomic();
-  bool axisymm    = config->GetAxisymmetric();
-  bool viscous    = config->GetViscous();
-  bool rans       = (config->GetKind_Turb_Model() != TURB_MODEL::NONE);
+  const bool implicit   = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  const bool frozen     = config->GetFrozen();
+  const bool monoatomic = config->GetMonoatomic();
+  const bool axisymm    = config->GetAxisymmetric();
+  const bool viscous    = config->GetViscous();
+  const bool rans       = (config->GetKind_Turb_Model() != TURB_MODEL::NONE);
 
-  CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM];
+  /*--- Pick one numerics object per thread. ---*/
+  CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM + omp_get_thread_num()*MAX_TERMS];
 
-  /*--- Initialize the error counter ---*/
+  /*--- Initialize the error counters (local to the thread, and shared) ---*/
   unsigned long eAxi_local = 0;
   unsigned long eChm_local = 0;
   unsigned long eVib_local = 0;
 
-  /*--- Initialize the source residual to zero ---*/
-  for (iVar = 0; iVar < nVar; iVar++) Residual[iVar] = 0.0;
+  SU2_OMP_MASTER
+  for (auto& counter : SourceErrorCounter) counter = 0;
+  END_SU2_OMP_MASTER
 
   /*--- Preprocess viscous axisymm variables (if necessary) ---*/
   if (axisymm && viscous) {
@@ -782,9 +828,61 @@ void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_con
 
   AD::StartNoSharedReading();
 
+  /*--- Without Jacobians the chemistry is computed for blocks of points with the batched routine of the gas
+   *    model (if available), the implicit Jacobians of the chemistry are only available point by point. ---*/
+  const bool batchedChemistry = !implicit && !monoatomic && !frozen &&
+                                GetFluidModel()->HasBatchedNetProductionRates();
+
+  if (batchedChemistry) {
+    constexpr unsigned long blockSize = 64;
+    const unsigned long nBlocks = roundUpDiv(nPointDomain, blockSize);
+
+    const auto RHOS_INDEX = nodes->GetRhosIndex();
+    const auto T_INDEX    = nodes->GetTIndex();
+    const auto TVE_INDEX  = nodes->GetTveIndex();
+
+    SU2_OMP_FOR_DYN(roundUpDiv(nBlocks, 2*omp_get_num_threads()))
+    for (unsigned long iBlock = 0; iBlock < nBlocks; iBlock++) {
+
+      const unsigned long start = iBlock*blockSize;
+      const unsigned long size = min(blockSize, nPointDomain-start);
+
+      /*--- Gather the species densities and temperatures of the block by species. ---*/
+      su2double rhos[MAXNVAR*blockSize], T[blockSize], Tve[blockSize], ws[MAXNVAR*blockSize];
+
+      for (unsigned long k = 0; k < size; k++) {
+        const su2double* V = nodes->GetPrimitive(start+k);
+        for (unsigned short iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+          rhos[iSpecies*size+k] = V[RHOS_INDEX+iSpecies];
+        T[k] = V[T_INDEX];
+        Tve[k] = V[TVE_INDEX];
+      }
+
+      GetFluidModel()->ComputeNetProductionRates(size, rhos, T, Tve, ws);
+
+      /*--- Apply the chemical sources to the residual. ---*/
+      for (unsigned long k = 0; k < size; k++) {
+        const unsigned long iPoint = start+k;
+        const su2double Volume = geometry->nodes->GetVolume(iPoint);
+
+        su2double residual[MAXNVAR] = {0.0};
+        for (unsigned short iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+          residual[iSpecies] = ws[iSpecies*size+k] * Volume;
+
+        if (!CNumerics::CheckResidualNaNs(false, nVar, CNumerics::ResidualType<>(residual, nullptr, nullptr)))
+          LinSysRes.SubtractBlock(iPoint, residual);
+        else
+          eChm_local++;
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+
   /*--- loop over interior points ---*/
   SU2_OMP_FOR_DYN(omp_chunk_size)
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+
+    bool err = false;
 
     /*--- Set conserved & primitive variables  ---*/
     numerics->SetConservative(nodes->GetSolution(iPoint),  nullptr);
@@ -804,7 +902,7 @@ void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_con
     /*--- Compute finite rate chemistry ---*/
 
     if(!monoatomic){
-      if(!frozen){
+      if(!frozen && !batchedChemistry){
         /*--- Compute the non-equilibrium chemistry ---*/
         auto residual = numerics->ComputeChemistry(config);
 
@@ -891,20 +989,27 @@ void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_con
 
   AD::EndNoSharedReading();
 
-  /*--- Checking for NaN ---*/
-  unsigned long eAxi_global = eAxi_local;
-  unsigned long eChm_global = eChm_local;
-  unsigned long eVib_global = eVib_local;
-
-  //THIS IS NO FUN
-  if ((eAxi_global != 0) ||
-      (eChm_global != 0) ||
-      (eVib_global != 0)) {
-    cout << "Warning!! Instances of NaN in the following source terms: " << endl;
-    cout << "Axisymmetry: " << eAxi_global << endl;
-    cout << "Chemical:    " << eChm_global << endl;
-    cout << "Vib. Relax:  " << eVib_global << endl;
+  /*--- Checking for NaN, add the counters of all threads. ---*/
+  atomicAdd(eAxi_local, SourceErrorCounter[0]);
+  atomicAdd(eChm_local, SourceErrorCounter[1]);
+  atomicAdd(eVib_local, SourceErrorCounter[2]);
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+  {
+    const auto eAxi_global = SourceErrorCounter[0];
+    const auto eChm_global = SourceErrorCounter[1];
+    const auto eVib_global = SourceErrorCounter[2];
+
+    if ((eAxi_global != 0) ||
+        (eChm_global != 0) ||
+        (eVib_global != 0)) {
+      cout << "Warning!! Instances of NaN in the following source terms: " << endl;
+      cout << "Axisymmetry: " << eAxi_global << endl;
+      cout << "Chemical:    " << eChm_global << endl;
+      cout << "Vib. Relax:  " << eVib_global << endl;
+    }
   }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
 }
 
 void CNEMOEulerSolver::ExplicitRK_Iteration(CGeometry *geometry, CSolver **solver_container,
@@ -926,6 +1031,8 @@ void CNEMOEulerSolver::ExplicitEuler_Iteration(CGeometry *geometry, CSolver **so
 
 void CNEMOEulerSolver::PrepareImplicitIteration(CGeometry *geometry, CSolver**, CConfig *config) {
 
+  SU2_PROFILE_SCOPE("Jacobian_Assembly");
+
   struct DummyPrec {
     const bool active = false;
     FORCEINLINE su2double** operator() (const CConfig*, unsigned long, su2double) const { return nullptr; }
@@ -1036,19 +1143,25 @@ void CNEMOEulerSolver::SetNondimensionalization(CConfig *config, unsigned short
   config->SetViscosity_Ref(1.0);
   config->SetConductivity_Ref(1.0);
 
-  /*--- Instatiate the fluid model ---*/
-  switch (config->GetKind_FluidModel()) {
-  case MUTATIONPP:
-   #if defined(HAVE_MPP) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
-     FluidModel = new CMutationTCLib(config, nDim);
-   #else
-     SU2_MPI::Error(string("Either 1) Mutation++ has not been configured/compiled (add '-Denable-mpp=true' to your meson string) or 2) CODI must be deactivated since it is not compatible with Mutation++."),
-     CURRENT_FUNCTION);
-   #endif
-   break;
-  case SU2_NONEQ:
-   FluidModel = new CSU2TCLib(config, nDim, viscous);
-   break;
+  /*--- Instatiate the fluid model, one per thread since the models hold the thermodynamic state.
+   *    GetFluidModel() should be used to automatically access the "right" object of each thread. ---*/
+  assert(FluidModel.empty() && "Potential memory leak!");
+  FluidModel.resize(omp_get_max_threads());
+
+  for (auto& model : FluidModel) {
+    switch (config->GetKind_FluidModel()) {
+    case MUTATIONPP:
+     #if defined(HAVE_MPP) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+       model = new CMutationTCLib(config, nDim);
+     #else
+       SU2_MPI::Error(string("Either 1) Mutation++ has not been configured/compiled (add '-Denable-mpp=true' to your meson string) or 2) CODI must be deactivated since it is not compatible with Mutation++."),
+       CURRENT_FUNCTION);
+     #endif
+     break;
+    case SU2_NONEQ:
+     model = new CSU2TCLib(config, nDim, viscous);
+     break;
+    }
   }
 
   /*--- Compute the Free Stream Pressure, Temperatrue, and Density ---*/
@@ -1061,17 +1174,17 @@ void CNEMOEulerSolver::SetNondimensionalization(CConfig *config, unsigned short
   /*---                                     ---*/
 
   /*--- Set mixture state based on pressure, mass fractions and temperatures ---*/
-  FluidModel->SetTDStatePTTv(Pressure_FreeStream, MassFrac_Inf,
+  GetFluidModel()->SetTDStatePTTv(Pressure_FreeStream, MassFrac_Inf,
                              Temperature_FreeStream, Temperature_ve_FreeStream);
 
   /*--- Compute Gas Constant ---*/
-  GasConstant_Inf = FluidModel->ComputeGasConstant();
+  GasConstant_Inf = GetFluidModel()->ComputeGasConstant();
   config->SetGas_Constant(GasConstant_Inf);
 
   /*--- Compute the freestream density, soundspeed ---*/
-  Density_FreeStream = FluidModel->GetDensity();
-  soundspeed         = FluidModel->ComputeSoundSpeed();
-  Gamma              = FluidModel->ComputeGamma();
+  Density_FreeStream = GetFluidModel()->GetDensity();
+  soundspeed         = GetFluidModel()->ComputeSoundSpeed();
+  Gamma              = GetFluidModel()->ComputeGamma();
 
   /*--- Compute the Free Stream velocity, using the Mach number ---*/
   if (nDim == 2) {
@@ -1093,7 +1206,7 @@ void CNEMOEulerSolver::SetNondimensionalization(CConfig *config, unsigned short
   ModVel_FreeStream = sqrt(ModVel_FreeStream); config->SetModVel_FreeStream(ModVel_FreeStream);
 
   /*--- Calculate energies ---*/
-  const auto& energies = FluidModel->ComputeMixtureEnergies();
+  const auto& energies = GetFluidModel()->ComputeMixtureEnergies();
 
   /*--- Viscous initialization ---*/
   if (viscous) {
@@ -1107,7 +1220,7 @@ void CNEMOEulerSolver::SetNondimensionalization(CConfig *config, unsigned short
     if (!reynolds_init) {
 
       /*--- Thermodynamics quantities based initialization ---*/
-      Viscosity_FreeStream = FluidModel->GetViscosity();
+      Viscosity_FreeStream = GetFluidModel()->GetViscosity();
       Energy_FreeStream    = energies[0] + 0.5*sqvel;
 
     } else {
@@ -1412,16 +1525,18 @@ void CNEMOEulerSolver::BC_Sym_Plane(CGeometry *geometry, CSolver **solver_contai
                                     CNumerics *visc_numerics, CConfig *config, unsigned short val_marker) {
 
   unsigned short iDim, jDim, iSpecies, iVar, jVar;
-  unsigned long iPoint, iVertex;
 
-  /*--- Allocate the necessary vector structures ---*/
+  /*--- Allocate the necessary vector structures (local to the thread) ---*/
   su2double Normal[MAXNDIM] = {0.0}, UnitNormal[MAXNDIM] = {0.0};
+  su2double Residual[MAXNVAR] = {0.0};
+  su2activematrix Jacobian_i(nVar, nVar);
 
   bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
 
   /*--- Loop over all the vertices on this boundary (val_marker) ---*/
-  for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+  for (unsigned long iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
+    const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
 
     /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
     if (geometry->nodes->GetDomain(iPoint)) {
@@ -1458,7 +1573,7 @@ void CNEMOEulerSolver::BC_Sym_Plane(CGeometry *geometry, CSolver **solver_contai
         su2double Velocity[MAXNDIM] = {0.0};
 
         /*--- Get species molar mass ---*/
-        auto& Ms = FluidModel->GetSpeciesMolarMass();
+        auto& Ms = GetFluidModel()->GetSpeciesMolarMass();
 
         /*--- Initialize Jacobian ---*/
         for (iVar = 0; iVar < nVar; iVar++)
@@ -1507,6 +1622,7 @@ void CNEMOEulerSolver::BC_Sym_Plane(CGeometry *geometry, CSolver **solver_contai
       }
     }
   }
+  END_SU2_OMP_FOR
 }
 
 void CNEMOEulerSolver::BC_Far_Field(CGeometry *geometry,
@@ -1519,6 +1635,7 @@ void CNEMOEulerSolver::BC_Far_Field(CGeometry *geometry,
   su2double Normal[MAXNDIM] = {0.0};
 
   /*--- Loop over all the vertices on this boundary (val_marker) ---*/
+  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
   for (unsigned long iVertex = 0; iVertex < geometry->nVertex[val_marker];
        iVertex++) {
     const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
@@ -1623,6 +1740,7 @@ void CNEMOEulerSolver::BC_Far_Field(CGeometry *geometry,
       }
     }
   }
+  END_SU2_OMP_FOR
 }
 
 void CNEMOEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
@@ -1904,7 +2022,6 @@ void CNEMOEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container
                                  CNumerics *conv_numerics, CNumerics *visc_numerics, CConfig *config, unsigned short val_marker) {
 
   unsigned short iVar, iDim, iSpecies;
-  unsigned long iVertex, iPoint;
   su2double Pressure, P_Exit, Velocity[3], Temperature, Tve, Velocity2, Entropy, Density,
   Riemann, Vn, SoundSpeed, Mach_Exit, Vn_Exit, Area, UnitNormal[3];
   vector<su2double> rhos;
@@ -1916,11 +2033,12 @@ void CNEMOEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container
   bool gravity      = config->GetGravityForce();
   bool implicit     = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
 
+  /*--- Local arrays (private to each thread) ---*/
   su2double *U_domain;
-  su2double *U_outlet = new su2double[nVar];
+  su2double U_outlet[MAXNVAR] = {0.0};
   su2double *V_domain, *V_outlet;
-  su2double *Normal   = new su2double[nDim];
-  su2double *Ys       = new su2double[nSpecies];
+  su2double Normal[MAXNDIM] = {0.0};
+  su2double Ys[MAXNVAR] = {0.0};
 
   unsigned short T_INDEX       = nodes->GetTIndex();
   unsigned short TVE_INDEX     = nodes->GetTveIndex();
@@ -1933,8 +2051,9 @@ void CNEMOEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container
   unsigned short RHOCVVE_INDEX = nodes->GetRhoCvveIndex();
 
   /*--- Loop over all the vertices on this boundary marker ---*/
-  for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+  for (unsigned long iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
+    const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
 
     /*--- Allocate the value at the outlet ---*/
     V_outlet = GetCharacPrimVar(val_marker, iVertex);
@@ -1963,8 +2082,8 @@ void CNEMOEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container
       /*--- Build the fictitious intlet state based on characteristics ---*/
 
       /*--- Compute Gamma using domain state ---*/
-      Gamma = nodes->GetGamma(iPoint);
-      Gamma_Minus_One = Gamma - 1.0;
+      const su2double Gamma = nodes->GetGamma(iPoint);
+      const su2double Gamma_Minus_One = Gamma - 1.0;
 
       /*--- Retrieve the specified back pressure for this outlet. ---*/
       if (gravity) P_Exit = config->GetOutlet_Pressure(Marker_Tag) - geometry->nodes->GetCoord(iPoint, nDim-1)*STANDARD_GRAVITY;
@@ -2046,11 +2165,11 @@ void CNEMOEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container
         V_outlet[A_INDEX]     = SoundSpeed;
 
         /*--- Set mixture state and compute quantities ---*/
-        FluidModel->SetTDStateRhosTTv(rhos, Temperature, Tve);
-        V_outlet[RHOCVTR_INDEX] = FluidModel->ComputerhoCvtr();
-        V_outlet[RHOCVVE_INDEX] = FluidModel->ComputerhoCvve();
+        GetFluidModel()->SetTDStateRhosTTv(rhos, Temperature, Tve);
+        V_outlet[RHOCVTR_INDEX] = GetFluidModel()->ComputerhoCvtr();
+        V_outlet[RHOCVVE_INDEX] = GetFluidModel()->ComputerhoCvve();
 
-        const auto& energies = FluidModel->ComputeMixtureEnergies();
+        const auto& energies = GetFluidModel()->ComputeMixtureEnergies();
 
         /*--- Conservative variables, using the derived quantities ---*/
         for (iSpecies = 0; iSpecies < nSpecies; iSpecies ++){
@@ -2144,11 +2263,7 @@ void CNEMOEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container
 //      }
     }
   }
-
-  /*--- Free locally allocated memory ---*/
-  delete [] U_outlet;
-  delete [] Normal;
-  delete [] Ys;
+  END_SU2_OMP_FOR
 
 }
 
@@ -2174,10 +2289,10 @@ void CNEMOEulerSolver::BC_Supersonic_Inlet(
   }
 
   /*--- Set mixture state ---*/
-  FluidModel->SetTDStatePTTv(Pressure, Mass_Frac, Temperature, Temperature_ve);
+  GetFluidModel()->SetTDStatePTTv(Pressure, Mass_Frac, Temperature, Temperature_ve);
 
   /*--- Compute Ma vector for flow direction ---*/
-  const su2double soundspeed = FluidModel->ComputeSoundSpeed();
+  const su2double soundspeed = GetFluidModel()->ComputeSoundSpeed();
 
   su2double Mvec[MAXNDIM] = {0.0};
 
@@ -2187,12 +2302,13 @@ void CNEMOEulerSolver::BC_Supersonic_Inlet(
   /*--- Allocate inlet node to compute gradients for numerics ---*/
   CNEMOEulerVariable node_inlet(Pressure, Mass_Frac, Mvec, Temperature,
                                 Temperature_ve, 1, nDim, nVar, nPrimVar,
-                                nPrimVarGrad, config, FluidModel);
-  node_inlet.SetPrimVar(0, FluidModel);
+                                nPrimVarGrad, config, GetFluidModel());
+  node_inlet.SetPrimVar(0, GetFluidModel());
 
   su2double Normal[MAXNDIM] = {0.0};
 
   /*--- Loop over all the vertices on this boundary marker ---*/
+  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
   for (unsigned long iVertex = 0; iVertex < geometry->nVertex[val_marker];
        iVertex++) {
     const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
@@ -2294,6 +2410,7 @@ void CNEMOEulerSolver::BC_Supersonic_Inlet(
         Jacobian.SubtractBlock2Diag(iPoint, residual.jacobian_i);
     }
   }
+  END_SU2_OMP_FOR
 }
 
 void CNEMOEulerSolver::BC_Supersonic_Outlet(
@@ -2308,6 +2425,7 @@ void CNEMOEulerSolver::BC_Supersonic_Outlet(
   const string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
 
   /*--- Loop over all the vertices on this boundary marker ---*/
+  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
   for (unsigned long iVertex = 0; iVertex < geometry->nVertex[val_marker];
        iVertex++) {
 
@@ -2353,12 +2471,14 @@ void CNEMOEulerSolver::BC_Supersonic_Outlet(
     if (implicit)
       Jacobian.AddBlock2Diag(iPoint, residual.jacobian_i);
   }
+  END_SU2_OMP_FOR
 }
 
 void CNEMOEulerSolver::SetPressureDiffusionSensor(CGeometry *geometry, CConfig *config) {
 
   const auto P_INDEX = nodes->GetPIndex();
 
+  SU2_OMP_FOR_STAT(omp_chunk_size)
   for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
     su2double Sensor = 1.0;
@@ -2370,6 +2490,7 @@ void CNEMOEulerSolver::SetPressureDiffusionSensor(CGeometry *geometry, CConfig *
 
     nodes->SetSensor(iPoint,Sensor);
   }
+  END_SU2_OMP_FOR
 
   /*--- MPI parallelization ---*/
 
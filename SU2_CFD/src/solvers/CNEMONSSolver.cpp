@@ -132,7 +132,7 @@ unsigned long CNEMONSSolver::SetPrimitive_Variables(CSolver **solver_container,C
 
     /*--- Compressible flow, primitive variables. ---*/
 
-    bool nonphysical = nodes->SetPrimVar(iPoint,FluidModel);
+    bool nonphysical = nodes->SetPrimVar(iPoint, GetFluidModel());
 
     /* Check for non-realizable states for reporting. */
 
@@ -145,8 +145,6 @@ unsigned long CNEMONSSolver::SetPrimitive_Variables(CSolver **solver_container,C
 
 void CNEMONSSolver::SetPrimitive_Gradient_GG(CGeometry *geometry, const CConfig *config, bool reconstruction) {
 
-  unsigned long iPoint, iVar;
-  unsigned short iSpecies;
   auto& gradient = reconstruction ? nodes->GetGradient_Reconstruction() : nodes->GetGradient_Primitive();
   const auto comm = reconstruction? PRIMITIVE_GRAD_REC : PRIMITIVE_GRADIENT;
   const auto commPer = reconstruction? PERIODIC_PRIM_GG_R : PERIODIC_PRIM_GG;
@@ -156,89 +154,89 @@ void CNEMONSSolver::SetPrimitive_Gradient_GG(CGeometry *geometry, const CConfig
   const unsigned short RHO_INDEX  = nodes->GetRhoIndex();
 
   /*--- Modify species density to mass concentration ---*/
-  for ( iPoint = 0; iPoint < nPoint; iPoint++){
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++){
     su2double primitives_aux[MAXNVAR] = {0.0};
-    for( iVar = 0; iVar < nPrimVar; iVar++)
+    for(unsigned long iVar = 0; iVar < nPrimVar; iVar++)
       primitives_aux[iVar] = nodes->GetPrimitive(iPoint, iVar);
-    for ( iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+    for (unsigned short iSpecies = 0; iSpecies < nSpecies; iSpecies++)
       primitives_aux[RHOS_INDEX+iSpecies] = primitives_aux[RHOS_INDEX+iSpecies]/primitives_aux[RHO_INDEX];
-    for( iVar = 0; iVar < nPrimVar; iVar++)
+    for(unsigned long iVar = 0; iVar < nPrimVar; iVar++)
       nodes->SetPrimitive_Aux(iPoint, iVar, primitives_aux[iVar] );
   }
+  END_SU2_OMP_FOR
 
   const auto& primitives = nodes->GetPrimitive_Aux();
 
   computeGradientsGreenGauss(this, comm, commPer, *geometry, *config, primitives, 0, nPrimVarGrad, gradient);
 }
 
-void CNEMONSSolver::Viscous_Residual(CGeometry *geometry,
-                                     CSolver **solver_container,
-                                     CNumerics **numerics_container,
-                                     CConfig *config, unsigned short iMesh,
-                                     unsigned short iRKStep) {
+void CNEMONSSolver::Viscous_Residual(unsigned long iEdge, CGeometry *geometry, CSolver **solver_container,
+                                     CNumerics *numerics, CConfig *config) {
 
-  bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
-  CNumerics* numerics = numerics_container[VISC_TERM];
-
-  for (unsigned long iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-
-    /*--- Points, coordinates and normal vector in edge ---*/
-    auto iPoint = geometry->edges->GetNode(iEdge, 0);
-    auto jPoint = geometry->edges->GetNode(iEdge, 1);
-    numerics->SetCoord(geometry->nodes->GetCoord(iPoint),
-                       geometry->nodes->GetCoord(jPoint) );
-    numerics->SetNormal(geometry->edges->GetNormal(iEdge));
-
-    /*--- Primitive variables, and gradient ---*/
-    numerics->SetConservative   (nodes->GetSolution(iPoint),
-                                 nodes->GetSolution(jPoint) );
-    numerics->SetPrimitive      (nodes->GetPrimitive(iPoint),
-                                 nodes->GetPrimitive(jPoint) );
-    numerics->SetPrimVarGradient(nodes->GetGradient_Primitive(iPoint),
-                                 nodes->GetGradient_Primitive(jPoint) );
-
-    /*--- Pass supplementary information to CNumerics ---*/
-    numerics->SetdPdU  (nodes->GetdPdU(iPoint),   nodes->GetdPdU(jPoint));
-    numerics->SetdTdU  (nodes->GetdTdU(iPoint),   nodes->GetdTdU(jPoint));
-    numerics->SetdTvedU(nodes->GetdTvedU(iPoint), nodes->GetdTvedU(jPoint));
-    numerics->SetEve   (nodes->GetEve(iPoint),    nodes->GetEve(jPoint));
-    numerics->SetCvve  (nodes->GetCvve(iPoint),   nodes->GetCvve(jPoint));
-
-    /*--- Species diffusion coefficients ---*/
-    numerics->SetDiffusionCoeff(nodes->GetDiffusionCoeff(iPoint),
-                                nodes->GetDiffusionCoeff(jPoint) );
-
-    /*--- Laminar viscosity ---*/
-    numerics->SetLaminarViscosity(nodes->GetLaminarViscosity(iPoint),
-                                  nodes->GetLaminarViscosity(jPoint) );
-
-    /*--- Eddy viscosity ---*/
-    numerics->SetEddyViscosity(nodes->GetEddyViscosity(iPoint),
-                               nodes->GetEddyViscosity(jPoint) );
-
-    /*--- Thermal conductivity ---*/
-    numerics->SetThermalConductivity(nodes->GetThermalConductivity(iPoint),
-                                     nodes->GetThermalConductivity(jPoint));
-
-    /*--- Vib-el. thermal conductivity ---*/
-    numerics->SetThermalConductivity_ve(nodes->GetThermalConductivity_ve(iPoint),
-                                        nodes->GetThermalConductivity_ve(jPoint) );
-
-    /*--- Compute and update residual ---*/
-    auto residual = numerics->ComputeResidual(config);
-
-    /*--- Check for NaNs before applying the residual to the linear system ---*/
-    bool err = CNumerics::CheckResidualNaNs(implicit, nVar, residual);
-
-    /*--- Update the residual and Jacobian ---*/
-    if (!err) {
-      LinSysRes.SubtractBlock(iPoint, residual);
-      LinSysRes.AddBlock(jPoint, residual);
-      if (implicit) {
-        Jacobian.UpdateBlocks(iEdge, iPoint, jPoint, residual.jacobian_i, residual.jacobian_j);
-      }
+  const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+
+  /*--- Points, coordinates and normal vector in edge ---*/
+  auto iPoint = geometry->edges->GetNode(iEdge, 0);
+  auto jPoint = geometry->edges->GetNode(iEdge, 1);
+  numerics->SetCoord(geometry->nodes->GetCoord(iPoint),
+                     geometry->nodes->GetCoord(jPoint) );
+  numerics->SetNormal(geometry->edges->GetNormal(iEdge));
+
+  /*--- Primitive variables, and gradient ---*/
+  numerics->SetConservative   (nodes->GetSolution(iPoint),
+                               nodes->GetSolution(jPoint) );
+  numerics->SetPrimitive      (nodes->GetPrimitive(iPoint),
+                               nodes->GetPrimitive(jPoint) );
+  numerics->SetPrimVarGradient(nodes->GetGradient_Primitive(iPoint),
+                               nodes->GetGradient_Primitive(jPoint) );
+
+  /*--- Pass supplementary information to CNumerics ---*/
+  numerics->SetdPdU  (nodes->GetdPdU(iPoint),   nodes->GetdPdU(jPoint));
+  numerics->SetdTdU  (nodes->GetdTdU(iPoint),   nodes->GetdTdU(jPoint));
+  numerics->SetdTvedU(nodes->GetdTvedU(iPoint), nodes->GetdTvedU(jPoint));
+  numerics->SetEve   (nodes->GetEve(iPoint),    nodes->GetEve(jPoint));
+  numerics->SetCvve  (nodes->GetCvve(iPoint),   nodes->GetCvve(jPoint));
+
+  /*--- Species diffusion coefficients ---*/
+  numerics->SetDiffusionCoeff(nodes->GetDiffusionCoeff(iPoint),
+                              nodes->GetDiffusionCoeff(jPoint) );
+
+  /*--- Laminar viscosity ---*/
+  numerics->SetLaminarViscosity(nodes->GetLaminarViscosity(iPoint),
+                                nodes->GetLaminarViscosity(jPoint) );
+
+  /*--- Eddy viscosity ---*/
+  numerics->SetEddyViscosity(nodes->GetEddyViscosity(iPoint),
+                             nodes->GetEddyViscosity(jPoint) );
+
+  /*--- Thermal conductivity ---*/
+  numerics->SetThermalConductivity(nodes->GetThermalConductivity(iPoint),
+                                   nodes->GetThermalConductivity(jPoint));
+
+  /*--- Vib-el. thermal conductivity ---*/
+  numerics->SetThermalConductivity_ve(nodes->GetThermalConductivity_ve(iPoint),
+                                      nodes->GetThermalConductivity_ve(jPoint) );
+
+  /*--- Compute and update residual ---*/
+  auto residual = numerics->ComputeResidual(config);
+
+  /*--- Check for NaNs before applying the residual to the linear system ---*/
+  const bool err = CNumerics::CheckResidualNaNs(implicit, nVar, residual);
+  if (err) return;
+
+  /*--- Update the residual and Jacobian ---*/
+  if (ReducerStrategy) {
+    EdgeFluxes.SubtractBlock(iEdge, residual);
+    if (implicit) Jacobian.UpdateBlocks(iEdge, residual.jacobian_i, residual.jacobian_j);
+  }
+  else {
+    LinSysRes.SubtractBlock(iPoint, residual);
+    LinSysRes.AddBlock(jPoint, residual);
+    if (implicit) {
+      Jacobian.UpdateBlocks(iEdge, iPoint, jPoint, residual.jacobian_i, residual.jacobian_j);
     }
-  } //iEdge
+  }
 }
 
 void CNEMONSSolver::BC_HeatFluxNonCatalytic_Wall(CGeometry *geometry,
@@ -259,6 +257,9 @@ void CNEMONSSolver::BC_HeatFluxNonCatalytic_Wall(CGeometry *geometry,
   /*--- Set "Proportional control" coefficient ---*/
   const su2double pcontrol = 1.0;
 
+  /*--- Residual of each vertex (local to the thread) ---*/
+  su2double Res_Visc[MAXNVAR] = {0.0};
+
   /*--- Get the locations of the primitive variables ---*/
   const unsigned short T_INDEX       = nodes->GetTIndex();
   const unsigned short TVE_INDEX     = nodes->GetTveIndex();
@@ -548,6 +549,8 @@ void CNEMONSSolver::BC_IsothermalNonCatalytic_Wall(CGeometry *geometry,
   /*--- Retrieve the specified wall temperature ---*/
   su2double Twall = config->GetIsothermal_Temperature(Marker_Tag);
 
+  /*--- Residual and Jacobian of each vertex (local to the thread) ---*/
+  su2double Res_Visc[MAXNVAR] = {0.0};
   su2double **Jacobian_i = nullptr;
   if (implicit) {
     Jacobian_i = new su2double* [nVar];
@@ -660,9 +663,11 @@ void CNEMONSSolver::BC_IsothermalCatalytic_Wall(CGeometry *geometry,
   BC_IsothermalNonCatalytic_Wall(geometry, solver_container, conv_numerics,
                                  sour_numerics, config, val_marker);
 
-  /*--- Local variables ---*/
+  /*--- Local variables (private to each thread) ---*/
   unsigned short iSpecies, jSpecies, iVar, jVar, kVar;
   su2double **GradY, **dVdU;
+  su2double Res_Visc[MAXNVAR] = {0.0};
+  su2activematrix Jacobian_i, Jacobian_j;
 
   /*--- Assign booleans ---*/
   const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
@@ -671,7 +676,7 @@ void CNEMONSSolver::BC_IsothermalCatalytic_Wall(CGeometry *geometry,
   /*--- Get universal information ---*/
   const su2double RuSI = UNIVERSAL_GAS_CONSTANT;
   const su2double Ru = 1000.0*RuSI;
-  const auto& Ms = FluidModel->GetSpeciesMolarMass();
+  const auto& Ms = GetFluidModel()->GetSpeciesMolarMass();
 
   /*--- Get the locations of the primitive variables ---*/
   const unsigned short RHOS_INDEX  = nodes->GetRhosIndex();
@@ -686,8 +691,13 @@ void CNEMONSSolver::BC_IsothermalCatalytic_Wall(CGeometry *geometry,
   dVdU = new su2double*[nVar];
   for (iVar = 0; iVar < nVar; iVar++)
     dVdU[iVar] = new su2double[nVar];
+  if (implicit) {
+    Jacobian_i.resize(nVar, nVar);
+    Jacobian_j.resize(nVar, nVar);
+  }
 
   /*--- Loop over all of the vertices on this boundary marker ---*/
+  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
   for (auto iVertex = 0u; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
     const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
@@ -715,7 +725,7 @@ void CNEMONSSolver::BC_IsothermalCatalytic_Wall(CGeometry *geometry,
       const auto& Vj = nodes->GetPrimitive(jPoint);
       const auto& Di = nodes->GetDiffusionCoeff(iPoint);
       const auto& eves = nodes->GetEve(iPoint);
-      const auto& hs = FluidModel->ComputeSpeciesEnthalpy(Vi[T_INDEX], Vi[TVE_INDEX], eves);
+      const auto& hs = GetFluidModel()->ComputeSpeciesEnthalpy(Vi[T_INDEX], Vi[TVE_INDEX], eves);
       const su2double rho = Vi[RHO_INDEX];
       const auto& dTdU = nodes->GetdTdU(iPoint);
       const auto& dTvedU = nodes->GetdTvedU(iPoint);
@@ -759,7 +769,7 @@ void CNEMONSSolver::BC_IsothermalCatalytic_Wall(CGeometry *geometry,
           }
 
           /*--- Calculate supplementary quantities ---*/
-          const auto& Cvtrs = FluidModel->GetSpeciesCvTraRot();
+          const auto& Cvtrs = GetFluidModel()->GetSpeciesCvTraRot();
           const auto& Cvve = nodes->GetCvve(iPoint);
 
           /*--- Take the primitive var. Jacobian & store in Jac. jj ---*/
@@ -794,7 +804,7 @@ void CNEMONSSolver::BC_IsothermalCatalytic_Wall(CGeometry *geometry,
                 Jacobian_i[iVar][jVar] += Jacobian_j[iVar][kVar]*dVdU[kVar][jVar]*Area;
 
           /*--- Apply to the linear system ---*/
-          Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
+          Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
         }
 
       } else {
@@ -813,7 +823,7 @@ void CNEMONSSolver::BC_IsothermalCatalytic_Wall(CGeometry *geometry,
         const su2double gam = config->GetCatalytic_Efficiency();
 
         /*--- Get cataltyic reaction map ---*/
-        const auto& RxnTable = FluidModel->GetCatalyticRecombination();
+        const auto& RxnTable = GetFluidModel()->GetCatalyticRecombination();
 
         /*--- Common catalytic flux factor ---*/
         const su2double factor = gam*rho*sqrt(RuSI*Tw/2/PI_NUMBER)*Area;
@@ -836,6 +846,7 @@ void CNEMONSSolver::BC_IsothermalCatalytic_Wall(CGeometry *geometry,
       LinSysRes.SubtractBlock(iPoint, Res_Visc);
     }
   }
+  END_SU2_OMP_FOR
 
   for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
     delete [] GradY[iSpecies];
@@ -879,6 +890,9 @@ void CNEMONSSolver::BC_Smoluchowski_Maxwell(CGeometry *geometry,
   const unsigned short VEL_INDEX = nodes->GetVelIndex();
   const unsigned short TVE_INDEX = nodes->GetTveIndex();
 
+  /*--- Residual and slip velocity of each vertex (local to the thread) ---*/
+  su2double Res_Visc[MAXNVAR] = {0.0}, Vector[MAXNDIM] = {0.0};
+
   /*--- Loop over boundary points to calculate energy flux ---*/
   SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
   for(auto iVertex = 0u; iVertex < geometry->nVertex[val_marker]; iVertex++) {
@@ -930,7 +944,7 @@ void CNEMONSSolver::BC_Smoluchowski_Maxwell(CGeometry *geometry,
     const auto Grad_PrimVar = nodes->GetGradient_Primitive(iPoint);
 
     /*--- Calculate specific gas constant --- */
-    su2double GasConstant = FluidModel->ComputeGasConstant();
+    su2double GasConstant = GetFluidModel()->ComputeGasConstant();
 
     /*--- Calculate temperature gradients normal to surface---*/ //Doubt about minus sign
     su2double dTn = GeometryToolbox::DotProduct(nDim, Grad_PrimVar[T_INDEX], UnitNormal);
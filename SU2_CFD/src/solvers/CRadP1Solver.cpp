@@ -35,7 +35,6 @@ CRadP1Solver::CRadP1Solver(void) : CRadSolver() {
 
 CRadP1Solver::CRadP1Solver(CGeometry* geometry, CConfig *config) : CRadSolver(geometry, config) {
 
-  unsigned short iVar;
   unsigned short direct_diff = config->GetDirectDiff();
   bool multizone = config->GetMultizone_Problem();
 
@@ -48,11 +47,8 @@ CRadP1Solver::CRadP1Solver(CGeometry* geometry, CConfig *config) : CRadSolver(ge
 
   nVarGrad = nVar;
 
-  Residual = new su2double[nVar];
   Solution = new su2double[nVar];
 
-  Res_Visc = new su2double[nVar];
-
   /*--- Define some structures for locating max residuals ---*/
 
   Residual_RMS.resize(nVar,0.0);
@@ -60,19 +56,35 @@ CRadP1Solver::CRadP1Solver(CGeometry* geometry, CConfig *config) : CRadSolver(ge
   Point_Max.resize(nVar,0);
   Point_Max_Coord.resize(nVar,nDim) = su2double(0.0);
 
+#ifdef HAVE_OMP
+  /*--- Get the edge coloring, see notes in CEulerSolver's constructor. ---*/
+  su2double parallelEff = 1.0;
+  const auto& coloring = geometry->GetEdgeColoring(&parallelEff);
+
+  ReducerStrategy = parallelEff < COLORING_EFF_THRESH;
+
+  if (ReducerStrategy && (coloring.getOuterSize() > 1)) geometry->SetNaturalEdgeColoring();
+
+  if (!coloring.empty()) {
+    auto groupSize = ReducerStrategy ? 1ul : geometry->GetEdgeColorGroupSize();
+    auto nColor = coloring.getOuterSize();
+    EdgeColoring.reserve(nColor);
+
+    for (auto iColor = 0ul; iColor < nColor; ++iColor)
+      EdgeColoring.emplace_back(coloring.innerIdx(iColor), coloring.getNumNonZeros(iColor), groupSize);
+  }
+
+  omp_chunk_size = computeStaticChunkSize(nPoint, omp_get_max_threads(), OMP_MAX_SIZE);
+#else
+  EdgeColoring[0] = DummyGridColor<>(geometry->GetnEdge());
+#endif
+
   /*--- Jacobians and vector structures for implicit computations ---*/
 
   if (config->GetKind_TimeIntScheme_Radiation() == EULER_IMPLICIT) {
 
-    Jacobian_i = new su2double* [nVar];
-    Jacobian_j = new su2double* [nVar];
-    for (iVar = 0; iVar < nVar; iVar++) {
-      Jacobian_i[iVar] = new su2double [nVar];
-      Jacobian_j[iVar] = new su2double [nVar];
-    }
-
     if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (P1 radiation equation)." << endl;
-    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, ReducerStrategy);
 
   }
 
@@ -81,6 +93,8 @@ CRadP1Solver::CRadP1Solver(CGeometry* geometry, CConfig *config) : CRadSolver(ge
   LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
   LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
 
+  if (ReducerStrategy) EdgeFluxes.Initialize(geometry->GetnEdge(), geometry->GetnEdge(), nVar, nullptr);
+
   /*--- Read farfield conditions from config ---*/
   Temperature_Inf = config->GetTemperature_FreeStreamND();
 
@@ -137,15 +151,16 @@ CRadP1Solver::~CRadP1Solver(void) {
 
 void CRadP1Solver::Preprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh, unsigned short iRKStep, unsigned short RunTime_EqSystem, bool Output) {
 
-  unsigned long iPoint;
-
   /*--- Initialize the residual vector ---*/
-  for (iPoint = 0; iPoint < nPoint; iPoint ++) {
-    LinSysRes.SetBlock_Zero(iPoint);
-  }
+  LinSysRes.SetValZero();
+  if (ReducerStrategy) EdgeFluxes.SetValZero();
 
   /*--- Initialize the Jacobian matrix ---*/
-  Jacobian.SetValZero();
+  if (config->GetKind_TimeIntScheme_Radiation() == EULER_IMPLICIT) {
+    Jacobian.SetValZero();
+  } else {
+    SU2_OMP_BARRIER
+  }
 
   /*--- Compute the Solution gradients ---*/
   if (config->GetReconstructionGradientRequired()) {
@@ -160,81 +175,139 @@ void CRadP1Solver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 
 void CRadP1Solver::Postprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh) {
 
-  unsigned long iPoint;
-  su2double Energy, Temperature;
-  su2double SourceTerm, SourceTerm_Derivative;
+  const auto flowNodes = solver_container[FLOW_SOL]->GetNodes();
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
 
     /*--- Retrieve the radiative energy ---*/
-    Energy = nodes->GetSolution(iPoint, 0);
+    const su2double Energy = nodes->GetSolution(iPoint, 0);
 
     /*--- Retrieve temperature from the flow solver ---*/
-    Temperature = solver_container[FLOW_SOL]->GetNodes()->GetTemperature(iPoint);
+    const su2double Temperature = flowNodes->GetTemperature(iPoint);
 
     /*--- Compute the divergence of the radiative flux ---*/
-    SourceTerm = Absorption_Coeff*(Energy - 4.0*STEFAN_BOLTZMANN*pow(Temperature,4.0));
+    const su2double SourceTerm = Absorption_Coeff*(Energy - 4.0*STEFAN_BOLTZMANN*pow(Temperature,4.0));
 
     /*--- Compute the derivative of the source term with respect to the temperature ---*/
-    SourceTerm_Derivative =  - 16.0*Absorption_Coeff*STEFAN_BOLTZMANN*pow(Temperature,3.0);
+    const su2double SourceTerm_Derivative =  - 16.0*Absorption_Coeff*STEFAN_BOLTZMANN*pow(Temperature,3.0);
 
     /*--- Store the source term and its derivative ---*/
     nodes->SetRadiative_SourceTerm(iPoint, 0, SourceTerm);
     nodes->SetRadiative_SourceTerm(iPoint, 1, SourceTerm_Derivative);
 
   }
+  END_SU2_OMP_FOR
 
 }
 
 void CRadP1Solver::Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                                     CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
 
-  CNumerics* numerics = numerics_container[VISC_TERM];
+  const bool implicit = (config->GetKind_TimeIntScheme_Radiation() == EULER_IMPLICIT);
+
+  CNumerics* numerics = numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS];
+
+  /*--- Thread-local residual and Jacobians (the P1 model has a single variable). ---*/
 
-  unsigned long iEdge, iPoint, jPoint;
+  su2double residual[1] = {0.0}, jac_i[1] = {0.0}, jac_j[1] = {0.0};
+  su2double* Jac_i[1] = {jac_i};
+  su2double* Jac_j[1] = {jac_j};
 
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  bool pausePreacc = false;
+  if (ReducerStrategy)
+    pausePreacc = AD::PausePreaccumulation();
+  else
+    AD::StartNoSharedReading();
 
-    /*--- Points in edge ---*/
+  for (auto color : EdgeColoring) {
+    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+    for (auto k = 0ul; k < color.size; ++k) {
 
-    iPoint = geometry->edges->GetNode(iEdge,0);
-    jPoint = geometry->edges->GetNode(iEdge,1);
+      auto iEdge = color.indices[k];
 
-    /*--- Points coordinates, and normal vector ---*/
+      /*--- Points in edge ---*/
 
-    numerics->SetCoord(geometry->nodes->GetCoord(iPoint),
-                       geometry->nodes->GetCoord(jPoint));
-    numerics->SetNormal(geometry->edges->GetNormal(iEdge));
+      auto iPoint = geometry->edges->GetNode(iEdge,0);
+      auto jPoint = geometry->edges->GetNode(iEdge,1);
 
-    /*--- Radiation variables w/o reconstruction, and its gradients ---*/
+      /*--- Points coordinates, and normal vector ---*/
 
-    numerics->SetRadVar(nodes->GetSolution(iPoint), nodes->GetSolution(jPoint));
-    numerics->SetRadVarGradient(nodes->GetGradient(iPoint), nodes->GetGradient(jPoint));
+      numerics->SetCoord(geometry->nodes->GetCoord(iPoint),
+                         geometry->nodes->GetCoord(jPoint));
+      numerics->SetNormal(geometry->edges->GetNormal(iEdge));
 
-    /*--- Compute residual, and Jacobians ---*/
+      /*--- Radiation variables w/o reconstruction, and its gradients ---*/
 
-    numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
+      numerics->SetRadVar(nodes->GetSolution(iPoint), nodes->GetSolution(jPoint));
+      numerics->SetRadVarGradient(nodes->GetGradient(iPoint), nodes->GetGradient(jPoint));
 
-    /*--- Add and subtract residual, and update Jacobian ---*/
+      /*--- Compute residual, and Jacobians ---*/
 
-    LinSysRes.SubtractBlock(iPoint, Residual);
-    LinSysRes.AddBlock(jPoint, Residual);
-    Jacobian.UpdateBlocksSub(iEdge, iPoint, jPoint, Jacobian_i, Jacobian_j);
+      numerics->ComputeResidual(residual, Jac_i, Jac_j, config);
 
+      /*--- Add and subtract residual, and update Jacobian ---*/
+
+      if (ReducerStrategy) {
+        EdgeFluxes.SubtractBlock(iEdge, residual);
+        if (implicit) Jacobian.UpdateBlocksSub(iEdge, Jac_i, Jac_j);
+      }
+      else {
+        LinSysRes.SubtractBlock(iPoint, residual);
+        LinSysRes.AddBlock(jPoint, residual);
+        if (implicit) Jacobian.UpdateBlocksSub(iEdge, iPoint, jPoint, Jac_i, Jac_j);
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+
+  /*--- Restore preaccumulation and adjoint evaluation state. ---*/
+  AD::ResumePreaccumulation(pausePreacc);
+  if (!ReducerStrategy) AD::EndNoSharedReading();
+
+  if (ReducerStrategy) {
+    SumEdgeFluxes(geometry);
+    if (implicit) Jacobian.SetDiagonalAsColumnSum();
   }
 
 }
 
+void CRadP1Solver::SumEdgeFluxes(const CGeometry* geometry) {
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+
+    LinSysRes.SetBlock_Zero(iPoint);
+
+    for (auto iEdge : geometry->nodes->GetEdges(iPoint)) {
+      if (iPoint == geometry->edges->GetNode(iEdge,0))
+        LinSysRes.AddBlock(iPoint, EdgeFluxes.GetBlock(iEdge));
+      else
+        LinSysRes.SubtractBlock(iPoint, EdgeFluxes.GetBlock(iEdge));
+    }
+  }
+  END_SU2_OMP_FOR
+
+}
+
 void CRadP1Solver::Source_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                                   CConfig *config, unsigned short iMesh) {
 
-  CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM];
+  const bool implicit = (config->GetKind_TimeIntScheme_Radiation() == EULER_IMPLICIT);
+
+  CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM + omp_get_thread_num()*MAX_TERMS];
 
-  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+  const auto flowNodes = solver_container[FLOW_SOL]->GetNodes();
+
+  su2double residual[1] = {0.0}, jac_i[1] = {0.0};
+  su2double* Jac_i[1] = {jac_i};
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
 
     /*--- Conservative variables w/o reconstruction ---*/
 
-    numerics->SetPrimitive(solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(iPoint), nullptr);
+    numerics->SetPrimitive(flowNodes->GetPrimitive(iPoint), nullptr);
 
     /*--- Radiation variables w/o reconstruction ---*/
 
@@ -246,414 +319,295 @@ void CRadP1Solver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
 
     /*--- Compute the source term ---*/
 
-    numerics->ComputeResidual(Residual, Jacobian_i, config);
+    numerics->ComputeResidual(residual, Jac_i, config);
 
     /*--- Subtract residual and the Jacobian ---*/
 
-    LinSysRes.SubtractBlock(iPoint, Residual);
-    Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
+    LinSysRes.SubtractBlock(iPoint, residual);
+    if (implicit) Jacobian.SubtractBlock2Diag(iPoint, Jac_i);
 
   }
+  END_SU2_OMP_FOR
 
 }
 
-void CRadP1Solver::BC_Isothermal_Wall(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics, CNumerics *visc_numerics, CConfig *config,
-                                       unsigned short val_marker) {
-
-  unsigned short iVar, jVar;
-  unsigned long iVertex, iPoint;
+void CRadP1Solver::WeakRadiativeFlux(const CGeometry *geometry, const CConfig *config, unsigned short val_marker,
+                                     su2double Theta, const CVariable* flowNodes, su2double Twall) {
 
-  su2double Theta, Ib_w, Radiative_Energy;
-  su2double *Normal, Area, Wall_Emissivity;
-  su2double Radiative_Heat_Flux;
-  su2double Twall;
-
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
-
-  /*--- Identify the boundary by string name ---*/
-  string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
-
-  /*--- Get the specified wall emissivity from config ---*/
-  Wall_Emissivity = config->GetWall_Emissivity(Marker_Tag);
-
-  /*--- Compute the constant for the wall theta ---*/
-  Theta = Wall_Emissivity / (2.0*(2.0 - Wall_Emissivity));
-
-    /*--- Retrieve the specified wall temperature ---*/
-  Twall = config->GetIsothermal_Temperature(Marker_Tag)/config->GetTemperature_Ref();
+  const bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
 
   /*--- Loop over all of the vertices on this boundary marker ---*/
 
-  for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+  for (auto iVertex = 0ul; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-    /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
-
-    if (geometry->nodes->GetDomain(iPoint)) {
+    const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
 
-      /*--- Compute dual-grid area and boundary normal ---*/
-      Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
-
-      Area = GeometryToolbox::Norm(nDim, Normal);
+    /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
 
-      // Weak application of the boundary condition
+    if (!geometry->nodes->GetDomain(iPoint)) continue;
 
-      /*--- Initialize the viscous residuals to zero ---*/
-      for (iVar = 0; iVar < nVar; iVar++) {
-        Res_Visc[iVar] = 0.0;
-        if (implicit) {
-          for (jVar = 0; jVar < nVar; jVar++)
-            Jacobian_i[iVar][jVar] = 0.0;
-        }
-      }
+    /*--- Compute dual-grid area and boundary normal ---*/
 
-      /*--- Apply a weak boundary condition for the radiative transfer equation. ---*/
+    const auto* Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
+    const su2double Area = GeometryToolbox::Norm(nDim, Normal);
 
-      /*--- Compute the blackbody intensity at the wall. ---*/
-      Ib_w = 4.0*STEFAN_BOLTZMANN*pow(Twall,4.0);
+    /*--- Apply a weak boundary condition for the radiative transfer equation. ---*/
 
-      /*--- Compute the radiative heat flux. ---*/
-      Radiative_Energy = nodes->GetSolution(iPoint, 0);
-      Radiative_Heat_Flux = 1.0*Theta*(Ib_w - Radiative_Energy);
+    /*--- Compute the blackbody intensity at the wall, with the flow temperature if requested. ---*/
+    const su2double Temperature = flowNodes ? flowNodes->GetTemperature(iPoint) : Twall;
+    const su2double Ib_w = 4.0*STEFAN_BOLTZMANN*pow(Temperature,4.0);
 
-      /*--- Compute the Viscous contribution to the residual ---*/
-      Res_Visc[0] = Radiative_Heat_Flux*Area;
+    /*--- Compute the radiative heat flux. ---*/
+    const su2double Radiative_Energy = nodes->GetSolution(iPoint, 0);
+    const su2double Radiative_Heat_Flux = Theta*(Ib_w - Radiative_Energy);
 
-      /*--- Apply to the residual vector ---*/
-      LinSysRes.SubtractBlock(iPoint, Res_Visc);
+    /*--- Compute the Viscous contribution to the residual and apply it ---*/
+    LinSysRes(iPoint, 0) -= Radiative_Heat_Flux*Area;
 
-      /*--- Compute the Jacobian contribution. ---*/
-      if (implicit) {
-        Jacobian_i[0][0] = - Theta;
-        Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
-      }
-    }
+    /*--- Compute the Jacobian contribution. ---*/
+    if (implicit) Jacobian.AddVal2Diag(iPoint, Theta);
   }
+  END_SU2_OMP_FOR
 
 }
 
-void CRadP1Solver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics, CNumerics *visc_numerics, CConfig *config, unsigned short val_marker) {
-
-  unsigned short iVar, jVar;
-  unsigned long iVertex, iPoint;
-
-  su2double Theta, Ib_w, Radiative_Energy;
-  su2double *Normal, Area, Wall_Emissivity;
-  su2double Radiative_Heat_Flux;
-  su2double Twall;
-
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+void CRadP1Solver::BC_Isothermal_Wall(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics, CNumerics *visc_numerics, CConfig *config,
+                                       unsigned short val_marker) {
 
   /*--- Identify the boundary by string name ---*/
-  string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
+  const string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
 
   /*--- Get the specified wall emissivity from config ---*/
-  Wall_Emissivity = config->GetWall_Emissivity(Marker_Tag);
+  const su2double Wall_Emissivity = config->GetWall_Emissivity(Marker_Tag);
 
   /*--- Compute the constant for the wall theta ---*/
-  Theta = Wall_Emissivity / (2.0*(2.0 - Wall_Emissivity));
+  const su2double Theta = Wall_Emissivity / (2.0*(2.0 - Wall_Emissivity));
 
   /*--- Retrieve the specified wall temperature ---*/
-  Twall = GetTemperature_Inf();
-
-  /*--- Loop over all of the vertices on this boundary marker ---*/
-
-  for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
-
-    /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
-
-    if (geometry->nodes->GetDomain(iPoint)) {
-
-      /*--- Compute dual-grid area and boundary normal ---*/
-      Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
-
-      Area = GeometryToolbox::Norm(nDim, Normal);
+  const su2double Twall = config->GetIsothermal_Temperature(Marker_Tag)/config->GetTemperature_Ref();
 
-      // Weak application of the boundary condition
+  WeakRadiativeFlux(geometry, config, val_marker, Theta, nullptr, Twall);
 
-      /*--- Initialize the viscous residuals to zero ---*/
-      for (iVar = 0; iVar < nVar; iVar++) {
-        Res_Visc[iVar] = 0.0;
-        if (implicit) {
-          for (jVar = 0; jVar < nVar; jVar++)
-            Jacobian_i[iVar][jVar] = 0.0;
-        }
-      }
+}
 
-      /*--- Apply a weak boundary condition for the radiative transfer equation. ---*/
+void CRadP1Solver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics, CNumerics *visc_numerics, CConfig *config, unsigned short val_marker) {
 
-      /*--- Compute the blackbody intensity at the wall. ---*/
-      Ib_w = 4.0*STEFAN_BOLTZMANN*pow(Twall,4.0);
+  /*--- Identify the boundary by string name ---*/
+  const string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
 
-      /*--- Compute the radiative heat flux. ---*/
-      Radiative_Energy = nodes->GetSolution(iPoint, 0);
-      Radiative_Heat_Flux = 1.0*Theta*(Ib_w - Radiative_Energy);
+  /*--- Get the specified wall emissivity from config ---*/
+  const su2double Wall_Emissivity = config->GetWall_Emissivity(Marker_Tag);
 
-      /*--- Compute the Viscous contribution to the residual ---*/
-      Res_Visc[0] = Radiative_Heat_Flux*Area;
+  /*--- Compute the constant for the wall theta ---*/
+  const su2double Theta = Wall_Emissivity / (2.0*(2.0 - Wall_Emissivity));
 
-      /*--- Apply to the residual vector ---*/
-      LinSysRes.SubtractBlock(iPoint, Res_Visc);
-
-      /*--- Compute the Jacobian contribution. ---*/
-      if (implicit) {
-        Jacobian_i[0][0] = - Theta;
-        Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
-      }
-    }
-  }
+  /*--- Use the freestream temperature ---*/
+  WeakRadiativeFlux(geometry, config, val_marker, Theta, nullptr, GetTemperature_Inf());
 
 }
 
 void CRadP1Solver::BC_Marshak(CGeometry *geometry, CSolver **solver_container, CConfig *config,
                               unsigned short val_marker) {
 
-  unsigned short iVar, jVar;
-  unsigned long iVertex, iPoint;
-
-  su2double Theta, Ib_w, Temperature, Radiative_Energy;
-  su2double *Normal, Area, Wall_Emissivity;
-  su2double Radiative_Heat_Flux;
-
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
-
   /*--- Identify the boundary by string name ---*/
-  string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
+  const string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
 
   /*--- Get the specified wall emissivity from config ---*/
-  Wall_Emissivity = config->GetWall_Emissivity(Marker_Tag);
+  const su2double Wall_Emissivity = config->GetWall_Emissivity(Marker_Tag);
 
   /*--- Compute the constant for the wall theta ---*/
-  Theta = Wall_Emissivity / (2.0*(2.0 - Wall_Emissivity));
-
-  /*--- Loop over all of the vertices on this boundary marker ---*/
-
-  for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
-
-    /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
-
-    if (geometry->nodes->GetDomain(iPoint)) {
-
-      /*--- Compute dual-grid area and boundary normal ---*/
-      Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
-
-      Area = GeometryToolbox::Norm(nDim, Normal);
-
-      // Weak application of the boundary condition
-
-      /*--- Initialize the viscous residuals to zero ---*/
-      for (iVar = 0; iVar < nVar; iVar++) {
-        Res_Visc[iVar] = 0.0;
-        if (implicit) {
-          for (jVar = 0; jVar < nVar; jVar++)
-            Jacobian_i[iVar][jVar] = 0.0;
-        }
-      }
-
-      /*--- Apply a weak boundary condition for the radiative transfer equation. ---*/
-
-      /*--- Retrieve temperature from the flow solver ---*/
-      Temperature = solver_container[FLOW_SOL]->GetNodes()->GetTemperature(iPoint);
+  const su2double Theta = Wall_Emissivity / (2.0*(2.0 - Wall_Emissivity));
 
-      /*--- Compute the blackbody intensity at the wall. ---*/
-      Ib_w = 4.0*STEFAN_BOLTZMANN*pow(Temperature,4.0);
-
-      /*--- Compute the radiative heat flux. ---*/
-      Radiative_Energy = nodes->GetSolution(iPoint, 0);
-      Radiative_Heat_Flux = Theta*(Ib_w - Radiative_Energy);
-
-      /*--- Compute the Viscous contribution to the residual ---*/
-      Res_Visc[0] = Radiative_Heat_Flux*Area;
-
-      /*--- Apply to the residual vector ---*/
-      LinSysRes.SubtractBlock(iPoint, Res_Visc);
-
-      /*--- Compute the Jacobian contribution. ---*/
-      if (implicit) {
-        Jacobian_i[0][0] = - Theta;
-        Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
-      }
-
-    }
-  }
+  /*--- Retrieve temperature from the flow solver ---*/
+  WeakRadiativeFlux(geometry, config, val_marker, Theta, solver_container[FLOW_SOL]->GetNodes(), 0.0);
 
 }
 
 
 void CRadP1Solver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
-  unsigned short iVar;
-  unsigned long iPoint, total_index, IterLinSol = 0;
-  su2double Vol;
-  su2double Delta;
-
-  /*--- Set maximum residual to zero ---*/
+  /*--- Set shared residual variables to 0 and declare
+   *    local ones for current thread to work on. ---*/
 
   SetResToZero();
 
-  /*--- Build implicit system ---*/
-
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+  su2double resMax[1] = {0.0}, resRMS[1] = {0.0};
+  unsigned long idxMax[1] = {0};
 
-    /*--- Read the volume ---*/
+  /*--- Build implicit system ---*/
 
-    Vol = geometry->nodes->GetVolume(iPoint);
+  SU2_OMP_FOR_(schedule(static,omp_chunk_size) SU2_NOWAIT)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
 
     /*--- Modify matrix diagonal to assure diagonal dominance ---*/
 
-    if (nodes->GetDelta_Time(iPoint) != 0.0) {
-      Delta = Vol / nodes->GetDelta_Time(iPoint);
-      Jacobian.AddVal2Diag(iPoint, Delta);
+    const su2double dt = nodes->GetDelta_Time(iPoint);
+
+    if (dt != 0.0) {
+      Jacobian.AddVal2Diag(iPoint, geometry->nodes->GetVolume(iPoint) / dt);
     }
     else {
       Jacobian.SetVal2Diag(iPoint, 1.0);
-      for (iVar = 0; iVar < nVar; iVar++) {
-        total_index = iPoint*nVar + iVar;
-        LinSysRes[total_index] = 0.0;
-      }
+      LinSysRes.SetBlock_Zero(iPoint);
     }
 
     /*--- Right hand side of the system (-Residual) and initial guess (x = 0) ---*/
 
-    for (iVar = 0; iVar < nVar; iVar++) {
-      total_index = iPoint*nVar+iVar;
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      const auto total_index = iPoint*nVar+iVar;
       LinSysRes[total_index] = - (LinSysRes[total_index]);
       LinSysSol[total_index] = 0.0;
-      Residual_RMS[iVar] += LinSysRes[total_index]*LinSysRes[total_index];
-      AddRes_Max(iVar, fabs(LinSysRes[total_index]), geometry->nodes->GetGlobalIndex(iPoint), geometry->nodes->GetCoord(iPoint));
+      ResidualReductions_PerThread(iPoint, iVar, LinSysRes[total_index], resRMS, resMax, idxMax);
     }
   }
+  END_SU2_OMP_FOR
 
   /*--- Initialize residual and solution at the ghost points ---*/
 
-  for (iPoint = nPointDomain; iPoint < nPoint; iPoint++) {
-    for (iVar = 0; iVar < nVar; iVar++) {
-      total_index = iPoint*nVar + iVar;
-      LinSysRes[total_index] = 0.0;
-      LinSysSol[total_index] = 0.0;
-    }
+  SU2_OMP_FOR_(schedule(static,OMP_MIN_SIZE) SU2_NOWAIT)
+  for (auto iPoint = nPointDomain; iPoint < nPoint; iPoint++) {
+    LinSysRes.SetBlock_Zero(iPoint);
+    LinSysSol.SetBlock_Zero(iPoint);
   }
+  END_SU2_OMP_FOR
 
-  /*--- Solve or smooth the linear system ---*/
+  /*--- "Add" residuals from all threads to global residual variables
+   *    (this also computes the root mean square residual). ---*/
 
-  IterLinSol = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+  ResidualReductions_FromAllThreads(geometry, config, resRMS, resMax, idxMax);
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    for (iVar = 0; iVar < nVar; iVar++) {
-      nodes->AddSolution(iPoint, iVar, LinSysSol[iPoint*nVar+iVar]);
-    }
-  }
+  /*--- Solve or smooth the linear system ---*/
+
+  const auto IterLinSol = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
 
   /*--- The the number of iterations of the linear solver ---*/
 
-  SetIterLinSolver(IterLinSol);
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    SetIterLinSolver(IterLinSol);
+    SetResLinSolver(System.GetResidual());
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      nodes->AddSolution(iPoint, iVar, LinSysSol(iPoint,iVar));
+    }
+  }
+  END_SU2_OMP_FOR
 
   /*--- MPI solution ---*/
 
   InitiateComms(geometry, config, SOLUTION);
   CompleteComms(geometry, config, SOLUTION);
 
-  /*--- Compute the root mean square residual ---*/
-
-  SetResidual_RMS(geometry, config);
-
 }
 
 void CRadP1Solver::SetTime_Step(CGeometry *geometry, CSolver **solver_container, CConfig *config,
                                unsigned short iMesh, unsigned long Iteration) {
 
-  unsigned short iMarker;
-  unsigned long iEdge, iVertex, iPoint = 0, jPoint = 0;
-  su2double Area, Vol, Lambda;
-  su2double Global_Delta_Time = 1E6, Local_Delta_Time = 0.0, K_v = 0.25;
-  su2double CFL = config->GetCFL_Rad();
-  su2double GammaP1 = 1.0 / (3.0*(Absorption_Coeff + Scattering_Coeff));
-  const su2double* Normal;
+  const su2double K_v = 0.25;
+  const su2double CFL = config->GetCFL_Rad();
+  const su2double GammaP1 = 1.0 / (3.0*(Absorption_Coeff + Scattering_Coeff));
 
-  /*--- Compute spectral radius based on thermal conductivity ---*/
+  /*--- Init thread-shared variables to compute min/max values. ---*/
 
-  Min_Delta_Time = 1.E6; Max_Delta_Time = 0.0;
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    Min_Delta_Time = 1.E6; Max_Delta_Time = 0.0;
+  } END_SU2_OMP_SAFE_GLOBAL_ACCESS
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    nodes->SetMax_Lambda_Visc(iPoint, 0.0);
-  }
+  /*--- Compute spectral radius based on thermal conductivity, looping over the
+   *    neighbors of each point (i.e. the interior edges) to avoid races. ---*/
 
-  /*--- Loop interior edges ---*/
+  SU2_OMP_FOR_DYN(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
 
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-
-    iPoint = geometry->edges->GetNode(iEdge,0);
-    jPoint = geometry->edges->GetNode(iEdge,1);
-
-    /*--- Get the edge's normal vector to compute the edge's area ---*/
-    Normal = geometry->edges->GetNormal(iEdge);
-    Area = GeometryToolbox::Norm(nDim, Normal);
+    nodes->SetMax_Lambda_Visc(iPoint, 0.0);
 
-    /*--- Viscous contribution ---*/
+    for (auto iEdge : geometry->nodes->GetEdges(iPoint)) {
 
-    Lambda = GammaP1*Area*Area;
-    if (geometry->nodes->GetDomain(iPoint)) nodes->AddMax_Lambda_Visc(iPoint, Lambda);
-    if (geometry->nodes->GetDomain(jPoint)) nodes->AddMax_Lambda_Visc(jPoint, Lambda);
+      /*--- Get the edge's normal vector to compute the edge's area ---*/
+      const auto* Normal = geometry->edges->GetNormal(iEdge);
 
+      /*--- Viscous contribution ---*/
+      nodes->AddMax_Lambda_Visc(iPoint, GammaP1*GeometryToolbox::SquaredNorm(nDim, Normal));
+    }
   }
+  END_SU2_OMP_FOR
 
   /*--- Loop boundary edges ---*/
 
-  for (iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
-    for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+  for (unsigned short iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for (auto iVertex = 0ul; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
 
       /*--- Point identification, Normal vector and area ---*/
 
-      iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-      Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
-      Area = GeometryToolbox::Norm(nDim, Normal);
+      const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      const auto* Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
 
       /*--- Viscous contribution ---*/
 
-      Lambda = GammaP1*Area*Area;
-      if (geometry->nodes->GetDomain(iPoint)) nodes->AddMax_Lambda_Visc(iPoint, Lambda);
+      if (geometry->nodes->GetDomain(iPoint))
+        nodes->AddMax_Lambda_Visc(iPoint, GammaP1*GeometryToolbox::SquaredNorm(nDim, Normal));
 
     }
+    END_SU2_OMP_FOR
   }
 
   /*--- Each element uses their own speed, steady state simulation ---*/
+  {
+    /*--- Thread-local variables for min/max reduction. ---*/
+    su2double minDt = 1.E6, maxDt = 0.0;
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    SU2_OMP_FOR_(schedule(static,omp_chunk_size) SU2_NOWAIT)
+    for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
 
-    Vol = geometry->nodes->GetVolume(iPoint);
+      const su2double Vol = geometry->nodes->GetVolume(iPoint);
 
-    if (Vol != 0.0) {
+      if (Vol != 0.0) {
 
-      /*--- Time step setting method ---*/
+        /*--- Time step setting method ---*/
 
-       Local_Delta_Time = CFL*K_v*Vol*Vol/ nodes->GetMax_Lambda_Visc(iPoint);
+        su2double Local_Delta_Time = CFL*K_v*Vol*Vol/ nodes->GetMax_Lambda_Visc(iPoint);
 
-      /*--- Min-Max-Logic ---*/
+        /*--- Min-Max-Logic ---*/
 
-      Global_Delta_Time = min(Global_Delta_Time, Local_Delta_Time);
-      Min_Delta_Time = min(Min_Delta_Time, Local_Delta_Time);
-      Max_Delta_Time = max(Max_Delta_Time, Local_Delta_Time);
-      if (Local_Delta_Time > config->GetMax_DeltaTime())
-        Local_Delta_Time = config->GetMax_DeltaTime();
+        minDt = min(minDt, Local_Delta_Time);
+        maxDt = max(maxDt, Local_Delta_Time);
+        if (Local_Delta_Time > config->GetMax_DeltaTime())
+          Local_Delta_Time = config->GetMax_DeltaTime();
 
-      nodes->SetDelta_Time(iPoint, Local_Delta_Time);
+        nodes->SetDelta_Time(iPoint, Local_Delta_Time);
+      }
+      else {
+        nodes->SetDelta_Time(iPoint, 0.0);
+      }
     }
-    else {
-      nodes->SetDelta_Time(iPoint, 0.0);
+    END_SU2_OMP_FOR
+
+    /*--- Min/max over threads. ---*/
+    SU2_OMP_CRITICAL
+    {
+      Min_Delta_Time = min(Min_Delta_Time, minDt);
+      Max_Delta_Time = max(Max_Delta_Time, maxDt);
     }
+    END_SU2_OMP_CRITICAL
   }
 
   /*--- Compute the max and the min dt (in parallel) ---*/
-  if (config->GetComm_Level() == COMM_FULL) {
 
-    su2double sbuf_time;
-    sbuf_time = Min_Delta_Time;
-    SU2_MPI::Allreduce(&sbuf_time, &Min_Delta_Time, 1, MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    if (config->GetComm_Level() == COMM_FULL) {
 
-    sbuf_time = Max_Delta_Time;
-    SU2_MPI::Allreduce(&sbuf_time, &Max_Delta_Time, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
-  }
+      su2double sbuf_time;
+      sbuf_time = Min_Delta_Time;
+      SU2_MPI::Allreduce(&sbuf_time, &Min_Delta_Time, 1, MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
+
+      sbuf_time = Max_Delta_Time;
+      SU2_MPI::Allreduce(&sbuf_time, &Max_Delta_Time, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+    }
+  } END_SU2_OMP_SAFE_GLOBAL_ACCESS
 
 }
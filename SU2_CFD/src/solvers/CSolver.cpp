@@ -1408,6 +1408,8 @@ void CSolver::InitiateComms(CGeometry *geometry,
                             const CConfig *config,
                             unsigned short commType) {
 
+  SU2_PROFILE_SCOPE("Halo_Comms");
+
   /*--- Local variables ---*/
 
   unsigned short iVar, iDim;
@@ -1550,6 +1552,8 @@ void CSolver::CompleteComms(CGeometry *geometry,
                             const CConfig *config,
                             unsigned short commType) {
 
+  SU2_PROFILE_SCOPE("Halo_Comms");
+
   /*--- Local variables ---*/
 
   unsigned short iDim, iVar;
@@ -444,8 +444,7 @@ void SetProjection_FD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
 
   unsigned short iDV, nDV, iFFDBox, nDV_Value, iMarker, iDim;
   unsigned long iVertex, iPoint;
-  su2double delta_eps, my_Gradient, localGradient, *Normal, dS, *VarCoord, Sensitivity,
-  dalpha[3], deps[3], dalpha_deps;
+  su2double delta_eps, my_Gradient, localGradient, *Normal, dS, Sensitivity;
   bool *UpdatePoint, MoveSurface, Local_MoveSurface;
   CFreeFormDefBox **FFDBox;
 
@@ -470,6 +469,44 @@ void SetProjection_FD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
     }
   }
 
+  /*--- The surface sensitivity projected on the unit normal does not depend on the design
+   variable, compute it once for each (domain) surface point, the gradient of each design
+   variable is then the dot product of these values with the variation of the coordinates. ---*/
+
+  vector<unsigned short> dvMarker;
+  vector<unsigned long> dvVertex;
+  vector<su2double> sensNormal;
+
+  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++)
+    UpdatePoint[iPoint] = true;
+
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if (config->GetMarker_All_DV(iMarker) == YES) {
+      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+
+        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        if ((iPoint < geometry->GetnPointDomain()) && UpdatePoint[iPoint]) {
+
+          Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+          Sensitivity = geometry->vertex[iMarker][iVertex]->GetAuxVar();
+
+          dS = 0.0;
+          for (iDim = 0; iDim < geometry->GetnDim(); iDim++)
+            dS += Normal[iDim]*Normal[iDim];
+          dS = sqrt(dS);
+
+          dvMarker.push_back(iMarker);
+          dvVertex.push_back(iVertex);
+          for (iDim = 0; iDim < 3; iDim++)
+            sensNormal.push_back((iDim < geometry->GetnDim())? Sensitivity*Normal[iDim]/dS : su2double(0.0));
+
+          UpdatePoint[iPoint] = false;
+        }
+      }
+    }
+  }
+  const unsigned long nDVVertex = dvVertex.size();
+
   /*--- Continuous adjoint gradient computation ---*/
 
   if (rank == MASTER_NODE)
@@ -640,39 +677,32 @@ void SetProjection_FD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
 
         delta_eps = config->GetDV_Value(iDV);
 
-        for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++)
-          UpdatePoint[iPoint] = true;
+        /*--- Each thread accumulates its (static) range of vertices, the partial sums are added in the
+         *    order of the threads such that the gradient does not depend on the timing of the threads. ---*/
 
-        for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-          if (config->GetMarker_All_DV(iMarker) == YES) {
-            for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+        vector<su2double> thread_Gradient(omp_get_max_threads(), 0.0);
 
-              iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-              if ((iPoint < geometry->GetnPointDomain()) && UpdatePoint[iPoint]) {
+        SU2_OMP_PARALLEL
+        {
+          su2double partial = 0.0;
 
-                Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
-                VarCoord = geometry->vertex[iMarker][iVertex]->GetVarCoord();
-                Sensitivity = geometry->vertex[iMarker][iVertex]->GetAuxVar();
+          SU2_OMP_FOR_STAT(1024)
+          for (auto iDVVertex = 0ul; iDVVertex < nDVVertex; iDVVertex++) {
+            const su2double* varCoord = geometry->vertex[dvMarker[iDVVertex]][dvVertex[iDVVertex]]->GetVarCoord();
 
-                dS = 0.0;
-                for (iDim = 0; iDim < geometry->GetnDim(); iDim++) {
-                  dS += Normal[iDim]*Normal[iDim];
-                  deps[iDim] = VarCoord[iDim] / delta_eps;
-                }
-                dS = sqrt(dS);
+            su2double dalpha_deps = 0.0;
+            for (unsigned short jDim = 0; jDim < geometry->GetnDim(); jDim++)
+              dalpha_deps -= sensNormal[3*iDVVertex+jDim] * varCoord[jDim] / delta_eps;
 
-                dalpha_deps = 0.0;
-                for (iDim = 0; iDim < geometry->GetnDim(); iDim++) {
-                  dalpha[iDim] = Normal[iDim] / dS;
-                  dalpha_deps -= dalpha[iDim]*deps[iDim];
-                }
-
-                my_Gradient += Sensitivity*dalpha_deps;
-                UpdatePoint[iPoint] = false;
-              }
-            }
+            partial += dalpha_deps;
           }
+          END_SU2_OMP_FOR
+
+          thread_Gradient[omp_get_thread_num()] = partial;
         }
+        END_SU2_OMP_PARALLEL
+
+        for (const auto& partial : thread_Gradient) my_Gradient += partial;
       }
 
       SU2_MPI::Allreduce(&my_Gradient, &localGradient, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
@@ -0,0 +1,89 @@
+#!/usr/bin/env python
+
+## \file history_to_csv.py
+#  \brief Convert a binary history file (HISTORY_FORMAT= BINARY) to CSV.
+#  \version 7.5.1 "Blackbird"
+#
+# SU2 Project Website: https://su2code.github.io
+#
+# The SU2 Project is maintained by the SU2 Foundation
+# (http://su2foundation.org)
+#
+# Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+
+import struct
+import sys
+from optparse import OptionParser
+
+def read_binary_history(filename):
+  """Returns the column names and the lines of a binary history file."""
+  with open(filename, 'rb') as f:
+    data = f.read()
+
+  if data[0:8] != b'SU2HIST1':
+    raise RuntimeError(filename + ' is not a binary SU2 history file.')
+
+  pos = 8
+  nColumns, = struct.unpack_from('=i', data, pos)
+  pos += 4
+  names = []
+  for i in range(nColumns):
+    length, = struct.unpack_from('=i', data, pos)
+    pos += 4
+    names.append(data[pos:pos+length].decode())
+    pos += length
+
+  # Blocks of lines stored by column, a truncated last block is ignored.
+  lines = []
+  while pos + 4 <= len(data):
+    nLines, = struct.unpack_from('=i', data, pos)
+    pos += 4
+    if pos + 8*nLines*nColumns > len(data): break
+    values = struct.unpack_from('=%dd' % (nLines*nColumns), data, pos)
+    pos += 8*nLines*nColumns
+    for iLine in range(nLines):
+      lines.append([values[iCol*nLines + iLine] for iCol in range(nColumns)])
+
+  return names, lines
+
+def main():
+  parser = OptionParser(usage = "%prog [options] history.bin")
+  parser.add_option("-o", "--output", dest="output", default="",
+                    help="CSV file, the input name with extension .csv by default", metavar="FILE")
+  parser.add_option("-p", "--precision", dest="precision", default="10",
+                    help="significant digits of the values (as OUTPUT_PRECISION)", metavar="DIGITS")
+  (options, args) = parser.parse_args()
+
+  if len(args) != 1:
+    parser.error("One binary history file is required.")
+
+  output = options.output
+  if not output:
+    output = args[0][:-4] if args[0].endswith('.bin') else args[0]
+    output += '.csv'
+
+  names, lines = read_binary_history(args[0])
+  fmt = '%.' + str(int(options.precision)) + 'g'
+
+  with open(output, 'w') as f:
+    f.write(','.join('"' + name + '"' for name in names) + '\n')
+    for line in lines:
+      f.write(','.join(fmt % value for value in line) + '\n')
+
+  print('Wrote %d lines of %d columns to %s.' % (len(lines), len(names), output))
+
+if __name__ == '__main__':
+  main()
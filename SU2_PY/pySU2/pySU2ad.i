@@ -53,12 +53,25 @@ threads="1"
 %include "std_vector.i"
 %include "std_map.i"
 %include "typemaps.i"
-//%include "numpy.i"
+%include "numpy.i"
 #ifdef HAVE_MPI                    //Need mpi4py only for a parallel build of the wrapper.
   %include "mpi4py/mpi4py.i"
   %mpi4py_typemap(Comm, MPI_Comm)
 #endif
 
+%init %{
+  import_array();
+%}
+
+// Bulk access to marker and volume data with NumPy arrays: getters fill arrays allocated
+// by the caller (in place), setters read them, views share the memory of the solver.
+%apply (unsigned long* INPLACE_ARRAY1, int DIM1) {(unsigned long* indices, int nRows)};
+%apply (double* INPLACE_ARRAY1, int DIM1) {(passivedouble* values, int nRows)};
+%apply (double* INPLACE_ARRAY2, int DIM1, int DIM2) {(passivedouble* values, int nRows, int nCols)};
+%apply (double* IN_ARRAY1, int DIM1) {(passivedouble* newValues, int nRows)};
+%apply (double* IN_ARRAY2, int DIM1, int DIM2) {(passivedouble* newValues, int nRows, int nCols)};
+%apply (double** ARGOUTVIEW_ARRAY2, int* DIM1, int* DIM2) {(passivedouble** view, int* nRows, int* nCols)};
+
 namespace std {
    %template() vector<int>;
    %template() vector<double>;
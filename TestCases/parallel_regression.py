@@ -1327,6 +1327,17 @@ def main():
     pywrapper_unsteadyCHT.new_output    = True
     test_list.append(pywrapper_unsteadyCHT)
 
+    # Bulk NumPy access to the marker and volume data (same boundary conditions as pywrapper_unsteadyCHT)
+    pywrapper_bulkNumpy               = TestCase('pywrapper_bulkNumpy')
+    pywrapper_bulkNumpy.cfg_dir       = "py_wrapper/flatPlate_unsteady_CHT"
+    pywrapper_bulkNumpy.cfg_file      = "unsteady_CHT_FlatPlate_Conf.cfg"
+    pywrapper_bulkNumpy.test_iter     = 5
+    pywrapper_bulkNumpy.test_vals     = [-1.614167, 2.245725, -0.001241, 0.175713]
+    pywrapper_bulkNumpy.command       = TestCase.Command("mpirun -np 2", "python", "launch_bulk_numpy_CHT_FlatPlate.py --parallel -f")
+    pywrapper_bulkNumpy.unsteady      = True
+    pywrapper_bulkNumpy.new_output    = True
+    test_list.append(pywrapper_bulkNumpy)
+
     # Rigid motion
     pywrapper_rigidMotion               = TestCase('pywrapper_rigidMotion')
     pywrapper_rigidMotion.cfg_dir       = "py_wrapper/flatPlate_rigidMotion"
@@ -0,0 +1,221 @@
+#!/usr/bin/env python
+
+## \file launch_bulk_numpy_CHT_FlatPlate.py
+#  \brief Python script to test the bulk NumPy access to marker and volume data of the Python wrapper,
+#         on the unsteady CHT flat plate (same boundary conditions as launch_unsteady_CHT_FlatPlate.py).
+#  \version 7.5.1 "Blackbird"
+#
+# SU2 Project Website: https://su2code.github.io
+#
+# The SU2 Project is maintained by the SU2 Foundation
+# (http://su2foundation.org)
+#
+# Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+
+# ----------------------------------------------------------------------
+#  Imports
+# ----------------------------------------------------------------------
+
+import sys
+from optparse import OptionParser	# use a parser for configuration
+import pysu2			            # imports the SU2 wrapped module
+import numpy
+from math import *
+
+FLOW_SOL = 0  # Position of the flow solver in the solver container (option_structure.hpp)
+
+# -------------------------------------------------------------------
+#  Checks
+# -------------------------------------------------------------------
+
+def check(condition, message, comm):
+  """Stop all ranks if a check fails."""
+  if condition: return
+  print('FAILED: ' + message)
+  sys.stdout.flush()
+  if comm != 0:
+    comm.Abort(1)
+  sys.exit(1)
+
+def check_marker(SU2Driver, markerID, nDim, comm):
+  """The marker getters give the same values as the functions for one vertex."""
+  nVertex = SU2Driver.GetNumberVertices(markerID)
+
+  indices = numpy.zeros(nVertex, dtype=numpy.uint64)
+  SU2Driver.GetMarkerGlobalIndices(markerID, indices)
+  normals = numpy.zeros((nVertex, nDim))
+  SU2Driver.GetMarkerNormals(markerID, normals)
+  unitNormals = numpy.zeros((nVertex, nDim))
+  SU2Driver.GetMarkerNormals(markerID, unitNormals, True)
+  temperatures = numpy.zeros(nVertex)
+  SU2Driver.GetMarkerTemperatures(markerID, temperatures)
+  heatFluxes = numpy.zeros((nVertex, nDim))
+  SU2Driver.GetMarkerHeatFluxes(markerID, heatFluxes)
+  loads = numpy.zeros((nVertex, nDim))
+  SU2Driver.GetMarkerFlowLoads(markerID, loads)
+
+  for iVertex in range(nVertex):
+    check(indices[iVertex] == SU2Driver.GetVertexGlobalIndex(markerID, iVertex), 'GetMarkerGlobalIndices', comm)
+    check(list(normals[iVertex]) == list(SU2Driver.GetVertexNormal(markerID, iVertex))[0:nDim], 'GetMarkerNormals', comm)
+    check(list(unitNormals[iVertex]) == list(SU2Driver.GetVertexUnitNormal(markerID, iVertex))[0:nDim],
+          'GetMarkerNormals (unit)', comm)
+    check(temperatures[iVertex] == SU2Driver.GetVertexTemperature(markerID, iVertex), 'GetMarkerTemperatures', comm)
+    check(list(heatFluxes[iVertex]) == list(SU2Driver.GetVertexHeatFluxes(markerID, iVertex))[0:nDim],
+          'GetMarkerHeatFluxes', comm)
+    check(list(loads[iVertex]) == list(SU2Driver.GetFlowLoad(markerID, iVertex))[0:nDim], 'GetMarkerFlowLoads', comm)
+
+def check_views(SU2Driver, coordView, solView, comm):
+  """Views taken earlier still show the current data of the driver."""
+  coords = numpy.zeros(coordView.shape)
+  SU2Driver.GetCoordinates(coords)
+  check(numpy.array_equal(coords, coordView), 'GetCoordinatesView differs from GetCoordinates', comm)
+
+  solution = numpy.zeros(solView.shape)
+  SU2Driver.GetSolution(FLOW_SOL, solution)
+  check(numpy.array_equal(solution, solView), 'GetSolutionView differs from GetSolution', comm)
+
+# -------------------------------------------------------------------
+#  Main
+# -------------------------------------------------------------------
+
+def main():
+
+  # Command line options
+  parser=OptionParser()
+  parser.add_option("-f", "--file", dest="filename", help="Read config from FILE", metavar="FILE")
+  parser.add_option("--parallel", action="store_true",
+                    help="Specify if we need to initialize MPI", dest="with_MPI", default=False)
+
+  (options, args) = parser.parse_args()
+  options.nDim = int(2)
+  options.nZone = int(1)
+
+  # Import mpi4py for parallel run
+  if options.with_MPI == True:
+    from mpi4py import MPI
+    comm = MPI.COMM_WORLD
+    rank = comm.Get_rank()
+  else:
+    comm = 0
+    rank = 0
+
+  # Initialize the corresponding driver of SU2, this includes solver preprocessing
+  try:
+      SU2Driver = pysu2.CSinglezoneDriver(options.filename, options.nZone, comm);
+  except TypeError as exception:
+    print('A TypeError occured in pysu2.CDriver : ',exception)
+    if options.with_MPI == True:
+      print('ERROR : You are trying to initialize MPI with a serial build of the wrapper. Please, remove the --parallel option that is incompatible with a serial build.')
+    else:
+      print('ERROR : You are trying to launch a computation without initializing MPI but the wrapper has been built in parallel. Please add the --parallel option in order to initialize MPI for the wrapper.')
+    return
+
+  CHTMarkerID = None
+  CHTMarker = 'plate'       # Specified by the user
+
+  # Get all the tags with the CHT option
+  CHTMarkerList =  SU2Driver.GetAllCHTMarkersTag()
+
+  # Get all the markers defined on this rank and their associated indices.
+  allMarkerIDs = SU2Driver.GetAllBoundaryMarkers()
+
+  #Check if the specified marker has a CHT option and if it exists on this rank.
+  if CHTMarker in CHTMarkerList and CHTMarker in allMarkerIDs.keys():
+    CHTMarkerID = allMarkerIDs[CHTMarker]
+
+  # Number of vertices on the specified marker (per rank, physical + halo)
+  nVertex_CHTMarker = 0
+  if CHTMarkerID != None:
+    nVertex_CHTMarker = SU2Driver.GetNumberVertices(CHTMarkerID)
+
+  # Views of the coordinates and of the flow solution, they share the memory of the driver
+  coordView = SU2Driver.GetCoordinatesView()
+  solView = SU2Driver.GetSolutionView(FLOW_SOL)
+  nPoint = coordView.shape[0]
+  check(coordView.shape == (nPoint, options.nDim), 'shape of GetCoordinatesView', comm)
+  check(solView.shape[0] == nPoint, 'shape of GetSolutionView', comm)
+  check(not solView.flags['OWNDATA'], 'GetSolutionView returned a copy', comm)
+  check_views(SU2Driver, coordView, solView, comm)
+
+  # SetSolution and writes through the view are seen by the solver, restore the solution afterwards
+  solution = numpy.zeros(solView.shape)
+  SU2Driver.GetSolution(FLOW_SOL, solution)
+
+  modified = solution.copy()
+  modified[:, 0] *= 1.5
+  SU2Driver.SetSolution(FLOW_SOL, modified)
+  check(numpy.array_equal(solView, modified), 'SetSolution is not seen by the view', comm)
+
+  solView[:, 0] = solution[:, 0]
+  check_views(SU2Driver, coordView, solView, comm)
+  SU2Driver.SetSolution(FLOW_SOL, solution)
+  check_views(SU2Driver, coordView, solView, comm)
+
+  # Retrieve some control parameters from the driver
+  deltaT = SU2Driver.GetUnsteady_TimeStep()
+  TimeIter = SU2Driver.GetTime_Iter()
+  nTimeIter = SU2Driver.GetnTimeIter()
+  time = TimeIter*deltaT
+
+  # Time loop is defined in Python so that we have acces to SU2 functionalities at each time step
+  if rank == 0:
+    print("\n------------------------------ Begin Solver -----------------------------\n")
+  sys.stdout.flush()
+  if options.with_MPI == True:
+    comm.Barrier()
+
+  while (TimeIter < nTimeIter):
+    # Time iteration preprocessing
+    SU2Driver.Preprocess(TimeIter)
+    # Define the homogeneous unsteady wall temperature on the structure (user defined)
+    WallTemp = 293.0 + 57.0*sin(2*pi*time)
+    # Set this temperature to all the vertices on the specified CHT marker (in one call)
+    if CHTMarkerID != None:
+      SU2Driver.SetMarkerTemperatures(CHTMarkerID, numpy.full(nVertex_CHTMarker, WallTemp))
+    # Tell the SU2 drive to update the boundary conditions
+    SU2Driver.BoundaryConditionsUpdate()
+    # Run one time iteration (e.g. dual-time)
+    SU2Driver.Run()
+    # Postprocess the solver and exit cleanly
+    SU2Driver.Postprocess()
+    # Update the solver for the next time iteration
+    SU2Driver.Update()
+    # The views taken before the time loop follow the solution
+    check_views(SU2Driver, coordView, solView, comm)
+    if CHTMarkerID != None:
+      check_marker(SU2Driver, CHTMarkerID, options.nDim, comm)
+    # Monitor the solver and output solution to file if required
+    stopCalc = SU2Driver.Monitor(TimeIter)
+    SU2Driver.Output(TimeIter)
+    if (stopCalc == True):
+      break
+    # Update control parameters
+    TimeIter += 1
+    time += deltaT
+
+  # The views must not be used once the driver is deleted
+  del coordView, solView
+
+  if SU2Driver != None:
+    del SU2Driver
+
+# -------------------------------------------------------------------
+#  Run Main Program
+# -------------------------------------------------------------------
+
+# this is only accessed if running from command prompt
+if __name__ == '__main__':
+    main()
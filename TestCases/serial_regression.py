@@ -1636,6 +1636,20 @@ def main():
     test_list.append(pywrapper_unsteadyCHT)
     pass_list.append(pywrapper_unsteadyCHT.run_test())
 
+    # Bulk NumPy access to the marker and volume data (same boundary conditions as pywrapper_unsteadyCHT)
+    pywrapper_bulkNumpy               = TestCase('pywrapper_bulkNumpy')
+    pywrapper_bulkNumpy.cfg_dir       = "py_wrapper/flatPlate_unsteady_CHT"
+    pywrapper_bulkNumpy.cfg_file      = "unsteady_CHT_FlatPlate_Conf.cfg"
+    pywrapper_bulkNumpy.test_iter     = 5
+    pywrapper_bulkNumpy.test_vals     = [-1.614167, 2.245716, 0.000766, 0.175719]
+    pywrapper_bulkNumpy.command       =  TestCase.Command(exec = "python", param = "launch_bulk_numpy_CHT_FlatPlate.py -f")
+    pywrapper_bulkNumpy.timeout       = 1600
+    pywrapper_bulkNumpy.new_output    = True
+    pywrapper_bulkNumpy.tol           = 0.00001
+    pywrapper_bulkNumpy.unsteady      = True
+    test_list.append(pywrapper_bulkNumpy)
+    pass_list.append(pywrapper_bulkNumpy.run_test())
+
     # Rigid motion
     pywrapper_rigidMotion               = TestCase('pywrapper_rigidMotion')
     pywrapper_rigidMotion.cfg_dir       = "py_wrapper/flatPlate_rigidMotion"
@@ -0,0 +1,108 @@
+/*!
+ * \file CFEMStandardElement_tests.cpp
+ * \brief Unit tests for the sum factorization kernels of the FEM standard elements.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cmath>
+#include <vector>
+#include "../../../Common/include/fem/fem_standard_element.hpp"
+
+namespace {
+
+/*!
+ * \brief Dense row major product C = A*B, with A (M x K) and B (K x N).
+ */
+std::vector<su2double> matMul(unsigned long M, unsigned long N, unsigned long K,
+                              const su2double* A, const std::vector<su2double>& B) {
+  std::vector<su2double> C(M*N, 0.0);
+  for (unsigned long i = 0; i < M; ++i)
+    for (unsigned long k = 0; k < K; ++k)
+      for (unsigned long j = 0; j < N; ++j) C[i*N+j] += A[i*K+k] * B[k*N+j];
+  return C;
+}
+
+/*!
+ * \brief Compare the sum factorization kernels with the dense matrices of the standard element.
+ */
+void checkTensorProduct(unsigned short VTK_Type, unsigned short nDim, unsigned short nPoly, unsigned short orderExact) {
+  CFEMStandardElement elem(VTK_Type, nPoly, true, nullptr, orderExact);
+  REQUIRE(elem.TensorProductBasis());
+
+  const unsigned short NPad = 8;
+  const unsigned short nDOFs = elem.GetNDOFs();
+  const unsigned short nInt = elem.GetNIntegration();
+
+  std::vector<su2double> work(elem.SizeWorkTensorProduct(NPad));
+
+  /*--- Solution and gradients in the integration points. ---*/
+  std::vector<su2double> solDOFs(nDOFs*NPad);
+  for (size_t i = 0; i < solDOFs.size(); ++i) solDOFs[i] = sin(0.37*i + 0.1);
+
+  const auto ref = matMul(nInt*(nDim+1), NPad, nDOFs, elem.GetMatBasisFunctionsIntegration(), solDOFs);
+
+  std::vector<su2double> solAndGradInt(ref.size());
+  elem.SolAndGradIntTensorProduct(NPad, true, solDOFs.data(), solAndGradInt.data(), work.data());
+  for (size_t i = 0; i < ref.size(); ++i) CHECK(solAndGradInt[i] == Approx(ref[i]).margin(1e-12));
+
+  std::vector<su2double> solInt(nInt*NPad);
+  elem.SolAndGradIntTensorProduct(NPad, false, solDOFs.data(), solInt.data(), work.data());
+  for (size_t i = 0; i < solInt.size(); ++i) CHECK(solInt[i] == Approx(ref[i]).margin(1e-12));
+
+  /*--- Volume residual, with and without source terms. ---*/
+  std::vector<su2double> fluxes(nInt*nDim*NPad), sources(nInt*NPad);
+  for (size_t i = 0; i < fluxes.size(); ++i) fluxes[i] = cos(0.23*i + 0.4);
+  for (size_t i = 0; i < sources.size(); ++i) sources[i] = sin(0.11*i - 0.3);
+
+  auto resRef = matMul(nDOFs, NPad, nInt*nDim, elem.GetDerMatBasisFunctionsIntTrans(), fluxes);
+
+  std::vector<su2double> res(nDOFs*NPad);
+  elem.ResidualTensorProduct(NPad, fluxes.data(), nullptr, res.data(), work.data());
+  for (size_t i = 0; i < res.size(); ++i) CHECK(res[i] == Approx(resRef[i]).margin(1e-12));
+
+  const auto resSource = matMul(nDOFs, NPad, nInt, elem.GetBasisFunctionsIntegrationTrans(), sources);
+  for (size_t i = 0; i < resRef.size(); ++i) resRef[i] += resSource[i];
+
+  elem.ResidualTensorProduct(NPad, fluxes.data(), sources.data(), res.data(), work.data());
+  for (size_t i = 0; i < res.size(); ++i) CHECK(res[i] == Approx(resRef[i]).margin(1e-12));
+}
+
+}  // namespace
+
+TEST_CASE("Sum factorization of quadrilaterals", "[FEM]") {
+  checkTensorProduct(QUADRILATERAL, 2, 1, 2);
+  checkTensorProduct(QUADRILATERAL, 2, 3, 6);
+  checkTensorProduct(QUADRILATERAL, 2, 4, 4);
+}
+
+TEST_CASE("Sum factorization of hexahedra", "[FEM]") {
+  checkTensorProduct(HEXAHEDRON, 3, 0, 1);
+  checkTensorProduct(HEXAHEDRON, 3, 2, 4);
+  checkTensorProduct(HEXAHEDRON, 3, 3, 9);
+}
+
+TEST_CASE("Non tensor product elements", "[FEM]") {
+  CFEMStandardElement tet(TETRAHEDRON, 2, true, nullptr, 4);
+  CHECK_FALSE(tet.TensorProductBasis());
+}
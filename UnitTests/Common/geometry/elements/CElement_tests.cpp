@@ -0,0 +1,64 @@
+/*!
+ * \file CElement_tests.cpp
+ * \brief Unit tests for the finite element classes.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <vector>
+#include "../../../../Common/include/geometry/elements/CElement.hpp"
+
+TEST_CASE("Stored reference gradients", "[Elements]") {
+
+  /*--- A distorted hexahedron. ---*/
+  const su2double coord[8][3] = {{0.0, 0.0, 0.0}, {1.1, 0.1, 0.0}, {1.0, 0.9, 0.1}, {0.1, 1.2, 0.0},
+                                 {0.0, 0.1, 1.0}, {1.2, 0.0, 0.9}, {1.0, 1.0, 1.1}, {0.0, 1.1, 1.0}};
+  CHEXA8 elem, other;
+
+  for (unsigned short iNode = 0; iNode < 8; ++iNode) {
+    for (unsigned short iDim = 0; iDim < 3; ++iDim) {
+      elem.SetRef_Coord(iNode, iDim, coord[iNode][iDim]);
+      other.SetRef_Coord(iNode, iDim, 2.0 * coord[7-iNode][iDim]);
+    }
+  }
+  elem.ComputeGrad_Linear();
+
+  std::vector<su2double> grads(elem.GetnRefGradients());
+  elem.GetRefGradients(grads.data());
+
+  /*--- The stored gradients take precedence over the coordinates while they are set. ---*/
+  other.SetRefGradients(grads.data());
+  other.ComputeGrad_Linear();
+  other.SetRefGradients(nullptr);
+
+  for (unsigned short iGauss = 0; iGauss < elem.GetnGaussPoints(); ++iGauss) {
+    CHECK(other.GetJ_X(iGauss) == elem.GetJ_X(iGauss));
+    for (unsigned short iNode = 0; iNode < 8; ++iNode)
+      for (unsigned short iDim = 0; iDim < 3; ++iDim)
+        CHECK(other.GetGradNi_X(iNode, iGauss, iDim) == elem.GetGradNi_X(iNode, iGauss, iDim));
+  }
+
+  /*--- Once unset, the gradients are computed from the coordinates again. ---*/
+  other.ComputeGrad_Linear();
+  CHECK(other.GetJ_X(0) != Approx(elem.GetJ_X(0)));
+}
@@ -0,0 +1,169 @@
+/*!
+ * \file CFreeFormDefBox_tests.cpp
+ * \brief Unit tests for the inversion of the parametric coordinates of FFD boxes.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <vector>
+#include "../../../Common/include/CConfig.hpp"
+#include "../../../Common/include/grid_movement/CFreeFormDefBox.hpp"
+#include "../../../Common/include/grid_movement/CSurfaceMovement.hpp"
+
+namespace {
+
+/*--- Greville abscissae of the open uniform knot vector of CBSplineBlending, the B-spline
+ *    map reproduces linear functions when the control points are placed at these values. ---*/
+std::vector<su2double> Greville(unsigned short order, unsigned short nControl) {
+  std::vector<su2double> knots(order + nControl, 1.0);
+  for (unsigned short i = 0; i < order; i++) knots[i] = 0.0;
+  for (unsigned short i = 0; i + order < nControl; i++) knots[order + i] = su2double(i + 1) / (nControl - order + 1);
+
+  std::vector<su2double> xi(nControl, 0.0);
+  for (unsigned short i = 0; i < nControl; i++) {
+    for (unsigned short j = 1; j < order; j++) xi[i] += knots[i + j];
+    xi[i] /= order - 1;
+  }
+  return xi;
+}
+
+}  // namespace
+
+TEST_CASE("B-spline FFD inversion on the upper faces", "[FFD]") {
+
+  std::stringstream config_options;
+  config_options << "SOLVER= EULER" << std::endl;
+  config_options << "FFD_BLENDING= BSPLINE_UNIFORM" << std::endl;
+  config_options << "FFD_TOLERANCE= 1E-6" << std::endl;
+  config_options << "FFD_ITERATIONS= 500" << std::endl;
+
+  CConfig config(config_options, SU2_COMPONENT::SU2_DEF, false);
+
+  unsigned short degree[3] = {5, 4, 3}, order[3] = {3, 3, 4};
+  CFreeFormDefBox box(degree, order, BSPLINE_UNIFORM);
+  box.SetnControlPoints();
+
+  /*--- Sheared and curved box, the control points are x = A u + b + q(u) at the Greville abscissae.
+   *    The upper corner is placed near the origin, where samples taken at t = 1 (all basis vanish)
+   *    would be mapped to. ---*/
+  const su2double A[3][3] = {{2.0, 0.3, 0.1}, {0.2, 1.5, -0.2}, {0.0, 0.25, 0.8}};
+  const su2double b[3] = {-2.35, -1.45, -1.0};
+  auto map = [&](const su2double* uvw, su2double* xyz) {
+    for (int iDim = 0; iDim < 3; iDim++)
+      xyz[iDim] = b[iDim] + A[iDim][0] * uvw[0] + A[iDim][1] * uvw[1] + A[iDim][2] * uvw[2];
+    xyz[0] += 0.15 * uvw[1] * uvw[1];
+    xyz[1] -= 0.1 * uvw[2] * uvw[0];
+    xyz[2] += 0.2 * uvw[0] * uvw[0];
+  };
+
+  const auto xi = Greville(order[0], box.GetlOrder());
+  const auto eta = Greville(order[1], box.GetmOrder());
+  const auto zeta = Greville(order[2], box.GetnOrder());
+
+  for (unsigned short i = 0; i < box.GetlOrder(); i++)
+    for (unsigned short j = 0; j < box.GetmOrder(); j++)
+      for (unsigned short k = 0; k < box.GetnOrder(); k++) {
+        const su2double uvw[3] = {xi[i], eta[j], zeta[k]};
+        su2double xyz[3];
+        map(uvw, xyz);
+        box.SetCoordControlPoints(xyz, i, j, k);
+      }
+
+  /*--- Points on the three upper faces (and on their edges and corner), plus interior points.
+   *    The coordinates on the faces are the limit of the B-spline map as the parameter tends to 1. ---*/
+  std::vector<su2double> uvw, xyz;
+  for (int face = 0; face < 4; face++) {
+    for (int p = 0; p < 8; p++) {
+      su2double u[3] = {0.02 + 0.96 * ((p * 7) % 25) / 24.0, 0.02 + 0.96 * ((p * 11) % 25) / 24.0,
+                        0.02 + 0.96 * ((p * 3) % 25) / 24.0};
+      if (face < 3) u[face] = 1.0;
+      if (p == 0) u[0] = u[1] = u[2] = 1.0;
+      su2double x[3], ulim[3];
+      for (int iDim = 0; iDim < 3; iDim++) ulim[iDim] = std::min(u[iDim], su2double(1.0 - 1e-12));
+      box.EvalCartesianCoord(ulim, x);
+      uvw.insert(uvw.end(), u, u + 3);
+      xyz.insert(xyz.end(), x, x + 3);
+    }
+  }
+  const unsigned long nPoint = uvw.size() / 3;
+  std::vector<unsigned long> pointID(nPoint);
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) pointID[iPoint] = iPoint;
+
+  std::vector<su2double> result(3 * nPoint);
+  box.GetParametricCoord_Parallel(nPoint, xyz.data(), pointID.data(), &config, result.data());
+
+  for (auto i = 0ul; i < 3 * nPoint; i++) {
+    CHECK(SU2_TYPE::GetValue(result[i]) == Approx(SU2_TYPE::GetValue(uvw[i])).margin(1e-6));
+  }
+}
+
+TEST_CASE("FFD inversion cache key", "[FFD]") {
+
+  auto makeConfig = [](const std::string& splineOrder, const std::string& tolerance) {
+    std::stringstream config_options;
+    config_options << "SOLVER= EULER" << std::endl;
+    config_options << "FFD_BLENDING= BSPLINE_UNIFORM" << std::endl;
+    config_options << "FFD_BSPLINE_ORDER= " << splineOrder << std::endl;
+    config_options << "FFD_TOLERANCE= " << tolerance << std::endl;
+    return std::unique_ptr<CConfig>(new CConfig(config_options, SU2_COMPONENT::SU2_DEF, false));
+  };
+
+  unsigned short degree[3] = {2, 2, 2}, order[3] = {2, 2, 2};
+  CFreeFormDefBox box(degree, order, BSPLINE_UNIFORM);
+  box.SetnControlPoints();
+  for (unsigned short i = 0; i < box.GetlOrder(); i++)
+    for (unsigned short j = 0; j < box.GetmOrder(); j++)
+      for (unsigned short k = 0; k < box.GetnOrder(); k++) {
+        su2double xyz[3] = {0.5 * i, 0.5 * j, 0.5 * k};
+        box.SetCoordControlPoints(xyz, i, j, k);
+      }
+
+  const std::vector<unsigned short> markerIdx = {0, 0};
+  const std::vector<unsigned long> vertexIdx = {0, 1}, pointIdx = {3, 7};
+  const std::vector<su2double> cartCoord = {0.1, 0.2, 0.3, 0.4, 0.5, 0.6};
+
+  auto key = [&](const CConfig& config) {
+    return CSurfaceMovement::FFDInversionKey(&config, &box, markerIdx, vertexIdx, pointIdx, cartCoord);
+  };
+
+  const auto reference = makeConfig("2, 2, 2", "1E-6");
+  CHECK(key(*reference) == key(*makeConfig("2, 2, 2", "1E-6")));
+
+  /*--- Each entry of the B-spline order is used by the inversion, changing any of them invalidates the cache. ---*/
+  CHECK(key(*reference) != key(*makeConfig("3, 2, 2", "1E-6")));
+  CHECK(key(*reference) != key(*makeConfig("2, 3, 2", "1E-6")));
+  CHECK(key(*reference) != key(*makeConfig("2, 2, 3", "1E-6")));
+  CHECK(key(*reference) != key(*makeConfig("2, 2, 2", "1E-7")));
+
+  /*--- So do the control points and the points. ---*/
+  const auto refKey = key(*reference);
+  su2double moved[3] = {0.0, 0.0, 0.01};
+  box.SetCoordControlPoints(moved, 0, 0, 0);
+  CHECK(refKey != key(*reference));
+
+  CHECK(CSurfaceMovement::FFDInversionKey(reference.get(), &box, markerIdx, vertexIdx, {3, 8}, cartCoord) !=
+        key(*reference));
+}
@@ -0,0 +1,177 @@
+/*!
+ * \file tape_replay_test.cpp
+ * \brief Compare the adjoints of a replayed tape with those of fresh recordings (UNST_ADJOINT_TAPE_REPLAY).
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+
+#include <cmath>
+#include <vector>
+#include "../../Common/include/basic_types/datatype_structure.hpp"
+
+namespace {
+
+/*--- External function y = x^2, with and without primal function. ---*/
+
+void SquareReverse(const su2double::Real* x, su2double::Real* x_b, size_t m,
+                   const su2double::Real* y, const su2double::Real* y_b, size_t n, codi::DataStore* d) {
+  x_b[0] += 2 * x[0] * y_b[0];
+}
+
+void SquarePrimal(const su2double::Real* x, size_t m, su2double::Real* y, size_t n, codi::DataStore* d) {
+  y[0] = x[0] * x[0];
+}
+
+/*!
+ * \brief A small "time step", the state is reallocated at every step like the data of the solvers,
+ *        the time step size is an input that changes between steps.
+ */
+struct TimeStep {
+  std::vector<su2double> state, residual;
+  su2double dt, obj;
+
+  TimeStep(int step, size_t n) : state(n), residual(n) {
+    for (size_t i = 0; i < n; ++i) state[i] = 1.0 + 0.1 * i + 0.05 * step * std::cos(i + step);
+    dt = 0.1 + 0.02 * step;
+  }
+
+  void RegisterInputs() {
+    for (auto& x : state) AD::RegisterInput(x);
+    AD::RegisterInput(dt);
+  }
+
+  void RegisterOutputs() {
+    for (auto& r : residual) AD::RegisterOutput(r);
+    AD::RegisterOutput(obj);
+  }
+
+  void Compute(bool primalExtFunc) {
+    const auto n = state.size();
+    obj = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+      AD::ExtFuncHelper helper(true);
+      helper.addInput(state[i]);
+      AD::StopRecording();
+      su2double square = state[i] * state[i];
+      AD::StartRecording();
+      helper.addOutput(square);
+      if (primalExtFunc) AD::AddExtFuncToTape(helper, SquareReverse, SquarePrimal);
+      else AD::AddExtFuncToTape(helper, SquareReverse, nullptr);
+
+      residual[i] = state[i] * sin(state[(i+1)%n]) * dt + square;
+      obj += residual[i] * residual[i];
+    }
+  }
+
+  /*--- Adjoints of the inputs for a seed on the objective and on the residuals. ---*/
+  std::vector<passivedouble> Adjoints() {
+    SU2_TYPE::SetDerivative(obj, 1.0);
+    for (size_t i = 0; i < residual.size(); ++i) SU2_TYPE::SetDerivative(residual[i], 0.1 * i);
+    AD::ComputeAdjoint();
+    std::vector<passivedouble> adj;
+    for (auto& x : state) adj.push_back(SU2_TYPE::GetDerivative(x));
+    adj.push_back(SU2_TYPE::GetDerivative(dt));
+    AD::ClearAdjoints();
+    return adj;
+  }
+};
+
+void Record(TimeStep& step, bool primalExtFunc) {
+  AD::Reset();
+  AD::StartRecording();
+  step.RegisterInputs();
+  step.Compute(primalExtFunc);
+  step.RegisterOutputs();
+  AD::StopRecording();
+}
+
+}  // namespace
+
+TEST_CASE("Tape replay", "[AD tests]") {
+
+  if (!AD::PrimalTape) return;
+
+  const size_t n = 5;
+  AD::SetTapeTracking(true);
+
+  /*--- Slot 0 holds the replayed tape, slot 1 the fresh recordings. ---*/
+
+  AD::SetTapeSlot(0);
+  {
+    TimeStep first(0, n);
+    Record(first, true);
+  }
+
+  SECTION("Replayed adjoints match fresh recordings") {
+    for (int iStep = 1; iStep <= 4; ++iStep) {
+      AD::SetTapeSlot(1);
+      TimeStep fresh(iStep, n);
+      Record(fresh, true);
+      const auto reference = fresh.Adjoints();
+
+      AD::SetTapeSlot(0);
+      TimeStep replayed(iStep, n);
+      REQUIRE(AD::BeginReplay());
+      replayed.RegisterInputs();
+      AD::ReplayTape();
+      replayed.RegisterOutputs();
+      REQUIRE(AD::EndReplay());
+
+      CHECK(SU2_TYPE::GetValue(replayed.obj) == Approx(SU2_TYPE::GetValue(fresh.obj)));
+      for (size_t i = 0; i < n; ++i)
+        CHECK(SU2_TYPE::GetValue(replayed.residual[i]) == Approx(SU2_TYPE::GetValue(fresh.residual[i])));
+
+      const auto adjoints = replayed.Adjoints();
+      REQUIRE(adjoints.size() == reference.size());
+      for (size_t i = 0; i < adjoints.size(); ++i) CHECK(adjoints[i] == Approx(reference[i]));
+    }
+  }
+
+  SECTION("Registrations that do not match the recording are detected") {
+    TimeStep replayed(1, n);
+    REQUIRE(AD::BeginReplay());
+    for (size_t i = 1; i < n; ++i) AD::RegisterInput(replayed.state[i]);
+    AD::RegisterInput(replayed.dt);
+    AD::ReplayTape();
+    replayed.RegisterOutputs();
+    CHECK_FALSE(AD::EndReplay());
+  }
+
+  SECTION("External functions without primal function prevent the replay") {
+    TimeStep step(0, n);
+    Record(step, false);
+    CHECK_FALSE(AD::BeginReplay());
+
+    Record(step, true);
+    CHECK(AD::BeginReplay());
+    step.RegisterInputs();
+    AD::ReplayTape();
+    step.RegisterOutputs();
+    CHECK(AD::EndReplay());
+  }
+
+  AD::SetTapeSlot(0);
+  AD::Reset();
+  AD::SetTapeTracking(false);
+}
@@ -0,0 +1,120 @@
+/*!
+ * \file CPrimalStateStore_tests.cpp
+ * \brief Unit tests for the in-memory primal state store and the
+ *        binomial checkpointing schedule used by the unsteady adjoint.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include "../../../Common/include/toolboxes/CPrimalStateStore.hpp"
+#include "../../../Common/include/toolboxes/CBinomialCheckpointing.hpp"
+
+TEST_CASE("Binomial checkpointing cost", "[Toolboxes]") {
+  using Index = CBinomialCheckpointing::Index;
+  constexpr Index maxL = 40, maxS = 5;
+
+  /*--- Brute force minimum cost, P(l,s) = min_m m + P(l-m,s-1) + P(m-1,s). ---*/
+  std::vector<std::vector<Index> > P(maxS+1, std::vector<Index>(maxL+1, 0));
+  for (Index s = 0; s <= maxS; ++s) {
+    for (Index l = 1; l <= maxL; ++l) {
+      P[s][l] = l + P[s][l-1];
+      for (Index m = 1; s > 0 && m < l; ++m)
+        P[s][l] = std::min(P[s][l], m + P[s-1][l-m] + P[s][m-1]);
+      CHECK(CBinomialCheckpointing::Cost(l, s) == P[s][l]);
+    }
+  }
+}
+
+TEST_CASE("Binomial checkpointing schedule", "[Toolboxes]") {
+  using Index = CBinomialCheckpointing::Index;
+  const Index nSteps = 200;
+
+  for (Index nSnaps : {1ul, 3ul, 10ul}) {
+    Index nEvals = 0, maxUsed = 0;
+
+    /*--- Stack of checkpoints, the bottom is the initial state which is not counted. ---*/
+    std::vector<Index> stack = {0};
+
+    /*--- Deliver the states in reverse order. ---*/
+    for (Index target = nSteps; target > 0; --target) {
+      if (stack.back() == target) {
+        stack.pop_back();
+        continue;
+      }
+      Index current = stack.back();
+      while (current < target) {
+        const Index nFree = nSnaps + 1 - stack.size();
+        current += CBinomialCheckpointing::Advance(target - current, nFree);
+        nEvals += current - stack.back();
+        if (current < target) stack.push_back(current);
+        maxUsed = std::max<Index>(maxUsed, stack.size() - 1);
+      }
+    }
+    CHECK(maxUsed <= nSnaps);
+    CHECK(nEvals == CBinomialCheckpointing::Cost(nSteps, nSnaps));
+  }
+}
+
+TEST_CASE("Primal state store", "[Toolboxes]") {
+  const unsigned long nPoint = 500, nVar = 4;
+
+  su2activematrix state(nPoint, nVar), copy(nPoint, nVar);
+  for (auto i = 0ul; i < nPoint; ++i)
+    for (auto j = 0ul; j < nVar; ++j)
+      state(i,j) = (j+1) * std::sin(0.01 * i) + 1e-3 * j;
+
+  for (auto kind : {PRIMAL_STORE_COMPRESSION::NONE, PRIMAL_STORE_COMPRESSION::LOSSLESS,
+                    PRIMAL_STORE_COMPRESSION::FLOAT32}) {
+    CPrimalStateStore store(2, kind);
+
+    store.Store(10, {&state}, true);
+    REQUIRE(store.Retrieve(10, {&copy}));
+
+    for (auto i = 0ul; i < nPoint; ++i) {
+      for (auto j = 0ul; j < nVar; ++j) {
+        if (kind == PRIMAL_STORE_COMPRESSION::FLOAT32)
+          CHECK(copy(i,j) == Approx(state(i,j)).epsilon(1e-6));
+        else
+          CHECK(copy(i,j) == state(i,j));
+      }
+    }
+    if (kind == PRIMAL_STORE_COMPRESSION::LOSSLESS)
+      CHECK(store.GetMemoryUsage() < nPoint * nVar * sizeof(passivedouble));
+
+    /*--- Window of 2 states, the checkpoint is kept, and the working range is protected. ---*/
+    store.SetWorkingRange(3, 5);
+    for (long key = 1; key <= 6; ++key) store.Store(key, {&state});
+    CHECK(store.Contains(10));
+    CHECK(store.Contains(4));
+    CHECK(store.Contains(5));
+    CHECK_FALSE(store.Contains(6));
+    CHECK_FALSE(store.Contains(1));
+
+    store.SetWorkingRange(2, 3);
+    CHECK_FALSE(store.Contains(4));
+    CHECK(store.Contains(10));
+  }
+}
@@ -0,0 +1,210 @@
+/*!
+ * \file CRegionProfiler_tests.cpp
+ * \brief Unit tests for the hierarchical profiler of the solver phases.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include "../../../Common/include/toolboxes/CRegionProfiler.hpp"
+#include "../../../Common/include/parallelization/mpi_structure.hpp"
+
+namespace {
+
+void inner() { SU2_PROFILE_SCOPE("Inner"); }
+
+void outer(int n) {
+  SU2_PROFILE_SCOPE("Outer");
+  for (int i = 0; i < n; ++i) inner();
+}
+
+void masterOnly() { SU2_PROFILE_SCOPE("Master"); }
+
+/*!
+ * \brief Fields of a line of a CSV file, without the quotes of the strings.
+ */
+std::vector<std::string> SplitCSV(const std::string& line) {
+  std::vector<std::string> fields;
+  std::stringstream stream(line);
+  std::string field;
+  while (std::getline(stream, field, ',')) {
+    if (field.size() >= 2 && field.front() == '"') field = field.substr(1, field.size() - 2);
+    fields.push_back(field);
+  }
+  return fields;
+}
+
+/*!
+ * \brief Value of a numeric key of a JSON object written on one line.
+ */
+double JsonNumber(const std::string& object, const std::string& key) {
+  const auto pos = object.find("\"" + key + "\":");
+  REQUIRE(pos != std::string::npos);
+  return std::stod(object.substr(pos + key.size() + 3));
+}
+
+}  // namespace
+
+TEST_CASE("Region profiler tree", "[Toolboxes]") {
+  /*--- Scopes do nothing when the profiler is not active. ---*/
+  CRegionProfiler::Initialize(PROFILING_MODE::NONE, false);
+  outer(1);
+  CHECK(CRegionProfiler::GetLocalTree().empty());
+
+  CRegionProfiler::Initialize(PROFILING_MODE::SUMMARY, false);
+  outer(3);
+  outer(2);
+  inner();
+  const auto tree = CRegionProfiler::GetLocalTree();
+
+  /*--- Depth-first, children in order of first appearance. ---*/
+  REQUIRE(tree.size() == 3);
+  CHECK(tree[0].path == "Outer");
+  CHECK(tree[0].depth == 0);
+  CHECK(tree[0].calls == 2);
+  CHECK(tree[1].path == "Outer/Inner");
+  CHECK(tree[1].depth == 1);
+  CHECK(tree[1].calls == 5);
+  CHECK(tree[2].path == "Inner");
+  CHECK(tree[2].calls == 1);
+  CHECK(tree[0].time >= tree[1].time);
+
+  /*--- Same name, same region. ---*/
+  CHECK(CRegionProfiler::RegisterRegion("Inner") == CRegionProfiler::RegisterRegion("Inner"));
+
+  CRegionProfiler::Initialize(PROFILING_MODE::NONE, false);
+  CHECK(CRegionProfiler::GetLocalTree().empty());
+}
+
+TEST_CASE("Region profiler files", "[Toolboxes]") {
+  const int rank = SU2_MPI::GetRank(), size = SU2_MPI::GetSize();
+  const std::string summaryFile = "profiler_test.csv", traceFile = "profiler_test.json";
+
+  CRegionProfiler::Initialize(PROFILING_MODE::TRACE, false);
+  outer(2);
+  outer(2);
+  inner();
+  if (rank == MASTER_NODE) masterOnly();
+
+  const auto orig_buf = std::cout.rdbuf(nullptr);
+  CRegionProfiler::Finalize(summaryFile, traceFile);
+  std::cout.rdbuf(orig_buf);
+
+  /*--- Profiling stops. ---*/
+  CHECK_FALSE(CRegionProfiler::IsActive());
+  CHECK(CRegionProfiler::GetLocalTree().empty());
+
+  if (rank != MASTER_NODE) return;
+
+  /*--- Summary of the regions combined over the ranks (no sections, Finalize is collective). ---*/
+  {
+    std::ifstream csv(summaryFile);
+    REQUIRE(csv.is_open());
+    std::string line;
+    std::getline(csv, line);
+    const auto header = SplitCSV(line);
+    REQUIRE(header.size() == 11);
+    CHECK(header[0] == "Region");
+    CHECK(header[3] == "Avg_Time");
+
+    std::vector<std::vector<std::string> > rows;
+    while (std::getline(csv, line)) rows.push_back(SplitCSV(line));
+    REQUIRE(rows.size() == 4);
+
+    /*--- Depth-first, the calls are the sum over the ranks. ---*/
+    const std::vector<std::string> paths = {"Outer", "Outer/Inner", "Inner", "Master"};
+    const std::vector<int> depths = {0, 1, 0, 0};
+    const std::vector<int> calls = {2 * size, 4 * size, size, 1};
+
+    for (size_t iRow = 0; iRow < rows.size(); ++iRow) {
+      const auto& row = rows[iRow];
+      REQUIRE(row.size() == 11);
+      CHECK(row[0] == paths[iRow]);
+      CHECK(std::stoi(row[1]) == depths[iRow]);
+      CHECK(std::stoi(row[2]) == calls[iRow]);
+
+      const double avgTime = std::stod(row[3]), minTime = std::stod(row[4]), maxTime = std::stod(row[5]);
+      CHECK(minTime >= 0.0);
+      CHECK(minTime <= avgTime * (1 + 1e-9));
+      CHECK(avgTime <= maxTime * (1 + 1e-9));
+      CHECK(std::stod(row[6]) >= 1.0 - 1e-9);
+      CHECK(std::stod(row[7]) >= 1.0 - 1e-9);
+
+      /*--- Without counters the columns are zero. ---*/
+      for (int i = 8; i < 11; ++i) CHECK(row[i] == "0");
+    }
+
+    /*--- A region that some ranks did not enter has a minimum of zero. ---*/
+    if (size > 1) CHECK(std::stod(rows[3][4]) == 0.0);
+  }
+
+  /*--- Trace with the events of all ranks. ---*/
+  {
+    std::ifstream trace(traceFile);
+    REQUIRE(trace.is_open());
+    std::string line;
+    std::getline(trace, line);
+    CHECK(line == "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+
+    std::vector<int> rankNames(size, 0);
+    std::vector<std::string> events;
+    while (std::getline(trace, line)) {
+      if (line.find("\"ph\":\"M\"") != std::string::npos) {
+        const auto iRank = static_cast<int>(JsonNumber(line, "pid"));
+        REQUIRE(iRank < size);
+        CHECK(line.find("\"name\":\"Rank " + std::to_string(iRank) + "\"") != std::string::npos);
+        ++rankNames[iRank];
+      } else if (line.find("\"ph\":\"X\"") != std::string::npos) {
+        events.push_back(line);
+      }
+    }
+    for (auto n : rankNames) CHECK(n == 1);
+
+    /*--- Every closed scope of every rank is an event. ---*/
+    CHECK(events.size() == size_t(7 * size + 1));
+
+    /*--- The events of the inner regions lie within those of the outer regions (of the same rank). ---*/
+    std::vector<std::pair<double, double> > outerEvents;
+    for (const auto& event : events) {
+      CHECK(JsonNumber(event, "dur") >= 0.0);
+      if (JsonNumber(event, "pid") == 0 && event.find("\"name\":\"Outer\"") != std::string::npos)
+        outerEvents.emplace_back(JsonNumber(event, "ts"), JsonNumber(event, "dur"));
+    }
+    REQUIRE(outerEvents.size() == 2);
+
+    int nNested = 0;
+    for (const auto& event : events) {
+      if (JsonNumber(event, "pid") != 0 || event.find("\"name\":\"Inner\"") == std::string::npos) continue;
+      const double start = JsonNumber(event, "ts"), end = start + JsonNumber(event, "dur");
+      for (const auto& outerEvent : outerEvents)
+        nNested += (start >= outerEvent.first - 0.0011 && end <= outerEvent.first + outerEvent.second + 0.0011);
+    }
+    CHECK(nNested == 4);
+  }
+
+  std::remove(summaryFile.c_str());
+  std::remove(traceFile.c_str());
+}
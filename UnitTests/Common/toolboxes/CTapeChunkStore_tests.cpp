@@ -0,0 +1,137 @@
+/*!
+ * \file CTapeChunkStore_tests.cpp
+ * \brief Unit tests for the store of idle AD tape chunks.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include "../../../Common/include/toolboxes/CTapeChunkStore.hpp"
+
+namespace {
+
+/*--- Data like that of a Jacobian tape chunk, Jacobians, argument indices, and number of arguments. ---*/
+
+struct TapeData {
+  std::vector<double> jacobians;
+  std::vector<int> indices;
+  std::vector<uint8_t> nArgs;
+  struct Entry { int a; short b; char c[6]; };
+  std::vector<Entry> entries;
+
+  explicit TapeData(int n) {
+    for (int i = 0; i < n; ++i) {
+      jacobians.push_back(sin(0.01 * i) / (1 + i % 7));
+      indices.push_back(1000 + i - 3 * (i % 4));
+      nArgs.push_back(static_cast<uint8_t>(1 + i % 3));
+      entries.push_back({i, static_cast<short>(i % 5), {'t', 'a', 'p', 'e', static_cast<char>(i), 0}});
+    }
+  }
+};
+
+struct Blocks {
+  CTapeChunkStore::Block jacobians, indices, nArgs, entries;
+};
+
+void StoreAll(CTapeChunkStore& store, const TapeData& data, Blocks& blocks) {
+  store.Store(data.jacobians.data(), data.jacobians.size(), blocks.jacobians);
+  store.Store(data.indices.data(), data.indices.size(), blocks.indices);
+  store.Store(data.nArgs.data(), data.nArgs.size(), blocks.nArgs);
+  store.Store(data.entries.data(), data.entries.size(), blocks.entries);
+}
+
+void CheckAll(const CTapeChunkStore& store, const TapeData& data, const Blocks& blocks) {
+  const auto n = data.jacobians.size();
+  std::vector<double> jacobians(n);
+  std::vector<int> indices(n);
+  std::vector<uint8_t> nArgs(n);
+  std::vector<TapeData::Entry> entries(n);
+  store.Load(blocks.jacobians, jacobians.data());
+  store.Load(blocks.indices, indices.data());
+  store.Load(blocks.nArgs, nArgs.data());
+  store.Load(blocks.entries, entries.data());
+
+  for (size_t i = 0; i < n; ++i) {
+    REQUIRE(jacobians[i] == data.jacobians[i]);
+    REQUIRE(indices[i] == data.indices[i]);
+    REQUIRE(nArgs[i] == data.nArgs[i]);
+    REQUIRE(entries[i].a == data.entries[i].a);
+    REQUIRE(entries[i].b == data.entries[i].b);
+    REQUIRE(entries[i].c[4] == data.entries[i].c[4]);
+  }
+}
+
+}  // namespace
+
+TEST_CASE("Tape chunk store", "[Toolboxes]") {
+  const TapeData data(5000);
+  const unsigned long rawBytes = data.jacobians.size() * (sizeof(double) + sizeof(int) + 1 + sizeof(TapeData::Entry));
+
+  SECTION("Compressed in memory") {
+    CTapeChunkStore store(false);
+    Blocks blocks;
+    StoreAll(store, data, blocks);
+    CheckAll(store, data, blocks);
+
+    /*--- The index streams are small once xor'ed with the previous value. ---*/
+    CHECK(blocks.indices.size < data.indices.size() * sizeof(int) / 2);
+    CHECK(store.GetMemoryUsage() < rawBytes);
+    CHECK(store.GetFileUsage() == 0);
+
+    /*--- Storing again replaces the data, releasing frees the memory. ---*/
+    StoreAll(store, data, blocks);
+    CheckAll(store, data, blocks);
+    for (auto* block : {&blocks.jacobians, &blocks.indices, &blocks.nArgs, &blocks.entries}) store.Release(*block);
+    CHECK(store.GetMemoryUsage() == 0);
+  }
+
+  SECTION("Scratch file") {
+    CTapeChunkStore store(true);
+    Blocks blocks;
+    StoreAll(store, data, blocks);
+    CheckAll(store, data, blocks);
+
+    CHECK(store.GetMemoryUsage() == 0);
+    CHECK(blocks.jacobians.bytes.empty());
+    const auto fileUsage = store.GetFileUsage();
+    CHECK(fileUsage > 0);
+    CHECK(fileUsage < rawBytes);
+
+    /*--- After clearing, the file is reused from its start. ---*/
+    store.Clear();
+    StoreAll(store, data, blocks);
+    CheckAll(store, data, blocks);
+    CHECK(store.GetFileUsage() == fileUsage);
+  }
+
+  SECTION("Empty arrays") {
+    CTapeChunkStore store(false);
+    CTapeChunkStore::Block block;
+    store.Store(data.jacobians.data(), 0, block);
+    double value = 1.0;
+    store.Load(block, &value);
+    CHECK(value == 1.0);
+  }
+}
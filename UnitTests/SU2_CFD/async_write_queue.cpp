@@ -0,0 +1,95 @@
+/*!
+ * \file async_write_queue.cpp
+ * \brief Unit tests for the asynchronous output writing queue.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "catch.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "../../SU2_CFD/include/output/filewriter/CAsyncWriteQueue.hpp"
+
+#ifndef HAVE_MPI
+/*--- Must run before any other use of the queue in this process, the helper thread
+ *    of the parent would not exist in the forked process. ---*/
+TEST_CASE("Async write queue error exit", "[Output]") {
+  fflush(stdout);
+  const pid_t pid = fork();
+  REQUIRE(pid >= 0);
+
+  if (pid == 0) {
+    /*--- A deadlock in the error exit is turned into a signal. ---*/
+    alarm(30);
+    if (!freopen("/dev/null", "w", stdout)) _exit(2);
+
+    CAsyncWriteQueue::Job job;
+    job.fileName = "non_existent_folder/async_write_queue_test.dat";
+    const char data[] = "data";
+    job.AddPiece(0, data, sizeof(data));
+
+    auto& queue = CAsyncWriteQueue::GetInstance();
+    queue.Submit(std::move(job));
+    queue.Flush();
+    _exit(0);
+  }
+
+  int status = 0;
+  REQUIRE(waitpid(pid, &status, 0) == pid);
+  REQUIRE(WIFEXITED(status));
+  CHECK(WEXITSTATUS(status) == EXIT_FAILURE);
+}
+#endif
+
+TEST_CASE("Async write queue", "[Output]") {
+  const std::string filename = "async_write_queue_test.dat";
+  auto& queue = CAsyncWriteQueue::GetInstance();
+  queue.SetMaxPending(2);
+
+  /*--- A longer previous file is truncated to the size of the job. ---*/
+  {
+    std::ofstream file(filename);
+    file << std::string(64, 'x');
+  }
+
+  CAsyncWriteQueue::Job job;
+  job.fileName = filename;
+  job.fileSize = 10;
+  job.setSize = true;
+  job.AddPiece(5, "56789", 5);
+  job.AddPiece(0, "01234", 5);
+  queue.Submit(std::move(job));
+  queue.Flush();
+
+  std::ifstream file(filename);
+  std::string content;
+  std::getline(file, content);
+  CHECK(content == "0123456789");
+
+  file.close();
+  std::remove(filename.c_str());
+}
@@ -0,0 +1,161 @@
+/*!
+ * \file binary_history.cpp
+ * \brief Unit tests for the binary columnar history file.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include "../../SU2_CFD/include/output/tools/CBinaryHistoryWriter.hpp"
+
+namespace {
+
+template <class T>
+T read(std::ifstream& file) {
+  T val;
+  file.read(reinterpret_cast<char*>(&val), sizeof(T));
+  return val;
+}
+
+}  // namespace
+
+TEST_CASE("Binary history file", "[Output]") {
+  const std::string filename = "binary_history_test.bin";
+  su2double iter = 0.0, res = 0.0;
+  const std::vector<const su2double*> values = {&iter, &res};
+
+  {
+    CBinaryHistoryWriter writer;
+    writer.Open(filename, {"Inner_Iter", "rms[Rho]"}, 2);
+
+    /*--- Two full blocks and one partial block written on destruction. ---*/
+    for (int i = 0; i < 5; ++i) {
+      iter = i;
+      res = -i * 0.5;
+      writer.AddLine(values);
+    }
+  }
+
+  std::ifstream file(filename, std::ios::binary);
+  REQUIRE(file.is_open());
+
+  char magic[8];
+  file.read(magic, 8);
+  CHECK(std::string(magic, 8) == "SU2HIST1");
+
+  REQUIRE(read<int32_t>(file) == 2);
+  std::vector<std::string> names;
+  for (int i = 0; i < 2; ++i) {
+    std::string name(read<int32_t>(file), ' ');
+    file.read(&name[0], name.size());
+    names.push_back(name);
+  }
+  CHECK(names[0] == "Inner_Iter");
+  CHECK(names[1] == "rms[Rho]");
+
+  const std::vector<int32_t> blockLines = {2, 2, 1};
+  int line = 0;
+  for (const auto nLines : blockLines) {
+    REQUIRE(read<int32_t>(file) == nLines);
+    std::vector<double> block(2 * nLines);
+    file.read(reinterpret_cast<char*>(block.data()), block.size() * sizeof(double));
+    for (int i = 0; i < nLines; ++i, ++line) {
+      CHECK(block[i] == line);
+      CHECK(block[nLines + i] == -line * 0.5);
+    }
+  }
+  read<int32_t>(file);
+  CHECK(file.eof());
+
+  file.close();
+  std::remove(filename.c_str());
+}
+
+#if defined(SU2_PY_DIR) && defined(SU2_PYTHON)
+TEST_CASE("Conversion of the binary history file to CSV", "[Output]") {
+  const std::string script = std::string(SU2_PY_DIR) + "/history_to_csv.py";
+  if (!std::ifstream(script).good()) {
+    WARN("history_to_csv.py not found at " << script << ", e.g. the test driver was moved after the build.");
+    return;
+  }
+  const std::string filename = "history_to_csv_test.bin";
+  const std::string csvname = "history_to_csv_test.csv";
+  su2double iter = 0.0, res = 0.0, lift = 0.0;
+  const std::vector<const su2double*> values = {&iter, &res, &lift};
+
+  auto value = [](int line, int column) {
+    return column == 0 ? double(line) : column == 1 ? -0.1 * line * line : std::exp(0.3 * line) / 3.0;
+  };
+
+  {
+    CBinaryHistoryWriter writer;
+    writer.Open(filename, {"Inner_Iter", "rms[Rho]", "CL"}, 3);
+    for (int i = 0; i < 7; ++i) {
+      iter = value(i, 0);
+      res = value(i, 1);
+      lift = value(i, 2);
+      writer.AddLine(values);
+    }
+  }
+
+  /*--- A block cut short, e.g. by an abort while it was written, is not converted. ---*/
+  {
+    std::ofstream file(filename, std::ios::binary | std::ios::app);
+    const int32_t nLines = 3;
+    const double partial = 1.0;
+    file.write(reinterpret_cast<const char*>(&nLines), sizeof(nLines));
+    file.write(reinterpret_cast<const char*>(&partial), sizeof(partial));
+  }
+
+  /*--- 17 significant digits are enough to recover the doubles exactly. ---*/
+  const std::string command = std::string("\"") + SU2_PYTHON + "\" \"" + script + "\" -p 17 -o " + csvname + " " +
+                              filename + " > /dev/null";
+  REQUIRE(std::system(command.c_str()) == 0);
+
+  std::ifstream csv(csvname);
+  REQUIRE(csv.is_open());
+  std::string line;
+  std::getline(csv, line);
+  CHECK(line == "\"Inner_Iter\",\"rms[Rho]\",\"CL\"");
+
+  int nLines = 0;
+  while (std::getline(csv, line)) {
+    std::stringstream lineStream(line);
+    std::string entry;
+    int column = 0;
+    for (; std::getline(lineStream, entry, ','); ++column) CHECK(std::stod(entry) == value(nLines, column));
+    CHECK(column == 3);
+    ++nLines;
+  }
+  CHECK(nLines == 7);
+
+  csv.close();
+  std::remove(filename.c_str());
+  std::remove(csvname.c_str());
+}
+#endif
@@ -0,0 +1,210 @@
+/*!
+ * \file fem_dg_implicit.cpp
+ * \brief Unit tests for the implicit (Jacobian-free Newton-Krylov) time integration of the FEM-DG solver.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <vector>
+#include "../../Common/include/geometry/CPhysicalGeometry.hpp"
+#include "../../Common/include/fem/fem_geometry_structure.hpp"
+#include "../../SU2_CFD/include/solvers/CFEM_DG_EulerSolver.hpp"
+
+namespace {
+
+const std::string meshFileName = "fem_dg_implicit.su2";
+
+/*!
+ * \brief Write a mesh of n x n linear quadrilaterals on the unit square with a linear solution
+ *        (type 20009) and a single far field marker, in the SU2 format.
+ */
+void WriteMesh(unsigned long n) {
+  if (SU2_MPI::GetRank() != MASTER_NODE) {
+    SU2_MPI::Barrier(SU2_MPI::GetComm());
+    return;
+  }
+  std::ofstream file(meshFileName);
+  file << "NDIME= 2\n";
+
+  file << "NELEM= " << n*n << "\n";
+  for (auto j = 0ul; j < n; ++j)
+    for (auto i = 0ul; i < n; ++i) {
+      const auto p = j*(n+1) + i;
+      file << "20009 " << p << " " << p+1 << " " << p+n+2 << " " << p+n+1 << "\n";
+    }
+
+  file << "NPOIN= " << (n+1)*(n+1) << "\n";
+  for (auto j = 0ul; j <= n; ++j)
+    for (auto i = 0ul; i <= n; ++i) file << double(i)/n << " " << double(j)/n << "\n";
+
+  file << "NMARK= 1\n";
+  file << "MARKER_TAG= farfield\n";
+  file << "MARKER_ELEMS= " << 4*n << "\n";
+  for (auto i = 0ul; i < n; ++i) {
+    file << "3 " << i << " " << i+1 << "\n";
+    file << "3 " << n*(n+1)+i << " " << n*(n+1)+i+1 << "\n";
+    file << "3 " << i*(n+1) << " " << (i+1)*(n+1) << "\n";
+    file << "3 " << i*(n+1)+n << " " << (i+1)*(n+1)+n << "\n";
+  }
+  file.close();
+  SU2_MPI::Barrier(SU2_MPI::GetComm());
+}
+
+/*!
+ * \brief Geometry and solver of the DG discretization, set up as in CDriver::Geometrical_Preprocessing_DGFEM.
+ */
+struct DGTestCase {
+  std::unique_ptr<CConfig> config;
+  std::unique_ptr<CGeometry> geometry;
+  std::unique_ptr<CSolver> solver;
+  CSolver* container[MAX_SOLS] = {nullptr};
+  CNumerics* numerics[MAX_TERMS] = {nullptr};  // The DG solver evaluates the Riemann solver (ROE) itself.
+  CMeshFEM_DG* mesh{nullptr};
+  streambuf* orig_buf{cout.rdbuf()};
+
+  explicit DGTestCase(const std::string& options) {
+    cout.rdbuf(nullptr);
+    stringstream ss("SOLVER= FEM_EULER\n"
+                    "MESH_FORMAT= SU2\n"
+                    "MESH_FILENAME= " + meshFileName + "\n"
+                    "MACH_NUMBER= 0.5\n"
+                    "AOA= 10.0\n"
+                    "FREESTREAM_PRESSURE= 101325.0\n"
+                    "FREESTREAM_TEMPERATURE= 288.15\n"
+                    "REF_DIMENSIONALIZATION= FREESTREAM_PRESS_EQ_ONE\n"
+                    "MARKER_FAR= ( farfield )\n"
+                    "RIEMANN_SOLVER_FEM= ROE\n"
+                    "TIME_DISCRE_FEM_FLOW= EULER_IMPLICIT\n"
+                    "LINEAR_SOLVER_ERROR= 1e-6\n"
+                    "LINEAR_SOLVER_ITER= 100\n" + options);
+    config = std::unique_ptr<CConfig>(new CConfig(ss, SU2_COMPONENT::SU2_CFD, false));
+
+    {
+      auto aux_geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(config.get(), 0, 1));
+      std::unique_ptr<CSolver> aux_solver(new CFEM_DG_EulerSolver(config.get(), aux_geometry->GetnDim(), MESH_0));
+      aux_geometry->SetColorFEMGrid_Parallel(config.get());
+      geometry = std::unique_ptr<CGeometry>(new CMeshFEM_DG(aux_geometry.get(), config.get()));
+    }
+    geometry->SetSendReceive(config.get());
+    geometry->SetBoundaries(config.get());
+
+    mesh = dynamic_cast<CMeshFEM_DG*>(geometry.get());
+    mesh->CreateStandardVolumeElements(config.get());
+    mesh->CreateFaces(config.get());
+    mesh->MetricTermsVolumeElements(config.get());
+    mesh->MetricTermsSurfaceElements(config.get());
+    mesh->LengthScaleVolumeElements();
+    mesh->CoordinatesIntegrationPoints();
+    mesh->CoordinatesSolDOFs();
+    mesh->WallFunctionPreprocessing(config.get());
+    geometry->SetGlobal_to_Local_Point();
+
+    solver = std::unique_ptr<CSolver>(new CFEM_DG_EulerSolver(geometry.get(), config.get(), MESH_0));
+    container[FLOW_SOL] = solver.get();
+    cout.rdbuf(orig_buf);
+  }
+
+  /*!
+   * \brief One steady iteration, as in CFEM_DG_Integration::SingleGrid_Iteration.
+   */
+  void Iterate(unsigned long iter) {
+    cout.rdbuf(nullptr);
+    solver->SetTime_Step(geometry.get(), container, config.get(), MESH_0, iter);
+    solver->Preprocessing(geometry.get(), container, config.get(), MESH_0, 0, RUNTIME_FLOW_SYS, false);
+    solver->Set_OldSolution();
+    solver->ProcessTaskList_DG(geometry.get(), container, numerics, config.get(), MESH_0);
+    solver->ImplicitNewtonKrylov_Iteration(geometry.get(), container, numerics, config.get(), MESH_0);
+    solver->Postprocessing(geometry.get(), container, config.get(), MESH_0);
+    cout.rdbuf(orig_buf);
+  }
+
+  /*!
+   * \brief The solution of the owned DOFs.
+   */
+  std::vector<passivedouble> Solution() const {
+    unsigned long nDOFs = 0;
+    for (auto l = 0ul; l < mesh->GetNVolElemOwned(); ++l) nDOFs += mesh->GetVolElem()[l].nDOFsSol;
+
+    const auto* sol = solver->GetVecSolDOFs();
+    std::vector<passivedouble> values(nDOFs*solver->GetnVar());
+    for (auto i = 0ul; i < values.size(); ++i) values[i] = SU2_TYPE::GetValue(sol[i]);
+    return values;
+  }
+};
+
+}  // namespace
+
+TEST_CASE("Implicit Newton-Krylov iteration of the DG solver", "[FEM]") {
+  WriteMesh(4);
+
+  SECTION("The free stream is preserved") {
+    DGTestCase test("CFL_NUMBER= 100.0\n");
+    const auto before = test.Solution();
+    test.Iterate(0);
+    const auto after = test.Solution();
+
+    REQUIRE(after.size() == before.size());
+    for (auto i = 0ul; i < before.size(); ++i) CHECK(after[i] == Approx(before[i]).margin(1e-10));
+    for (auto iVar = 0u; iVar < test.solver->GetnVar(); ++iVar)
+      CHECK(SU2_TYPE::GetValue(test.solver->GetRes_RMS(iVar)) < 1e-10);
+  }
+
+  SECTION("A disturbance is damped with large time steps") {
+    DGTestCase test("CFL_NUMBER= 1000.0\nIMPLICIT_PRECOND_FREQ_DGFEM= 2\n");
+
+    /*--- Disturb the density and the energy with a smooth bump in the middle of the domain. ---*/
+    const auto nVar = test.solver->GetnVar();
+    auto* sol = test.solver->GetVecSolDOFs();
+    for (auto l = 0ul; l < test.mesh->GetNVolElemOwned(); ++l) {
+      const auto& elem = test.mesh->GetVolElem()[l];
+      for (auto j = 0u; j < elem.nDOFsSol; ++j) {
+        const su2double* coor = elem.coorSolDOFs.data() + j*2;
+        const su2double r2 = pow(coor[0]-0.5, 2) + pow(coor[1]-0.5, 2);
+        const su2double bump = 0.1*exp(-20.0*r2);
+        sol[(elem.offsetDOFsSolLocal + j)*nVar] *= 1.0 + bump;
+        sol[(elem.offsetDOFsSolLocal + j)*nVar + nVar-1] *= 1.0 + bump;
+      }
+    }
+
+    std::vector<passivedouble> resRho;
+    for (auto iter = 0ul; iter < 5; ++iter) {
+      test.Iterate(iter);
+      resRho.push_back(SU2_TYPE::GetValue(test.solver->GetRes_RMS(0)));
+      CHECK(test.solver->GetIterLinSolver() > 0);
+    }
+
+    /*--- Close to Newton convergence, the steady state is reached in a few iterations. ---*/
+    CHECK(resRho.front() > 1e-4);
+    CHECK(resRho.back() < 1e-6*resRho.front());
+    for (auto iter = 1ul; iter < resRho.size(); ++iter) CHECK(resRho[iter] < resRho[iter-1]);
+
+    for (const auto value : test.Solution()) CHECK(std::isfinite(value));
+  }
+
+  SU2_MPI::Barrier(SU2_MPI::GetComm());
+  if (SU2_MPI::GetRank() == MASTER_NODE) std::remove(meshFileName.c_str());
+}
@@ -0,0 +1,101 @@
+/*!
+ * \file CSU2TCLib_tests.cpp
+ * \brief Unit tests for the SU2 thermochemical library.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cmath>
+#include <sstream>
+#include <vector>
+#include "../../../SU2_CFD/include/fluid/CSU2TCLib.hpp"
+
+TEST_CASE("Batched net production rates", "[NEMO]") {
+
+  std::stringstream config_options;
+
+  config_options << "SOLVER= NEMO_EULER" << std::endl;
+  config_options << "GAS_MODEL= AIR-5" << std::endl;
+  config_options << "GAS_COMPOSITION= (0.77, 0.23, 0.0, 0.0, 0.0)" << std::endl;
+
+  /*--- Setup ---*/
+
+  CConfig* config = new CConfig(config_options, SU2_COMPONENT::SU2_CFD, false);
+  CSU2TCLib gas(config, 2, false);
+
+  /*--- More points than the chunk size of the batched routine, spanning the Keq table. ---*/
+  const unsigned long nSpecies = 5, nPoints = 150;
+  std::vector<su2double> rhos(nSpecies*nPoints), T(nPoints), Tve(nPoints), ws(nSpecies*nPoints);
+
+  for (auto iPoint = 0ul; iPoint < nPoints; ++iPoint) {
+    T[iPoint] = 3000.0 + 100.0*iPoint;
+    Tve[iPoint] = 2500.0 + 90.0*iPoint;
+    for (auto iSpecies = 0ul; iSpecies < nSpecies; ++iSpecies)
+      rhos[iSpecies*nPoints+iPoint] = 1e-3 * (1.0 + iSpecies + 0.1*iPoint) * pow(10.0, -0.03*iPoint);
+  }
+
+  /*--- Test ---*/
+
+  gas.ComputeNetProductionRates(nPoints, rhos.data(), T.data(), Tve.data(), ws.data());
+
+  /*--- Against the per-point routine, called as in CSource_NEMO::ComputeChemistry. ---*/
+
+  const unsigned short RHOS_INDEX = 0, T_INDEX = nSpecies, TVE_INDEX = nSpecies+1;
+  std::vector<su2double> rhos_i(nSpecies), V_i(nSpecies+2);
+
+  for (auto iPoint = 0ul; iPoint < nPoints; ++iPoint) {
+    for (auto iSpecies = 0ul; iSpecies < nSpecies; ++iSpecies) {
+      rhos_i[iSpecies] = rhos[iSpecies*nPoints+iPoint];
+      V_i[RHOS_INDEX+iSpecies] = rhos_i[iSpecies];
+    }
+    V_i[T_INDEX] = T[iPoint];
+    V_i[TVE_INDEX] = Tve[iPoint];
+
+    gas.SetTDStateRhosTTv(rhos_i, V_i[T_INDEX], V_i[TVE_INDEX]);
+    const auto eve_i = gas.ComputeSpeciesEve(V_i[TVE_INDEX]);
+    const auto Cvve_i = gas.ComputeSpeciesCvVibEle(V_i[TVE_INDEX]);
+    const auto& ws_i = gas.ComputeNetProductionRates(false, V_i.data(), eve_i.data(), Cvve_i.data(),
+                                                     nullptr, nullptr, nullptr);
+
+    for (auto iSpecies = 0ul; iSpecies < nSpecies; ++iSpecies)
+      CHECK(SU2_TYPE::GetValue(ws[iSpecies*nPoints+iPoint]) == Approx(SU2_TYPE::GetValue(ws_i[iSpecies])));
+  }
+
+  /*--- Against reference values of the per-point routine prior to the batched implementation. ---*/
+
+  const unsigned long refPoints[] = {0, 40, 90, 149};
+  const su2double refValues[][5] = {
+    {29760.194735655812, -7371.4618386048314, -24911.154722974126, -18131.79014931231, 20654.211975235459},
+    {249.67666250961111, -325.13777906047471, -55.696342310615648, -223.67788366657248, 354.8353425280518},
+    {0.24267349021347007, -4.4123177572473375, -11.765707267572056, 5.2495008338306928, 10.685850700775232},
+    {-0.00033003556878565796, -0.0079173825105836836, -0.068584374456781297, 0.032344884472968426,
+     0.044486908063182215}};
+
+  for (auto i = 0ul; i < 4; ++i)
+    for (auto iSpecies = 0ul; iSpecies < nSpecies; ++iSpecies)
+      CHECK(SU2_TYPE::GetValue(ws[iSpecies*nPoints+refPoints[i]]) == Approx(SU2_TYPE::GetValue(refValues[i][iSpecies])));
+
+  /*--- Teardown ---*/
+
+  delete config;
+}
@@ -0,0 +1,206 @@
+/*!
+ * \file CCenteredFlux_b_tests.cpp
+ * \brief Unit tests for the hand-differentiated centered fluxes.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cmath>
+#include <vector>
+#include "../../UnitQuadTestCase.hpp"
+#include "../../../SU2_CFD/include/numerics_simd/flow/convection/centered.hpp"
+#include "../../../SU2_CFD/include/numerics_simd/flow/diffusion/viscous_fluxes.hpp"
+
+namespace {
+
+/*!
+ * \brief Edge of the unit quad test case and the flow variables used by the production kernels.
+ * \note The inputs of CCenteredFlux_b are read from, and written to, the data of the edge.
+ */
+template<size_t nDim>
+struct EdgeData {
+  using Flux_b = CCenteredFlux_b<nDim>;
+
+  CGeometry& geometry;
+  CEulerVariable& nodes;
+  const unsigned long iEdge, points[2];
+  const CCenteredDissipationParams params;
+
+  EdgeData(CGeometry& geo, CEulerVariable& var, unsigned long edge, const CCenteredDissipationParams& par)
+    : geometry(geo), nodes(var), iEdge(edge),
+      points{geo.edges->GetNode(edge,0), geo.edges->GetNode(edge,1)}, params(par) {}
+
+  /*--- Pointer to each input, in the order of CCenteredFlux_b. ---*/
+  std::vector<su2double*> inputs() const {
+    std::vector<su2double*> x;
+    auto& normal = const_cast<su2activematrix&>(geometry.edges->GetNormal());
+    for (size_t iDim = 0; iDim < nDim; ++iDim) x.push_back(&normal(iEdge,iDim));
+    auto& primitives = const_cast<su2activematrix&>(nodes.GetPrimitive());
+    for (auto point : points)
+      for (size_t iVar = 1; iVar <= Flux_b::nPrimVar; ++iVar) x.push_back(&primitives(point,iVar));
+    auto& lambda = const_cast<su2activevector&>(nodes.GetLambda());
+    for (auto point : points) x.push_back(&lambda(point));
+    auto& sensor = const_cast<su2activevector&>(nodes.GetSensor());
+    if (params.sensor) for (auto point : points) x.push_back(&sensor(point));
+    auto& lapl = const_cast<su2activematrix&>(nodes.GetUndivided_Laplacian());
+    if (params.laplacian)
+      for (auto point : points)
+        for (size_t iVar = 0; iVar < Flux_b::nVar; ++iVar) x.push_back(&lapl(point,iVar));
+    return x;
+  }
+};
+
+/*!
+ * \brief Set a smooth, physically valid state at the points of the edge.
+ */
+template<size_t nDim>
+void setState(EdgeData<nDim>& edge) {
+  using Flux_b = CCenteredFlux_b<nDim>;
+  for (size_t k = 0; k < 2; ++k) {
+    const auto point = edge.points[k];
+    const su2double velocity[] = {0.6-0.2*k, 0.35+0.1*k, -0.3+0.05*k};
+    for (size_t iDim = 0; iDim < nDim; ++iDim) edge.nodes.SetPrimitive(point, iDim+1, velocity[iDim]);
+    edge.nodes.SetPrimitive(point, nDim+1, 1.0+0.1*k);  // pressure
+    edge.nodes.SetPrimitive(point, nDim+2, 1.2-0.1*k);  // density
+    edge.nodes.SetPrimitive(point, nDim+3, 3.5+0.2*k);  // enthalpy
+    edge.nodes.SetPrimitive(point, nDim+4, 1.1+0.05*k); // speed of sound
+    edge.nodes.SetLambda(point, 0.4+0.1*k);
+    edge.nodes.SetSensor(point, 0.01+0.005*k);
+    for (size_t iVar = 0; iVar < Flux_b::nVar; ++iVar)
+      edge.nodes.SetUnd_Lapl(point, iVar, 0.05*sin(1.3*iVar + 0.7 + k));
+  }
+}
+
+/*!
+ * \brief Flux of the edge computed by the production (primal) kernel.
+ */
+template<size_t nDim>
+std::vector<passivedouble> productionFlux(const CNumericsSIMD& numerics, const CConfig& config,
+                                          const EdgeData<nDim>& edge) {
+  using Flux_b = CCenteredFlux_b<nDim>;
+  CSysVector<su2double> fluxes(edge.geometry.GetnEdge(), edge.geometry.GetnEdge(), Flux_b::nVar);
+  SparseMatrixType matrix;
+
+  /*--- The kernels expect contiguous edges in the SIMD lanes (see CEdge::GetNode), only the first is kept. ---*/
+  Double mask = 0.0;
+  mask[0] = 1.0;
+  numerics.ComputeFlux(Int(edge.iEdge, 1), config, edge.geometry, edge.nodes, UpdateType::REDUCTION,
+                       mask, fluxes, matrix);
+
+  std::vector<passivedouble> flux(Flux_b::nVar);
+  for (size_t iVar = 0; iVar < Flux_b::nVar; ++iVar) flux[iVar] = SU2_TYPE::GetValue(fluxes(edge.iEdge,iVar));
+  return flux;
+}
+
+/*!
+ * \brief Compare the flux and J^T y_b from CCenteredFlux_b with the production kernel of the same
+ * scheme (and its central finite differences), on the same edge states.
+ */
+template<size_t nDim, class Scheme>
+void checkAgainstProduction(const CConfig& config, CGeometry& geometry, CEulerVariable& nodes) {
+  using Flux_b = CCenteredFlux_b<nDim>;
+  const Scheme numerics(config);
+
+  for (auto iEdge = 0ul; iEdge < geometry.GetnEdge(); iEdge += 37) {
+    const auto ni = geometry.nodes->GetnNeighbor(geometry.edges->GetNode(iEdge,0));
+    const auto nj = geometry.nodes->GetnNeighbor(geometry.edges->GetNode(iEdge,1));
+    EdgeData<nDim> edge(geometry, nodes, iEdge, numerics.dissipationParams(ni, nj));
+    setState(edge);
+
+    const auto inputs = edge.inputs();
+    REQUIRE(inputs.size() == Flux_b::nInput(edge.params));
+
+    std::vector<passivedouble> x(inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) x[i] = SU2_TYPE::GetValue(*inputs[i]);
+
+    /*--- The primal function used to replay the tape must match the kernel. ---*/
+
+    std::vector<passivedouble> y(Flux_b::nVar);
+    Flux_b::Flux(x.data(), edge.params, y.data());
+    const auto flux = productionFlux(numerics, config, edge);
+    for (size_t iVar = 0; iVar < Flux_b::nVar; ++iVar) CHECK(y[iVar] == Approx(flux[iVar]).epsilon(1e-12));
+
+    std::vector<passivedouble> y_b(Flux_b::nVar);
+    for (size_t iVar = 0; iVar < Flux_b::nVar; ++iVar) y_b[iVar] = 1.0 + 0.3*iVar;
+
+    std::vector<passivedouble> x_b(inputs.size(), 0.0);
+    Flux_b::Adjoint(x.data(), y_b.data(), edge.params, x_b.data());
+
+    for (size_t i = 0; i < inputs.size(); ++i) {
+      const passivedouble h = 1e-6 * (1 + fabs(x[i]));
+      *inputs[i] = x[i] + h;
+      const auto fp = productionFlux(numerics, config, edge);
+      *inputs[i] = x[i] - h;
+      const auto fm = productionFlux(numerics, config, edge);
+      *inputs[i] = x[i];
+
+      passivedouble ref = 0.0;
+      for (size_t iVar = 0; iVar < Flux_b::nVar; ++iVar) ref += y_b[iVar]*(fp[iVar]-fm[iVar])/(2*h);
+      CHECK(x_b[i] == Approx(ref).margin(1e-7).epsilon(1e-6));
+    }
+  }
+}
+
+/*!
+ * \brief Check the centered schemes on the unit quad test case (a RECTANGLE mesh in 2D).
+ */
+template<size_t nDim>
+void checkSchemes() {
+  UnitQuadTestCase test;
+  if (nDim == 2) {
+    auto replace = [&](const std::string& from, const std::string& to) {
+      test.config_options.replace(test.config_options.find(from), from.size(), to);
+    };
+    replace("MESH_FORMAT= BOX", "MESH_FORMAT= RECTANGLE");
+    replace("MARKER_CUSTOM= ( x_minus, x_plus, z_plus, z_minus)", "MARKER_CUSTOM= ( x_minus, x_plus)");
+  }
+  test.AddOption("CONV_NUM_METHOD_FLOW= JST");
+  test.AddOption("JST_SENSOR_COEFF= (0.5, 0.02)");
+  test.AddOption("LAX_SENSOR_COEFF= 0.15");
+  test.InitConfig();
+  test.InitGeometry();
+  REQUIRE(test.geometry->GetnDim() == nDim);
+
+  /*--- Only the fluxes are compared, the kernels do not update a system matrix when explicit. ---*/
+  test.config->SetKind_TimeIntScheme(EULER_EXPLICIT);
+
+  const su2double velocity[] = {0.5, 0.0, 0.0};
+  CEulerVariable nodes(1.0, velocity, 2.5, test.geometry->GetnPoint(), nDim, nDim+2, test.config.get());
+
+  SECTION("JST") {
+    checkAgainstProduction<nDim, CJSTScheme<CNoViscousFlux<nDim> > >(*test.config, *test.geometry, nodes);
+  }
+  SECTION("LAX") {
+    checkAgainstProduction<nDim, CLaxScheme<CNoViscousFlux<nDim> > >(*test.config, *test.geometry, nodes);
+  }
+  SECTION("JST_KE") {
+    checkAgainstProduction<nDim, CJSTkeScheme<CNoViscousFlux<nDim> > >(*test.config, *test.geometry, nodes);
+  }
+}
+
+}  // namespace
+
+TEST_CASE("Hand-differentiated centered fluxes vs production kernels", "[Numerics]") {
+  SECTION("2D") { checkSchemes<2>(); }
+  SECTION("3D") { checkSchemes<3>(); }
+}
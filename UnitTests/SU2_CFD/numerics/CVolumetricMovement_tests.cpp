@@ -0,0 +1,144 @@
+/*!
+ * \file CVolumetricMovement_tests.cpp
+ * \brief Unit tests for the assembly of the stiffness matrix of the linear elasticity mesh deformation.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cmath>
+#include <set>
+#include <vector>
+#include "../../UnitQuadTestCase.hpp"
+#include "../../../Common/include/grid_movement/CVolumetricMovement.hpp"
+
+namespace {
+
+/*--- Gives access to the assembled stiffness matrix. ---*/
+class CTestVolumetricMovement : public CVolumetricMovement {
+public:
+  using CVolumetricMovement::CVolumetricMovement;
+
+  void Assemble(CGeometry* geometry, CConfig* config) {
+    StiffMatrix.SetValZero();
+    SetFEAMethodContributions_Elem(geometry, config);
+  }
+
+  passivedouble Entry(unsigned long iPoint, unsigned long jPoint, unsigned short iVar, unsigned short jVar) const {
+    return SU2_TYPE::GetValue(StiffMatrix.GetBlock(iPoint, jPoint)[iVar*nVar + jVar]);
+  }
+};
+
+}  // namespace
+
+TEST_CASE("Stiffness matrix of the mesh deformation", "[Mesh deformation]") {
+  UnitQuadTestCase test;
+  /*--- The stiffness matrix is only allocated for volumetric movement, which is unsteady. ---*/
+  test.AddOption("TIME_DOMAIN= YES");
+  test.AddOption("TIME_MARCHING= DUAL_TIME_STEPPING-2ND_ORDER");
+  test.AddOption("TIME_STEP= 0.1");
+  test.AddOption("SURFACE_MOVEMENT= EXTERNAL");
+  test.AddOption("MARKER_MOVING= ( y_plus )");
+  test.AddOption("DEFORM_STIFFNESS_TYPE= INVERSE_VOLUME");
+  test.InitConfig();
+  test.InitGeometry();
+
+  auto* config = test.config.get();
+  auto* geometry = test.geometry.get();
+  const auto nDim = geometry->GetnDim();
+  const auto nPoint = geometry->GetnPoint();
+
+  /*--- Distort the interior points, so that the elements and their stiffness differ. ---*/
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    if (geometry->nodes->GetPhysicalBoundary(iPoint)) continue;
+    for (auto iDim = 0u; iDim < nDim; ++iDim) {
+      const su2double coord = geometry->nodes->GetCoord(iPoint, iDim);
+      geometry->nodes->SetCoord(iPoint, iDim, coord + 0.04 * std::sin(3.0 * iPoint + iDim));
+    }
+  }
+
+  /*--- Points coupled by the elements. ---*/
+  std::vector<std::set<unsigned long> > neighbors(nPoint);
+  for (auto iElem = 0ul; iElem < geometry->GetnElem(); ++iElem) {
+    const auto nNodes = geometry->elem[iElem]->GetnNodes();
+    for (auto iNode = 0u; iNode < nNodes; ++iNode)
+      for (auto jNode = 0u; jNode < nNodes; ++jNode)
+        neighbors[geometry->elem[iElem]->GetNode(iNode)].insert(geometry->elem[iElem]->GetNode(jNode));
+  }
+
+  cout.rdbuf(nullptr);
+  CTestVolumetricMovement movement(geometry, config);
+  movement.Assemble(geometry, config);
+  cout.rdbuf(test.orig_buf);
+
+  SECTION("Symmetric with a positive diagonal") {
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      for (auto iVar = 0u; iVar < nDim; ++iVar) CHECK(movement.Entry(iPoint, iPoint, iVar, iVar) > 0.0);
+
+      for (auto jPoint : neighbors[iPoint])
+        for (auto iVar = 0u; iVar < nDim; ++iVar)
+          for (auto jVar = 0u; jVar < nDim; ++jVar)
+            CHECK(movement.Entry(iPoint, jPoint, iVar, jVar) ==
+                  Approx(movement.Entry(jPoint, iPoint, jVar, iVar)).margin(1e-10));
+    }
+  }
+
+  SECTION("No forces for rigid body translations and rotations") {
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      const auto scale = movement.Entry(iPoint, iPoint, 0, 0);
+
+      for (auto iVar = 0u; iVar < nDim; ++iVar) {
+        passivedouble translation[3] = {0.0, 0.0, 0.0}, rotation = 0.0;
+
+        for (auto jPoint : neighbors[iPoint]) {
+          const auto x = SU2_TYPE::GetValue(geometry->nodes->GetCoord(jPoint, 0));
+          const auto y = SU2_TYPE::GetValue(geometry->nodes->GetCoord(jPoint, 1));
+
+          for (auto jVar = 0u; jVar < nDim; ++jVar) translation[jVar] += movement.Entry(iPoint, jPoint, iVar, jVar);
+
+          /*--- Rotation about z, u = (-y, x, 0). ---*/
+          rotation += -y * movement.Entry(iPoint, jPoint, iVar, 0) + x * movement.Entry(iPoint, jPoint, iVar, 1);
+        }
+        for (auto jVar = 0u; jVar < nDim; ++jVar) CHECK(translation[jVar] == Approx(0.0).margin(1e-9 * scale));
+        CHECK(rotation == Approx(0.0).margin(1e-9 * scale));
+      }
+    }
+  }
+
+  SECTION("The assembly can be repeated") {
+    std::vector<passivedouble> first;
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+      for (auto jPoint : neighbors[iPoint])
+        for (auto iVar = 0u; iVar < nDim; ++iVar)
+          for (auto jVar = 0u; jVar < nDim; ++jVar) first.push_back(movement.Entry(iPoint, jPoint, iVar, jVar));
+
+    cout.rdbuf(nullptr);
+    movement.Assemble(geometry, config);
+    cout.rdbuf(test.orig_buf);
+
+    size_t k = 0;
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+      for (auto jPoint : neighbors[iPoint])
+        for (auto iVar = 0u; iVar < nDim; ++iVar)
+          for (auto jVar = 0u; jVar < nDim; ++jVar) CHECK(movement.Entry(iPoint, jPoint, iVar, jVar) == first[k++]);
+  }
+}
@@ -0,0 +1,187 @@
+/*!
+ * \file surface_sorting.cpp
+ * \brief Unit tests for the reuse of the surface sorting between output writes.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include "../UnitQuadTestCase.hpp"
+#include "../../SU2_CFD/include/output/CFlowCompOutput.hpp"
+#include "../../SU2_CFD/include/output/filewriter/CSurfaceFVMDataSorter.hpp"
+
+namespace {
+
+/*--- Value of the test field, different at every point and every write. ---*/
+su2double TestValue(unsigned long globalIndex, int iWrite) { return std::sin(0.37 * globalIndex + iWrite) + iWrite; }
+
+/*!
+ * \brief Load the coordinates and the test field into the volume sorter and sort it, as Load_Data does.
+ */
+void LoadVolume(CGeometry* geometry, CFVMDataSorter& volume, int iWrite) {
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); ++iPoint) {
+    for (auto iDim = 0u; iDim < geometry->GetnDim(); ++iDim)
+      volume.SetUnsorted_Data(iPoint, iDim, geometry->nodes->GetCoord(iPoint, iDim));
+    volume.SetUnsorted_Data(iPoint, 3, TestValue(geometry->nodes->GetGlobalIndex(iPoint), iWrite));
+  }
+  volume.SortOutputData();
+}
+
+/*!
+ * \brief Check that a surface sorter that was used before holds the same points, values and
+ *        connectivity as a surface sorter that sorted for the first time.
+ */
+void CompareSorters(const CParallelDataSorter& used, const CParallelDataSorter& fresh, int iWrite) {
+  REQUIRE(used.GetnPoints() == fresh.GetnPoints());
+  CHECK(used.GetnPointsGlobal() == fresh.GetnPointsGlobal());
+  CHECK(used.GetnElem() == fresh.GetnElem());
+
+  for (auto iPoint = 0ul; iPoint < fresh.GetnPoints(); ++iPoint) {
+    CHECK(used.GetGlobalIndex(iPoint) == fresh.GetGlobalIndex(iPoint));
+    for (unsigned short iField = 0; iField < 4; ++iField)
+      CHECK(used.GetData(iField, iPoint) == fresh.GetData(iField, iPoint));
+    CHECK(fresh.GetData(3, iPoint) == Approx(SU2_TYPE::GetValue(TestValue(fresh.GetGlobalIndex(iPoint), iWrite))));
+  }
+
+  for (auto type : {LINE, TRIANGLE, QUADRILATERAL}) {
+    REQUIRE(used.GetnElem(type) == fresh.GetnElem(type));
+    for (auto iElem = 0ul; iElem < fresh.GetnElem(type); ++iElem)
+      for (auto iNode = 0u; iNode < nPointsOfElementType(type); ++iNode)
+        CHECK(used.GetElem_Connectivity(type, iElem, iNode) == fresh.GetElem_Connectivity(type, iElem, iNode));
+  }
+}
+
+}  // namespace
+
+TEST_CASE("Surface sorting reused between writes", "[Output]") {
+  UnitQuadTestCase test;
+  test.AddOption("MARKER_PLOTTING= (y_minus, y_plus, x_minus)");
+  test.InitConfig();
+  test.InitGeometry();
+
+  auto* config = test.config.get();
+  auto* geometry = test.geometry.get();
+
+  cout.rdbuf(nullptr);
+  CFVMDataSorter volume(config, geometry, {"x", "y", "z", "Value"});
+  CSurfaceFVMDataSorter surface(config, geometry, &volume);
+  cout.rdbuf(test.orig_buf);
+
+  /*--- First write, the sorting is cached. ---*/
+  LoadVolume(geometry, volume, 0);
+  surface.SortConnectivity(config, geometry, true);
+  surface.SortOutputData();
+
+  SECTION("Second write with changed values") {
+    LoadVolume(geometry, volume, 1);
+    surface.SortConnectivity(config, geometry, true);
+    surface.SortOutputData();
+
+    CSurfaceFVMDataSorter fresh(config, geometry, &volume);
+    fresh.SortConnectivity(config, geometry, true);
+    fresh.SortOutputData();
+    CompareSorters(surface, fresh, 1);
+  }
+
+  SECTION("Per marker write (multiblock) followed by a full surface write") {
+    LoadVolume(geometry, volume, 2);
+    const vector<string> marker = {"y_plus"};
+    surface.SortConnectivity(config, geometry, marker);
+    surface.SortOutputData();
+
+    CSurfaceFVMDataSorter freshMarker(config, geometry, &volume);
+    freshMarker.SortConnectivity(config, geometry, marker);
+    freshMarker.SortOutputData();
+    CompareSorters(surface, freshMarker, 2);
+
+    surface.SortConnectivity(config, geometry, true);
+    surface.SortOutputData();
+
+    CSurfaceFVMDataSorter fresh(config, geometry, &volume);
+    fresh.SortConnectivity(config, geometry, true);
+    fresh.SortOutputData();
+    CompareSorters(surface, fresh, 2);
+  }
+}
+
+TEST_CASE("Surface file after a box restricted volume file matches a fresh write", "[Output]") {
+  UnitQuadTestCase test;
+  test.AddOption("VOLUME_OUTPUT= SOLUTION");
+  test.AddOption("VOLUME_OUTPUT_BOX= (0.0, 0.5, 0.0, 0.5, 0.0, 0.5)");
+  test.AddOption("MARKER_PLOTTING= (y_minus, x_plus)");
+  test.InitConfig();
+  test.InitGeometry();
+  test.InitSolver();
+
+  auto* config = test.config.get();
+  auto* geometry = test.geometry.get();
+  auto* nodes = test.solver[FLOW_SOL]->GetNodes();
+
+  auto setSolution = [&](int iWrite) {
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint)
+      for (auto iVar = 0u; iVar < test.solver[FLOW_SOL]->GetnVar(); ++iVar)
+        nodes->SetSolution(iPoint, iVar, TestValue(geometry->nodes->GetGlobalIndex(iPoint) + iVar, iWrite));
+  };
+
+  auto readFile = [](const std::string& fileName) {
+    std::ifstream file(fileName, std::ios::binary);
+    REQUIRE(file.is_open());
+    return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  };
+
+  cout.rdbuf(nullptr);
+
+  /*--- Surface write, then new values, a box restricted volume write and a surface write. ---*/
+  setSolution(0);
+  CFlowCompOutput output(config, geometry->GetnDim());
+  output.PreprocessVolumeOutput(config);
+  output.PreprocessHistoryOutput(config, false);
+  output.Load_Data(geometry, config, test.solver);
+  output.WriteToFile(config, geometry, OUTPUT_TYPE::SURFACE_PARAVIEW_XML, "surface_sorting_test_used");
+
+  setSolution(1);
+  output.Load_Data(geometry, config, test.solver);
+  output.WriteToFile(config, geometry, OUTPUT_TYPE::PARAVIEW_XML, "surface_sorting_test_box");
+  output.WriteToFile(config, geometry, OUTPUT_TYPE::SURFACE_PARAVIEW_XML, "surface_sorting_test_used");
+
+  /*--- Reference, the surface of the same values written by a new output. ---*/
+  CFlowCompOutput freshOutput(config, geometry->GetnDim());
+  freshOutput.PreprocessVolumeOutput(config);
+  freshOutput.PreprocessHistoryOutput(config, false);
+  freshOutput.Load_Data(geometry, config, test.solver);
+  freshOutput.WriteToFile(config, geometry, OUTPUT_TYPE::SURFACE_PARAVIEW_XML, "surface_sorting_test_fresh");
+
+  cout.rdbuf(test.orig_buf);
+
+  const auto used = readFile("surface_sorting_test_used.vtu");
+  const auto fresh = readFile("surface_sorting_test_fresh.vtu");
+  CHECK(!fresh.empty());
+  CHECK(used == fresh);
+
+  std::remove("surface_sorting_test_used.vtu");
+  std::remove("surface_sorting_test_fresh.vtu");
+  std::remove("surface_sorting_test_box.vtu");
+}
@@ -0,0 +1,123 @@
+/*!
+ * \file task_list.cpp
+ * \brief Unit tests for the runner of the FEM-DG task list.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <atomic>
+#include <vector>
+#include "../../SU2_CFD/include/task_definition.hpp"
+
+namespace {
+
+/*!
+ * \brief Run a task list shaped like the one of the FEM-DG solver, with a communication that only
+ *        completes when waited for, and check that every item is processed once, after its dependencies.
+ */
+void RunTaskList(int nThreads) {
+  using Task = CTaskDefinition;
+
+  std::vector<CTaskDefinition> tasks;
+  tasks.emplace_back(Task::INITIATE_MPI_COMMUNICATION, 0);                     // 0
+  tasks.emplace_back(Task::ADER_PREDICTOR_STEP_INTERNAL_ELEMENTS, 0);          // 1
+  tasks.emplace_back(Task::COMPLETE_MPI_COMMUNICATION, 0, 0);                  // 2
+  tasks.emplace_back(Task::VOLUME_RESIDUAL, 0, 1);                             // 3
+  tasks.emplace_back(Task::SURFACE_RESIDUAL_HALO_ELEMENTS, 0, 2, 3);           // 4
+  tasks.emplace_back(Task::BOUNDARY_CONDITIONS_DEPEND_ON_OWNED, 0, 1);         // 5
+  tasks.emplace_back(Task::SUM_UP_RESIDUAL_CONTRIBUTIONS_OWNED_ELEMENTS, 0, 4, 5);  // 6
+  tasks.emplace_back(Task::MULTIPLY_INVERSE_MASS_MATRIX, 0, 6);                // 7
+
+  const std::vector<unsigned long> nItems = {1, 1000, 1, 333, 17, 1, 1, 64};
+
+  std::vector<std::vector<int> > hits(tasks.size());
+  for (size_t i = 0; i < tasks.size(); ++i) hits[i].assign(nItems[i], 0);
+
+  auto completed = [&](int i) {
+    for (auto h : hits[i]) if (h != 1) return false;
+    return true;
+  };
+
+  std::atomic<int> violations{0}, kernelCalls{0};
+  int commAttempts = 0;
+
+  CTaskListRunner runner(tasks, nThreads);
+
+  runner.Run([&](unsigned long i, bool wait) {
+    switch (tasks[i].task) {
+      case Task::INITIATE_MPI_COMMUNICATION:
+        hits[i][0] += 1;
+        runner.CompleteTask(i);
+        return true;
+
+      case Task::COMPLETE_MPI_COMMUNICATION:
+        /*--- Behaves like SU2_MPI::Testall, it only completes when waited for. ---*/
+        ++commAttempts;
+        if (!wait) return false;
+        hits[i][0] += 1;
+        runner.CompleteTask(i);
+        return true;
+
+      default:
+        runner.StartTask(i, nItems[i], [&, i](unsigned long beg, unsigned long end, int thread) {
+          ++kernelCalls;
+          if (thread < 0 || thread >= nThreads) ++violations;
+          for (int k = 0; k < tasks[i].nIndMustBeCompleted; ++k)
+            if (!completed(tasks[i].indMustBeCompleted[k])) ++violations;
+          for (auto item = beg; item < end; ++item) hits[i][item] += 1;
+        });
+        return true;
+    }
+  });
+
+  CHECK(violations.load() == 0);
+  for (size_t i = 0; i < tasks.size(); ++i) CHECK(completed(i));
+  CHECK(commAttempts >= 1);
+
+  /*--- With one thread each task is carried out inline, in a single call of its kernel. ---*/
+  if (nThreads == 1) CHECK(kernelCalls.load() == 6);
+  else CHECK(kernelCalls.load() >= 6);
+}
+
+}  // namespace
+
+TEST_CASE("FEM-DG task list runner", "[TaskList]") {
+  SECTION("One thread") { RunTaskList(1); }
+  SECTION("Several threads") { RunTaskList(4); }
+
+  SECTION("Run twice with the same runner") {
+    std::vector<CTaskDefinition> tasks(3, CTaskDefinition(CTaskDefinition::VOLUME_RESIDUAL, 0));
+    tasks[1] = CTaskDefinition(CTaskDefinition::VOLUME_RESIDUAL, 0, 0);
+    tasks[2] = CTaskDefinition(CTaskDefinition::VOLUME_RESIDUAL, 0, 1);
+
+    std::vector<int> order;
+    CTaskListRunner runner(tasks, 2);
+    auto carryOut = [&](unsigned long i, bool) {
+      runner.StartTask(i, 1, [&, i](unsigned long, unsigned long, int) { order.push_back(i); });
+      return true;
+    };
+    runner.Run(carryOut);
+    runner.Run(carryOut);
+    CHECK(order == std::vector<int>({0, 1, 2, 0, 1, 2}));
+  }
+}
@@ -0,0 +1,236 @@
+/*!
+ * \file volume_output_box.cpp
+ * \brief Unit tests for the output of a volume restricted to a box.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "catch.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include "../UnitQuadTestCase.hpp"
+#include "../../SU2_CFD/include/output/CFlowCompOutput.hpp"
+
+TEST_CASE("Surface output after a box restricted volume output", "[Output]") {
+  UnitQuadTestCase test;
+  test.AddOption("VOLUME_OUTPUT= COORDINATES");
+  test.AddOption("VOLUME_OUTPUT_BOX= (0.0, 0.5, 0.0, 0.5, 0.0, 0.5)");
+  test.AddOption("MARKER_PLOTTING= (y_minus)");
+  test.InitConfig();
+  test.InitGeometry();
+  test.InitSolver();
+
+  auto* config = test.config.get();
+  auto* geometry = test.geometry.get();
+
+  /*--- The data is sorted once and then written in several formats, as SU2_SOL does. ---*/
+  cout.rdbuf(nullptr);
+  CFlowCompOutput output(config, geometry->GetnDim());
+  output.PreprocessVolumeOutput(config);
+  output.PreprocessHistoryOutput(config, false);
+  output.Load_Data(geometry, config, test.solver);
+  output.WriteToFile(config, geometry, OUTPUT_TYPE::PARAVIEW_XML, "volume_output_box_test");
+  output.WriteToFile(config, geometry, OUTPUT_TYPE::SURFACE_CSV, "volume_output_box_test_surf");
+  cout.rdbuf(test.orig_buf);
+
+  /*--- The surface file must have all the points of the y_minus face (5 x 5) at their coordinates. ---*/
+  std::ifstream file("volume_output_box_test_surf.csv");
+  REQUIRE(file.is_open());
+
+  std::string line;
+  std::getline(file, line);
+
+  int nPoints = 0;
+  while (std::getline(file, line)) {
+    std::stringstream ss(line);
+    std::string id, x, y, z;
+    std::getline(ss, id, ',');
+    std::getline(ss, x, ',');
+    std::getline(ss, y, ',');
+    std::getline(ss, z, ',');
+
+    CHECK(std::stod(x) >= 0.0);
+    CHECK(std::stod(x) <= 1.0);
+    CHECK(std::stod(y) == Approx(0.0));
+    CHECK(std::stod(z) >= 0.0);
+    CHECK(std::stod(z) <= 1.0);
+    ++nPoints;
+  }
+  CHECK(nPoints == 25);
+
+  file.close();
+  std::remove("volume_output_box_test.vtu");
+  std::remove("volume_output_box_test_surf.csv");
+}
+
+TEST_CASE("Points, connectivity and cells of a box restricted volume file", "[Output]") {
+  UnitQuadTestCase test;
+  test.AddOption("VOLUME_OUTPUT= COORDINATES");
+  test.AddOption("VOLUME_OUTPUT_BOX= (0.0, 0.5, 0.0, 0.5, 0.0, 0.5)");
+  test.InitConfig();
+  test.InitGeometry();
+  test.InitSolver();
+
+  auto* config = test.config.get();
+  auto* geometry = test.geometry.get();
+
+  cout.rdbuf(nullptr);
+  CFlowCompOutput output(config, geometry->GetnDim());
+  output.PreprocessVolumeOutput(config);
+  output.PreprocessHistoryOutput(config, false);
+  output.Load_Data(geometry, config, test.solver);
+  output.WriteToFile(config, geometry, OUTPUT_TYPE::TECPLOT_ASCII, "volume_output_box_test");
+  cout.rdbuf(test.orig_buf);
+
+  std::ifstream file("volume_output_box_test.dat");
+  REQUIRE(file.is_open());
+
+  std::string line;
+  std::getline(file, line);
+  std::getline(file, line);
+  std::getline(file, line);
+
+  /*--- The 5 x 5 x 5 box has a spacing of 0.25, 3 x 3 x 3 points and 2 x 2 x 2 cells are inside the
+   *    restriction, the cells that cross its faces are dropped. ---*/
+  const auto nodesPos = line.find("NODES=");
+  const auto elemsPos = line.find("ELEMENTS=");
+  REQUIRE(nodesPos != std::string::npos);
+  REQUIRE(elemsPos != std::string::npos);
+  const auto nPoints = std::stoul(line.substr(nodesPos + 6));
+  const auto nElems = std::stoul(line.substr(elemsPos + 9));
+  CHECK(nPoints == 27);
+  CHECK(nElems == 8);
+
+  std::vector<std::array<double, 3> > coords(nPoints);
+  for (auto& coord : coords) {
+    std::getline(file, line);
+    std::stringstream ss(line);
+    ss >> coord[0] >> coord[1] >> coord[2];
+    for (auto x : coord) {
+      CHECK(x >= -1e-12);
+      CHECK(x <= 0.5 + 1e-12);
+    }
+  }
+
+  /*--- The connectivity must refer to the renumbered points, every cell being one of the hexahedra
+   *    of the box, and every point must belong to a cell. ---*/
+  std::vector<int> used(nPoints, 0);
+  for (auto iElem = 0ul; iElem < nElems; ++iElem) {
+    std::getline(file, line);
+    std::stringstream ss(line);
+    std::array<double, 3> lo = {1e9, 1e9, 1e9}, hi = {-1e9, -1e9, -1e9};
+    for (int iNode = 0; iNode < 8; ++iNode) {
+      unsigned long id = 0;
+      ss >> id;
+      REQUIRE(id >= 1);
+      REQUIRE(id <= nPoints);
+      used[id-1] = 1;
+      for (int iDim = 0; iDim < 3; ++iDim) {
+        lo[iDim] = std::min(lo[iDim], coords[id-1][iDim]);
+        hi[iDim] = std::max(hi[iDim], coords[id-1][iDim]);
+      }
+    }
+    for (int iDim = 0; iDim < 3; ++iDim) CHECK(hi[iDim] - lo[iDim] == Approx(0.25));
+  }
+  for (auto u : used) CHECK(u == 1);
+
+  file.close();
+  std::remove("volume_output_box_test.dat");
+}
+
+TEST_CASE("Time averages of the volume output start at VOLUME_AVERAGE_START_ITER", "[Output]") {
+  UnitQuadTestCase test;
+  /*--- The manufactured solution of the test case is steady. ---*/
+  const std::string verification = "KIND_VERIFICATION_SOLUTION=MMS_NS_UNIT_QUAD";
+  test.config_options.replace(test.config_options.find(verification), verification.size(),
+                              "KIND_VERIFICATION_SOLUTION= NO_VERIFICATION_SOLUTION");
+  test.AddOption("TIME_DOMAIN= YES");
+  test.AddOption("TIME_MARCHING= DUAL_TIME_STEPPING-2ND_ORDER");
+  test.AddOption("TIME_STEP= 0.1");
+  test.AddOption("TIME_ITER= 10");
+  test.AddOption("VOLUME_OUTPUT= TIME_AVERAGE");
+  test.AddOption("VOLUME_AVERAGE_START_ITER= 3");
+  test.InitConfig();
+  test.InitGeometry();
+  test.InitSolver();
+
+  auto* config = test.config.get();
+  auto* geometry = test.geometry.get();
+  auto* nodes = test.solver[FLOW_SOL]->GetNodes();
+
+  cout.rdbuf(nullptr);
+  CFlowCompOutput output(config, geometry->GetnDim());
+  output.PreprocessVolumeOutput(config);
+  output.PreprocessHistoryOutput(config, false);
+  cout.rdbuf(test.orig_buf);
+
+  /*--- The mean density of a point in the volume file. ---*/
+  auto meanDensity = [&]() {
+    cout.rdbuf(nullptr);
+    output.WriteToFile(config, geometry, OUTPUT_TYPE::CSV, "volume_average_test");
+    cout.rdbuf(test.orig_buf);
+
+    std::ifstream file("volume_average_test.csv");
+    REQUIRE(file.is_open());
+    std::string header, row, entry;
+    std::getline(file, header);
+    std::getline(file, row);
+
+    std::stringstream headerStream(header), rowStream(row);
+    double value = 0.0;
+    bool found = false;
+    while (std::getline(headerStream, entry, ',')) {
+      std::string valueStr;
+      std::getline(rowStream, valueStr, ',');
+      if (entry.find("\"MeanDensity\"") != std::string::npos) {
+        value = std::stod(valueStr);
+        found = true;
+      }
+    }
+    REQUIRE(found);
+    std::remove("volume_average_test.csv");
+    return value;
+  };
+
+  /*--- The instantaneous density is 1 + TimeIter, the average starts with the value of iteration 3. ---*/
+  double sum = 0.0;
+  for (unsigned long TimeIter = 0; TimeIter < 7; ++TimeIter) {
+    const double density = 1.0 + TimeIter;
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint) nodes->SetSolution(iPoint, 0, density);
+
+    cout.rdbuf(nullptr);
+    output.SetHistory_Output(geometry, test.solver, config, TimeIter, 0, 0);
+    output.Load_Data(geometry, config, test.solver);
+    cout.rdbuf(test.orig_buf);
+
+    if (TimeIter < 3) {
+      CHECK(meanDensity() == Approx(density));
+    } else {
+      sum += density;
+      CHECK(meanDensity() == Approx(sum / (TimeIter - 2)));
+    }
+  }
+}
@@ -0,0 +1,232 @@
+/*!
+ * \file vtu_compression.cpp
+ * \brief Unit tests for the compressed and quantized Paraview XML output.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include "../UnitQuadTestCase.hpp"
+#include "../../SU2_CFD/include/output/CFlowCompOutput.hpp"
+
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+
+namespace {
+
+/*!
+ * \brief Write the solution of a 16 x 16 x 32 box (8192 points, i.e. one full block for each scalar
+ *        Float32 array) with varying values, to a Paraview XML file.
+ */
+void WriteVolume(const std::string& options, const std::string& fileName) {
+  UnitQuadTestCase test;
+  const std::string defaultSize = "MESH_BOX_SIZE=5,5,5";
+  test.config_options.replace(test.config_options.find(defaultSize), defaultSize.size(), "MESH_BOX_SIZE=16,16,32");
+  test.AddOption("VOLUME_OUTPUT= SOLUTION");
+  test.AddOption(options);
+  test.InitConfig();
+  test.InitGeometry();
+  test.InitSolver();
+
+  auto* config = test.config.get();
+  auto* geometry = test.geometry.get();
+  auto* nodes = test.solver[FLOW_SOL]->GetNodes();
+
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint) {
+    const auto* coord = geometry->nodes->GetCoord(iPoint);
+    for (auto iVar = 0u; iVar < test.solver[FLOW_SOL]->GetnVar(); ++iVar) {
+      nodes->SetSolution(iPoint, iVar, (1.0 + iVar) * (1.0 + coord[0]) + std::sin(7.1 * coord[1] + coord[2]));
+    }
+  }
+
+  cout.rdbuf(nullptr);
+  CFlowCompOutput output(config, geometry->GetnDim());
+  output.PreprocessVolumeOutput(config);
+  output.PreprocessHistoryOutput(config, false);
+  output.Load_Data(geometry, config, test.solver);
+  output.WriteToFile(config, geometry, OUTPUT_TYPE::PARAVIEW_XML, fileName);
+  cout.rdbuf(test.orig_buf);
+}
+
+/*!
+ * \brief The raw bytes of the arrays of a file, by name, "" being the coordinates.
+ */
+std::map<std::string, std::string> ReadArrays(const std::string& fileName) {
+  std::ifstream file(fileName, std::ios::binary);
+  REQUIRE(file.is_open());
+  const std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+  const std::string appendedTag = "<AppendedData encoding=\"raw\">\n_";
+  const auto appendedStart = content.find(appendedTag);
+  REQUIRE(appendedStart != std::string::npos);
+  const auto dataStart = appendedStart + appendedTag.size();
+  const auto dataEnd = content.rfind("</AppendedData>");
+
+  /*--- Name and offset of each array, the arrays are consecutive. ---*/
+  std::vector<std::pair<std::string, size_t> > arrays;
+  size_t pos = 0;
+  while ((pos = content.find("<DataArray", pos)) < appendedStart) {
+    const auto nameStart = content.find("Name=\"", pos) + 6;
+    const auto offsetStart = content.find("offset=\"", pos) + 8;
+    arrays.emplace_back(content.substr(nameStart, content.find('"', nameStart) - nameStart),
+                        std::stoul(content.substr(offsetStart, content.find('"', offsetStart) - offsetStart)));
+    ++pos;
+  }
+
+  std::map<std::string, std::string> result;
+  for (size_t i = 0; i < arrays.size(); ++i) {
+    const auto begin = dataStart + arrays[i].second;
+    const auto end = (i+1 < arrays.size())? dataStart + arrays[i+1].second : dataEnd;
+    result[arrays[i].first] = content.substr(begin, end - begin);
+  }
+  return result;
+}
+
+/*!
+ * \brief Check the header of an array written uncompressed and return the data.
+ */
+std::string ReadRawArray(const std::string& array) {
+  uint64_t size;
+  REQUIRE(array.size() >= sizeof(uint64_t));
+  memcpy(&size, array.data(), sizeof(uint64_t));
+  REQUIRE(array.size() == sizeof(uint64_t) + size);
+  return array.substr(sizeof(uint64_t));
+}
+
+/*!
+ * \brief Check the header of a compressed array against the uncompressed size and decompress the blocks.
+ */
+std::string ReadCompressedArray(const std::string& array, uint64_t uncompressedSize) {
+  const uint64_t blockSize = 32768;
+  std::vector<uint64_t> header(3);
+  REQUIRE(array.size() >= 3*sizeof(uint64_t));
+  memcpy(header.data(), array.data(), 3*sizeof(uint64_t));
+
+  const auto nBlocks = header[0];
+  CHECK(nBlocks == (uncompressedSize + blockSize - 1) / blockSize);
+  CHECK(header[1] == blockSize);
+  CHECK(header[2] == uncompressedSize % blockSize);
+
+  header.resize(3 + nBlocks);
+  REQUIRE(array.size() >= header.size()*sizeof(uint64_t));
+  memcpy(header.data() + 3, array.data() + 3*sizeof(uint64_t), nBlocks*sizeof(uint64_t));
+
+  /*--- The compressed sizes must add up to the data that follows the header. ---*/
+  uint64_t compressedSize = 0;
+  for (auto iBlock = 0ul; iBlock < nBlocks; ++iBlock) compressedSize += header[3+iBlock];
+  REQUIRE(array.size() == header.size()*sizeof(uint64_t) + compressedSize);
+
+  std::string data;
+  auto pos = header.size()*sizeof(uint64_t);
+  for (auto iBlock = 0ul; iBlock < nBlocks; ++iBlock) {
+    const bool last = (iBlock == nBlocks-1) && (header[2] != 0);
+    uLongf len = last? header[2] : blockSize;
+    std::vector<Bytef> block(len);
+    const auto ierr = uncompress(block.data(), &len, reinterpret_cast<const Bytef*>(array.data() + pos), header[3+iBlock]);
+    REQUIRE(ierr == Z_OK);
+    CHECK(len == (last? header[2] : blockSize));
+    data.append(reinterpret_cast<const char*>(block.data()), len);
+    pos += header[3+iBlock];
+  }
+  return data;
+}
+
+}  // namespace
+
+TEST_CASE("Compressed and quantized Paraview XML output", "[Output]") {
+
+  WriteVolume("OUTPUT_COMPRESSION= NONE", "vtu_compression_raw");
+  const auto raw = ReadArrays("vtu_compression_raw.vtu");
+  REQUIRE(raw.count("Density") == 1);
+  REQUIRE(raw.count("Momentum") == 1);
+
+  SECTION("The zlib blocks round trip to the uncompressed arrays") {
+    WriteVolume("OUTPUT_COMPRESSION= ZLIB", "vtu_compression_zlib");
+    const auto zlib = ReadArrays("vtu_compression_zlib.vtu");
+    REQUIRE(zlib.size() == raw.size());
+
+    for (const auto& array : raw) {
+      const auto data = ReadRawArray(array.second);
+      REQUIRE(zlib.count(array.first) == 1);
+      CHECK(ReadCompressedArray(zlib.at(array.first), data.size()) == data);
+    }
+
+    /*--- A scalar field is exactly one full block, the connectivity ends with a partial block. ---*/
+    uint64_t header[3];
+    memcpy(header, zlib.at("Density").data(), sizeof(header));
+    CHECK(header[0] == 1);
+    CHECK(header[2] == 0);
+    memcpy(header, zlib.at("connectivity").data(), sizeof(header));
+    CHECK(header[0] > 1);
+    CHECK(header[2] != 0);
+
+    std::remove("vtu_compression_zlib.vtu");
+  }
+
+  SECTION("Quantization error bounds") {
+    const unsigned short bits = 10;
+    WriteVolume("OUTPUT_COMPRESSION= ZLIB\nOUTPUT_QUANTIZED_FIELDS= (Density, Momentum)\n"
+                "OUTPUT_QUANTIZATION_BITS= " + std::to_string(bits), "vtu_compression_quant");
+    const auto quant = ReadArrays("vtu_compression_quant.vtu");
+
+    for (const auto& array : raw) {
+      const auto data = ReadRawArray(array.second);
+      const auto quantData = ReadCompressedArray(quant.at(array.first), data.size());
+      REQUIRE(quantData.size() == data.size());
+
+      if (array.first != "Density" && array.first != "Momentum") {
+        CHECK(quantData == data);
+        continue;
+      }
+
+      /*--- Rounding to the nearest value with "bits" mantissa bits, the discarded bits are zero. ---*/
+      const auto n = data.size() / sizeof(float);
+      std::vector<float> values(n), quantValues(n);
+      memcpy(values.data(), data.data(), data.size());
+      memcpy(quantValues.data(), quantData.data(), quantData.size());
+
+      const uint32_t discarded = (uint32_t(1) << (23 - bits)) - 1;
+      int nChanged = 0;
+      for (auto i = 0ul; i < n; ++i) {
+        uint32_t quantBits;
+        memcpy(&quantBits, &quantValues[i], sizeof(float));
+        CHECK((quantBits & discarded) == 0);
+        CHECK(std::abs(double(quantValues[i]) - double(values[i])) <= std::ldexp(std::abs(double(values[i])), -(bits+1)));
+        nChanged += (quantValues[i] != values[i]);
+      }
+      CHECK(nChanged > 0);
+    }
+
+    std::remove("vtu_compression_quant.vtu");
+  }
+
+  std::remove("vtu_compression_raw.vtu");
+}
+
+#endif
@@ -0,0 +1,200 @@
+/*!
+ * \file CBenchmarkCase.cpp
+ * \brief Set up of the problem on which the micro-benchmarks run.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CBenchmarkCase.hpp"
+
+#include <fstream>
+#include <sstream>
+
+#include "../Common/include/geometry/CPhysicalGeometry.hpp"
+#include "../SU2_CFD/include/solvers/CSolverFactory.hpp"
+
+std::string CBenchmarkCase::ConfigOptions(const BenchmarkOptions& options, SCHEME scheme) {
+  std::ostringstream opts;
+
+  opts << "SOLVER= EULER\n"
+          "MATH_PROBLEM= DIRECT\n"
+          "MACH_NUMBER= 0.8\n"
+          "AOA= 1.25\n"
+          "FREESTREAM_PRESSURE= 101325.0\n"
+          "FREESTREAM_TEMPERATURE= 288.15\n"
+          "NUM_METHOD_GRAD= GREEN_GAUSS\n"
+          "MUSCL_FLOW= YES\n"
+          "SLOPE_LIMITER_FLOW= VENKATAKRISHNAN\n"
+          "TIME_DISCRE_FLOW= EULER_IMPLICIT\n"
+          "CFL_NUMBER= 10.0\n"
+          "LINEAR_SOLVER= FGMRES\n"
+          "LINEAR_SOLVER_PREC= ILU\n"
+          "LINEAR_SOLVER_ERROR= 1E-30\n";
+  opts << "LINEAR_SOLVER_ITER= " << options.linearIterations << "\n";
+  opts << "CONV_NUM_METHOD_FLOW= " << (scheme == SCHEME::ROE ? "ROE" : "JST") << "\n";
+
+  /*--- Every boundary is a far-field. ---*/
+  std::vector<std::string> markers;
+
+  if (options.mesh == "BOX" || options.mesh == "RECTANGLE") {
+    const bool box = (options.mesh == "BOX");
+    if (options.size.size() != (box ? 3u : 2u)) {
+      SU2_MPI::Error(options.mesh + " meshes require " + (box ? "3" : "2") + " sizes.", CURRENT_FUNCTION);
+    }
+    opts << "MESH_FORMAT= " << options.mesh << "\n";
+    opts << "MESH_BOX_SIZE= " << options.size[0] << ", " << options.size[1] << ", "
+         << (box ? options.size[2] : 2) << "\n";
+    opts << "MESH_BOX_LENGTH= 1.0, 1.0, 1.0\n"
+            "MESH_BOX_OFFSET= 0.0, 0.0, 0.0\n";
+    markers = {"x_minus", "x_plus", "y_minus", "y_plus"};
+    if (box) {
+      markers.push_back("z_minus");
+      markers.push_back("z_plus");
+    }
+  } else {
+    std::ifstream meshFile(options.mesh);
+    if (!meshFile.is_open()) {
+      SU2_MPI::Error("Could not open the mesh file " + options.mesh, CURRENT_FUNCTION);
+    }
+    std::string line;
+    while (getline(meshFile, line)) {
+      const auto pos = line.find("MARKER_TAG=");
+      if (pos == std::string::npos) continue;
+      std::istringstream tag(line.substr(pos + 11));
+      std::string name;
+      tag >> name;
+      markers.push_back(name);
+    }
+    opts << "MESH_FORMAT= SU2\n";
+    opts << "MESH_FILENAME= " << options.mesh << "\n";
+  }
+
+  if (!markers.empty()) {
+    opts << "MARKER_FAR= (";
+    for (size_t i = 0; i < markers.size(); ++i) opts << (i ? ", " : "") << markers[i];
+    opts << ")\n";
+  }
+  return opts.str();
+}
+
+CBenchmarkCase::CBenchmarkCase(const BenchmarkOptions& options, SCHEME scheme_) : scheme(scheme_) {
+  /*--- The set up is verbose, only the benchmark results are of interest. ---*/
+  auto origBuf = cout.rdbuf();
+  cout.rdbuf(nullptr);
+
+  std::stringstream ss(ConfigOptions(options, scheme));
+  config = std::unique_ptr<CConfig>(new CConfig(ss, SU2_COMPONENT::SU2_CFD, false));
+
+  InitGeometry();
+  InitSolvers();
+
+  cout.rdbuf(origBuf);
+
+  meshName = options.mesh;
+  if (options.mesh == "BOX" || options.mesh == "RECTANGLE") {
+    for (size_t i = 0; i < options.size.size(); ++i) meshName += (i ? "x" : "_") + std::to_string(options.size[i]);
+  }
+}
+
+CBenchmarkCase::~CBenchmarkCase() {
+  if (solvers) {
+    for (unsigned int iSol = 0; iSol < MAX_SOLS; iSol++) delete solvers[iSol];
+    delete[] solvers;
+    CSolverFactory::ClearSolverMeta();
+  }
+}
+
+void CBenchmarkCase::InitGeometry() {
+  /*--- Same sequence as CDriver::Geometrical_Preprocessing_FVM without multigrid. ---*/
+  {
+    auto aux = std::unique_ptr<CGeometry>(new CPhysicalGeometry(config.get(), ZONE_0, 1));
+    aux->SetColorGrid_Parallel(config.get());
+    geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(aux.get(), config.get()));
+  }
+  geometry->SetSendReceive(config.get());
+  geometry->SetBoundaries(config.get());
+  geometry->SetPoint_Connectivity();
+  geometry->SetRCM_Ordering(config.get());
+  geometry->SetPoint_Connectivity();
+  geometry->SetElement_Connectivity();
+  geometry->SetBoundVolume();
+  geometry->Check_IntElem_Orientation(config.get());
+  geometry->Check_BoundElem_Orientation(config.get());
+  geometry->SetEdges();
+  geometry->SetVertex(config.get());
+  SU2_OMP_PARALLEL {
+    geometry->SetControlVolume(config.get(), ALLOCATE);
+    geometry->SetBoundControlVolume(config.get(), ALLOCATE);
+  }
+  END_SU2_OMP_PARALLEL
+  geometry->FindNormal_Neighbor(config.get());
+  geometry->SetGlobal_to_Local_Point();
+  geometry->Check_Periodicity(config.get());
+  geometry->SetMGLevel(MESH_0);
+  geometry->PreprocessP2PComms(geometry.get(), config.get());
+  geometry->SetMaxLength(config.get());
+  geometry->InitiateComms(geometry.get(), config.get(), NEIGHBORS);
+  geometry->CompleteComms(geometry.get(), config.get(), NEIGHBORS);
+
+  unsigned long localEdges = geometry->GetnEdge();
+  SU2_MPI::Allreduce(&localEdges, &globalEdges, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+}
+
+void CBenchmarkCase::InitSolvers() {
+  solvers = CSolverFactory::CreateSolverContainer(config->GetKind_Solver(), config.get(), geometry.get(), MESH_0);
+  config->SetGlobalParam(config->GetKind_Solver(), RUNTIME_FLOW_SYS);
+
+  /*--- Perturb the density and energy of the free-stream with a smooth function of the coordinates,
+   *    the halos get the same values as their owners so no communication is needed. ---*/
+  const auto nDim = geometry->GetnDim();
+  auto* nodes = GetFlowSolver()->GetNodes();
+  const auto iEnergy = GetFlowSolver()->GetnVar() - 1;
+
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint) {
+    const auto* coord = geometry->nodes->GetCoord(iPoint);
+    su2double factor = 1.0;
+    for (auto iDim = 0u; iDim < nDim; ++iDim) factor *= sin(2 * PI_NUMBER * coord[iDim] + iDim);
+    factor = 1.0 + 0.05 * factor;
+    nodes->SetSolution(iPoint, 0, factor * nodes->GetSolution(iPoint, 0));
+    nodes->SetSolution(iPoint, iEnergy, factor * nodes->GetSolution(iPoint, iEnergy));
+  }
+  nodes->Set_OldSolution();
+
+  SU2_OMP_PARALLEL {
+    AssembleLinearSystem();
+  }
+  END_SU2_OMP_PARALLEL
+}
+
+void CBenchmarkCase::AssembleLinearSystem() {
+  auto* solver = GetFlowSolver();
+
+  solver->Preprocessing(geometry.get(), solvers, config.get(), MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS, false);
+  solver->SetTime_Step(geometry.get(), solvers, config.get(), MESH_0, 0);
+
+  if (scheme == SCHEME::ROE) {
+    solver->Upwind_Residual(geometry.get(), solvers, nullptr, config.get(), MESH_0);
+  } else {
+    solver->Centered_Residual(geometry.get(), solvers, nullptr, config.get(), MESH_0, NO_RK_ITER);
+  }
+  solver->PrepareImplicitIteration(geometry.get(), solvers, config.get());
+}
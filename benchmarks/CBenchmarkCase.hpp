@@ -0,0 +1,120 @@
+/*!
+ * \file CBenchmarkCase.hpp
+ * \brief Problem (config, geometry, and flow solver) on which the micro-benchmarks run.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../Common/include/CConfig.hpp"
+#include "../Common/include/geometry/CGeometry.hpp"
+#include "../SU2_CFD/include/solvers/CSolver.hpp"
+
+/*!
+ * \brief Settings of a benchmark run.
+ */
+struct BenchmarkOptions {
+  std::string mesh = "BOX";                   /*!< \brief BOX, RECTANGLE, or the name of a SU2 mesh file. */
+  std::vector<unsigned short> size = {33, 33, 33}; /*!< \brief Number of nodes per direction of BOX and RECTANGLE. */
+  unsigned long repetitions = 10;             /*!< \brief Number of timed calls of each kernel. */
+  unsigned long warmup = 2;                   /*!< \brief Number of calls before timing starts. */
+  unsigned long linearIterations = 20;        /*!< \brief Fixed number of iterations of the linear solver. */
+  std::string filter;                         /*!< \brief Run only the benchmarks whose name contains this. */
+};
+
+/*!
+ * \class CBenchmarkCase
+ * \brief Inviscid flow problem set up like the driver does it (partitioning, renumbering, solver allocation),
+ *        with a smooth non-uniform flow field so that reconstruction and limiters do representative work.
+ * \note All far-field boundaries, the boundary conditions are not part of any benchmark.
+ */
+class CBenchmarkCase {
+ public:
+  enum class SCHEME { ROE, JST }; /*!< \brief Convective scheme of the case. */
+
+ private:
+  std::unique_ptr<CConfig> config;
+  std::unique_ptr<CGeometry> geometry;
+  CSolver** solvers = nullptr;
+  const SCHEME scheme;
+  std::string meshName;
+  unsigned long globalEdges = 0;
+
+  /*!
+   * \brief Config file contents for the options and scheme.
+   */
+  static std::string ConfigOptions(const BenchmarkOptions& options, SCHEME scheme);
+
+  /*!
+   * \brief Partition the mesh and compute the dual grid.
+   */
+  void InitGeometry();
+
+  /*!
+   * \brief Allocate the solvers and set the initial flow field.
+   */
+  void InitSolvers();
+
+ public:
+  /*!
+   * \brief Set up the problem (collective).
+   */
+  CBenchmarkCase(const BenchmarkOptions& options, SCHEME scheme);
+
+  ~CBenchmarkCase();
+
+  CBenchmarkCase(const CBenchmarkCase&) = delete;
+  CBenchmarkCase& operator=(const CBenchmarkCase&) = delete;
+
+  inline SCHEME GetScheme() const { return scheme; }
+  inline CConfig* GetConfig() { return config.get(); }
+  inline CGeometry* GetGeometry() { return geometry.get(); }
+  inline CSolver** GetSolvers() { return solvers; }
+  inline CSolver* GetFlowSolver() { return solvers[FLOW_SOL]; }
+
+  /*!
+   * \brief Description of the mesh, e.g. "BOX_33x33x33".
+   */
+  inline const std::string& GetMeshName() const { return meshName; }
+
+  /*!
+   * \brief Number of points of the mesh (excluding halos).
+   */
+  inline unsigned long GetGlobalPoints() const { return geometry->GetGlobal_nPointDomain(); }
+
+  /*!
+   * \brief Number of edges of all partitions (edges between partitions are counted twice).
+   */
+  inline unsigned long GetGlobalEdges() const { return globalEdges; }
+
+  /*!
+   * \brief Recompute primitives, gradients, limiters, residual and Jacobian (with the pseudo time term)
+   *        as at the start of an implicit iteration.
+   * \note Must be called by all threads of a parallel region.
+   */
+  void AssembleLinearSystem();
+};
@@ -0,0 +1,167 @@
+/*!
+ * \file CBenchmarkSuite.cpp
+ * \brief Timing and reporting of the micro-benchmarks.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CBenchmarkSuite.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <numeric>
+
+#include "../Common/include/parallelization/vectorization.hpp"
+
+void CBenchmarkSuite::Add(std::string name, CBenchmarkCase::SCHEME scheme, SetupFunction setup) {
+  for (const auto& bench : benchmarks) {
+    if (bench.name == name) SU2_MPI::Error("Duplicate benchmark " + name, CURRENT_FUNCTION);
+  }
+  benchmarks.push_back({std::move(name), scheme, std::move(setup)});
+}
+
+std::vector<std::string> CBenchmarkSuite::GetNames() const {
+  std::vector<std::string> names;
+  for (const auto& bench : benchmarks) names.push_back(bench.name);
+  return names;
+}
+
+BenchmarkResult CBenchmarkSuite::Measure(const BenchmarkKernel& kernel) const {
+  std::vector<double> times;
+
+  for (auto iRep = 0ul; iRep < options.warmup + options.repetitions; ++iRep) {
+    SU2_MPI::Barrier(SU2_MPI::GetComm());
+    const auto start = std::chrono::steady_clock::now();
+
+    SU2_OMP_PARALLEL {
+      kernel.run();
+    }
+    END_SU2_OMP_PARALLEL
+
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    passivedouble localTime = elapsed.count(), time = 0.0;
+    SelectMPIWrapper<passivedouble>::W::Allreduce(&localTime, &time, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+
+    if (iRep >= options.warmup) times.push_back(time);
+  }
+
+  BenchmarkResult result;
+  result.repetitions = times.size();
+  result.work = kernel.work;
+  result.unit = kernel.unit;
+  if (times.empty()) return result;
+
+  std::sort(times.begin(), times.end());
+  const auto n = times.size();
+  result.minTime = times.front();
+  result.maxTime = times.back();
+  result.medianTime = (n % 2) ? times[n / 2] : 0.5 * (times[n / 2 - 1] + times[n / 2]);
+  result.meanTime = std::accumulate(times.begin(), times.end(), 0.0) / n;
+  return result;
+}
+
+void CBenchmarkSuite::Run() {
+  const int rank = SU2_MPI::GetRank();
+  std::unique_ptr<CBenchmarkCase> bcase;
+
+  if (rank == MASTER_NODE) {
+    cout << left << setw(36) << "Benchmark" << right << setw(14) << "Median [s]" << setw(14) << "Min [s]"
+         << setw(14) << "Max [s]" << setw(16) << "Items/s" << "  Items" << endl;
+  }
+
+  /*--- Group by scheme to build each case at most once, one case at a time to limit the memory. ---*/
+  auto selected = benchmarks;
+  selected.erase(std::remove_if(selected.begin(), selected.end(),
+                                [&](const Benchmark& b) { return b.name.find(options.filter) == std::string::npos; }),
+                 selected.end());
+  std::stable_sort(selected.begin(), selected.end(),
+                   [](const Benchmark& a, const Benchmark& b) { return a.scheme < b.scheme; });
+
+  for (const auto& bench : selected) {
+    if (!bcase || bcase->GetScheme() != bench.scheme) {
+      bcase.reset();
+      bcase = std::unique_ptr<CBenchmarkCase>(new CBenchmarkCase(options, bench.scheme));
+    }
+
+    auto result = Measure(bench.setup(*bcase));
+    result.name = bench.name;
+    result.mesh = bcase->GetMeshName();
+    result.points = bcase->GetGlobalPoints();
+    result.edges = bcase->GetGlobalEdges();
+    result.ranks = SU2_MPI::GetSize();
+    result.threads = omp_get_max_threads();
+    results.push_back(result);
+
+    if (rank == MASTER_NODE) {
+      cout << left << setw(36) << result.name << right << scientific << setprecision(4) << setw(14)
+           << result.medianTime << setw(14) << result.minTime << setw(14) << result.maxTime << setw(16)
+           << result.Throughput() << "  " << result.unit << defaultfloat << endl;
+    }
+  }
+}
+
+void CBenchmarkSuite::WriteCSV(std::ostream& out) const {
+  out << "name,mesh,points,edges,ranks,threads,repetitions,work,unit,"
+         "min_time,median_time,mean_time,max_time,throughput\n";
+  out << std::setprecision(9);
+  for (const auto& r : results) {
+    out << r.name << ',' << r.mesh << ',' << r.points << ',' << r.edges << ',' << r.ranks << ','
+        << r.threads << ',' << r.repetitions << ',' << r.work << ',' << r.unit << ',' << r.minTime << ','
+        << r.medianTime << ',' << r.meanTime << ',' << r.maxTime << ',' << r.Throughput() << '\n';
+  }
+}
+
+void CBenchmarkSuite::WriteJSON(std::ostream& out) const {
+  auto boolean = [](bool b) { return b ? "true" : "false"; };
+#ifdef HAVE_MPI
+  const bool mpi = true;
+#else
+  const bool mpi = false;
+#endif
+#ifdef HAVE_OMP
+  const bool omp = true;
+#else
+  const bool omp = false;
+#endif
+
+  out << std::setprecision(9);
+  out << "{\n"
+      << "  \"version\": \"7.5.1\",\n"
+      << "  \"build\": {\"mpi\": " << boolean(mpi) << ", \"openmp\": " << boolean(omp)
+      << ", \"mixed_precision\": " << boolean(sizeof(su2mixedfloat) < sizeof(passivedouble))
+      << ", \"simd_bytes\": " << simd::PREFERRED_SIZE << "},\n"
+      << "  \"warmup\": " << options.warmup << ",\n"
+      << "  \"linear_iterations\": " << options.linearIterations << ",\n"
+      << "  \"benchmarks\": [";
+
+  for (size_t i = 0; i < results.size(); ++i) {
+    const auto& r = results[i];
+    out << (i ? "," : "") << "\n    {\"name\": \"" << r.name << "\", \"mesh\": \"" << r.mesh
+        << "\", \"points\": " << r.points << ", \"edges\": " << r.edges << ", \"ranks\": " << r.ranks
+        << ", \"threads\": " << r.threads << ", \"repetitions\": " << r.repetitions << ", \"work\": " << r.work
+        << ", \"unit\": \"" << r.unit << "\", \"min_time\": " << r.minTime << ", \"median_time\": "
+        << r.medianTime << ", \"mean_time\": " << r.meanTime << ", \"max_time\": " << r.maxTime
+        << ", \"throughput\": " << r.Throughput() << "}";
+  }
+  out << "\n  ]\n}\n";
+}
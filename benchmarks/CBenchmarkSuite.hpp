@@ -0,0 +1,143 @@
+/*!
+ * \file CBenchmarkSuite.hpp
+ * \brief Registry, timing, and reporting of the micro-benchmarks.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "CBenchmarkCase.hpp"
+
+/*!
+ * \brief What a benchmark times.
+ */
+struct BenchmarkKernel {
+  std::function<void()> run; /*!< \brief The timed work, called by all threads of a parallel region. */
+  unsigned long work = 0;    /*!< \brief Number of items processed per call (all ranks), for the throughput. */
+  std::string unit;          /*!< \brief What the items are, e.g. "edges". */
+};
+
+/*!
+ * \brief Timings of a benchmark, the time of a call is the maximum over the ranks.
+ */
+struct BenchmarkResult {
+  std::string name;
+  std::string mesh;
+  unsigned long points = 0;
+  unsigned long edges = 0;
+  int ranks = 1;
+  int threads = 1;
+  unsigned long repetitions = 0;
+  unsigned long work = 0;
+  std::string unit;
+  double minTime = 0.0;
+  double medianTime = 0.0;
+  double meanTime = 0.0;
+  double maxTime = 0.0;
+
+  /*!
+   * \brief Items processed per second, based on the median time.
+   */
+  inline double Throughput() const { return medianTime > 0.0 ? work / medianTime : 0.0; }
+};
+
+/*!
+ * \class CBenchmarkSuite
+ * \brief Runs the registered benchmarks and writes the results as CSV or JSON.
+ * \note Benchmarks are run grouped by the scheme of their case, otherwise in order of registration.
+ *       Each call is timed separately, including the start of the parallel region, after a barrier.
+ */
+class CBenchmarkSuite {
+ public:
+  using SetupFunction = std::function<BenchmarkKernel(CBenchmarkCase&)>;
+
+ private:
+  struct Benchmark {
+    std::string name;
+    CBenchmarkCase::SCHEME scheme;
+    SetupFunction setup; /*!< \brief Untimed preparation, returns the kernel. */
+  };
+
+  const BenchmarkOptions options;
+  std::vector<Benchmark> benchmarks;
+  std::vector<BenchmarkResult> results;
+
+  /*!
+   * \brief Time one kernel (collective).
+   */
+  BenchmarkResult Measure(const BenchmarkKernel& kernel) const;
+
+ public:
+  explicit CBenchmarkSuite(const BenchmarkOptions& opts) : options(opts) {}
+
+  /*!
+   * \brief Register a benchmark.
+   * \param[in] name - Unique name, reported in the results.
+   * \param[in] scheme - Convective scheme of the case the benchmark needs.
+   * \param[in] setup - Prepares the data, returns the kernel.
+   */
+  void Add(std::string name, CBenchmarkCase::SCHEME scheme, SetupFunction setup);
+
+  /*!
+   * \brief Names of the registered benchmarks.
+   */
+  std::vector<std::string> GetNames() const;
+
+  /*!
+   * \brief Run the benchmarks selected by the filter and print their results (collective).
+   */
+  void Run();
+
+  inline const std::vector<BenchmarkResult>& GetResults() const { return results; }
+
+  /*!
+   * \brief Write the results as CSV, one line per benchmark.
+   */
+  void WriteCSV(std::ostream& out) const;
+
+  /*!
+   * \brief Write the results and the build information as JSON.
+   */
+  void WriteJSON(std::ostream& out) const;
+};
+
+/*!
+ * \brief Residuals of the vectorized convective schemes and halo exchanges.
+ */
+void AddNumericsBenchmarks(CBenchmarkSuite& suite);
+
+/*!
+ * \brief Gradients and limiters.
+ */
+void AddGradientBenchmarks(CBenchmarkSuite& suite);
+
+/*!
+ * \brief Sparse matrix operations, preconditioners, and linear solver.
+ */
+void AddLinearAlgebraBenchmarks(CBenchmarkSuite& suite);
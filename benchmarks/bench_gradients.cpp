@@ -0,0 +1,102 @@
+/*!
+ * \file bench_gradients.cpp
+ * \brief Micro-benchmarks of the gradient and limiter computations.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CBenchmarkSuite.hpp"
+#include "../SU2_CFD/include/gradients/computeGradientsGreenGauss.hpp"
+#include "../SU2_CFD/include/gradients/computeGradientsLeastSquares.hpp"
+#include "../SU2_CFD/include/limiters/computeLimiters.hpp"
+
+void AddGradientBenchmarks(CBenchmarkSuite& suite) {
+  using SCHEME = CBenchmarkCase::SCHEME;
+
+  /*--- The kernels operate on the primitive variables of the flow solver, without a solver
+   *    object there are no halo exchanges (those are timed separately). ---*/
+
+  suite.Add("gradient_green_gauss", SCHEME::ROE, [](CBenchmarkCase& bcase) {
+    auto* geometry = bcase.GetGeometry();
+    auto* config = bcase.GetConfig();
+    auto* solver = bcase.GetFlowSolver();
+    const auto nVar = solver->GetnPrimVarGrad();
+    auto gradient = std::make_shared<C3DDoubleMatrix>(geometry->GetnPoint(), nVar, geometry->GetnDim());
+
+    BenchmarkKernel kernel;
+    kernel.run = [=]() {
+      computeGradientsGreenGauss(nullptr, SOLUTION, PERIODIC_NONE, *geometry, *config,
+                                 solver->GetNodes()->GetPrimitive(), 0, nVar, *gradient);
+    };
+    kernel.work = bcase.GetGlobalPoints();
+    kernel.unit = "points";
+    return kernel;
+  });
+
+  auto leastSquares = [](bool weighted) {
+    return [weighted](CBenchmarkCase& bcase) {
+      auto* geometry = bcase.GetGeometry();
+      auto* config = bcase.GetConfig();
+      auto* solver = bcase.GetFlowSolver();
+      const auto nVar = solver->GetnPrimVarGrad();
+      const auto nDim = geometry->GetnDim();
+      auto gradient = std::make_shared<C3DDoubleMatrix>(geometry->GetnPoint(), nVar, nDim);
+      auto rmatrix = std::make_shared<C3DDoubleMatrix>(geometry->GetnPoint(), nDim, nDim);
+
+      BenchmarkKernel kernel;
+      kernel.run = [=]() {
+        computeGradientsLeastSquares(nullptr, SOLUTION, PERIODIC_NONE, *geometry, *config, weighted,
+                                     solver->GetNodes()->GetPrimitive(), 0, nVar, *gradient, *rmatrix);
+      };
+      kernel.work = bcase.GetGlobalPoints();
+      kernel.unit = "points";
+      return kernel;
+    };
+  };
+
+  suite.Add("gradient_least_squares", SCHEME::ROE, leastSquares(false));
+  suite.Add("gradient_weighted_least_squares", SCHEME::ROE, leastSquares(true));
+
+  /*--- Limiters of the reconstruction gradients computed by the case set up. ---*/
+
+  auto limiter = [](LIMITER kind) {
+    return [kind](CBenchmarkCase& bcase) {
+      auto* geometry = bcase.GetGeometry();
+      auto* config = bcase.GetConfig();
+      auto* nodes = bcase.GetFlowSolver()->GetNodes();
+      const auto nVar = bcase.GetFlowSolver()->GetnPrimVarGrad();
+
+      BenchmarkKernel kernel;
+      kernel.run = [=]() {
+        computeLimiters(kind, nullptr, SOLUTION_LIMITER, PERIODIC_NONE, PERIODIC_NONE, *geometry, *config, 0, nVar,
+                        nodes->GetPrimitive(), nodes->GetGradient_Reconstruction(), nodes->GetSolution_Min(),
+                        nodes->GetSolution_Max(), nodes->GetLimiter_Primitive());
+      };
+      kernel.work = bcase.GetGlobalPoints();
+      kernel.unit = "points";
+      return kernel;
+    };
+  };
+
+  suite.Add("limiter_venkatakrishnan", SCHEME::ROE, limiter(LIMITER::VENKATAKRISHNAN));
+  suite.Add("limiter_barth_jespersen", SCHEME::ROE, limiter(LIMITER::BARTH_JESPERSEN));
+}
@@ -0,0 +1,127 @@
+/*!
+ * \file bench_linear_algebra.cpp
+ * \brief Micro-benchmarks of the sparse matrix operations, preconditioners, and linear solver.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CBenchmarkSuite.hpp"
+#include "../Common/include/linear_algebra/CPreconditioner.hpp"
+
+namespace {
+
+using VectorType = CSysVector<su2mixedfloat>;
+
+/*!
+ * \brief Assemble a fresh flow Jacobian (earlier benchmarks may have accumulated into it).
+ */
+void Assemble(CBenchmarkCase& bcase) {
+  SU2_OMP_PARALLEL {
+    bcase.AssembleLinearSystem();
+  }
+  END_SU2_OMP_PARALLEL
+}
+
+/*!
+ * \brief Input and output vectors of the size of the flow Jacobian.
+ */
+struct VectorPair {
+  VectorType u, v;
+  explicit VectorPair(const CSolver* solver)
+    : u(solver->LinSysRes.GetNBlk(), solver->LinSysRes.GetNBlkDomain(), solver->GetnVar(), 1.0),
+      v(solver->LinSysRes.GetNBlk(), solver->LinSysRes.GetNBlkDomain(), solver->GetnVar(), 0.0) {
+    for (auto i = 0ul; i < u.GetLocSize(); ++i) u[i] = 1.0 + 0.5 * sin(0.1 * i);
+  }
+};
+
+/*!
+ * \brief Time the build or the application of a preconditioner of the flow Jacobian.
+ */
+CBenchmarkSuite::SetupFunction Preconditioner(ENUM_LINEAR_SOLVER_PREC kind, bool build) {
+  return [kind, build](CBenchmarkCase& bcase) {
+    Assemble(bcase);
+    auto* geometry = bcase.GetGeometry();
+    auto* solver = bcase.GetFlowSolver();
+
+    std::shared_ptr<CPreconditioner<su2mixedfloat>> precond(
+        CPreconditioner<su2mixedfloat>::Create(kind, solver->Jacobian, geometry, bcase.GetConfig()));
+    auto vectors = std::make_shared<VectorPair>(solver);
+
+    BenchmarkKernel kernel;
+    if (build) {
+      kernel.run = [=]() { precond->Build(); };
+    } else {
+      SU2_OMP_PARALLEL {
+        precond->Build();
+      }
+      END_SU2_OMP_PARALLEL
+      kernel.run = [=]() { (*precond)(vectors->u, vectors->v); };
+    }
+    kernel.work = geometry->GetGlobal_nPointDomain();
+    kernel.unit = "points";
+    return kernel;
+  };
+}
+
+}  // namespace
+
+void AddLinearAlgebraBenchmarks(CBenchmarkSuite& suite) {
+  using SCHEME = CBenchmarkCase::SCHEME;
+
+  suite.Add("matrix_vector_product", SCHEME::ROE, [](CBenchmarkCase& bcase) {
+    Assemble(bcase);
+    auto* geometry = bcase.GetGeometry();
+    auto* config = bcase.GetConfig();
+    auto* solver = bcase.GetFlowSolver();
+    auto vectors = std::make_shared<VectorPair>(solver);
+
+    BenchmarkKernel kernel;
+    kernel.run = [=]() { solver->Jacobian.MatrixVectorProduct(vectors->u, vectors->v, geometry, config); };
+    kernel.work = bcase.GetGlobalPoints();
+    kernel.unit = "points";
+    return kernel;
+  });
+
+  suite.Add("ilu_build", SCHEME::ROE, Preconditioner(ILU, true));
+  suite.Add("ilu_apply", SCHEME::ROE, Preconditioner(ILU, false));
+  suite.Add("lu_sgs_apply", SCHEME::ROE, Preconditioner(LU_SGS, false));
+
+  /*--- Complete linear solve as in an implicit iteration, FGMRES with a fixed number of iterations
+   *    (the tolerance is not reachable) including the build of the ILU preconditioner. ---*/
+
+  suite.Add("fgmres_ilu_solve", SCHEME::ROE, [](CBenchmarkCase& bcase) {
+    Assemble(bcase);
+    auto* geometry = bcase.GetGeometry();
+    auto* config = bcase.GetConfig();
+    auto* solver = bcase.GetFlowSolver();
+
+    BenchmarkKernel kernel;
+    kernel.run = [=]() {
+      solver->LinSysSol.SetValZero();
+      SU2_OMP_BARRIER
+      solver->System.Solve(solver->Jacobian, solver->LinSysRes, solver->LinSysSol, geometry, config);
+    };
+    kernel.work = bcase.GetGlobalPoints();
+    kernel.unit = "points";
+    return kernel;
+  });
+}
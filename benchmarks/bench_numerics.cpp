@@ -0,0 +1,80 @@
+/*!
+ * \file bench_numerics.cpp
+ * \brief Micro-benchmarks of the convective residuals and of the halo exchanges.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CBenchmarkSuite.hpp"
+
+void AddNumericsBenchmarks(CBenchmarkSuite& suite) {
+  using SCHEME = CBenchmarkCase::SCHEME;
+
+  /*--- Vectorized (CNumericsSIMD) edge loops, residual and Jacobian. The residual accumulates over
+   *    the calls, which does not change the work done. Roe includes the MUSCL reconstruction. ---*/
+
+  suite.Add("residual_roe", SCHEME::ROE, [](CBenchmarkCase& bcase) {
+    auto* geometry = bcase.GetGeometry();
+    auto* config = bcase.GetConfig();
+    auto** solvers = bcase.GetSolvers();
+    BenchmarkKernel kernel;
+    kernel.run = [=]() { solvers[FLOW_SOL]->Upwind_Residual(geometry, solvers, nullptr, config, MESH_0); };
+    kernel.work = bcase.GetGlobalEdges();
+    kernel.unit = "edges";
+    return kernel;
+  });
+
+  suite.Add("residual_jst", SCHEME::JST, [](CBenchmarkCase& bcase) {
+    auto* geometry = bcase.GetGeometry();
+    auto* config = bcase.GetConfig();
+    auto** solvers = bcase.GetSolvers();
+    BenchmarkKernel kernel;
+    kernel.run = [=]() {
+      solvers[FLOW_SOL]->Centered_Residual(geometry, solvers, nullptr, config, MESH_0, NO_RK_ITER);
+    };
+    kernel.work = bcase.GetGlobalEdges();
+    kernel.unit = "edges";
+    return kernel;
+  });
+
+  /*--- Point-to-point halo exchanges of the conservative variables and of the primitive gradients,
+   *    these only communicate when running with more than one rank. ---*/
+
+  auto haloExchange = [](MPI_QUANTITIES quantity) {
+    return [quantity](CBenchmarkCase& bcase) {
+      auto* geometry = bcase.GetGeometry();
+      auto* config = bcase.GetConfig();
+      auto* solver = bcase.GetFlowSolver();
+      BenchmarkKernel kernel;
+      kernel.run = [=]() {
+        solver->InitiateComms(geometry, config, quantity);
+        solver->CompleteComms(geometry, config, quantity);
+      };
+      kernel.work = bcase.GetGlobalPoints();
+      kernel.unit = "points";
+      return kernel;
+    };
+  };
+
+  suite.Add("halo_exchange_solution", SCHEME::ROE, haloExchange(SOLUTION));
+  suite.Add("halo_exchange_gradient", SCHEME::ROE, haloExchange(PRIMITIVE_GRAD_REC));
+}
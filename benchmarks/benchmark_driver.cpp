@@ -0,0 +1,96 @@
+/*!
+ * \file benchmark_driver.cpp
+ * \brief Entry point of the micro-benchmarks of the numerics, gradients, and linear algebra.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <fstream>
+
+#include "CLI11.hpp"
+#include "CBenchmarkSuite.hpp"
+
+int main(int argc, char* argv[]) {
+  BenchmarkOptions options;
+  int num_threads = omp_get_max_threads();
+  std::string output = "benchmarks.csv";
+  bool list = false;
+
+  /*--- Command line parsing ---*/
+
+  CLI::App app{"SU2 v7.5.1 \"Blackbird\", micro-benchmarks of the numerics, gradients, and linear algebra"};
+  app.add_option("-m,--mesh", options.mesh, "BOX, RECTANGLE, or a SU2 mesh file.");
+  app.add_option("-s,--size", options.size, "Nodes per direction of BOX (3 values) or RECTANGLE (2 values).");
+  app.add_option("-r,--repetitions", options.repetitions, "Number of timed calls of each kernel.");
+  app.add_option("-w,--warmup", options.warmup, "Number of untimed calls before the timed ones.");
+  app.add_option("--linear_iterations", options.linearIterations, "Iterations of the linear solver.");
+  app.add_option("-f,--filter", options.filter, "Only run the benchmarks whose name contains this.");
+  app.add_option("-t,--threads", num_threads, "Number of OpenMP threads per MPI rank.");
+  app.add_option("-o,--output", output, "Results file, JSON if the extension is .json, CSV otherwise.");
+  app.add_flag("-l,--list", list, "List the benchmarks and exit.");
+
+  CLI11_PARSE(app, argc, argv)
+
+  /*--- OpenMP and MPI initialization ---*/
+
+  omp_initialize();
+
+  omp_set_num_threads(num_threads);
+
+#if defined(HAVE_OMP) && defined(HAVE_MPI)
+  int provided;
+  SU2_MPI::Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &provided);
+#else
+  SU2_MPI::Init(&argc, &argv);
+#endif
+  const int rank = SU2_MPI::GetRank();
+
+  CBenchmarkSuite suite(options);
+  AddNumericsBenchmarks(suite);
+  AddGradientBenchmarks(suite);
+  AddLinearAlgebraBenchmarks(suite);
+
+  if (list) {
+    if (rank == MASTER_NODE) {
+      for (const auto& name : suite.GetNames()) cout << name << "\n";
+    }
+  } else {
+    suite.Run();
+
+    if (rank == MASTER_NODE) {
+      std::ofstream file(output);
+      if (!file.is_open()) SU2_MPI::Error("Could not open " + output, CURRENT_FUNCTION);
+
+      const auto ext = output.rfind(".json");
+      if (ext != std::string::npos && ext + 5 == output.size()) {
+        suite.WriteJSON(file);
+      } else {
+        suite.WriteCSV(file);
+      }
+      cout << "Results written to " << output << "." << endl;
+    }
+  }
+
+  SU2_MPI::Finalize();
+
+  return EXIT_SUCCESS;
+}
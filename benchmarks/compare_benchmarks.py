@@ -0,0 +1,74 @@
+#!/usr/bin/env python
+
+## \file compare_benchmarks.py
+#  \brief Compare two result files of su2_benchmarks and flag the slower kernels.
+#  \version 7.5.1 "Blackbird"
+#
+# SU2 Project Website: https://su2code.github.io
+#
+# The SU2 Project is maintained by the SU2 Foundation
+# (http://su2foundation.org)
+#
+# Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+
+import csv
+import json
+import sys
+from optparse import OptionParser
+
+def read_results(filename):
+  """Median time of each (benchmark, mesh, ranks, threads) of a CSV or JSON file."""
+  if filename.endswith('.json'):
+    with open(filename) as f:
+      rows = json.load(f)['benchmarks']
+  else:
+    with open(filename) as f:
+      rows = list(csv.DictReader(f))
+
+  return {(r['name'], r['mesh'], int(r['ranks']), int(r['threads'])): float(r['median_time']) for r in rows}
+
+def main():
+  parser = OptionParser(usage = "%prog [options] reference_file new_file")
+  parser.add_option("-t", "--tolerance", dest="tolerance", default="0.1",
+                    help="relative increase of the median time considered a regression", metavar="TOL")
+  (options, args) = parser.parse_args()
+
+  if len(args) != 2:
+    parser.error("A reference and a new result file are required.")
+
+  reference = read_results(args[0])
+  new = read_results(args[1])
+  tolerance = float(options.tolerance)
+
+  regressions = 0
+  print("%-36s %-16s %12s %12s %9s" % ("Benchmark", "Mesh", "Ref. [s]", "New [s]", "Change"))
+  for key in sorted(set(reference) & set(new)):
+    change = new[key] / reference[key] - 1 if reference[key] > 0 else 0.0
+    flag = ""
+    if change > tolerance:
+      flag = "  <-- slower"
+      regressions += 1
+    print("%-36s %-16s %12.4e %12.4e %+8.1f%%%s" % (key[0], key[1], reference[key], new[key], 100 * change, flag))
+
+  for key in sorted(set(reference) ^ set(new)):
+    print("%-36s %-16s only in %s" % (key[0], key[1], args[0] if key in reference else args[1]))
+
+  if regressions:
+    print("%d benchmark(s) slower by more than %.0f%%." % (regressions, 100 * tolerance))
+    sys.exit(1)
+
+if __name__ == '__main__':
+  main()